@@ -0,0 +1,146 @@
+#include "bench.h"
+
+#include <map>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include <tinystl/algorithm/numeric.h>
+#include <tinystl/container/segmented_vector.h>
+#include <tinystl/container/vector.h>
+
+namespace {
+
+// The single-thread cases take the element count, to show the kernels both
+// in cache and streaming from memory. The scaling cases take the worker
+// count; pools are kept across runs so thread start-up is not measured.
+constexpr std::size_t elements = 1 << 22;
+
+tinystl::thread_pool &pool_with(std::size_t threads) {
+  static std::map<std::size_t, std::unique_ptr<tinystl::thread_pool>> pools;
+  auto &pool = pools[threads];
+  if (!pool) {
+    pool = std::make_unique<tinystl::thread_pool>(threads);
+  }
+  return *pool;
+}
+
+// The left-to-right fold the SIMD sum replaces.
+void accumulate_double(tinystl::bench::state &st) {
+  tinystl::vector<double> v(st.arg(), 1.5);
+  while (st.keep_running()) {
+    tinystl::bench::do_not_optimize(std::accumulate(v.begin(), v.end(), 0.0));
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+void reduce_double(tinystl::bench::state &st) {
+  tinystl::vector<double> v(st.arg(), 1.5);
+  while (st.keep_running()) {
+    tinystl::bench::do_not_optimize(tinystl::reduce(v.begin(), v.end()));
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+void reduce_float(tinystl::bench::state &st) {
+  tinystl::vector<float> v(st.arg(), 1.5f);
+  while (st.keep_running()) {
+    tinystl::bench::do_not_optimize(tinystl::reduce(v.begin(), v.end()));
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+void inner_product_double(tinystl::bench::state &st) {
+  tinystl::vector<double> a(st.arg(), 1.5);
+  tinystl::vector<double> b(st.arg(), 0.5);
+  while (st.keep_running()) {
+    tinystl::bench::do_not_optimize(std::inner_product(a.begin(), a.end(), b.begin(), 0.0));
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+void dot_double(tinystl::bench::state &st) {
+  tinystl::vector<double> a(st.arg(), 1.5);
+  tinystl::vector<double> b(st.arg(), 0.5);
+  while (st.keep_running()) {
+    tinystl::bench::do_not_optimize(tinystl::transform_reduce(a.begin(), a.end(), b.begin(), 0.0));
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+// Segment by segment against iterating the segmented range element-wise.
+void segmented_accumulate(tinystl::bench::state &st) {
+  tinystl::segmented_vector<double> v;
+  for (std::size_t i = 0; i < st.arg(); ++i) {
+    v.push_back(1.5);
+  }
+  while (st.keep_running()) {
+    tinystl::bench::do_not_optimize(std::accumulate(v.begin(), v.end(), 0.0));
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+void segmented_reduce(tinystl::bench::state &st) {
+  tinystl::segmented_vector<double> v;
+  for (std::size_t i = 0; i < st.arg(); ++i) {
+    v.push_back(1.5);
+  }
+  while (st.keep_running()) {
+    tinystl::bench::do_not_optimize(tinystl::reduce(v.begin(), v.end()));
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+void reduce_double_scaling(tinystl::bench::state &st) {
+  auto policy = tinystl::execution::par.on(pool_with(st.arg()));
+  tinystl::vector<double> v(elements, 1.5);
+  while (st.keep_running()) {
+    tinystl::bench::do_not_optimize(tinystl::reduce(policy, v.begin(), v.end()));
+  }
+  st.set_items_processed(st.iterations() * elements);
+}
+
+// Fixed pieces cost little next to the pool-sized ones.
+void deterministic_reduce_scaling(tinystl::bench::state &st) {
+  auto policy = tinystl::execution::par.on(pool_with(st.arg())).deterministic();
+  tinystl::vector<double> v(elements, 1.5);
+  while (st.keep_running()) {
+    tinystl::bench::do_not_optimize(tinystl::reduce(policy, v.begin(), v.end()));
+  }
+  st.set_items_processed(st.iterations() * elements);
+}
+
+void inclusive_scan_sequential(tinystl::bench::state &st) {
+  tinystl::vector<double> v(elements, 1.5);
+  tinystl::vector<double> out(elements);
+  while (st.keep_running()) {
+    tinystl::inclusive_scan(v.begin(), v.end(), out.begin());
+    tinystl::bench::do_not_optimize(out.data());
+  }
+  st.set_items_processed(st.iterations() * elements);
+}
+
+void inclusive_scan_scaling(tinystl::bench::state &st) {
+  auto policy = tinystl::execution::par.on(pool_with(st.arg()));
+  tinystl::vector<double> v(elements, 1.5);
+  tinystl::vector<double> out(elements);
+  while (st.keep_running()) {
+    tinystl::inclusive_scan(policy, v.begin(), v.end(), out.begin());
+    tinystl::bench::do_not_optimize(out.data());
+  }
+  st.set_items_processed(st.iterations() * elements);
+}
+
+} // namespace
+
+TINYSTL_BENCH(accumulate_double, 1 << 12, 1 << 22);
+TINYSTL_BENCH(reduce_double, 1 << 12, 1 << 22);
+TINYSTL_BENCH(reduce_float, 1 << 12, 1 << 22);
+TINYSTL_BENCH(inner_product_double, 1 << 12, 1 << 22);
+TINYSTL_BENCH(dot_double, 1 << 12, 1 << 22);
+TINYSTL_BENCH(segmented_accumulate, 1 << 20);
+TINYSTL_BENCH(segmented_reduce, 1 << 20);
+TINYSTL_BENCH(reduce_double_scaling, 1, 2, 4, 8, 16);
+TINYSTL_BENCH(deterministic_reduce_scaling, 1, 2, 4, 8, 16);
+TINYSTL_BENCH(inclusive_scan_sequential, 1);
+TINYSTL_BENCH(inclusive_scan_scaling, 1, 2, 4, 8, 16);
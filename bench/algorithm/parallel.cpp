@@ -0,0 +1,97 @@
+#include "bench.h"
+
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include <tinystl/algorithm/algorithm.h>
+#include <tinystl/container/vector.h>
+
+namespace {
+
+// The argument is the worker count, so each benchmark reads as a scaling
+// curve from one core up. Pools are kept across runs so thread start-up is
+// not measured.
+constexpr std::size_t elements = 1 << 22;
+
+tinystl::thread_pool &pool_with(std::size_t threads) {
+  static std::map<std::size_t, std::unique_ptr<tinystl::thread_pool>> pools;
+  auto &pool = pools[threads];
+  if (!pool) {
+    pool = std::make_unique<tinystl::thread_pool>(threads);
+  }
+  return *pool;
+}
+
+void for_each_scaling(tinystl::bench::state &st) {
+  auto policy = tinystl::execution::par.on(pool_with(st.arg()));
+  std::vector<double> v(elements, 1.0);
+  while (st.keep_running()) {
+    tinystl::for_each(policy, v.begin(), v.end(), [](double &x) { x = std::sqrt(x + 1.0); });
+  }
+  tinystl::bench::do_not_optimize(v.front());
+  st.set_items_processed(st.iterations() * elements);
+}
+
+void transform_scaling(tinystl::bench::state &st) {
+  auto policy = tinystl::execution::par_unseq.on(pool_with(st.arg()));
+  std::vector<float> in(elements, 2.0f);
+  std::vector<float> out(elements);
+  while (st.keep_running()) {
+    tinystl::transform(policy, in.begin(), in.end(), out.begin(), [](float x) { return x * x + 1.0f; });
+  }
+  tinystl::bench::do_not_optimize(out.back());
+  st.set_items_processed(st.iterations() * elements);
+}
+
+void reduce_scaling(tinystl::bench::state &st) {
+  auto policy = tinystl::execution::par.on(pool_with(st.arg()));
+  std::vector<std::int64_t> v(elements);
+  std::iota(v.begin(), v.end(), 0);
+  while (st.keep_running()) {
+    tinystl::bench::do_not_optimize(tinystl::reduce(policy, v.begin(), v.end()));
+  }
+  st.set_items_processed(st.iterations() * elements);
+}
+
+void fill_scaling(tinystl::bench::state &st) {
+  auto policy = tinystl::execution::par.on(pool_with(st.arg()));
+  std::vector<std::uint32_t> v(elements);
+  while (st.keep_running()) {
+    tinystl::fill(policy, v.begin(), v.end(), 7u);
+    tinystl::bench::clobber_memory();
+  }
+  st.set_items_processed(st.iterations() * elements);
+}
+
+void copy_scaling(tinystl::bench::state &st) {
+  auto policy = tinystl::execution::par.on(pool_with(st.arg()));
+  std::vector<std::uint32_t> in(elements, 3u);
+  std::vector<std::uint32_t> out(elements);
+  while (st.keep_running()) {
+    tinystl::copy(policy, in.begin(), in.end(), out.begin());
+    tinystl::bench::clobber_memory();
+  }
+  st.set_items_processed(st.iterations() * elements);
+}
+
+void vector_construct_scaling(tinystl::bench::state &st) {
+  auto policy = tinystl::execution::par.on(pool_with(st.arg()));
+  while (st.keep_running()) {
+    tinystl::vector<double> v(policy, elements, 1.5);
+    tinystl::bench::do_not_optimize(v.data());
+  }
+  st.set_items_processed(st.iterations() * elements);
+}
+
+} // namespace
+
+TINYSTL_BENCH(for_each_scaling, 1, 2, 4, 8, 16);
+TINYSTL_BENCH(transform_scaling, 1, 2, 4, 8, 16);
+TINYSTL_BENCH(reduce_scaling, 1, 2, 4, 8, 16);
+TINYSTL_BENCH(fill_scaling, 1, 2, 4, 8, 16);
+TINYSTL_BENCH(copy_scaling, 1, 2, 4, 8, 16);
+TINYSTL_BENCH(vector_construct_scaling, 1, 2, 4, 8, 16);
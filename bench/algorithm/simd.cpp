@@ -0,0 +1,163 @@
+#include "bench.h"
+
+#include <algorithm>
+#include <compare>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <tinystl/algorithm/algorithm.h>
+
+namespace {
+
+// Each kernel runs against the standard algorithm it replaces, which is the
+// scalar path the containers used before. The needle sits at the end so
+// find and mismatch scan the whole range.
+
+template <class T>
+std::vector<T> make_input(std::size_t n) {
+  std::vector<T> values(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    values[i] = static_cast<T>(i % 97);
+  }
+  return values;
+}
+
+template <class T, bool Simd>
+void find(tinystl::bench::state &st) {
+  auto values = make_input<T>(st.arg());
+  values.back() = T(100);
+  while (st.keep_running()) {
+    auto it = Simd ? tinystl::find(values.begin(), values.end(), T(100))
+                   : std::find(values.begin(), values.end(), T(100));
+    tinystl::bench::do_not_optimize(it);
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+template <class T, bool Simd>
+void count(tinystl::bench::state &st) {
+  auto values = make_input<T>(st.arg());
+  while (st.keep_running()) {
+    auto c = Simd ? tinystl::count(values.begin(), values.end(), T(42))
+                  : std::count(values.begin(), values.end(), T(42));
+    tinystl::bench::do_not_optimize(c);
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+template <class T, bool Simd>
+void mismatch(tinystl::bench::state &st) {
+  auto a = make_input<T>(st.arg());
+  auto b = a;
+  b.back() = T(100);
+  while (st.keep_running()) {
+    auto it = Simd ? tinystl::mismatch(a.begin(), a.end(), b.begin(), b.end())
+                   : std::mismatch(a.begin(), a.end(), b.begin(), b.end());
+    tinystl::bench::do_not_optimize(it);
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+template <class T, bool Simd>
+void equal(tinystl::bench::state &st) {
+  auto a = make_input<T>(st.arg());
+  auto b = a;
+  while (st.keep_running()) {
+    bool eq = Simd ? tinystl::equal(a.begin(), a.end(), b.begin(), b.end())
+                   : std::equal(a.begin(), a.end(), b.begin(), b.end(), [](T x, T y) { return x == y; });
+    tinystl::bench::do_not_optimize(eq);
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+template <class T, bool Simd>
+void lexicographical_compare_three_way(tinystl::bench::state &st) {
+  auto a = make_input<T>(st.arg());
+  auto b = a;
+  b.back() = T(100);
+  while (st.keep_running()) {
+    auto order = Simd ? tinystl::lexicographical_compare_three_way(a.begin(), a.end(), b.begin(), b.end())
+                      : std::lexicographical_compare_three_way(a.begin(), a.end(), b.begin(), b.end());
+    tinystl::bench::do_not_optimize(order);
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+// Removes one value in 97 from a fresh copy each iteration.
+template <class T, bool Simd>
+void remove(tinystl::bench::state &st) {
+  const auto input = make_input<T>(st.arg());
+  std::vector<T> values;
+  while (st.keep_running()) {
+    st.pause_timing();
+    values = input;
+    st.resume_timing();
+    auto end = Simd ? tinystl::remove(values.begin(), values.end(), T(42))
+                    : std::remove(values.begin(), values.end(), T(42));
+    tinystl::bench::do_not_optimize(end);
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+// Drops the odd values of random input, a predicate no branch predictor can
+// learn.
+template <class T, bool Simd>
+void remove_if(tinystl::bench::state &st) {
+  std::mt19937 rng(42);
+  std::vector<T> input(st.arg());
+  for (T &x : input) {
+    x = static_cast<T>(rng());
+  }
+  std::vector<T> values;
+  auto pred = [](T x) { return (x & 1) != 0; };
+  while (st.keep_running()) {
+    st.pause_timing();
+    values = input;
+    st.resume_timing();
+    auto end = Simd ? tinystl::remove_if(values.begin(), values.end(), pred)
+                    : std::remove_if(values.begin(), values.end(), pred);
+    tinystl::bench::do_not_optimize(end);
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+void std_find_u8(tinystl::bench::state &st) { find<std::uint8_t, false>(st); }
+void simd_find_u8(tinystl::bench::state &st) { find<std::uint8_t, true>(st); }
+void std_find_u32(tinystl::bench::state &st) { find<std::uint32_t, false>(st); }
+void simd_find_u32(tinystl::bench::state &st) { find<std::uint32_t, true>(st); }
+void std_count_u8(tinystl::bench::state &st) { count<std::uint8_t, false>(st); }
+void simd_count_u8(tinystl::bench::state &st) { count<std::uint8_t, true>(st); }
+void std_count_u32(tinystl::bench::state &st) { count<std::uint32_t, false>(st); }
+void simd_count_u32(tinystl::bench::state &st) { count<std::uint32_t, true>(st); }
+void std_mismatch_u32(tinystl::bench::state &st) { mismatch<std::uint32_t, false>(st); }
+void simd_mismatch_u32(tinystl::bench::state &st) { mismatch<std::uint32_t, true>(st); }
+void std_equal_u16(tinystl::bench::state &st) { equal<std::uint16_t, false>(st); }
+void simd_equal_u16(tinystl::bench::state &st) { equal<std::uint16_t, true>(st); }
+void std_lex_compare_i32(tinystl::bench::state &st) { lexicographical_compare_three_way<std::int32_t, false>(st); }
+void simd_lex_compare_i32(tinystl::bench::state &st) { lexicographical_compare_three_way<std::int32_t, true>(st); }
+void std_remove_u32(tinystl::bench::state &st) { remove<std::uint32_t, false>(st); }
+void simd_remove_u32(tinystl::bench::state &st) { remove<std::uint32_t, true>(st); }
+void std_remove_if_u32(tinystl::bench::state &st) { remove_if<std::uint32_t, false>(st); }
+void branchless_remove_if_u32(tinystl::bench::state &st) { remove_if<std::uint32_t, true>(st); }
+
+} // namespace
+
+TINYSTL_BENCH(std_find_u8, 64, 1 << 16);
+TINYSTL_BENCH(simd_find_u8, 64, 1 << 16);
+TINYSTL_BENCH(std_find_u32, 64, 1 << 16);
+TINYSTL_BENCH(simd_find_u32, 64, 1 << 16);
+TINYSTL_BENCH(std_count_u8, 1 << 16);
+TINYSTL_BENCH(simd_count_u8, 1 << 16);
+TINYSTL_BENCH(std_count_u32, 1 << 16);
+TINYSTL_BENCH(simd_count_u32, 1 << 16);
+TINYSTL_BENCH(std_mismatch_u32, 64, 1 << 16);
+TINYSTL_BENCH(simd_mismatch_u32, 64, 1 << 16);
+TINYSTL_BENCH(std_equal_u16, 1 << 16);
+TINYSTL_BENCH(simd_equal_u16, 1 << 16);
+TINYSTL_BENCH(std_lex_compare_i32, 1 << 16);
+TINYSTL_BENCH(simd_lex_compare_i32, 1 << 16);
+TINYSTL_BENCH(std_remove_u32, 1 << 16);
+TINYSTL_BENCH(simd_remove_u32, 1 << 16);
+TINYSTL_BENCH(std_remove_if_u32, 1 << 16);
+TINYSTL_BENCH(branchless_remove_if_u32, 1 << 16);
@@ -0,0 +1,129 @@
+#include "bench.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <tinystl/algorithm/sort.h>
+
+namespace {
+
+enum class distribution { random, sorted, reversed, few_unique };
+
+std::vector<std::uint32_t> make_input(std::size_t n, distribution dist) {
+  std::mt19937 rng(42);
+  std::vector<std::uint32_t> values(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    switch (dist) {
+    case distribution::random:
+      values[i] = static_cast<std::uint32_t>(rng());
+      break;
+    case distribution::sorted:
+      values[i] = static_cast<std::uint32_t>(i);
+      break;
+    case distribution::reversed:
+      values[i] = static_cast<std::uint32_t>(n - i);
+      break;
+    case distribution::few_unique:
+      values[i] = static_cast<std::uint32_t>(rng() % 16);
+      break;
+    }
+  }
+  return values;
+}
+
+// A comparator other than std::less keeps the comparison sorts off the
+// radix path.
+struct compare_less {
+  bool operator()(std::uint32_t a, std::uint32_t b) const { return a < b; }
+};
+
+template <distribution Dist, class Sort>
+void run_sort(tinystl::bench::state &st, Sort sort) {
+  const auto input = make_input(st.arg(), Dist);
+  std::vector<std::uint32_t> values;
+  while (st.keep_running()) {
+    st.pause_timing();
+    values = input;
+    st.resume_timing();
+    sort(values);
+    tinystl::bench::clobber_memory();
+  }
+  tinystl::bench::do_not_optimize(values.front());
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+template <distribution Dist>
+void std_sort(tinystl::bench::state &st) {
+  run_sort<Dist>(st, [](auto &v) { std::sort(v.begin(), v.end(), compare_less()); });
+}
+
+template <distribution Dist>
+void pdqsort(tinystl::bench::state &st) {
+  run_sort<Dist>(st, [](auto &v) {
+    tinystl::sort(v.begin(), v.end(), compare_less());
+  });
+}
+
+template <distribution Dist>
+void radix_sort(tinystl::bench::state &st) {
+  run_sort<Dist>(st, [](auto &v) { tinystl::sort(v.begin(), v.end()); });
+}
+
+template <distribution Dist>
+void parallel_pdqsort(tinystl::bench::state &st) {
+  run_sort<Dist>(st, [](auto &v) {
+    tinystl::sort(tinystl::execution::par, v.begin(), v.end(), compare_less());
+  });
+}
+
+template <distribution Dist>
+void std_stable_sort(tinystl::bench::state &st) {
+  run_sort<Dist>(st, [](auto &v) {
+    std::stable_sort(v.begin(), v.end(), compare_less());
+  });
+}
+
+template <distribution Dist>
+void parallel_stable_sort(tinystl::bench::state &st) {
+  run_sort<Dist>(st, [](auto &v) {
+    tinystl::stable_sort(tinystl::execution::par, v.begin(), v.end(), compare_less());
+  });
+}
+
+void std_sort_random(tinystl::bench::state &st) { std_sort<distribution::random>(st); }
+void std_sort_sorted(tinystl::bench::state &st) { std_sort<distribution::sorted>(st); }
+void std_sort_reversed(tinystl::bench::state &st) { std_sort<distribution::reversed>(st); }
+void std_sort_few_unique(tinystl::bench::state &st) { std_sort<distribution::few_unique>(st); }
+
+void pdqsort_random(tinystl::bench::state &st) { pdqsort<distribution::random>(st); }
+void pdqsort_sorted(tinystl::bench::state &st) { pdqsort<distribution::sorted>(st); }
+void pdqsort_reversed(tinystl::bench::state &st) { pdqsort<distribution::reversed>(st); }
+void pdqsort_few_unique(tinystl::bench::state &st) { pdqsort<distribution::few_unique>(st); }
+
+void radix_sort_random(tinystl::bench::state &st) { radix_sort<distribution::random>(st); }
+void radix_sort_few_unique(tinystl::bench::state &st) { radix_sort<distribution::few_unique>(st); }
+
+void parallel_pdqsort_random(tinystl::bench::state &st) { parallel_pdqsort<distribution::random>(st); }
+void parallel_pdqsort_few_unique(tinystl::bench::state &st) { parallel_pdqsort<distribution::few_unique>(st); }
+
+void std_stable_sort_random(tinystl::bench::state &st) { std_stable_sort<distribution::random>(st); }
+void parallel_stable_sort_random(tinystl::bench::state &st) { parallel_stable_sort<distribution::random>(st); }
+
+} // namespace
+
+TINYSTL_BENCH(std_sort_random, 1 << 10, 1 << 20);
+TINYSTL_BENCH(pdqsort_random, 1 << 10, 1 << 20);
+TINYSTL_BENCH(radix_sort_random, 1 << 10, 1 << 20);
+TINYSTL_BENCH(parallel_pdqsort_random, 1 << 10, 1 << 20);
+TINYSTL_BENCH(std_sort_sorted, 1 << 20);
+TINYSTL_BENCH(pdqsort_sorted, 1 << 20);
+TINYSTL_BENCH(std_sort_reversed, 1 << 20);
+TINYSTL_BENCH(pdqsort_reversed, 1 << 20);
+TINYSTL_BENCH(std_sort_few_unique, 1 << 20);
+TINYSTL_BENCH(pdqsort_few_unique, 1 << 20);
+TINYSTL_BENCH(radix_sort_few_unique, 1 << 20);
+TINYSTL_BENCH(parallel_pdqsort_few_unique, 1 << 20);
+TINYSTL_BENCH(std_stable_sort_random, 1 << 20);
+TINYSTL_BENCH(parallel_stable_sort_random, 1 << 20);
@@ -0,0 +1,157 @@
+#pragma once
+
+// A minimal micro-benchmark harness. Each benchmark is a function taking a
+// bench::state; the timed region is the body of the keep_running() loop:
+//
+//   static void vector_push_back(tinystl::bench::state &st) {
+//     while (st.keep_running()) {
+//       tinystl::vector<int> v;
+//       for (std::size_t i = 0; i < st.arg(); ++i) v.push_back(i);
+//       tinystl::bench::do_not_optimize(v.data());
+//     }
+//     st.set_items_processed(st.iterations() * st.arg());
+//   }
+//   TINYSTL_BENCH(vector_push_back, 1 << 10, 1 << 20);
+//
+// When the runner is given --counters, the same region is also measured with
+// the hardware counters from perf_counters.h.
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+#include "perf_counters.h"
+
+namespace tinystl::bench {
+
+template <class T>
+inline void do_not_optimize(T const &value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static volatile const void *sink;
+  sink = &value;
+#endif
+}
+
+inline void clobber_memory() {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : : "memory");
+#endif
+}
+
+class state {
+  using clock = std::chrono::steady_clock;
+
+public:
+  state(
+    std::size_t arg, std::size_t iterations,
+    perf_counters *counters = nullptr
+  )
+    : m_arg(arg), m_iterations(iterations), m_remaining(iterations),
+      m_perf(counters) {}
+
+  // The counters start before and stop after the clock, so reading the
+  // clock is not counted against the benchmark.
+  bool keep_running() {
+    if (!m_started) {
+      m_started = true;
+      if (m_perf != nullptr) {
+        m_perf->start();
+      }
+      m_start = clock::now();
+    }
+    if (m_remaining == 0) {
+      m_stop = clock::now();
+      if (m_perf != nullptr) {
+        m_counters = m_perf->stop();
+      }
+      return false;
+    }
+    --m_remaining;
+    return true;
+  }
+
+  // exclude setup work inside the loop from the measurement
+  void pause_timing() {
+    m_paused_at = clock::now();
+    if (m_perf != nullptr) {
+      m_perf->pause();
+    }
+  }
+  void resume_timing() {
+    if (m_perf != nullptr) {
+      m_perf->resume();
+    }
+    m_paused += clock::now() - m_paused_at;
+  }
+
+  std::size_t arg() const noexcept { return m_arg; }
+  std::size_t iterations() const noexcept { return m_iterations; }
+
+  void set_items_processed(std::size_t n) noexcept { m_items = n; }
+  std::size_t items_processed() const noexcept { return m_items; }
+
+  void set_label(std::string label) { m_label = std::move(label); }
+  const std::string &label() const noexcept { return m_label; }
+
+  double elapsed_seconds() const {
+    return std::chrono::duration<double>(m_stop - m_start - m_paused).count();
+  }
+
+  // Totals over the timed region; all empty unless counters were requested.
+  const counter_values &counters() const noexcept { return m_counters; }
+
+private:
+  std::size_t m_arg;
+  std::size_t m_iterations;
+  std::size_t m_remaining;
+  std::size_t m_items = 0;
+  std::string m_label;
+  perf_counters *m_perf;
+  counter_values m_counters{};
+
+  bool m_started = false;
+  clock::time_point m_start{};
+  clock::time_point m_stop{};
+  clock::time_point m_paused_at{};
+  clock::duration m_paused{};
+};
+
+struct benchmark {
+  std::string name;
+  std::function<void(state &)> func;
+  std::vector<std::size_t> args;
+};
+
+inline std::vector<benchmark> &registry() {
+  static std::vector<benchmark> benchmarks;
+  return benchmarks;
+}
+
+struct registrar {
+  registrar(
+    const char *name, void (*func)(state &),
+    std::initializer_list<std::size_t> args
+  ) {
+    registry().push_back({name, func, args});
+  }
+};
+
+int run(int argc, char **argv);
+
+} // namespace tinystl::bench
+
+#define TINYSTL_BENCH_CONCAT_IMPL(a, b) a##b
+#define TINYSTL_BENCH_CONCAT(a, b) TINYSTL_BENCH_CONCAT_IMPL(a, b)
+
+// __COUNTER__ rather than __LINE__ so that a helper macro can register
+// several benchmarks from one line.
+#define TINYSTL_BENCH(func, ...)                                               \
+  static const ::tinystl::bench::registrar TINYSTL_BENCH_CONCAT(               \
+    tinystl_bench_registrar_, __COUNTER__                                      \
+  )(#func, func, {__VA_ARGS__})
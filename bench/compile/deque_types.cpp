@@ -0,0 +1,36 @@
+#include "types.h"
+
+#include <memory>
+
+#include <tinystl/container/deque.h>
+
+namespace {
+
+using namespace tinystl::compile_bench;
+
+// Only deque's iterator and its block map are defined so far, so this unit
+// instantiates those next to the class itself; it grows with deque.
+template <class T>
+struct exercise {
+  static void run(std::size_t &sink) {
+    using deque = tinystl::deque<T>;
+    sink += sizeof(deque);
+
+    typename deque::iterator first;
+    typename deque::iterator last = first + 4;
+    ++last;
+    --last;
+    last -= 2;
+    sink += static_cast<std::size_t>(last - first);
+    sink += first < last ? 1 : 0;
+
+    tinystl::split_buffer<T *, std::allocator<T *>> map;
+    map.emplace_back(nullptr);
+    map.emplace_front(nullptr);
+    sink += map.size();
+  }
+};
+
+} // namespace
+
+std::size_t deque_types() { return for_each_type<exercise>(element_types{}); }
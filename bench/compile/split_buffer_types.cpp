@@ -0,0 +1,34 @@
+#include "types.h"
+
+#include <memory>
+
+#include <tinystl/container/split_buffer.h>
+
+namespace {
+
+using namespace tinystl::compile_bench;
+
+template <class T>
+struct exercise {
+  static void run(std::size_t &sink) {
+    tinystl::split_buffer<T, std::allocator<T>> b;
+    for (std::size_t i = 0; i < 8; ++i) {
+      b.emplace_back(make<T>(i));
+      b.emplace_front(make<T>(i));
+    }
+    b.pop_front();
+    b.pop_back();
+
+    tinystl::split_buffer<T, std::allocator<T>> moved(std::move(b));
+    for (const T &value : moved) {
+      sink += value == make<T>(1) ? 1 : 0;
+    }
+    sink += moved.size();
+  }
+};
+
+} // namespace
+
+std::size_t split_buffer_types() {
+  return for_each_type<exercise>(element_types{});
+}
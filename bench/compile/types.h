@@ -0,0 +1,51 @@
+#pragma once
+
+// The element types every compile-time unit instantiates its container
+// over: scalars, a heap-owning string and trivially copyable records of
+// several sizes, so that template bloat scales the way it does in a real
+// program. The units are only compiled, never linked or run.
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace tinystl::compile_bench {
+
+template <std::size_t N>
+struct record {
+  unsigned char bytes[N];
+  friend bool operator==(const record &, const record &) = default;
+};
+
+template <class T>
+T make(std::size_t i) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    return std::string(i % 32, 'x');
+  } else if constexpr (std::is_arithmetic_v<T>) {
+    return static_cast<T>(i);
+  } else if constexpr (std::is_pointer_v<T>) {
+    return nullptr;
+  } else {
+    return T{{static_cast<unsigned char>(i)}};
+  }
+}
+
+template <class... Ts>
+struct type_list {};
+
+using element_types = type_list<
+  char, short, int, long, long long, unsigned char, unsigned short, unsigned,
+  unsigned long, float, double, long double, std::uint8_t *, const char *,
+  std::string, record<3>, record<8>, record<12>, record<16>, record<24>,
+  record<32>, record<48>, record<64>, record<128>, record<256>>;
+
+// Calls Exercise<T>::run(sink) for every element type.
+template <template <class> class Exercise, class... Ts>
+std::size_t for_each_type(type_list<Ts...>) {
+  std::size_t sink = 0;
+  (Exercise<Ts>::run(sink), ...);
+  return sink;
+}
+
+} // namespace tinystl::compile_bench
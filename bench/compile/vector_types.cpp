@@ -0,0 +1,38 @@
+#include "types.h"
+
+#include <tinystl/container/vector.h>
+
+namespace {
+
+using namespace tinystl::compile_bench;
+
+// The member functions a typical user of vector<T> reaches for.
+template <class T>
+struct exercise {
+  static void run(std::size_t &sink) {
+    tinystl::vector<T> v;
+    v.reserve(4);
+    for (std::size_t i = 0; i < 8; ++i) {
+      v.push_back(make<T>(i));
+    }
+    v.emplace_back(make<T>(8));
+    v.insert(v.begin() + 1, make<T>(9));
+    v.insert(v.end(), 2, make<T>(10));
+    v.erase(v.begin());
+    v.resize(16);
+    v.shrink_to_fit();
+
+    tinystl::vector<T> copy(v);
+    tinystl::vector<T> moved(std::move(copy));
+    copy = moved;
+    copy.assign(v.begin(), v.end());
+    sink += copy.size() + moved.size();
+    sink += v.at(1) == make<T>(1) ? 1 : 0;
+    sink += moved == v ? 1 : 0;
+    v.clear();
+  }
+};
+
+} // namespace
+
+std::size_t vector_types() { return for_each_type<exercise>(element_types{}); }
@@ -0,0 +1,187 @@
+#include "bench.h"
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include <tinystl/concurrent/bounded_queue.h>
+
+namespace {
+
+// The argument is the thread count. Half the threads produce and half
+// consume, so the numbers read as throughput under growing contention; a
+// single thread alternates pushing and popping. Threads are started inside
+// the timed region, which is small next to the items moved per run.
+constexpr std::size_t items = 1 << 18;
+constexpr std::size_t capacity = 1024;
+
+// The baseline the lock-free queues replace.
+template <class T>
+class locked_queue {
+public:
+  explicit locked_queue(std::size_t capacity) : m_capacity(capacity) {}
+
+  bool try_push(T value) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_items.size() == m_capacity) {
+      return false;
+    }
+    m_items.push_back(value);
+    return true;
+  }
+
+  std::optional<T> try_pop() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_items.empty()) {
+      return std::nullopt;
+    }
+    T value = m_items.front();
+    m_items.pop_front();
+    return value;
+  }
+
+private:
+  std::mutex m_mutex;
+  std::deque<T> m_items;
+  std::size_t m_capacity;
+};
+
+template <class Queue>
+void run_throughput(std::size_t threads, std::size_t producers, std::size_t consumers) {
+  Queue queue(capacity);
+  if (threads == 1) {
+    for (std::size_t i = 0; i < items; ++i) {
+      queue.try_push(i);
+      tinystl::bench::do_not_optimize(queue.try_pop());
+    }
+    return;
+  }
+
+  const std::size_t per_producer = items / producers;
+  const std::size_t total = per_producer * producers;
+  std::atomic<std::size_t> popped{0};
+  std::vector<std::thread> pool;
+  for (std::size_t p = 0; p < producers; ++p) {
+    pool.emplace_back([&] {
+      for (std::size_t i = 0; i < per_producer; ++i) {
+        while (!queue.try_push(i)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (std::size_t c = 0; c < consumers; ++c) {
+    pool.emplace_back([&] {
+      while (popped.load(std::memory_order_relaxed) < total) {
+        if (queue.try_pop()) {
+          popped.fetch_add(1, std::memory_order_relaxed);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (auto &t : pool) {
+    t.join();
+  }
+}
+
+void mpmc_throughput(tinystl::bench::state &st) {
+  const std::size_t producers = std::max<std::size_t>(st.arg() / 2, 1);
+  while (st.keep_running()) {
+    run_throughput<tinystl::mpmc_queue<std::size_t>>(st.arg(), producers, st.arg() - producers);
+  }
+  st.set_items_processed(st.iterations() * items);
+}
+
+void locked_queue_throughput(tinystl::bench::state &st) {
+  const std::size_t producers = std::max<std::size_t>(st.arg() / 2, 1);
+  while (st.keep_running()) {
+    run_throughput<locked_queue<std::size_t>>(st.arg(), producers, st.arg() - producers);
+  }
+  st.set_items_processed(st.iterations() * items);
+}
+
+void mpsc_throughput(tinystl::bench::state &st) {
+  const std::size_t producers = std::max<std::size_t>(st.arg() - 1, 1);
+  while (st.keep_running()) {
+    run_throughput<tinystl::mpsc_queue<std::size_t>>(st.arg(), producers, 1);
+  }
+  st.set_items_processed(st.iterations() * items);
+}
+
+void spsc_throughput(tinystl::bench::state &st) {
+  while (st.keep_running()) {
+    run_throughput<tinystl::spsc_queue<std::size_t>>(2, 1, 1);
+  }
+  st.set_items_processed(st.iterations() * items);
+}
+
+// One message bounces between two threads through a pair of queues; the
+// time per item is one round trip.
+template <class Queue>
+void run_round_trips(std::size_t trips) {
+  Queue ping(capacity);
+  Queue pong(capacity);
+  std::thread echo([&] {
+    for (std::size_t i = 0; i < trips; ++i) {
+      pong.push(ping.pop());
+    }
+  });
+  for (std::size_t i = 0; i < trips; ++i) {
+    ping.push(i);
+    tinystl::bench::do_not_optimize(pong.pop());
+  }
+  echo.join();
+}
+
+void spsc_round_trip(tinystl::bench::state &st) {
+  while (st.keep_running()) {
+    run_round_trips<tinystl::spsc_queue<std::size_t>>(st.arg());
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+void mpmc_round_trip(tinystl::bench::state &st) {
+  while (st.keep_running()) {
+    run_round_trips<tinystl::mpmc_queue<std::size_t>>(st.arg());
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+// Every thread pushes and immediately pops on one shared queue, so the time
+// per item is the latency of a push/pop pair while the other threads fight
+// over the same head and tail.
+void mpmc_contended_latency(tinystl::bench::state &st) {
+  const std::size_t per_thread = items / st.arg();
+  while (st.keep_running()) {
+    tinystl::mpmc_queue<std::size_t> queue(capacity);
+    std::vector<std::thread> pool;
+    for (std::size_t t = 0; t < st.arg(); ++t) {
+      pool.emplace_back([&] {
+        for (std::size_t i = 0; i < per_thread; ++i) {
+          queue.push(i);
+          tinystl::bench::do_not_optimize(queue.pop());
+        }
+      });
+    }
+    for (auto &t : pool) {
+      t.join();
+    }
+  }
+  st.set_items_processed(st.iterations() * per_thread * st.arg());
+}
+
+} // namespace
+
+TINYSTL_BENCH(mpmc_throughput, 1, 2, 4, 8, 16, 32, 64);
+TINYSTL_BENCH(locked_queue_throughput, 1, 2, 4, 8, 16, 32, 64);
+TINYSTL_BENCH(mpsc_throughput, 2, 4, 8, 16, 32, 64);
+TINYSTL_BENCH(spsc_throughput, 2);
+TINYSTL_BENCH(spsc_round_trip, 1 << 12);
+TINYSTL_BENCH(mpmc_round_trip, 1 << 12);
+TINYSTL_BENCH(mpmc_contended_latency, 1, 2, 4, 8, 16, 32, 64);
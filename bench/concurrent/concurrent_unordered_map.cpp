@@ -0,0 +1,157 @@
+#include "bench.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <tinystl/concurrent/concurrent_unordered_map.h>
+
+namespace {
+
+// The argument is the thread count; every run performs the same number of
+// operations on a map prefilled with half of the key space, so the numbers
+// read as throughput under growing contention. Threads are started inside
+// the timed region, which is small next to the operations.
+constexpr std::size_t operations = 1 << 18;
+constexpr std::uint64_t key_space = 1 << 16;
+
+// The pattern the sharded map replaces.
+class locked_map {
+public:
+  std::optional<std::uint64_t> find(std::uint64_t key) const {
+    std::shared_lock lock(m_mutex);
+    auto it = m_map.find(key);
+    return it == m_map.end() ? std::nullopt : std::optional<std::uint64_t>(it->second);
+  }
+
+  void insert_or_assign(std::uint64_t key, std::uint64_t value) {
+    std::unique_lock lock(m_mutex);
+    m_map.insert_or_assign(key, value);
+  }
+
+  void erase(std::uint64_t key) {
+    std::unique_lock lock(m_mutex);
+    m_map.erase(key);
+  }
+
+private:
+  mutable std::shared_mutex m_mutex;
+  std::unordered_map<std::uint64_t, std::uint64_t> m_map;
+};
+
+// write_percent of the operations write, split evenly between updates and
+// erases; the rest are lookups.
+template <class Map>
+void run_mix(Map &map, std::size_t threads, unsigned write_percent) {
+  std::vector<std::thread> pool;
+  for (std::size_t t = 0; t < threads; ++t) {
+    pool.emplace_back([&map, threads, write_percent, t] {
+      std::uint64_t state = 0x9e3779b97f4a7c15ULL * (t + 1);
+      std::uint64_t hits = 0;
+      for (std::size_t i = 0; i < operations / threads; ++i) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        std::uint64_t key = state % key_space;
+        unsigned roll = static_cast<unsigned>((state >> 32) % 100);
+        if (roll >= write_percent) {
+          hits += map.find(key).has_value();
+        } else if (roll % 2 == 0) {
+          map.insert_or_assign(key, state);
+        } else {
+          map.erase(key);
+        }
+      }
+      tinystl::bench::do_not_optimize(hits);
+    });
+  }
+  for (auto &thread : pool) {
+    thread.join();
+  }
+}
+
+template <class Map>
+void prefill(Map &map) {
+  for (std::uint64_t key = 0; key < key_space; key += 2) {
+    map.insert_or_assign(key, key);
+  }
+}
+
+void sharded_read_heavy(tinystl::bench::state &st) {
+  tinystl::concurrent_unordered_map<std::uint64_t, std::uint64_t> map;
+  prefill(map);
+  while (st.keep_running()) {
+    run_mix(map, st.arg(), 5);
+  }
+  st.set_items_processed(st.iterations() * operations);
+}
+
+void locked_read_heavy(tinystl::bench::state &st) {
+  locked_map map;
+  prefill(map);
+  while (st.keep_running()) {
+    run_mix(map, st.arg(), 5);
+  }
+  st.set_items_processed(st.iterations() * operations);
+}
+
+void sharded_write_heavy(tinystl::bench::state &st) {
+  tinystl::concurrent_unordered_map<std::uint64_t, std::uint64_t> map;
+  prefill(map);
+  while (st.keep_running()) {
+    run_mix(map, st.arg(), 50);
+  }
+  st.set_items_processed(st.iterations() * operations);
+}
+
+void locked_write_heavy(tinystl::bench::state &st) {
+  locked_map map;
+  prefill(map);
+  while (st.keep_running()) {
+    run_mix(map, st.arg(), 50);
+  }
+  st.set_items_processed(st.iterations() * operations);
+}
+
+// Loading a cache in bulk: one lock per shard instead of one per element.
+void sharded_batched_insert(tinystl::bench::state &st) {
+  std::vector<std::pair<std::uint64_t, std::uint64_t>> items;
+  for (std::uint64_t key = 0; key < st.arg(); ++key) {
+    items.emplace_back(key * 0x9e3779b97f4a7c15ULL, key);
+  }
+  while (st.keep_running()) {
+    tinystl::concurrent_unordered_map<std::uint64_t, std::uint64_t> map;
+    map.insert(items.begin(), items.end());
+    tinystl::bench::do_not_optimize(map.size());
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+void sharded_single_insert(tinystl::bench::state &st) {
+  std::vector<std::pair<std::uint64_t, std::uint64_t>> items;
+  for (std::uint64_t key = 0; key < st.arg(); ++key) {
+    items.emplace_back(key * 0x9e3779b97f4a7c15ULL, key);
+  }
+  while (st.keep_running()) {
+    tinystl::concurrent_unordered_map<std::uint64_t, std::uint64_t> map;
+    for (const auto &[key, value] : items) {
+      map.insert(key, value);
+    }
+    tinystl::bench::do_not_optimize(map.size());
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+} // namespace
+
+TINYSTL_BENCH(sharded_read_heavy, 1, 2, 4, 8, 16, 32, 64);
+TINYSTL_BENCH(locked_read_heavy, 1, 2, 4, 8, 16, 32, 64);
+TINYSTL_BENCH(sharded_write_heavy, 1, 2, 4, 8, 16, 32, 64);
+TINYSTL_BENCH(locked_write_heavy, 1, 2, 4, 8, 16, 32, 64);
+TINYSTL_BENCH(sharded_batched_insert, 1 << 16);
+TINYSTL_BENCH(sharded_single_insert, 1 << 16);
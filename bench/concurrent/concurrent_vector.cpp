@@ -0,0 +1,86 @@
+#include "bench.h"
+
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <tinystl/concurrent/concurrent_vector.h>
+#include <tinystl/container/vector.h>
+
+namespace {
+
+// The argument is the number of appending threads; every run appends the
+// same total, so the numbers read as throughput under growing contention.
+// Threads are started inside the timed region, which is small next to the
+// appends.
+constexpr std::size_t items = 1 << 20;
+
+template <class Append>
+void run_appenders(std::size_t threads, Append append) {
+  std::vector<std::thread> pool;
+  for (std::size_t t = 0; t < threads; ++t) {
+    pool.emplace_back([&, t] {
+      for (std::size_t i = t; i < items; i += threads) {
+        append(i);
+      }
+    });
+  }
+  for (auto &thread : pool) {
+    thread.join();
+  }
+}
+
+void concurrent_vector_push_back(tinystl::bench::state &st) {
+  while (st.keep_running()) {
+    tinystl::concurrent_vector<std::size_t> vec;
+    run_appenders(st.arg(), [&](std::size_t i) { vec.push_back(i); });
+    tinystl::bench::do_not_optimize(vec.back());
+  }
+  st.set_items_processed(st.iterations() * items);
+}
+
+// The pattern concurrent_vector replaces.
+void locked_vector_push_back(tinystl::bench::state &st) {
+  while (st.keep_running()) {
+    tinystl::vector<std::size_t> vec;
+    std::mutex mutex;
+    run_appenders(st.arg(), [&](std::size_t i) {
+      std::lock_guard<std::mutex> lock(mutex);
+      vec.push_back(i);
+    });
+    tinystl::bench::do_not_optimize(vec.back());
+  }
+  st.set_items_processed(st.iterations() * items);
+}
+
+// Workers that batch their results append one contiguous block per batch.
+void concurrent_vector_grow_by(tinystl::bench::state &st) {
+  constexpr std::size_t batch = 64;
+  while (st.keep_running()) {
+    tinystl::concurrent_vector<std::size_t> vec;
+    std::vector<std::thread> pool;
+    for (std::size_t t = 0; t < st.arg(); ++t) {
+      pool.emplace_back([&] {
+        std::size_t local[batch];
+        for (std::size_t i = 0; i < batch; ++i) {
+          local[i] = i;
+        }
+        for (std::size_t done = 0; done < items / st.arg(); done += batch) {
+          vec.grow_by(local, local + batch);
+        }
+      });
+    }
+    for (auto &thread : pool) {
+      thread.join();
+    }
+    tinystl::bench::do_not_optimize(vec.back());
+  }
+  st.set_items_processed(st.iterations() * items);
+}
+
+} // namespace
+
+TINYSTL_BENCH(concurrent_vector_push_back, 1, 2, 4, 8, 16, 32, 64);
+TINYSTL_BENCH(locked_vector_push_back, 1, 2, 4, 8, 16, 32, 64);
+TINYSTL_BENCH(concurrent_vector_grow_by, 1, 2, 4, 8, 16, 32, 64);
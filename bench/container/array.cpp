@@ -0,0 +1,95 @@
+#include "bench.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <tinystl/container/array.h>
+
+namespace {
+
+// The size of an array is part of its type, so each case is instantiated per
+// size and the benchmark argument only repeats it for the report. Each std_
+// case is registered right after its tinystl one.
+template <class Array>
+Array iota_array() {
+  Array a;
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    a[i] = static_cast<typename Array::value_type>(i);
+  }
+  return a;
+}
+
+template <class Array>
+void copy(tinystl::bench::state &st) {
+  const Array source = iota_array<Array>();
+  Array target{};
+  while (st.keep_running()) {
+    tinystl::bench::do_not_optimize(source);
+    target = source;
+    tinystl::bench::do_not_optimize(target);
+  }
+  st.set_items_processed(st.iterations() * source.size());
+}
+
+template <class Array>
+void fill(tinystl::bench::state &st) {
+  Array a{};
+  typename Array::value_type value = 1;
+  while (st.keep_running()) {
+    a.fill(value++);
+    tinystl::bench::do_not_optimize(a);
+  }
+  st.set_items_processed(st.iterations() * a.size());
+}
+
+template <class Array>
+void iterate(tinystl::bench::state &st) {
+  const Array a = iota_array<Array>();
+  while (st.keep_running()) {
+    tinystl::bench::do_not_optimize(a);
+    typename Array::value_type sum = 0;
+    for (auto value : a) {
+      sum += value;
+    }
+    tinystl::bench::do_not_optimize(sum);
+  }
+  st.set_items_processed(st.iterations() * a.size());
+}
+
+template <class Array>
+void compare(tinystl::bench::state &st) {
+  const Array a = iota_array<Array>();
+  const Array b = iota_array<Array>();
+  while (st.keep_running()) {
+    tinystl::bench::do_not_optimize(a);
+    tinystl::bench::do_not_optimize(a == b);
+  }
+  st.set_items_processed(st.iterations() * a.size());
+}
+
+} // namespace
+
+#define ARRAY_BENCH(op, type, n)                                               \
+  static void array_##op##_##type##_##n(tinystl::bench::state &st) {           \
+    op<tinystl::array<type, n>>(st);                                           \
+  }                                                                            \
+  static void std_array_##op##_##type##_##n(tinystl::bench::state &st) {       \
+    op<std::array<type, n>>(st);                                               \
+  }                                                                            \
+  TINYSTL_BENCH(array_##op##_##type##_##n, n);                                 \
+  TINYSTL_BENCH(std_array_##op##_##type##_##n, n)
+
+using u8 = std::uint8_t;
+
+ARRAY_BENCH(copy, int, 16);
+ARRAY_BENCH(copy, int, 4096);
+ARRAY_BENCH(copy, double, 4096);
+ARRAY_BENCH(fill, int, 16);
+ARRAY_BENCH(fill, int, 4096);
+ARRAY_BENCH(fill, u8, 4096);
+ARRAY_BENCH(iterate, int, 16);
+ARRAY_BENCH(iterate, int, 4096);
+ARRAY_BENCH(iterate, double, 4096);
+ARRAY_BENCH(compare, int, 16);
+ARRAY_BENCH(compare, int, 4096);
@@ -0,0 +1,117 @@
+#include "bench.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include <tinystl/container/bitvector.h>
+#include <tinystl/container/vector.h>
+
+namespace {
+
+// Bitmap-index style workloads over st.arg() rows: count the set bits, and
+// intersect two bitmaps before counting. Each flag set is compared in three
+// layouts: tinystl::bitvector, std::vector<bool> and one byte per flag.
+bool flag_a(std::size_t i) { return (i * 2654435761u) % 7 < 3; }
+bool flag_b(std::size_t i) { return (i * 40503u) % 5 < 2; }
+
+template <class Bits>
+Bits make_flags(std::size_t n, bool (*flag)(std::size_t)) {
+  Bits bits(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    bits[i] = flag(i);
+  }
+  return bits;
+}
+
+void bitvector_count(tinystl::bench::state &st) {
+  auto a = make_flags<tinystl::bitvector<>>(st.arg(), flag_a);
+  while (st.keep_running()) {
+    tinystl::bench::do_not_optimize(a.count());
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+void std_vector_bool_count(tinystl::bench::state &st) {
+  auto a = make_flags<std::vector<bool>>(st.arg(), flag_a);
+  while (st.keep_running()) {
+    tinystl::bench::do_not_optimize(std::count(a.begin(), a.end(), true));
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+void byte_vector_count(tinystl::bench::state &st) {
+  auto a = make_flags<tinystl::vector<std::uint8_t>>(st.arg(), flag_a);
+  while (st.keep_running()) {
+    std::size_t n = 0;
+    for (std::uint8_t f : a) {
+      n += f;
+    }
+    tinystl::bench::do_not_optimize(n);
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+void bitvector_and_count(tinystl::bench::state &st) {
+  auto a = make_flags<tinystl::bitvector<>>(st.arg(), flag_a);
+  auto b = make_flags<tinystl::bitvector<>>(st.arg(), flag_b);
+  tinystl::bitvector<> out;
+  while (st.keep_running()) {
+    out = a;
+    out &= b;
+    tinystl::bench::do_not_optimize(out.count());
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+void std_vector_bool_and_count(tinystl::bench::state &st) {
+  auto a = make_flags<std::vector<bool>>(st.arg(), flag_a);
+  auto b = make_flags<std::vector<bool>>(st.arg(), flag_b);
+  std::vector<bool> out(st.arg());
+  while (st.keep_running()) {
+    for (std::size_t i = 0; i < out.size(); ++i) {
+      out[i] = a[i] && b[i];
+    }
+    tinystl::bench::do_not_optimize(std::count(out.begin(), out.end(), true));
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+void byte_vector_and_count(tinystl::bench::state &st) {
+  auto a = make_flags<tinystl::vector<std::uint8_t>>(st.arg(), flag_a);
+  auto b = make_flags<tinystl::vector<std::uint8_t>>(st.arg(), flag_b);
+  tinystl::vector<std::uint8_t> out(st.arg());
+  while (st.keep_running()) {
+    std::size_t n = 0;
+    for (std::size_t i = 0; i < out.size(); ++i) {
+      out[i] = a[i] & b[i];
+      n += out[i];
+    }
+    tinystl::bench::do_not_optimize(n);
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+void bitvector_find_next(tinystl::bench::state &st) {
+  auto a = make_flags<tinystl::bitvector<>>(st.arg(), flag_a);
+  auto b = make_flags<tinystl::bitvector<>>(st.arg(), flag_b);
+  a &= b;
+  while (st.keep_running()) {
+    std::size_t sum = 0;
+    for (auto i = a.find_first(); i != a.npos; i = a.find_next(i)) {
+      sum += i;
+    }
+    tinystl::bench::do_not_optimize(sum);
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+} // namespace
+
+TINYSTL_BENCH(bitvector_count, 1 << 16, 1 << 24);
+TINYSTL_BENCH(std_vector_bool_count, 1 << 16, 1 << 24);
+TINYSTL_BENCH(byte_vector_count, 1 << 16, 1 << 24);
+TINYSTL_BENCH(bitvector_and_count, 1 << 16, 1 << 24);
+TINYSTL_BENCH(std_vector_bool_and_count, 1 << 16, 1 << 24);
+TINYSTL_BENCH(byte_vector_and_count, 1 << 16, 1 << 24);
+TINYSTL_BENCH(bitvector_find_next, 1 << 16, 1 << 24);
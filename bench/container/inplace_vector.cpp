@@ -0,0 +1,43 @@
+#include "bench.h"
+
+#include <cstdint>
+
+#include <tinystl/container/inplace_vector.h>
+#include <tinystl/container/vector.h>
+
+namespace {
+
+// Splits a synthetic packet stream into records of at most 16 fields, the
+// pattern of a decoder that builds one small buffer per message.
+constexpr std::size_t max_fields = 16;
+
+template <class Fields>
+void decode_packets(tinystl::bench::state &st) {
+  const std::size_t packets = st.arg();
+  std::uint64_t checksum = 0;
+  while (st.keep_running()) {
+    for (std::size_t p = 0; p < packets; ++p) {
+      Fields fields;
+      std::size_t n = 4 + p % (max_fields - 4);
+      for (std::size_t i = 0; i < n; ++i) {
+        fields.push_back(static_cast<std::uint32_t>(p * 31 + i));
+      }
+      checksum += fields[n / 2] + fields.size();
+    }
+  }
+  tinystl::bench::do_not_optimize(checksum);
+  st.set_items_processed(st.iterations() * packets);
+}
+
+void vector_decode(tinystl::bench::state &st) {
+  decode_packets<tinystl::vector<std::uint32_t>>(st);
+}
+
+void inplace_vector_decode(tinystl::bench::state &st) {
+  decode_packets<tinystl::inplace_vector<std::uint32_t, max_fields>>(st);
+}
+
+} // namespace
+
+TINYSTL_BENCH(vector_decode, 1 << 10, 1 << 16);
+TINYSTL_BENCH(inplace_vector_decode, 1 << 10, 1 << 16);
@@ -0,0 +1,112 @@
+#include "bench.h"
+
+#include <cstdint>
+#include <list>
+
+#include <tinystl/container/intrusive_list.h>
+#include <tinystl/container/list.h>
+#include <tinystl/container/vector.h>
+#include <tinystl/memory/node_pool.h>
+
+namespace {
+
+// LRU cache of st.arg() entries fed with keys drawn from twice that range, so
+// about half the lookups hit (move-to-front splice) and half miss (evict the
+// back node and insert a fresh one at the front).
+tinystl::vector<std::uint32_t> make_keys(std::size_t capacity) {
+  tinystl::vector<std::uint32_t> keys;
+  keys.reserve(1 << 16);
+  std::uint64_t x = 0x9e3779b97f4a7c15ull;
+  for (std::size_t i = 0; i < (1 << 16); ++i) {
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    keys.push_back(static_cast<std::uint32_t>(x % (2 * capacity)));
+  }
+  return keys;
+}
+
+template <class List>
+void lru_node_list(tinystl::bench::state &st, List cache) {
+  const std::size_t capacity = st.arg();
+  const auto keys = make_keys(capacity);
+
+  tinystl::vector<typename List::iterator> where(2 * capacity, cache.end());
+  for (std::uint32_t k = 0; k < capacity; ++k) {
+    where[k] = cache.insert(cache.end(), k);
+  }
+
+  std::size_t hits = 0;
+  while (st.keep_running()) {
+    for (std::uint32_t key : keys) {
+      auto &it = where[key];
+      if (it != cache.end()) {
+        cache.splice(cache.begin(), cache, it);
+        ++hits;
+      } else {
+        where[cache.back()] = cache.end();
+        cache.pop_back();
+        cache.push_front(key);
+        it = cache.begin();
+      }
+    }
+  }
+  tinystl::bench::do_not_optimize(hits);
+  st.set_items_processed(st.iterations() * keys.size());
+}
+
+void std_list_lru(tinystl::bench::state &st) {
+  lru_node_list(st, std::list<std::uint32_t>());
+}
+
+void list_lru(tinystl::bench::state &st) {
+  lru_node_list(st, tinystl::list<std::uint32_t>());
+}
+
+void pooled_list_lru(tinystl::bench::state &st) {
+  using alloc = tinystl::pool_allocator<std::uint32_t>;
+  tinystl::node_pool pool;
+  lru_node_list(st, tinystl::list<std::uint32_t, alloc>(alloc(pool)));
+}
+
+struct lru_entry : tinystl::intrusive_list_hook<> {
+  std::uint32_t key = 0;
+};
+
+void intrusive_list_lru(tinystl::bench::state &st) {
+  const std::size_t capacity = st.arg();
+  const auto keys = make_keys(capacity);
+
+  tinystl::vector<lru_entry> entries(2 * capacity);
+  tinystl::intrusive_list<lru_entry> cache;
+  for (std::uint32_t k = 0; k < entries.size(); ++k) {
+    entries[k].key = k;
+  }
+  for (std::uint32_t k = 0; k < capacity; ++k) {
+    cache.push_back(entries[k]);
+  }
+
+  std::size_t hits = 0;
+  while (st.keep_running()) {
+    for (std::uint32_t key : keys) {
+      lru_entry &e = entries[key];
+      if (e.is_linked()) {
+        cache.splice(cache.begin(), cache, cache.iterator_to(e));
+        ++hits;
+      } else {
+        cache.pop_back();
+        cache.push_front(e);
+      }
+    }
+  }
+  cache.clear();
+  tinystl::bench::do_not_optimize(hits);
+  st.set_items_processed(st.iterations() * keys.size());
+}
+
+} // namespace
+
+TINYSTL_BENCH(std_list_lru, 1 << 8, 1 << 12, 1 << 16);
+TINYSTL_BENCH(list_lru, 1 << 8, 1 << 12, 1 << 16);
+TINYSTL_BENCH(pooled_list_lru, 1 << 8, 1 << 12, 1 << 16);
+TINYSTL_BENCH(intrusive_list_lru, 1 << 8, 1 << 12, 1 << 16);
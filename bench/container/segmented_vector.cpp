@@ -0,0 +1,94 @@
+#include "bench.h"
+
+#include <cstdint>
+
+#include <tinystl/container/segmented_vector.h>
+#include <tinystl/container/vector.h>
+
+namespace {
+
+// A 32-byte event-log record.
+struct event {
+  std::uint64_t timestamp;
+  std::uint64_t id;
+  double value;
+  std::uint32_t kind;
+  std::uint32_t flags;
+};
+
+template <class Log>
+void append_events(tinystl::bench::state &st) {
+  while (st.keep_running()) {
+    Log log;
+    for (std::size_t i = 0; i < st.arg(); ++i) {
+      log.push_back({i, i, 1.0, 0, 0});
+    }
+    tinystl::bench::do_not_optimize(log.back());
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+void vector_append(tinystl::bench::state &st) {
+  append_events<tinystl::vector<event>>(st);
+}
+
+void segmented_vector_append(tinystl::bench::state &st) {
+  append_events<tinystl::segmented_vector<event>>(st);
+}
+
+tinystl::segmented_vector<event> make_log(std::size_t n) {
+  tinystl::segmented_vector<event> log;
+  for (std::size_t i = 0; i < n; ++i) {
+    log.push_back({i, i, static_cast<double>(i), 0, 0});
+  }
+  return log;
+}
+
+void segmented_vector_sum_iterator(tinystl::bench::state &st) {
+  auto log = make_log(st.arg());
+  while (st.keep_running()) {
+    double sum = 0;
+    for (const event &e : log) {
+      sum += e.value;
+    }
+    tinystl::bench::do_not_optimize(sum);
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+void segmented_vector_sum_index(tinystl::bench::state &st) {
+  auto log = make_log(st.arg());
+  while (st.keep_running()) {
+    double sum = 0;
+    for (std::size_t i = 0; i < log.size(); ++i) {
+      sum += log[i].value;
+    }
+    tinystl::bench::do_not_optimize(sum);
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+void segmented_vector_sum_segments(tinystl::bench::state &st) {
+  auto log = make_log(st.arg());
+  while (st.keep_running()) {
+    double sum = 0;
+    tinystl::for_each_segment(
+      log.cbegin(), log.cend(),
+      [&](const event *first, const event *last) {
+        for (; first != last; ++first) {
+          sum += first->value;
+        }
+      }
+    );
+    tinystl::bench::do_not_optimize(sum);
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+} // namespace
+
+TINYSTL_BENCH(vector_append, 1 << 12, 1 << 20, 1 << 24);
+TINYSTL_BENCH(segmented_vector_append, 1 << 12, 1 << 20, 1 << 24);
+TINYSTL_BENCH(segmented_vector_sum_iterator, 1 << 20);
+TINYSTL_BENCH(segmented_vector_sum_index, 1 << 20);
+TINYSTL_BENCH(segmented_vector_sum_segments, 1 << 20);
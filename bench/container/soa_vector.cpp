@@ -0,0 +1,119 @@
+#include "bench.h"
+
+#include <cstdint>
+
+#include <tinystl/container/soa_vector.h>
+#include <tinystl/container/vector.h>
+
+namespace {
+
+// A 64-byte row: one cache line per record in the array-of-structs layout.
+struct record {
+  double price;
+  double quantity;
+  std::int64_t id;
+  std::int64_t timestamp;
+  double bid;
+  double ask;
+  std::int32_t venue;
+  std::int32_t flags;
+  double fee;
+};
+
+using record_columns = tinystl::soa_vector<
+  double, double, std::int64_t, std::int64_t, double, double, std::int32_t,
+  std::int32_t, double>;
+
+tinystl::vector<record> make_aos(std::size_t n) {
+  tinystl::vector<record> v;
+  v.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    double x = static_cast<double>(i);
+    v.push_back(
+      {x, 2 * x, std::int64_t(i), std::int64_t(i), x, x, 1, 0, 0.5 * x}
+    );
+  }
+  return v;
+}
+
+record_columns make_soa(std::size_t n) {
+  record_columns v;
+  v.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    double x = static_cast<double>(i);
+    v.emplace_back(
+      x, 2 * x, std::int64_t(i), std::int64_t(i), x, x, 1, 0, 0.5 * x
+    );
+  }
+  return v;
+}
+
+void aos_sum_one_column(tinystl::bench::state &st) {
+  auto v = make_aos(st.arg());
+  while (st.keep_running()) {
+    double sum = 0.0;
+    for (const record &r : v) {
+      sum += r.price;
+    }
+    tinystl::bench::do_not_optimize(sum);
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+void soa_sum_one_column(tinystl::bench::state &st) {
+  auto v = make_soa(st.arg());
+  while (st.keep_running()) {
+    double sum = 0.0;
+    for (double price : v.column<0>()) {
+      sum += price;
+    }
+    tinystl::bench::do_not_optimize(sum);
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+void aos_dot_two_columns(tinystl::bench::state &st) {
+  auto v = make_aos(st.arg());
+  while (st.keep_running()) {
+    double sum = 0.0;
+    for (const record &r : v) {
+      sum += r.price * r.quantity;
+    }
+    tinystl::bench::do_not_optimize(sum);
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+void soa_dot_two_columns(tinystl::bench::state &st) {
+  auto v = make_soa(st.arg());
+  while (st.keep_running()) {
+    auto price = v.column<0>();
+    auto quantity = v.column<1>();
+    double sum = 0.0;
+    for (std::size_t i = 0; i < price.size(); ++i) {
+      sum += price[i] * quantity[i];
+    }
+    tinystl::bench::do_not_optimize(sum);
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+void soa_sum_row_proxy(tinystl::bench::state &st) {
+  auto v = make_soa(st.arg());
+  while (st.keep_running()) {
+    double sum = 0.0;
+    for (auto row : v) {
+      sum += std::get<0>(row);
+    }
+    tinystl::bench::do_not_optimize(sum);
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+} // namespace
+
+TINYSTL_BENCH(aos_sum_one_column, 1 << 10, 1 << 16, 1 << 22);
+TINYSTL_BENCH(soa_sum_one_column, 1 << 10, 1 << 16, 1 << 22);
+TINYSTL_BENCH(aos_dot_two_columns, 1 << 10, 1 << 16, 1 << 22);
+TINYSTL_BENCH(soa_dot_two_columns, 1 << 10, 1 << 16, 1 << 22);
+TINYSTL_BENCH(soa_sum_row_proxy, 1 << 10, 1 << 16, 1 << 22);
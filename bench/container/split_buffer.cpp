@@ -0,0 +1,110 @@
+#include "bench.h"
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include <tinystl/container/split_buffer.h>
+
+namespace {
+
+// split_buffer grows at both ends like a deque but keeps its elements
+// contiguous, so std::deque is the libstdc++ counterpart. Each std_ case is
+// registered right after its tinystl one.
+using string = std::string;
+
+template <class T>
+T make(std::size_t i) {
+  if constexpr (std::is_same_v<T, string>) {
+    return string(24, static_cast<char>('a' + i % 26));
+  } else {
+    return static_cast<T>(i);
+  }
+}
+
+template <class T>
+using buffer = tinystl::split_buffer<T, std::allocator<T>>;
+
+template <class Buffer>
+void push_back(tinystl::bench::state &st) {
+  while (st.keep_running()) {
+    Buffer b;
+    for (std::size_t i = 0; i < st.arg(); ++i) {
+      b.emplace_back(make<typename Buffer::value_type>(i));
+    }
+    tinystl::bench::do_not_optimize(b.front());
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+template <class Buffer>
+void push_front(tinystl::bench::state &st) {
+  while (st.keep_running()) {
+    Buffer b;
+    for (std::size_t i = 0; i < st.arg(); ++i) {
+      b.emplace_front(make<typename Buffer::value_type>(i));
+    }
+    tinystl::bench::do_not_optimize(b.back());
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+// A FIFO holding about 64 elements: the back keeps growing while the front
+// is consumed, so split_buffer recentres instead of reallocating.
+template <class Buffer>
+void fifo(tinystl::bench::state &st) {
+  while (st.keep_running()) {
+    Buffer b;
+    for (std::size_t i = 0; i < st.arg(); ++i) {
+      b.emplace_back(make<typename Buffer::value_type>(i));
+      if (b.size() > 64) {
+        b.pop_front();
+      }
+    }
+    tinystl::bench::do_not_optimize(b.back());
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+template <class Buffer>
+void iterate(tinystl::bench::state &st) {
+  Buffer b;
+  for (std::size_t i = 0; i < st.arg(); ++i) {
+    b.emplace_back(make<typename Buffer::value_type>(i));
+  }
+  while (st.keep_running()) {
+    std::size_t sum = 0;
+    for (const auto &value : b) {
+      if constexpr (std::is_same_v<typename Buffer::value_type, string>) {
+        sum += value.size();
+      } else {
+        sum += static_cast<std::size_t>(value);
+      }
+    }
+    tinystl::bench::do_not_optimize(sum);
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+} // namespace
+
+#define SPLIT_BUFFER_BENCH(op, type, ...)                                      \
+  static void split_buffer_##op##_##type(tinystl::bench::state &st) {          \
+    op<buffer<type>>(st);                                                      \
+  }                                                                            \
+  static void std_deque_##op##_##type(tinystl::bench::state &st) {             \
+    op<std::deque<type>>(st);                                                  \
+  }                                                                            \
+  TINYSTL_BENCH(split_buffer_##op##_##type, __VA_ARGS__);                      \
+  TINYSTL_BENCH(std_deque_##op##_##type, __VA_ARGS__)
+
+SPLIT_BUFFER_BENCH(push_back, int, 1 << 6, 1 << 10, 1 << 16);
+SPLIT_BUFFER_BENCH(push_back, string, 1 << 6, 1 << 10, 1 << 16);
+SPLIT_BUFFER_BENCH(push_front, int, 1 << 6, 1 << 10, 1 << 16);
+SPLIT_BUFFER_BENCH(push_front, string, 1 << 6, 1 << 10, 1 << 16);
+SPLIT_BUFFER_BENCH(fifo, int, 1 << 10, 1 << 16);
+SPLIT_BUFFER_BENCH(fifo, string, 1 << 10, 1 << 16);
+SPLIT_BUFFER_BENCH(iterate, int, 1 << 6, 1 << 10, 1 << 16);
+SPLIT_BUFFER_BENCH(iterate, string, 1 << 6, 1 << 10, 1 << 16);
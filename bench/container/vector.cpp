@@ -0,0 +1,162 @@
+#include "bench.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <tinystl/container/vector.h>
+
+namespace {
+
+// Every operation runs once on tinystl::vector and once on std::vector, for
+// a trivially copyable scalar, a heap-allocating string and a 64-byte
+// trivially copyable record. The std_ cases are registered right after the
+// tinystl ones, so the two read side by side.
+using string = std::string;
+
+struct blob {
+  std::uint64_t words[8];
+};
+
+template <class T>
+T make(std::size_t i) {
+  if constexpr (std::is_same_v<T, string>) {
+    return string(24, static_cast<char>('a' + i % 26));
+  } else if constexpr (std::is_same_v<T, blob>) {
+    return blob{{i, i + 1, i + 2, i + 3, i + 4, i + 5, i + 6, i + 7}};
+  } else {
+    return static_cast<T>(i);
+  }
+}
+
+template <class T>
+std::size_t weigh(const T &value) {
+  if constexpr (std::is_same_v<T, string>) {
+    return value.size();
+  } else if constexpr (std::is_same_v<T, blob>) {
+    return value.words[7];
+  } else {
+    return static_cast<std::size_t>(value);
+  }
+}
+
+template <class Vector>
+Vector filled(std::size_t n) {
+  Vector v;
+  v.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    v.push_back(make<typename Vector::value_type>(i));
+  }
+  return v;
+}
+
+template <class Vector>
+void push_back(tinystl::bench::state &st) {
+  while (st.keep_running()) {
+    Vector v;
+    for (std::size_t i = 0; i < st.arg(); ++i) {
+      v.push_back(make<typename Vector::value_type>(i));
+    }
+    tinystl::bench::do_not_optimize(v.data());
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+template <class Vector>
+void reserve_push_back(tinystl::bench::state &st) {
+  while (st.keep_running()) {
+    Vector v;
+    v.reserve(st.arg());
+    for (std::size_t i = 0; i < st.arg(); ++i) {
+      v.push_back(make<typename Vector::value_type>(i));
+    }
+    tinystl::bench::do_not_optimize(v.data());
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+// Builds the vector by inserting every element at the middle, so each
+// insert shifts half of what is already there.
+template <class Vector>
+void insert_middle(tinystl::bench::state &st) {
+  while (st.keep_running()) {
+    Vector v;
+    for (std::size_t i = 0; i < st.arg(); ++i) {
+      v.insert(v.begin() + v.size() / 2, make<typename Vector::value_type>(i));
+    }
+    tinystl::bench::do_not_optimize(v.data());
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+// Erases from the middle until half the elements are gone; building the
+// vector is not timed.
+template <class Vector>
+void erase_middle(tinystl::bench::state &st) {
+  while (st.keep_running()) {
+    st.pause_timing();
+    Vector v = filled<Vector>(st.arg());
+    st.resume_timing();
+    for (std::size_t i = 0; i < st.arg() / 2; ++i) {
+      v.erase(v.begin() + v.size() / 2);
+    }
+    tinystl::bench::do_not_optimize(v.data());
+  }
+  st.set_items_processed(st.iterations() * (st.arg() / 2));
+}
+
+template <class Vector>
+void copy(tinystl::bench::state &st) {
+  const Vector source = filled<Vector>(st.arg());
+  while (st.keep_running()) {
+    Vector v(source);
+    tinystl::bench::do_not_optimize(v.data());
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+template <class Vector>
+void iterate(tinystl::bench::state &st) {
+  const Vector v = filled<Vector>(st.arg());
+  while (st.keep_running()) {
+    std::size_t sum = 0;
+    for (const auto &value : v) {
+      sum += weigh(value);
+    }
+    tinystl::bench::do_not_optimize(sum);
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+} // namespace
+
+#define VECTOR_BENCH(op, type, ...)                                            \
+  static void vector_##op##_##type(tinystl::bench::state &st) {                \
+    op<tinystl::vector<type>>(st);                                             \
+  }                                                                            \
+  static void std_vector_##op##_##type(tinystl::bench::state &st) {            \
+    op<std::vector<type>>(st);                                                 \
+  }                                                                            \
+  TINYSTL_BENCH(vector_##op##_##type, __VA_ARGS__);                            \
+  TINYSTL_BENCH(std_vector_##op##_##type, __VA_ARGS__)
+
+VECTOR_BENCH(push_back, int, 1 << 6, 1 << 10, 1 << 16);
+VECTOR_BENCH(push_back, string, 1 << 6, 1 << 10, 1 << 16);
+VECTOR_BENCH(push_back, blob, 1 << 6, 1 << 10, 1 << 16);
+VECTOR_BENCH(reserve_push_back, int, 1 << 6, 1 << 10, 1 << 16);
+VECTOR_BENCH(reserve_push_back, string, 1 << 6, 1 << 10, 1 << 16);
+VECTOR_BENCH(reserve_push_back, blob, 1 << 6, 1 << 10, 1 << 16);
+VECTOR_BENCH(insert_middle, int, 1 << 6, 1 << 10, 1 << 13);
+VECTOR_BENCH(insert_middle, string, 1 << 6, 1 << 10, 1 << 13);
+VECTOR_BENCH(insert_middle, blob, 1 << 6, 1 << 10, 1 << 13);
+VECTOR_BENCH(erase_middle, int, 1 << 6, 1 << 10, 1 << 13);
+VECTOR_BENCH(erase_middle, string, 1 << 6, 1 << 10, 1 << 13);
+VECTOR_BENCH(erase_middle, blob, 1 << 6, 1 << 10, 1 << 13);
+VECTOR_BENCH(copy, int, 1 << 6, 1 << 10, 1 << 16);
+VECTOR_BENCH(copy, string, 1 << 6, 1 << 10, 1 << 16);
+VECTOR_BENCH(copy, blob, 1 << 6, 1 << 10, 1 << 16);
+VECTOR_BENCH(iterate, int, 1 << 6, 1 << 10, 1 << 16);
+VECTOR_BENCH(iterate, string, 1 << 6, 1 << 10, 1 << 16);
+VECTOR_BENCH(iterate, blob, 1 << 6, 1 << 10, 1 << 16);
@@ -0,0 +1,81 @@
+#include "bench.h"
+
+#include <cstddef>
+#include <string>
+
+#include <tinystl/container/vector.h>
+#include <tinystl/coroutine/batching_sink.h>
+#include <tinystl/coroutine/generator.h>
+
+namespace {
+
+// Every case materializes st.arg() strings short enough for the small
+// buffer, so the numbers compare the plumbing rather than allocation.
+tinystl::generator<std::string> strings(std::size_t n) {
+  co_yield tinystl::size_hint{n};
+  for (std::size_t i = 0; i < n; ++i) {
+    co_yield std::string(8, 'a');
+  }
+}
+
+tinystl::async_generator<std::string> async_strings(std::size_t n, bool with_hint) {
+  if (with_hint) {
+    co_yield tinystl::size_hint{n};
+  }
+  for (std::size_t i = 0; i < n; ++i) {
+    co_yield std::string(8, 'a');
+  }
+}
+
+// The baseline: no coroutine at all.
+void loop_push_back(tinystl::bench::state &st) {
+  while (st.keep_running()) {
+    tinystl::vector<std::string> out;
+    for (std::size_t i = 0; i < st.arg(); ++i) {
+      out.push_back(std::string(8, 'a'));
+    }
+    tinystl::bench::do_not_optimize(out.data());
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+void generator_push_back(tinystl::bench::state &st) {
+  while (st.keep_running()) {
+    tinystl::vector<std::string> out;
+    for (std::string &s : strings(st.arg())) {
+      out.push_back(std::move(s));
+    }
+    tinystl::bench::do_not_optimize(out.data());
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+// Batched appends, growing geometrically against reserving from the hint.
+void sink_without_hint(tinystl::bench::state &st) {
+  while (st.keep_running()) {
+    tinystl::vector<std::string> out;
+    tinystl::batching_sink sink(out);
+    auto gen = async_strings(st.arg(), false);
+    tinystl::sync_wait(sink.drain(gen));
+    tinystl::bench::do_not_optimize(out.data());
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+void sink_with_hint(tinystl::bench::state &st) {
+  while (st.keep_running()) {
+    tinystl::vector<std::string> out;
+    tinystl::batching_sink sink(out);
+    auto gen = async_strings(st.arg(), true);
+    tinystl::sync_wait(sink.drain(gen));
+    tinystl::bench::do_not_optimize(out.data());
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+} // namespace
+
+TINYSTL_BENCH(loop_push_back, 1 << 10, 1 << 18);
+TINYSTL_BENCH(generator_push_back, 1 << 10, 1 << 18);
+TINYSTL_BENCH(sink_without_hint, 1 << 10, 1 << 18);
+TINYSTL_BENCH(sink_with_hint, 1 << 10, 1 << 18);
@@ -0,0 +1,105 @@
+#include "bench.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <unistd.h>
+
+#include <tinystl/container/vector.h>
+#include <tinystl/io/binary.h>
+
+namespace {
+
+// The argument is the element count. Files are written once per size and
+// stay in the page cache, so the numbers are the CPU cost of a warm
+// reload, which is what dominates service startup.
+struct record {
+  std::uint64_t key;
+  double value;
+};
+
+class dataset {
+public:
+  explicit dataset(std::size_t n)
+    : m_path(
+        (std::filesystem::temp_directory_path() /
+         ("tinystl_bench_" + std::to_string(::getpid()) + "_" +
+          std::to_string(n) + ".bin"))
+          .string()
+      ) {
+    tinystl::vector<record> v;
+    v.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      v.push_back({i, i * 0.25});
+    }
+    tinystl::io::save(m_path, v);
+  }
+  dataset(const dataset &) = delete;
+  dataset &operator=(const dataset &) = delete;
+  ~dataset() { std::remove(m_path.c_str()); }
+
+  const std::string &path() const noexcept { return m_path; }
+
+private:
+  std::string m_path;
+};
+
+// Reads the payload one element at a time through a stream, the way the
+// data was loaded before.
+void stream_read_records(tinystl::bench::state &st) {
+  dataset data(st.arg());
+  while (st.keep_running()) {
+    std::ifstream in(data.path(), std::ios::binary);
+    in.seekg(64);
+    tinystl::vector<record> v;
+    record r;
+    while (in.read(reinterpret_cast<char *>(&r), sizeof r)) {
+      v.push_back(r);
+    }
+    tinystl::bench::do_not_optimize(v.data());
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+void binary_load(tinystl::bench::state &st) {
+  dataset data(st.arg());
+  while (st.keep_running()) {
+    tinystl::vector<record> v = tinystl::io::load<record>(data.path());
+    tinystl::bench::do_not_optimize(v.data());
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+// Opens the view and sums one field, touching every page once.
+void mapped_view_scan(tinystl::bench::state &st) {
+  dataset data(st.arg());
+  while (st.keep_running()) {
+    tinystl::io::mapped_view<record> view(data.path());
+    std::uint64_t sum = 0;
+    for (const record &r : view) {
+      sum += r.key;
+    }
+    tinystl::bench::do_not_optimize(sum);
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+void mapped_view_open(tinystl::bench::state &st) {
+  dataset data(st.arg());
+  while (st.keep_running()) {
+    tinystl::io::mapped_view<record> view(data.path());
+    tinystl::bench::do_not_optimize(view.data());
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+} // namespace
+
+TINYSTL_BENCH(stream_read_records, 1 << 10, 1 << 16, 1 << 20);
+TINYSTL_BENCH(binary_load, 1 << 10, 1 << 16, 1 << 20);
+TINYSTL_BENCH(mapped_view_scan, 1 << 10, 1 << 16, 1 << 20);
+TINYSTL_BENCH(mapped_view_open, 1 << 10, 1 << 16, 1 << 20);
@@ -0,0 +1,343 @@
+#include "bench.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <optional>
+#include <thread>
+
+namespace tinystl::bench {
+
+namespace {
+
+struct options {
+  const char *filter = nullptr;
+  const char *json = nullptr;
+  double min_time = 0.1;
+  std::size_t repetitions = 1;
+  bool counters = false;
+};
+
+// With repetitions, ns_per_iter and items_per_sec come from the median run
+// and mad_ns is the median absolute deviation of the runs, a spread measure
+// that a single noisy run cannot inflate. Counter values are per iteration,
+// taken from the calibration run.
+struct result {
+  std::string name;
+  std::size_t arg;
+  std::size_t iterations;
+  double ns_per_iter;
+  double items_per_sec;
+  double mad_ns;
+  std::vector<double> samples_ns;
+  std::string label;
+  double items_per_iter;
+  counter_values counters;
+};
+
+options parse_options(int argc, char **argv) {
+  options opts;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+      opts.filter = argv[++i];
+    } else if (std::strcmp(argv[i], "--min-time") == 0 && i + 1 < argc) {
+      opts.min_time = std::atof(argv[++i]);
+    } else if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+      opts.json = argv[++i];
+    } else if (std::strcmp(argv[i], "--repetitions") == 0 && i + 1 < argc) {
+      opts.repetitions = std::max(1, std::atoi(argv[++i]));
+    } else if (std::strcmp(argv[i], "--counters") == 0) {
+      opts.counters = true;
+    } else {
+      std::fprintf(
+        stderr,
+        "usage: %s [--filter <substring>] [--min-time <seconds>] "
+        "[--repetitions <n>] [--counters] [--json <file>]\n",
+        argv[0]
+      );
+      std::exit(EXIT_FAILURE);
+    }
+  }
+  return opts;
+}
+
+// Grow the iteration count until one run lasts at least min_time seconds.
+state measure(
+  const benchmark &b, std::size_t arg, double min_time,
+  perf_counters *counters
+) {
+  std::size_t iterations = 1;
+  for (;;) {
+    state st(arg, iterations, counters);
+    b.func(st);
+
+    double elapsed = st.elapsed_seconds();
+    if (elapsed >= min_time || iterations >= (std::size_t(1) << 40)) {
+      return st;
+    }
+
+    double scale = elapsed > 0.0 ? 1.4 * min_time / elapsed : 100.0;
+    if (scale > 100.0) {
+      scale = 100.0;
+    }
+    std::size_t next = static_cast<std::size_t>(iterations * scale);
+    iterations = next > iterations ? next : iterations + 1;
+  }
+}
+
+double median(std::vector<double> values) {
+  std::sort(values.begin(), values.end());
+  const std::size_t mid = values.size() / 2;
+  return values.size() % 2 != 0 ? values[mid]
+                                 : (values[mid - 1] + values[mid]) / 2;
+}
+
+// Calibrates the iteration count once, then repeats the case with that
+// count so that every sample measures the same amount of work. Only the
+// calibration runs are counted; the repetitions stay undisturbed.
+result run_case(
+  const benchmark &b, const std::string &name, std::size_t arg,
+  const options &opts, perf_counters *counters
+) {
+  state first = measure(b, arg, opts.min_time, counters);
+  const std::size_t iterations = first.iterations();
+  const double items_per_iter = static_cast<double>(first.items_processed()) /
+                                static_cast<double>(iterations);
+
+  std::vector<double> samples{first.elapsed_seconds() * 1e9 / iterations};
+  for (std::size_t r = 1; r < opts.repetitions; ++r) {
+    state st(arg, iterations);
+    b.func(st);
+    samples.push_back(st.elapsed_seconds() * 1e9 / iterations);
+  }
+
+  const double ns_per_iter = median(samples);
+  std::vector<double> deviations;
+  for (double s : samples) {
+    deviations.push_back(std::fabs(s - ns_per_iter));
+  }
+  const double items_per_sec =
+    ns_per_iter > 0.0 ? items_per_iter * 1e9 / ns_per_iter : 0.0;
+  counter_values per_iter = first.counters();
+  for (auto &value : per_iter) {
+    if (value) {
+      *value /= static_cast<double>(iterations);
+    }
+  }
+  return {
+    name,
+    arg,
+    iterations,
+    ns_per_iter,
+    items_per_sec,
+    median(deviations),
+    std::move(samples),
+    first.label(),
+    items_per_iter,
+    per_iter
+  };
+}
+
+// Metrics derived from the counters, empty where an input is missing:
+// instructions per cycle, then every miss counter per processed item, or
+// per iteration for cases that do not report items.
+struct derived_metric {
+  std::string name;
+  std::optional<double> value;
+};
+
+std::vector<derived_metric> derive(const result &r) {
+  auto get = [&](counter c) { return r.counters[static_cast<std::size_t>(c)]; };
+  std::vector<derived_metric> metrics;
+
+  std::optional<double> ipc;
+  if (get(counter::instructions) && get(counter::cycles) &&
+      *get(counter::cycles) > 0.0) {
+    ipc = *get(counter::instructions) / *get(counter::cycles);
+  }
+  metrics.push_back({"ipc", ipc});
+
+  const bool per_item = r.items_per_iter > 0.0;
+  for (counter c :
+       {counter::l1d_misses, counter::llc_misses, counter::branch_misses,
+        counter::dtlb_misses, counter::page_faults}) {
+    std::optional<double> value = get(c);
+    if (value && per_item) {
+      *value /= r.items_per_iter;
+    }
+    metrics.push_back(
+      {std::string(counter_names[static_cast<std::size_t>(c)]) +
+         (per_item ? "_per_item" : "_per_iter"),
+       value}
+    );
+  }
+  return metrics;
+}
+
+void write_json_number(std::FILE *out, const std::optional<double> &value) {
+  if (value) {
+    std::fprintf(out, "%.6g", *value);
+  } else {
+    std::fprintf(out, "null");
+  }
+}
+
+void write_json_string(std::FILE *out, const std::string &s) {
+  std::fputc('"', out);
+  for (char c : s) {
+    if (c == '"' || c == '\\') {
+      std::fprintf(out, "\\%c", c);
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      std::fprintf(out, "\\u%04x", c);
+    } else {
+      std::fputc(c, out);
+    }
+  }
+  std::fputc('"', out);
+}
+
+// One object per case, in run order, so that two runs of the same binary
+// can be diffed or joined on "name". "-" writes to stdout.
+bool write_json(
+  const char *path, const options &opts, const std::vector<result> &results
+) {
+  const bool to_stdout = std::strcmp(path, "-") == 0;
+  std::FILE *out = to_stdout ? stdout : std::fopen(path, "w");
+  if (out == nullptr) {
+    std::perror(path);
+    return false;
+  }
+
+  std::fprintf(out, "{\n  \"context\": {\n    \"compiler\": ");
+#if defined(__VERSION__)
+  write_json_string(out, __VERSION__);
+#else
+  write_json_string(out, "unknown");
+#endif
+#if defined(NDEBUG)
+  std::fprintf(out, ",\n    \"assertions\": false");
+#else
+  std::fprintf(out, ",\n    \"assertions\": true");
+#endif
+  std::fprintf(
+    out,
+    ",\n    \"hardware_concurrency\": %u,\n    \"repetitions\": %zu\n  },"
+    "\n  \"benchmarks\": [",
+    std::thread::hardware_concurrency(), opts.repetitions
+  );
+  for (std::size_t i = 0; i < results.size(); ++i) {
+    const result &r = results[i];
+    std::fprintf(out, "%s\n    {\"name\": ", i == 0 ? "" : ",");
+    write_json_string(out, r.name);
+    std::fprintf(
+      out,
+      ", \"arg\": %zu, \"iterations\": %zu, \"ns_per_iter\": %.6g, "
+      "\"items_per_sec\": %.6g, \"label\": ",
+      r.arg, r.iterations, r.ns_per_iter, r.items_per_sec
+    );
+    write_json_string(out, r.label);
+    std::fprintf(out, ", \"mad_ns\": %.6g, \"samples_ns\": [", r.mad_ns);
+    for (std::size_t k = 0; k < r.samples_ns.size(); ++k) {
+      std::fprintf(out, "%s%.6g", k == 0 ? "" : ", ", r.samples_ns[k]);
+    }
+    std::fprintf(out, "]");
+    if (opts.counters) {
+      std::fprintf(out, ", \"counters\": {");
+      for (std::size_t c = 0; c < counter_count; ++c) {
+        std::fprintf(
+          out, "%s\"%s\": ", c == 0 ? "" : ", ", counter_names[c].data()
+        );
+        write_json_number(out, r.counters[c]);
+      }
+      std::fprintf(out, "}, \"derived\": {");
+      const std::vector<derived_metric> metrics = derive(r);
+      for (std::size_t m = 0; m < metrics.size(); ++m) {
+        std::fprintf(
+          out, "%s\"%s\": ", m == 0 ? "" : ", ", metrics[m].name.c_str()
+        );
+        write_json_number(out, metrics[m].value);
+      }
+      std::fprintf(out, "}");
+    }
+    std::fprintf(out, "}");
+  }
+  std::fprintf(out, "\n  ]\n}\n");
+
+  return to_stdout ? std::fflush(out) == 0 : std::fclose(out) == 0;
+}
+
+} // namespace
+
+int run(int argc, char **argv) {
+  options opts = parse_options(argc, argv);
+  // Keep stdout clean for the JSON when it goes there.
+  std::FILE *table = opts.json != nullptr && std::strcmp(opts.json, "-") == 0
+                       ? stderr
+                       : stdout;
+  std::vector<result> results;
+
+  std::optional<perf_counters> counters;
+  if (opts.counters) {
+    counters.emplace();
+    if (!counters->any_available()) {
+      std::fprintf(
+        stderr, "note: no performance counters are available "
+                "(check perf_event_paranoid); reporting time only\n"
+      );
+    }
+  }
+
+  std::fprintf(
+    table, "%-48s %14s %14s %16s\n", "benchmark", "iterations", "ns/iter",
+    "items/s"
+  );
+  for (const benchmark &b : registry()) {
+    for (std::size_t arg : b.args) {
+      std::string name = b.name + "/" + std::to_string(arg);
+      if (opts.filter != nullptr && name.find(opts.filter) == std::string::npos) {
+        continue;
+      }
+
+      result r = run_case(b, name, arg, opts, counters ? &*counters : nullptr);
+      std::string spread;
+      if (opts.repetitions > 1 && r.ns_per_iter > 0.0) {
+        char buf[32];
+        std::snprintf(
+          buf, sizeof buf, "+-%.1f%% ", 100.0 * r.mad_ns / r.ns_per_iter
+        );
+        spread = buf;
+      }
+      std::fprintf(
+        table, "%-48s %14zu %14.1f %16.4g %s%s\n", name.c_str(), r.iterations,
+        r.ns_per_iter, r.items_per_sec, spread.c_str(), r.label.c_str()
+      );
+      if (counters) {
+        std::string line;
+        for (const derived_metric &m : derive(r)) {
+          if (m.value) {
+            char buf[64];
+            std::snprintf(
+              buf, sizeof buf, "  %s %.4g", m.name.c_str(), *m.value
+            );
+            line += buf;
+          }
+        }
+        if (!line.empty()) {
+          std::fprintf(table, "%-48s%s\n", "", line.c_str());
+        }
+      }
+      results.push_back(std::move(r));
+    }
+  }
+
+  if (opts.json != nullptr && !write_json(opts.json, opts, results)) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
+
+} // namespace tinystl::bench
+
+int main(int argc, char **argv) { return tinystl::bench::run(argc, argv); }
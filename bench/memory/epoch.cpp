@@ -0,0 +1,143 @@
+#include "bench.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <tinystl/memory/epoch.h>
+
+namespace {
+
+// For the threaded cases the argument is the thread count and every run does
+// the same total work, so the numbers read as throughput under growing
+// contention. Threads are started inside the timed region, which is small
+// next to the operations.
+constexpr std::size_t operations = 1 << 18;
+
+struct node {
+  std::uint64_t value;
+};
+
+template <class Body>
+void run_threads(std::size_t threads, Body body) {
+  std::vector<std::thread> pool;
+  for (std::size_t t = 0; t < threads; ++t) {
+    pool.emplace_back([&body, threads] {
+      for (std::size_t i = 0; i < operations / threads; ++i) {
+        body();
+      }
+    });
+  }
+  for (auto &thread : pool) {
+    thread.join();
+  }
+}
+
+// The fixed cost a reader pays to protect one operation.
+void pin_unpin(tinystl::bench::state &st) {
+  tinystl::epoch_domain domain;
+  while (st.keep_running()) {
+    run_threads(st.arg(), [&] {
+      auto guard = domain.pin();
+      tinystl::bench::do_not_optimize(guard);
+    });
+  }
+  st.set_items_processed(st.iterations() * operations);
+}
+
+// The same protection taken as a reader lock.
+void shared_lock_unlock(tinystl::bench::state &st) {
+  std::shared_mutex mutex;
+  while (st.keep_running()) {
+    run_threads(st.arg(), [&] {
+      std::shared_lock lock(mutex);
+      tinystl::bench::do_not_optimize(lock);
+    });
+  }
+  st.set_items_processed(st.iterations() * operations);
+}
+
+// Readers dereference a pointer that one writer keeps replacing; the writer
+// retires the old node instead of waiting for the readers.
+void epoch_read_while_replacing(tinystl::bench::state &st) {
+  tinystl::epoch_domain domain;
+  std::atomic<node *> shared{new node{0}};
+  while (st.keep_running()) {
+    std::atomic<bool> done{false};
+    std::thread writer([&] {
+      for (std::uint64_t i = 1; !done.load(std::memory_order_relaxed); ++i) {
+        auto guard = domain.pin();
+        guard.retire(shared.exchange(new node{i}, std::memory_order_acq_rel));
+      }
+    });
+    run_threads(st.arg(), [&] {
+      auto guard = domain.pin();
+      tinystl::bench::do_not_optimize(shared.load(std::memory_order_acquire)->value);
+    });
+    done = true;
+    writer.join();
+  }
+  st.set_items_processed(st.iterations() * operations);
+  delete shared.load();
+}
+
+void locked_read_while_replacing(tinystl::bench::state &st) {
+  std::shared_mutex mutex;
+  node *shared = new node{0};
+  while (st.keep_running()) {
+    std::atomic<bool> done{false};
+    std::thread writer([&] {
+      for (std::uint64_t i = 1; !done.load(std::memory_order_relaxed); ++i) {
+        node *fresh = new node{i};
+        std::unique_lock lock(mutex);
+        delete std::exchange(shared, fresh);
+      }
+    });
+    run_threads(st.arg(), [&] {
+      std::shared_lock lock(mutex);
+      tinystl::bench::do_not_optimize(shared->value);
+    });
+    done = true;
+    writer.join();
+  }
+  st.set_items_processed(st.iterations() * operations);
+  delete shared;
+}
+
+// The price of deferring a free: retire against deleting on the spot.
+void retire_node(tinystl::bench::state &st) {
+  tinystl::epoch_domain domain;
+  while (st.keep_running()) {
+    auto guard = domain.pin();
+    for (std::size_t i = 0; i < st.arg(); ++i) {
+      guard.retire(new node{i});
+    }
+    guard.flush();
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+void delete_node(tinystl::bench::state &st) {
+  while (st.keep_running()) {
+    for (std::size_t i = 0; i < st.arg(); ++i) {
+      node *p = new node{i};
+      tinystl::bench::do_not_optimize(p);
+      delete p;
+    }
+  }
+  st.set_items_processed(st.iterations() * st.arg());
+}
+
+} // namespace
+
+TINYSTL_BENCH(pin_unpin, 1, 2, 4, 8, 16, 32, 64);
+TINYSTL_BENCH(shared_lock_unlock, 1, 2, 4, 8, 16, 32, 64);
+TINYSTL_BENCH(epoch_read_while_replacing, 1, 2, 4, 8, 16);
+TINYSTL_BENCH(locked_read_while_replacing, 1, 2, 4, 8, 16);
+TINYSTL_BENCH(retire_node, 1 << 12);
+TINYSTL_BENCH(delete_node, 1 << 12);
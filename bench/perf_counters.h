@@ -0,0 +1,182 @@
+#pragma once
+
+// Hardware performance counters for the benchmark harness, read through
+// Linux perf_event_open. Each counter is opened on its own, so one that the
+// CPU, the kernel (perf_event_paranoid) or a container refuses is reported
+// as unavailable instead of disabling the rest. Elsewhere none are
+// available and every call is a no-op.
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace tinystl::bench {
+
+enum class counter : std::size_t {
+  cycles,
+  instructions,
+  l1d_misses,
+  llc_misses,
+  branch_misses,
+  dtlb_misses,
+  page_faults, // a software event, so it also counts inside most VMs
+};
+
+inline constexpr std::size_t counter_count = 7;
+
+inline constexpr std::array<std::string_view, counter_count> counter_names = {
+  "cycles",        "instructions", "l1d_misses", "llc_misses",
+  "branch_misses", "dtlb_misses",  "page_faults",
+};
+
+// Totals over one measured run; empty where a counter is unavailable.
+using counter_values = std::array<std::optional<double>, counter_count>;
+
+class perf_counters {
+public:
+  perf_counters() {
+#if defined(__linux__)
+    for (std::size_t i = 0; i < counter_count; ++i) {
+      m_fds[i] = open(static_cast<counter>(i));
+    }
+#endif
+  }
+
+  ~perf_counters() {
+#if defined(__linux__)
+    for (int fd : m_fds) {
+      if (fd >= 0) {
+        ::close(fd);
+      }
+    }
+#endif
+  }
+
+  perf_counters(const perf_counters &) = delete;
+  perf_counters &operator=(const perf_counters &) = delete;
+
+  bool available(counter c) const noexcept {
+    return m_fds[static_cast<std::size_t>(c)] >= 0;
+  }
+
+  bool any_available() const noexcept {
+    for (int fd : m_fds) {
+      if (fd >= 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void start() noexcept {
+    this->control(action::reset);
+    this->control(action::enable);
+  }
+  void pause() noexcept { this->control(action::disable); }
+  void resume() noexcept { this->control(action::enable); }
+
+  // Stops counting and returns the totals since start(). When the kernel
+  // had to multiplex the counters, each value is scaled up by the fraction
+  // of the run it was actually counting.
+  counter_values stop() noexcept {
+    this->control(action::disable);
+    counter_values values;
+#if defined(__linux__)
+    for (std::size_t i = 0; i < counter_count; ++i) {
+      std::uint64_t data[3] = {}; // value, time enabled, time running
+      if (m_fds[i] < 0 || ::read(m_fds[i], data, sizeof data) != sizeof data ||
+          data[2] == 0) {
+        continue;
+      }
+      values[i] = static_cast<double>(data[0]) * static_cast<double>(data[1]) /
+                  static_cast<double>(data[2]);
+    }
+#endif
+    return values;
+  }
+
+private:
+  enum class action { reset, enable, disable };
+
+#if defined(__linux__)
+  static std::uint64_t cache_event(
+    std::uint64_t cache, std::uint64_t op, std::uint64_t result
+  ) {
+    return cache | (op << 8) | (result << 16);
+  }
+
+  static int open(counter c) {
+    perf_event_attr attr{};
+    attr.size = sizeof attr;
+    switch (c) {
+    case counter::cycles:
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_CPU_CYCLES;
+      break;
+    case counter::instructions:
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+      break;
+    case counter::l1d_misses:
+      attr.type = PERF_TYPE_HW_CACHE;
+      attr.config = cache_event(
+        PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ,
+        PERF_COUNT_HW_CACHE_RESULT_MISS
+      );
+      break;
+    case counter::llc_misses:
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_CACHE_MISSES;
+      break;
+    case counter::branch_misses:
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+      break;
+    case counter::dtlb_misses:
+      attr.type = PERF_TYPE_HW_CACHE;
+      attr.config = cache_event(
+        PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_OP_READ,
+        PERF_COUNT_HW_CACHE_RESULT_MISS
+      );
+      break;
+    case counter::page_faults:
+      attr.type = PERF_TYPE_SOFTWARE;
+      attr.config = PERF_COUNT_SW_PAGE_FAULTS;
+      break;
+    }
+    attr.disabled = 1;
+    attr.exclude_kernel = 1; // allowed up to perf_event_paranoid 2
+    attr.exclude_hv = 1;
+    attr.inherit = 1; // include threads started by the benchmark
+    attr.read_format =
+      PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+  }
+
+  void control(action a) noexcept {
+    const unsigned long request = a == action::reset    ? PERF_EVENT_IOC_RESET
+                                  : a == action::enable ? PERF_EVENT_IOC_ENABLE
+                                                        : PERF_EVENT_IOC_DISABLE;
+    for (int fd : m_fds) {
+      if (fd >= 0) {
+        ::ioctl(fd, request, 0);
+      }
+    }
+  }
+#else
+  void control(action) noexcept {}
+#endif
+
+  std::array<int, counter_count> m_fds = {-1, -1, -1, -1, -1, -1, -1};
+};
+
+} // namespace tinystl::bench
@@ -0,0 +1,66 @@
+#pragma once
+
+// Shared pieces of the differential fuzz targets. A target decodes its
+// input into a sequence of operations, applies each one to a tinystl
+// container and to the std:: container it models, and aborts as soon as
+// the two disagree; the sanitizers catch what the comparison cannot see.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+namespace tinystl::fuzz {
+
+// Reads the input front to back. Once it is exhausted every read returns
+// zero, so each input decodes to a finite operation sequence.
+class input {
+public:
+  input(const std::uint8_t *data, std::size_t size) noexcept
+    : m_data(data), m_size(size) {}
+
+  bool empty() const noexcept { return m_pos == m_size; }
+
+  std::uint8_t byte() noexcept { return m_pos < m_size ? m_data[m_pos++] : 0; }
+
+  // A number in [0, bound].
+  std::size_t index(std::size_t bound) noexcept {
+    std::size_t n = this->byte();
+    n = n << 8 | this->byte();
+    return n % (bound + 1);
+  }
+
+private:
+  const std::uint8_t *m_data;
+  std::size_t m_size;
+  std::size_t m_pos = 0;
+};
+
+template <class T>
+T make(input &in);
+
+template <>
+inline int make<int>(input &in) {
+  return static_cast<int>(in.byte()) - 128;
+}
+
+// Long strings own heap memory, so a leaked, doubly destroyed or
+// use-after-moved element shows up under ASan.
+template <>
+inline std::string make<std::string>(input &in) {
+  std::uint8_t b = in.byte();
+  std::size_t length = (b & 1) ? 24 + b % 8 : b % 8;
+  return std::string(length, static_cast<char>('a' + b % 26));
+}
+
+[[noreturn]] inline void
+mismatch(const char *what, const char *file, int line) noexcept {
+  std::fprintf(stderr, "%s:%d: tinystl and std disagree: %s\n", file, line, what);
+  std::abort();
+}
+
+} // namespace tinystl::fuzz
+
+#define TINYSTL_FUZZ_CHECK(cond)                                               \
+  ((cond) ? void(0) : ::tinystl::fuzz::mismatch(#cond, __FILE__, __LINE__))
@@ -0,0 +1,122 @@
+// Random operation sequences on tinystl::split_buffer, mirrored on
+// std::deque, which grows at both ends the same way.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "fuzz.h"
+#include "tinystl/container/split_buffer.h"
+
+namespace {
+
+using tinystl::fuzz::input;
+using tinystl::fuzz::make;
+
+template <class T>
+using buffer = tinystl::split_buffer<T, std::allocator<T>>;
+
+template <class T>
+void check(const buffer<T> &b, const std::deque<T> &d) {
+  TINYSTL_FUZZ_CHECK(b.size() == d.size());
+  TINYSTL_FUZZ_CHECK(b.empty() == d.empty());
+  TINYSTL_FUZZ_CHECK(b.capacity() >= b.size());
+  TINYSTL_FUZZ_CHECK(b.front_spare() + b.size() + b.back_spare() == b.capacity());
+  TINYSTL_FUZZ_CHECK(std::equal(b.begin(), b.end(), d.begin(), d.end()));
+  if (!d.empty()) {
+    TINYSTL_FUZZ_CHECK(b.front() == d.front());
+    TINYSTL_FUZZ_CHECK(b.back() == d.back());
+  }
+}
+
+template <class T>
+void run(const std::uint8_t *data, std::size_t size) {
+  input in(data, size);
+  buffer<T> b;
+  std::deque<T> d;
+
+  while (!in.empty()) {
+    const std::size_t op = in.byte() % 9;
+    const std::size_t count = in.index(16);
+    const T value = make<T>(in);
+
+    switch (op) {
+    case 0:
+      for (std::size_t i = 0; i <= count; ++i) {
+        b.emplace_back(value);
+        d.emplace_back(value);
+      }
+      break;
+    case 1:
+      for (std::size_t i = 0; i <= count; ++i) {
+        b.emplace_front(value);
+        d.emplace_front(value);
+      }
+      break;
+    case 2:
+      for (std::size_t i = 0; i <= count && !d.empty(); ++i) {
+        b.pop_back();
+        d.pop_back();
+      }
+      break;
+    case 3:
+      for (std::size_t i = 0; i <= count && !d.empty(); ++i) {
+        b.pop_front();
+        d.pop_front();
+      }
+      break;
+    case 4: // alternate ends, the pattern that slides elements the most
+      for (std::size_t i = 0; i <= count; ++i) {
+        if (i % 2 == 0) {
+          b.emplace_back(value);
+          d.emplace_back(value);
+        } else {
+          b.emplace_front(value);
+          d.emplace_front(value);
+        }
+      }
+      break;
+    case 5:
+      b.shrink_to_fit();
+      d.shrink_to_fit();
+      break;
+    case 6:
+      b.clear();
+      d.clear();
+      break;
+    case 7: {
+      buffer<T> moved(std::move(b));
+      check(moved, d);
+      b = std::move(moved);
+      break;
+    }
+    case 8: {
+      buffer<T> other;
+      std::deque<T> std_other;
+      for (std::size_t i = 0; i < count; ++i) {
+        other.emplace_back(value);
+        std_other.emplace_back(value);
+      }
+      b.swap(other);
+      d.swap(std_other);
+      check(other, std_other);
+      break;
+    }
+    }
+
+    check(b, d);
+  }
+}
+
+} // namespace
+
+extern "C" int
+LLVMFuzzerTestOneInput(const std::uint8_t *data, std::size_t size) {
+  run<int>(data, size);
+  run<std::string>(data, size);
+  return 0;
+}
@@ -0,0 +1,76 @@
+// Drives a fuzz target where libFuzzer is not available (e.g. with gcc).
+// Arguments follow libFuzzer's: files or directories are replayed as
+// inputs, and -runs=N additionally feeds N random inputs, reproducible
+// with -seed=S and at most -max_len=L bytes long.
+//
+//   fuzz_vector_differential crash-1234
+//   fuzz_vector_differential -runs=100000 -seed=7
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t *data, std::size_t size);
+
+namespace {
+
+void replay(const std::filesystem::path &path) {
+  std::ifstream file(path, std::ios::binary);
+  std::vector<std::uint8_t> bytes(
+    (std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>()
+  );
+  std::fprintf(stderr, "running %s (%zu bytes)\n", path.c_str(), bytes.size());
+  LLVMFuzzerTestOneInput(bytes.data(), bytes.size());
+}
+
+bool flag(const std::string &arg, const char *name, unsigned long &value) {
+  std::string prefix = std::string("-") + name + "=";
+  if (arg.compare(0, prefix.size(), prefix) != 0) {
+    return false;
+  }
+  value = std::strtoul(arg.c_str() + prefix.size(), nullptr, 10);
+  return true;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  unsigned long runs = 0;
+  unsigned long seed = 0;
+  unsigned long max_len = 512;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (flag(arg, "runs", runs) || flag(arg, "seed", seed) ||
+        flag(arg, "max_len", max_len)) {
+      continue;
+    }
+    if (std::filesystem::is_directory(arg)) {
+      for (const auto &entry : std::filesystem::directory_iterator(arg)) {
+        replay(entry.path());
+      }
+    } else {
+      replay(arg);
+    }
+  }
+
+  std::mt19937_64 rng(seed);
+  std::vector<std::uint8_t> bytes;
+  for (unsigned long run = 0; run < runs; ++run) {
+    bytes.resize(rng() % (max_len + 1));
+    for (std::uint8_t &b : bytes) {
+      b = static_cast<std::uint8_t>(rng());
+    }
+    LLVMFuzzerTestOneInput(bytes.data(), bytes.size());
+  }
+  if (runs > 0) {
+    std::fprintf(stderr, "%lu random inputs passed (seed %lu)\n", runs, seed);
+  }
+  return 0;
+}
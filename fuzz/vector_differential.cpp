@@ -0,0 +1,254 @@
+// Random operation sequences on tinystl::vector, mirrored on std::vector.
+// Each input runs once with int elements, which take the trivially
+// copyable paths, and once with std::string.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "fuzz.h"
+#include "tinystl/container/vector.h"
+
+namespace {
+
+using tinystl::fuzz::input;
+using tinystl::fuzz::make;
+
+// Walks a range once, to reach the input-iterator overloads.
+template <class T>
+class single_pass {
+public:
+  using iterator_category = std::input_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const T *;
+  using reference = const T &;
+
+  single_pass() = default;
+  explicit single_pass(const T *p) : m_p(p) {}
+
+  reference operator*() const { return *m_p; }
+  single_pass &operator++() {
+    ++m_p;
+    return *this;
+  }
+  single_pass operator++(int) { return single_pass(m_p++); }
+
+  friend bool operator==(single_pass a, single_pass b) {
+    return a.m_p == b.m_p;
+  }
+
+private:
+  const T *m_p = nullptr;
+};
+
+// Taken after the call: an insertion may reallocate, so begin() must not be
+// read before it.
+template <class Container, class Iterator>
+std::ptrdiff_t offset(const Container &c, Iterator it) {
+  return it - c.begin();
+}
+
+template <class T>
+void check(const tinystl::vector<T> &v, const std::vector<T> &s) {
+  TINYSTL_FUZZ_CHECK(v.size() == s.size());
+  TINYSTL_FUZZ_CHECK(v.empty() == s.empty());
+  TINYSTL_FUZZ_CHECK(v.capacity() >= v.size());
+  TINYSTL_FUZZ_CHECK(std::equal(v.begin(), v.end(), s.begin(), s.end()));
+}
+
+template <class T>
+void run(const std::uint8_t *data, std::size_t size) {
+  input in(data, size);
+  tinystl::vector<T> v;
+  std::vector<T> s;
+
+  while (!in.empty()) {
+    const std::size_t op = in.byte() % 28;
+    const std::size_t pos = in.index(s.size());
+    const std::size_t count = in.index(16);
+    const bool has_element = pos < s.size();
+    std::vector<T> source;
+    for (std::size_t i = 0; i < count; ++i) {
+      source.push_back(make<T>(in));
+    }
+    const T value = make<T>(in);
+
+    // Offsets of the iterators returned by insert, emplace and erase.
+    std::ptrdiff_t got = 0;
+    std::ptrdiff_t want = 0;
+    switch (op) {
+    case 0:
+      v.push_back(value);
+      s.push_back(value);
+      break;
+    case 1: // an element of the vector itself, which may move while growing
+      if (has_element) {
+        v.push_back(v[pos]);
+        s.push_back(s[pos]);
+      }
+      break;
+    case 2:
+      v.emplace_back(value);
+      s.emplace_back(value);
+      break;
+    case 3:
+      if (!s.empty()) {
+        v.pop_back();
+        s.pop_back();
+      }
+      break;
+    case 4:
+      got = offset(v, v.insert(v.begin() + pos, value));
+      want = offset(s, s.insert(s.begin() + pos, value));
+      break;
+    case 5:
+      if (has_element) {
+        std::size_t from = in.index(s.size() - 1);
+        got = offset(v, v.insert(v.begin() + pos, v[from]));
+        want = offset(s, s.insert(s.begin() + pos, s[from]));
+      }
+      break;
+    case 6: {
+      T a = value;
+      T b = value;
+      got = offset(v, v.insert(v.begin() + pos, std::move(a)));
+      want = offset(s, s.insert(s.begin() + pos, std::move(b)));
+      break;
+    }
+    case 7:
+      got = offset(v, v.insert(v.begin() + pos, count, value));
+      want = offset(s, s.insert(s.begin() + pos, count, value));
+      break;
+    case 8:
+      if (has_element) {
+        std::size_t from = in.index(s.size() - 1);
+        got = offset(v, v.insert(v.begin() + pos, count, v[from]));
+        want = offset(s, s.insert(s.begin() + pos, count, s[from]));
+      }
+      break;
+    case 9:
+      got = offset(v, v.insert(v.begin() + pos, source.begin(), source.end()));
+      want =
+        offset(s, s.insert(s.begin() + pos, source.begin(), source.end()));
+      break;
+    case 10: {
+      single_pass<T> first(source.data());
+      single_pass<T> last(source.data() + source.size());
+      got = offset(v, v.insert(v.begin() + pos, first, last));
+      want = offset(s, s.insert(s.begin() + pos, first, last));
+      break;
+    }
+    case 11:
+      got = offset(v, v.emplace(v.begin() + pos, value));
+      want = offset(s, s.emplace(s.begin() + pos, value));
+      break;
+    case 12:
+      if (has_element) {
+        got = offset(v, v.erase(v.begin() + pos));
+        want = offset(s, s.erase(s.begin() + pos));
+      }
+      break;
+    case 13: {
+      std::size_t last = pos + in.index(s.size() - pos);
+      got = offset(v, v.erase(v.begin() + pos, v.begin() + last));
+      want = offset(s, s.erase(s.begin() + pos, s.begin() + last));
+      break;
+    }
+    case 14:
+      v.resize(count * 4);
+      s.resize(count * 4);
+      break;
+    case 15:
+      v.resize(count * 4, value);
+      s.resize(count * 4, value);
+      break;
+    case 16:
+      v.reserve(count * 8);
+      s.reserve(count * 8);
+      break;
+    case 17:
+      v.shrink_to_fit();
+      s.shrink_to_fit();
+      break;
+    case 18:
+      v.assign(count, value);
+      s.assign(count, value);
+      break;
+    case 19:
+      v.assign(source.begin(), source.end());
+      s.assign(source.begin(), source.end());
+      break;
+    case 20: {
+      single_pass<T> first(source.data());
+      single_pass<T> last(source.data() + source.size());
+      v.assign(first, last);
+      s.assign(first, last);
+      break;
+    }
+    case 21:
+      v.clear();
+      s.clear();
+      break;
+    case 22: {
+      tinystl::vector<T> copy(v);
+      check(copy, s);
+      tinystl::vector<T> other(source.begin(), source.end());
+      other = v;
+      check(other, s);
+      v = other;
+      break;
+    }
+    case 23: {
+      tinystl::vector<T> moved(std::move(v));
+      v = tinystl::vector<T>(source.begin(), source.end());
+      check(v, source);
+      v = std::move(moved);
+      break;
+    }
+    case 24: {
+      tinystl::vector<T> other(source.begin(), source.end());
+      std::vector<T> std_other(source);
+      v.swap(other);
+      s.swap(std_other);
+      check(other, std_other);
+      break;
+    }
+    case 25:
+      if (has_element) {
+        TINYSTL_FUZZ_CHECK(v.at(pos) == s.at(pos));
+        TINYSTL_FUZZ_CHECK(v.front() == s.front());
+        TINYSTL_FUZZ_CHECK(v.back() == s.back());
+      }
+      break;
+    case 26:
+      if (has_element) {
+        v.resize(pos + count * 4, v[pos]);
+        s.resize(pos + count * 4, s[pos]);
+      }
+      break;
+    case 27:
+      if (has_element) {
+        v.assign(count * 4, v[pos]);
+        s.assign(count * 4, s[pos]);
+      }
+      break;
+    }
+
+    TINYSTL_FUZZ_CHECK(got == want);
+    check(v, s);
+  }
+}
+
+} // namespace
+
+extern "C" int
+LLVMFuzzerTestOneInput(const std::uint8_t *data, std::size_t size) {
+  run<int>(data, size);
+  run<std::string>(data, size);
+  return 0;
+}
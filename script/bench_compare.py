@@ -0,0 +1,159 @@
+"""Compare benchmark results against a stored baseline.
+
+Runs a benchmark binary (or reads a results file it wrote with --json) and
+compares the median time of every case against the baseline. A case only
+counts as a regression when it is slower by more than --threshold *and* the
+slowdown stands out from the run-to-run spread: more than --noise times the
+sum of both runs' median absolute deviations. Flagged cases are rerun up to
+--retries times and fail only if every attempt is slow, since drift between
+runs is often larger than the spread within one. Cases whose names start with
+"std_" are libstdc++ references; they are reported, which shows when the
+whole machine got slower, but never fail the check.
+
+    python3 script/bench_compare.py --bench build/bench/bench_vector \\
+        --baseline bench/baseline/vector.json --filter _int/
+
+Exits with status 1 on a regression. --update rewrites the baseline from
+the current run instead of comparing.
+"""
+
+import argparse
+import json
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument('--bench', help='benchmark binary to run')
+    source.add_argument('--current', help='results file to compare instead')
+    parser.add_argument('--baseline', required=True, help='baseline JSON file')
+    parser.add_argument('--filter', help='only run cases containing this')
+    parser.add_argument('--repetitions', type=int, default=5)
+    parser.add_argument('--min-time', type=float, default=0.05)
+    parser.add_argument('--threshold', type=float, default=0.10,
+                        help='allowed slowdown as a fraction (default 0.10)')
+    parser.add_argument('--noise', type=float, default=3.0,
+                        help='required multiple of the combined MAD')
+    parser.add_argument('--retries', type=int, default=2,
+                        help='reruns that must confirm a regression')
+    parser.add_argument('--update', action='store_true',
+                        help='write the current results as the baseline')
+    return parser.parse_args()
+
+
+def run_bench(args, filter):
+    fd, path = tempfile.mkstemp(suffix='.json')
+    os.close(fd)
+    try:
+        cmd = [args.bench, '--json', path,
+               '--repetitions', str(args.repetitions),
+               '--min-time', str(args.min_time)]
+        if filter:
+            cmd += ['--filter', filter]
+        subprocess.run(cmd, check=True, stdout=subprocess.DEVNULL)
+        with open(path) as f:
+            return json.load(f), path
+    except BaseException:
+        os.unlink(path)
+        raise
+
+
+def by_name(results):
+    return {case['name']: case for case in results['benchmarks']}
+
+
+def is_slower(old, case, args):
+    before, after = old['ns_per_iter'], case['ns_per_iter']
+    spread = old.get('mad_ns', 0.0) + case.get('mad_ns', 0.0)
+    slower = after - before
+    return slower > args.threshold * before and slower > args.noise * spread
+
+
+def confirm(name, old, args):
+    """Reruns one case; returns its fastest result over the attempts."""
+    best = None
+    for _ in range(args.retries):
+        results, path = run_bench(args, name)
+        os.unlink(path)
+        case = by_name(results).get(name)
+        if case is None:
+            break
+        if best is None or case['ns_per_iter'] < best['ns_per_iter']:
+            best = case
+        if not is_slower(old, case, args):
+            break
+    return best
+
+
+def compare(baseline, current, args):
+    base = by_name(baseline)
+    regressions = []
+    print(f"{'benchmark':<48} {'baseline ns':>13} {'current ns':>13} "
+          f"{'change':>8}")
+    for name, case in by_name(current).items():
+        if name not in base:
+            print(f'{name:<48} {"-":>13} {case["ns_per_iter"]:>13.1f} '
+                  f'{"new":>8}')
+            continue
+        old = base[name]
+        status = ''
+        if is_slower(old, case, args):
+            if name.startswith('std_'):
+                status = '(reference)'
+            else:
+                if args.bench and args.retries > 0:
+                    case = confirm(name, old, args) or case
+                if is_slower(old, case, args):
+                    status = 'REGRESSION'
+                    regressions.append(name)
+                else:
+                    status = '(noise)'
+        before, after = old['ns_per_iter'], case['ns_per_iter']
+        change = (after - before) / before if before > 0 else 0.0
+        print(f'{name:<48} {before:>13.1f} {after:>13.1f} '
+              f'{change:>+8.1%} {status}')
+    for name in base.keys() - by_name(current).keys():
+        if not args.filter or args.filter in name:
+            print(f'{name:<48} missing from the current run')
+    return regressions
+
+
+def main():
+    args = parse_args()
+    temp = None
+    if args.bench:
+        current, temp = run_bench(args, args.filter)
+    else:
+        with open(args.current) as f:
+            current = json.load(f)
+
+    try:
+        if args.update:
+            if temp:
+                shutil.copyfile(temp, args.baseline)
+            else:
+                shutil.copyfile(args.current, args.baseline)
+            print(f'wrote {args.baseline}')
+            return 0
+
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+        regressions = compare(baseline, current, args)
+    finally:
+        if temp:
+            os.unlink(temp)
+
+    if regressions:
+        print(f'{len(regressions)} regression(s) beyond '
+              f'{args.threshold:.0%}: {", ".join(regressions)}')
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,230 @@
+"""Measure compile time, object size and template instantiations.
+
+Compiles every unit in bench/compile/ twice, once as is and once with
+-DTINYSTL_OPTIMIZE_SIZE, and reports for each:
+
+  compile_s       wall-clock compile time, best of --repetitions
+  frontend_s      parsing and template instantiation (clang -ftime-trace,
+  backend_s       or gcc -ftime-report), where the compiler reports them
+  text_bytes      size of the code in the object file
+  instantiations  distinct tinystl functions emitted into the object; with
+                  clang, also the class and function instantiations from the
+                  time trace
+
+    python3 script/compile_bench.py --compiler g++ --json compile.json
+    python3 script/compile_bench.py --baseline bench/baseline/compile.json
+
+With --baseline, text size and instantiation counts are compared against
+the stored results and growth beyond --threshold exits with status 1;
+those two are deterministic for one compiler, unlike times, which are only
+reported. --update rewrites the baseline instead.
+"""
+
+import argparse
+import glob
+import json
+import os
+import re
+import shlex
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+TRACKED = ('text_bytes', 'instantiations')
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('--compiler', default=os.environ.get('CXX', 'c++'))
+    parser.add_argument('--flags', default='-std=c++20 -O2',
+                        help='compiler flags (default "-std=c++20 -O2")')
+    parser.add_argument('--units', nargs='*',
+                        default=sorted(glob.glob(
+                            os.path.join(ROOT, 'bench', 'compile', '*.cpp'))))
+    parser.add_argument('--repetitions', type=int, default=1)
+    parser.add_argument('--json', help='write the results to this file')
+    parser.add_argument('--baseline', help='baseline JSON file')
+    parser.add_argument('--threshold', type=float, default=0.05,
+                        help='allowed growth as a fraction (default 0.05)')
+    parser.add_argument('--update', action='store_true',
+                        help='write the current results as the baseline')
+    return parser.parse_args()
+
+
+def compiler_id(compiler):
+    """"gcc 12.2.0" or "clang 17.0.6", whatever name the driver goes by."""
+    banner = subprocess.run([compiler, '--version'], capture_output=True,
+                            text=True, check=True).stdout
+    family = 'clang' if 'clang' in banner else 'gcc'
+    for flag in ('-dumpfullversion', '-dumpversion'):
+        proc = subprocess.run([compiler, flag], capture_output=True,
+                              text=True)
+        if proc.returncode == 0 and proc.stdout.strip():
+            return f'{family} {proc.stdout.strip()}'
+    return banner.splitlines()[0] if banner else compiler
+
+
+def text_bytes(obj):
+    """The text column of `size`, or the file size where it is missing."""
+    if shutil.which('size'):
+        out = subprocess.run(['size', obj], capture_output=True, text=True)
+        lines = out.stdout.splitlines()
+        if out.returncode == 0 and len(lines) >= 2:
+            return int(lines[1].split()[0])
+    return os.path.getsize(obj)
+
+
+def emitted_functions(obj):
+    """Distinct tinystl functions defined in the object file."""
+    if not shutil.which('nm'):
+        return None
+    out = subprocess.run(['nm', '-C', '--defined-only', obj],
+                         capture_output=True, text=True)
+    names = set()
+    for line in out.stdout.splitlines():
+        parts = line.split(' ', 2)
+        if len(parts) == 3 and parts[1] in 'TtWw' and \
+                parts[2].startswith('tinystl::') and \
+                not parts[2].startswith('tinystl::compile_bench'):
+            names.add(parts[2])
+    return len(names)
+
+
+def clang_trace(trace_file):
+    with open(trace_file) as f:
+        events = json.load(f)['traceEvents']
+    result = {'class_instantiations': 0, 'function_instantiations': 0}
+    for event in events:
+        name = event.get('name')
+        if name == 'InstantiateClass':
+            result['class_instantiations'] += 1
+        elif name == 'InstantiateFunction':
+            result['function_instantiations'] += 1
+        elif name == 'Total Frontend':
+            result['frontend_s'] = event['dur'] / 1e6
+        elif name == 'Total Backend':
+            result['backend_s'] = event['dur'] / 1e6
+    return result
+
+
+GCC_PHASE = re.compile(r'^\s*phase ([^:]+?)\s*:\s*([\d.]+)')
+
+
+def gcc_report(stderr):
+    """Splits gcc's -ftime-report into front and back end (user time)."""
+    phases = {}
+    for line in stderr.splitlines():
+        match = GCC_PHASE.match(line)
+        if match:
+            phases[match.group(1)] = float(match.group(2))
+    if not phases:
+        return {}
+    return {
+        'frontend_s': phases.get('parsing', 0.0) +
+                      phases.get('lang. deferred', 0.0),
+        'backend_s': phases.get('opt and generate', 0.0),
+    }
+
+
+def compile_unit(args, clang, unit, defines, workdir):
+    name = os.path.splitext(os.path.basename(unit))[0]
+    obj = os.path.join(workdir, name + '.o')
+    cmd = [args.compiler, *shlex.split(args.flags), *defines,
+           '-I', os.path.join(ROOT, 'source'), '-c', unit, '-o', obj]
+    cmd.append('-ftime-trace' if clang else '-ftime-report')
+
+    best, report = None, {}
+    for _ in range(max(1, args.repetitions)):
+        start = time.perf_counter()
+        proc = subprocess.run(cmd, capture_output=True, text=True)
+        elapsed = time.perf_counter() - start
+        if proc.returncode != 0:
+            sys.stderr.write(proc.stderr)
+            raise SystemExit(f'failed to compile {unit}')
+        if best is None or elapsed < best:
+            best = elapsed
+            trace = os.path.splitext(obj)[0] + '.json'
+            report = clang_trace(trace) if clang and os.path.exists(trace) \
+                else gcc_report(proc.stderr)
+
+    return {
+        'compile_s': round(best, 3),
+        'text_bytes': text_bytes(obj),
+        'instantiations': emitted_functions(obj),
+        **{k: round(v, 3) if isinstance(v, float) else v
+           for k, v in report.items()},
+    }
+
+
+def run(args):
+    version = compiler_id(args.compiler)
+    clang = version.startswith('clang')
+    results = {'context': {'compiler': version, 'flags': args.flags},
+               'units': []}
+    with tempfile.TemporaryDirectory() as workdir:
+        for unit in args.units:
+            name = os.path.splitext(os.path.basename(unit))[0]
+            for mode, defines in (('default', []),
+                                  ('size', ['-DTINYSTL_OPTIMIZE_SIZE'])):
+                case = {'name': f'{name}/{mode}',
+                        **compile_unit(args, clang, unit, defines, workdir)}
+                results['units'].append(case)
+                print(f"{case['name']:<32} {case['compile_s']:>8.2f} s "
+                      f"{case['text_bytes']:>10} B text "
+                      f"{case['instantiations'] or '-':>6} functions",
+                      flush=True)
+    return results
+
+
+def compare(baseline, current, args):
+    if baseline['context'] != current['context']:
+        print('baseline was measured with a different compiler or flags; '
+              'sizes are not comparable, refresh it with --update')
+        return []
+    base = {u['name']: u for u in baseline['units']}
+    growth = []
+    for unit in current['units']:
+        old = base.get(unit['name'])
+        if old is None:
+            continue
+        for key in TRACKED:
+            before, after = old.get(key), unit.get(key)
+            if not before or after is None:
+                continue
+            change = (after - before) / before
+            if change > args.threshold:
+                growth.append(f"{unit['name']} {key} {before} -> {after} "
+                              f'({change:+.1%})')
+    return growth
+
+
+def main():
+    args = parse_args()
+    current = run(args)
+    if args.json:
+        with open(args.json, 'w') as f:
+            json.dump(current, f, indent=2)
+            f.write('\n')
+
+    if not args.baseline:
+        return 0
+    if args.update:
+        with open(args.baseline, 'w') as f:
+            json.dump(current, f, indent=2)
+            f.write('\n')
+        print(f'wrote {args.baseline}')
+        return 0
+
+    with open(args.baseline) as f:
+        baseline = json.load(f)
+    growth = compare(baseline, current, args)
+    for line in growth:
+        print(f'GROWTH {line}')
+    return 1 if growth else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
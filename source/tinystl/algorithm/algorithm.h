@@ -0,0 +1,14 @@
+#pragma once
+
+// Umbrella header for the tinystl algorithms. Each family lives in its own
+// header under tinystl/algorithm/ and can also be included on its own.
+
+#include "tinystl/algorithm/compare.h"
+#include "tinystl/algorithm/copy.h"
+#include "tinystl/algorithm/fill.h"
+#include "tinystl/algorithm/for_each.h"
+#include "tinystl/algorithm/numeric.h"
+#include "tinystl/algorithm/remove.h"
+#include "tinystl/algorithm/search.h"
+#include "tinystl/algorithm/sort.h"
+#include "tinystl/algorithm/transform.h"
@@ -0,0 +1,143 @@
+#pragma once
+
+// https://en.cppreference.com/w/cpp/algorithm/mismatch.html
+// https://en.cppreference.com/w/cpp/algorithm/equal.html
+// https://en.cppreference.com/w/cpp/algorithm/lexicographical_compare.html
+// https://en.cppreference.com/w/cpp/algorithm/lexicographical_compare_three_way.html
+
+#include <algorithm>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+#include "tinystl/algorithm/search.h"
+#include "tinystl/algorithm/simd.h"
+
+namespace tinystl {
+
+namespace detail {
+
+// Two contiguous ranges of the same scalar type, compared with the default
+// predicate, can be compared byte-wise up to the first difference.
+template <class Iter1, class Iter2>
+concept simd_comparable_ranges =
+  std::contiguous_iterator<Iter1> && std::contiguous_iterator<Iter2> &&
+  std::same_as<std::iter_value_t<Iter1>, std::iter_value_t<Iter2>> &&
+  simd_scalar<std::iter_value_t<Iter1>>;
+
+template <class Pred>
+concept default_equality =
+  std::same_as<Pred, std::equal_to<>> || std::same_as<Pred, std::ranges::equal_to>;
+
+template <class Pred, class T>
+concept default_equality_for = default_equality<Pred> || std::same_as<Pred, std::equal_to<T>>;
+
+template <class Comp, class T>
+concept default_less_for =
+  std::same_as<Comp, std::less<>> || std::same_as<Comp, std::less<T>> ||
+  std::same_as<Comp, std::ranges::less>;
+
+// Index of the first differing element of two contiguous ranges of n
+// elements each.
+template <class Iter1, class Iter2>
+std::size_t simd_mismatch_index(Iter1 first1, Iter2 first2, std::size_t n) noexcept {
+  constexpr std::size_t size = sizeof(std::iter_value_t<Iter1>);
+  return simd_mismatch(simd_bytes(first1), simd_bytes(first2), n * size) / size;
+}
+
+} // namespace detail
+
+template <std::input_iterator Iter1, std::input_iterator Iter2, class Pred = std::equal_to<>>
+constexpr std::pair<Iter1, Iter2>
+mismatch(Iter1 first1, Iter1 last1, Iter2 first2, Iter2 last2, Pred pred = Pred()) {
+  if constexpr (detail::simd_comparable_ranges<Iter1, Iter2> &&
+                detail::default_equality_for<Pred, std::iter_value_t<Iter1>>) {
+    if (!std::is_constant_evaluated()) {
+      std::size_t n = static_cast<std::size_t>(std::min<std::ptrdiff_t>(last1 - first1, last2 - first2));
+      std::size_t i = detail::simd_mismatch_index(first1, first2, n);
+      return {first1 + i, first2 + i};
+    }
+  }
+  return std::mismatch(first1, last1, first2, last2, pred);
+}
+
+template <std::input_iterator Iter1, std::input_iterator Iter2, class Pred = std::equal_to<>>
+  requires(!std::input_iterator<Pred>)
+constexpr std::pair<Iter1, Iter2>
+mismatch(Iter1 first1, Iter1 last1, Iter2 first2, Pred pred = Pred()) {
+  if constexpr (detail::simd_comparable_ranges<Iter1, Iter2> &&
+                detail::default_equality_for<Pred, std::iter_value_t<Iter1>>) {
+    if (!std::is_constant_evaluated()) {
+      std::size_t i = detail::simd_mismatch_index(first1, first2, static_cast<std::size_t>(last1 - first1));
+      return {first1 + i, first2 + i};
+    }
+  }
+  return std::mismatch(first1, last1, first2, pred);
+}
+
+template <std::input_iterator Iter1, std::input_iterator Iter2, class Pred = std::equal_to<>>
+constexpr bool
+equal(Iter1 first1, Iter1 last1, Iter2 first2, Iter2 last2, Pred pred = Pred()) {
+  if constexpr (detail::simd_comparable_ranges<Iter1, Iter2> &&
+                detail::default_equality_for<Pred, std::iter_value_t<Iter1>>) {
+    if (!std::is_constant_evaluated()) {
+      std::size_t n = static_cast<std::size_t>(last1 - first1);
+      return n == static_cast<std::size_t>(last2 - first2) &&
+             detail::simd_mismatch_index(first1, first2, n) == n;
+    }
+  }
+  return std::equal(first1, last1, first2, last2, pred);
+}
+
+template <std::input_iterator Iter1, std::input_iterator Iter2, class Pred = std::equal_to<>>
+  requires(!std::input_iterator<Pred>)
+constexpr bool equal(Iter1 first1, Iter1 last1, Iter2 first2, Pred pred = Pred()) {
+  if constexpr (detail::simd_comparable_ranges<Iter1, Iter2> &&
+                detail::default_equality_for<Pred, std::iter_value_t<Iter1>>) {
+    if (!std::is_constant_evaluated()) {
+      std::size_t n = static_cast<std::size_t>(last1 - first1);
+      return detail::simd_mismatch_index(first1, first2, n) == n;
+    }
+  }
+  return std::equal(first1, last1, first2, pred);
+}
+
+// Skips the common prefix with the mismatch kernel and orders the ranges by
+// the first differing pair, or by length when one is a prefix of the other.
+template <std::input_iterator Iter1, std::input_iterator Iter2, class Comp = std::less<>>
+constexpr bool lexicographical_compare(
+  Iter1 first1, Iter1 last1, Iter2 first2, Iter2 last2, Comp comp = Comp()
+) {
+  if constexpr (detail::simd_comparable_ranges<Iter1, Iter2> &&
+                detail::default_less_for<Comp, std::iter_value_t<Iter1>>) {
+    if (!std::is_constant_evaluated()) {
+      std::size_t n1 = static_cast<std::size_t>(last1 - first1);
+      std::size_t n2 = static_cast<std::size_t>(last2 - first2);
+      std::size_t i = detail::simd_mismatch_index(first1, first2, std::min(n1, n2));
+      return i < std::min(n1, n2) ? comp(first1[i], first2[i]) : n1 < n2;
+    }
+  }
+  return std::lexicographical_compare(first1, last1, first2, last2, comp);
+}
+
+template <std::input_iterator Iter1, std::input_iterator Iter2, class Comp = std::compare_three_way>
+constexpr auto lexicographical_compare_three_way(
+  Iter1 first1, Iter1 last1, Iter2 first2, Iter2 last2, Comp comp = Comp()
+) -> decltype(comp(*first1, *first2)) {
+  using result_type = decltype(comp(*first1, *first2));
+  if constexpr (detail::simd_comparable_ranges<Iter1, Iter2> &&
+                std::same_as<Comp, std::compare_three_way>) {
+    if (!std::is_constant_evaluated()) {
+      std::size_t n1 = static_cast<std::size_t>(last1 - first1);
+      std::size_t n2 = static_cast<std::size_t>(last2 - first2);
+      std::size_t i = detail::simd_mismatch_index(first1, first2, std::min(n1, n2));
+      return i < std::min(n1, n2) ? comp(first1[i], first2[i]) : result_type(n1 <=> n2);
+    }
+  }
+  return std::lexicographical_compare_three_way(first1, last1, first2, last2, comp);
+}
+
+} // namespace tinystl
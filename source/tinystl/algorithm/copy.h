@@ -0,0 +1,35 @@
+#pragma once
+
+// https://en.cppreference.com/w/cpp/algorithm/copy.html
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+#include "tinystl/algorithm/parallel.h"
+#include "tinystl/execution/execution.h"
+
+namespace tinystl {
+
+template <std::input_iterator Iter, class OutIter>
+constexpr OutIter copy(Iter first, Iter last, OutIter d_first) {
+  return std::copy(first, last, d_first);
+}
+
+// Pieces of trivially copyable contiguous ranges still reach memmove through
+// std::copy, one per thread.
+template <execution_policy ExecutionPolicy, std::forward_iterator Iter, std::forward_iterator OutIter>
+OutIter copy(ExecutionPolicy &&policy, Iter first, Iter last, OutIter d_first) {
+  if constexpr (detail::runs_in_parallel<ExecutionPolicy, Iter, OutIter>) {
+    thread_pool &pool = policy.pool();
+    std::size_t n = static_cast<std::size_t>(last - first);
+    detail::parallel_for(pool, n, detail::parallel_grain(pool, n), [&](std::size_t b, std::size_t e) {
+      std::copy(first + b, first + e, d_first + b);
+    });
+    return d_first + n;
+  } else {
+    return std::copy(first, last, d_first);
+  }
+}
+
+} // namespace tinystl
@@ -0,0 +1,32 @@
+#pragma once
+
+// https://en.cppreference.com/w/cpp/algorithm/fill.html
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+#include "tinystl/algorithm/parallel.h"
+#include "tinystl/execution/execution.h"
+
+namespace tinystl {
+
+template <std::forward_iterator Iter, class T>
+constexpr void fill(Iter first, Iter last, const T &value) {
+  std::fill(first, last, value);
+}
+
+template <execution_policy ExecutionPolicy, std::forward_iterator Iter, class T>
+void fill(ExecutionPolicy &&policy, Iter first, Iter last, const T &value) {
+  if constexpr (detail::runs_in_parallel<ExecutionPolicy, Iter>) {
+    thread_pool &pool = policy.pool();
+    std::size_t n = static_cast<std::size_t>(last - first);
+    detail::parallel_for(pool, n, detail::parallel_grain(pool, n), [&](std::size_t b, std::size_t e) {
+      std::fill(first + b, first + e, value);
+    });
+  } else {
+    std::fill(first, last, value);
+  }
+}
+
+} // namespace tinystl
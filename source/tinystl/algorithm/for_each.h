@@ -0,0 +1,33 @@
+#pragma once
+
+// https://en.cppreference.com/w/cpp/algorithm/for_each.html
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+#include "tinystl/algorithm/parallel.h"
+#include "tinystl/execution/execution.h"
+
+namespace tinystl {
+
+template <std::input_iterator Iter, class Func>
+constexpr Func for_each(Iter first, Iter last, Func func) {
+  return std::for_each(first, last, std::move(func));
+}
+
+// Each piece works on its own copy of func.
+template <execution_policy ExecutionPolicy, std::forward_iterator Iter, class Func>
+void for_each(ExecutionPolicy &&policy, Iter first, Iter last, Func func) {
+  if constexpr (detail::runs_in_parallel<ExecutionPolicy, Iter>) {
+    thread_pool &pool = policy.pool();
+    std::size_t n = static_cast<std::size_t>(last - first);
+    detail::parallel_for(pool, n, detail::parallel_grain(pool, n), [&](std::size_t b, std::size_t e) {
+      std::for_each(first + b, first + e, func);
+    });
+  } else {
+    std::for_each(first, last, func);
+  }
+}
+
+} // namespace tinystl
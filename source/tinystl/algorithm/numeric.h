@@ -0,0 +1,364 @@
+#pragma once
+
+// https://en.cppreference.com/w/cpp/algorithm/reduce.html
+// https://en.cppreference.com/w/cpp/algorithm/transform_reduce.html
+// https://en.cppreference.com/w/cpp/algorithm/inclusive_scan.html
+// https://en.cppreference.com/w/cpp/algorithm/exclusive_scan.html
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "tinystl/algorithm/parallel.h"
+#include "tinystl/algorithm/simd.h"
+#include "tinystl/execution/execution.h"
+#include "tinystl/iterator/segmented_iterator.h"
+
+namespace tinystl {
+
+namespace detail {
+
+template <class Op, class T>
+concept plus_op = std::same_as<Op, std::plus<>> || std::same_as<Op, std::plus<T>>;
+
+template <class Op, class T>
+concept multiplies_op = std::same_as<Op, std::multiplies<>> || std::same_as<Op, std::multiplies<T>>;
+
+template <class Iter, class T>
+concept simd_float_run =
+  std::contiguous_iterator<Iter> && simd_float<T> && std::same_as<std::iter_value_t<Iter>, T>;
+
+// Folds one contiguous run, through the SIMD kernels when it is a plain
+// floating-point sum or dot product.
+template <class Iter, class T, class BinaryOp>
+constexpr T reduce_run(Iter first, Iter last, T init, BinaryOp op) {
+  if constexpr (simd_float_run<Iter, T> && plus_op<BinaryOp, T>) {
+    if (!std::is_constant_evaluated()) {
+      return init + detail::simd_sum(std::to_address(first), static_cast<std::size_t>(last - first));
+    }
+  }
+  return std::reduce(first, last, std::move(init), op);
+}
+
+template <class Iter1, class Iter2, class T, class BinaryReduceOp, class BinaryTransformOp>
+constexpr T transform_reduce_run(
+  Iter1 first1, Iter1 last1, Iter2 first2, T init, BinaryReduceOp reduce, BinaryTransformOp transform
+) {
+  if constexpr (
+    simd_float_run<Iter1, T> && simd_float_run<Iter2, T> && plus_op<BinaryReduceOp, T> &&
+    multiplies_op<BinaryTransformOp, T>
+  ) {
+    if (!std::is_constant_evaluated()) {
+      return init + detail::simd_dot(
+                      std::to_address(first1), std::to_address(first2),
+                      static_cast<std::size_t>(last1 - first1)
+                    );
+    }
+  }
+  return std::transform_reduce(first1, last1, first2, std::move(init), reduce, transform);
+}
+
+// The folds below walk a segmented range one contiguous run at a time, so
+// each segment reaches the kernels above as a plain pointer range.
+template <class Iter, class T, class BinaryOp>
+constexpr T reduce_segments(Iter first, Iter last, T init, BinaryOp op) {
+  tinystl::for_each_segment(first, last, [&](auto b, auto e) {
+    init = detail::reduce_run(b, e, std::move(init), op);
+  });
+  return init;
+}
+
+template <class Iter1, class Iter2, class T, class BinaryReduceOp, class BinaryTransformOp>
+constexpr T transform_reduce_segments(
+  Iter1 first1, Iter1 last1, Iter2 first2, T init, BinaryReduceOp reduce, BinaryTransformOp transform
+) {
+  if constexpr (segmented_iterator<Iter1> && std::forward_iterator<Iter2>) {
+    tinystl::for_each_segment(first1, last1, [&](auto b, auto e) {
+      init = detail::transform_reduce_run(b, e, first2, std::move(init), reduce, transform);
+      std::advance(first2, e - b);
+    });
+    return init;
+  } else {
+    return detail::transform_reduce_run(first1, last1, first2, std::move(init), reduce, transform);
+  }
+}
+
+template <class Iter, class T, class BinaryReduceOp, class UnaryTransformOp>
+constexpr T transform_reduce_segments(
+  Iter first, Iter last, T init, BinaryReduceOp reduce, UnaryTransformOp transform
+) {
+  tinystl::for_each_segment(first, last, [&](auto b, auto e) {
+    init = std::transform_reduce(b, e, std::move(init), reduce, transform);
+  });
+  return init;
+}
+
+// Scans continuing from acc, which holds the fold of everything before
+// first. Each input is read before its output is written, so the output may
+// alias the input.
+template <class Iter, class OutIter, class T, class BinaryOp>
+constexpr OutIter inclusive_scan_segments(Iter first, Iter last, OutIter d_first, T &acc, BinaryOp op) {
+  tinystl::for_each_segment(first, last, [&](auto b, auto e) {
+    for (; b != e; ++b, ++d_first) {
+      acc = op(std::move(acc), *b);
+      *d_first = acc;
+    }
+  });
+  return d_first;
+}
+
+template <class Iter, class OutIter, class T, class BinaryOp>
+constexpr OutIter exclusive_scan_segments(Iter first, Iter last, OutIter d_first, T &acc, BinaryOp op) {
+  tinystl::for_each_segment(first, last, [&](auto b, auto e) {
+    for (; b != e; ++b, ++d_first) {
+      T next = op(acc, *b);
+      *d_first = std::move(acc);
+      acc = std::move(next);
+    }
+  });
+  return d_first;
+}
+
+// Splits [0, n) into pieces, folds each with fold_piece(begin, end) on the
+// pool and combines the partial results onto init in piece order. Small
+// ranges, and any range on a one-thread pool, go to fold_all(init) instead
+// unless the policy is deterministic, whose pieces never depend on the pool.
+template <class ExecutionPolicy, class T, class BinaryOp, class FoldPiece, class FoldAll>
+T parallel_reduce(
+  const ExecutionPolicy &policy, std::size_t n, T init, BinaryOp op, FoldPiece fold_piece,
+  FoldAll fold_all
+) {
+  thread_pool &pool = policy.pool();
+  std::size_t grain = detail::policy_grain(policy, pool, n);
+  if (!policy.is_deterministic() && (n <= grain || pool.size() < 2)) {
+    return fold_all(std::move(init));
+  }
+
+  std::size_t pieces = (n + grain - 1) / grain;
+  auto partials = std::make_unique<std::optional<T>[]>(pieces);
+  std::size_t batch = std::max<std::size_t>(1, pieces / (4 * pool.size()));
+  detail::parallel_for(pool, pieces, batch, [&](std::size_t pb, std::size_t pe) {
+    for (std::size_t p = pb; p < pe; ++p) {
+      partials[p].emplace(fold_piece(p * grain, std::min(n, (p + 1) * grain)));
+    }
+  });
+
+  for (std::size_t p = 0; p < pieces; ++p) {
+    init = op(std::move(init), std::move(*partials[p]));
+  }
+  return init;
+}
+
+// The two-pass scan: every piece but the last is reduced on the pool, a
+// sequential pass turns the piece sums into the carry each piece starts
+// from, and every piece is then scanned from its carry on the pool. With no
+// init, the inclusive scan's first piece starts from its own first element.
+template <class T, class ExecutionPolicy, class Iter, class OutIter, class BinaryOp>
+OutIter parallel_scan(
+  const ExecutionPolicy &policy, Iter first, Iter last, OutIter d_first, std::optional<T> init,
+  BinaryOp op, bool inclusive
+) {
+  thread_pool &pool = policy.pool();
+  std::size_t n = static_cast<std::size_t>(last - first);
+  if (n == 0) {
+    return d_first;
+  }
+  std::size_t grain = detail::policy_grain(policy, pool, n);
+  if (!policy.is_deterministic() && (n <= grain || pool.size() < 2)) {
+    if (inclusive && !init) {
+      T acc = *first;
+      *d_first = acc;
+      return detail::inclusive_scan_segments(std::next(first), last, std::next(d_first), acc, op);
+    }
+    return inclusive ? detail::inclusive_scan_segments(first, last, d_first, *init, op)
+                     : detail::exclusive_scan_segments(first, last, d_first, *init, op);
+  }
+
+  std::size_t pieces = (n + grain - 1) / grain;
+  std::size_t batch = std::max<std::size_t>(1, pieces / (4 * pool.size()));
+  auto carries = std::make_unique<std::optional<T>[]>(pieces);
+  detail::parallel_for(pool, pieces - 1, batch, [&](std::size_t pb, std::size_t pe) {
+    for (std::size_t p = pb; p < pe; ++p) {
+      Iter b = first + p * grain;
+      carries[p + 1].emplace(detail::reduce_segments(std::next(b), first + (p + 1) * grain, T(*b), op));
+    }
+  });
+
+  carries[0] = std::move(init);
+  for (std::size_t p = 1; p < pieces; ++p) {
+    if (carries[p - 1]) {
+      carries[p] = op(*carries[p - 1], std::move(*carries[p]));
+    }
+  }
+
+  detail::parallel_for(pool, pieces, batch, [&](std::size_t pb, std::size_t pe) {
+    for (std::size_t p = pb; p < pe; ++p) {
+      Iter b = first + p * grain;
+      Iter e = first + std::min(n, (p + 1) * grain);
+      OutIter d = d_first + p * grain;
+      if (!inclusive) {
+        detail::exclusive_scan_segments(b, e, d, *carries[p], op);
+      } else if (carries[p]) {
+        detail::inclusive_scan_segments(b, e, d, *carries[p], op);
+      } else {
+        T acc = *b;
+        *d = acc;
+        detail::inclusive_scan_segments(std::next(b), e, std::next(d), acc, op);
+      }
+    }
+  });
+  return d_first + n;
+}
+
+} // namespace detail
+
+/* --------------------------------- reduce --------------------------------- */
+// Plain float and double sums over contiguous runs use the SIMD kernels,
+// which keep several partial sums; like std::reduce, the result may differ
+// from a left-to-right fold in the last bits.
+template <std::input_iterator Iter, class T = std::iter_value_t<Iter>, class BinaryOp = std::plus<>>
+constexpr T reduce(Iter first, Iter last, T init = T(), BinaryOp op = BinaryOp()) {
+  return detail::reduce_segments(first, last, std::move(init), op);
+}
+
+// Each piece is folded on its own, then the partial results are folded in
+// order onto init. op must be associative and commutative, as for
+// std::reduce.
+template <execution_policy ExecutionPolicy, std::forward_iterator Iter, class T = std::iter_value_t<Iter>, class BinaryOp = std::plus<>>
+T reduce(ExecutionPolicy &&policy, Iter first, Iter last, T init = T(), BinaryOp op = BinaryOp()) {
+  if constexpr (detail::runs_in_parallel<ExecutionPolicy, Iter>) {
+    return detail::parallel_reduce(
+      policy, static_cast<std::size_t>(last - first), std::move(init), op,
+      [&](std::size_t b, std::size_t e) {
+        return detail::reduce_segments(first + b + 1, first + e, T(first[b]), op);
+      },
+      [&](T acc) { return detail::reduce_segments(first, last, std::move(acc), op); }
+    );
+  } else {
+    return detail::reduce_segments(first, last, std::move(init), op);
+  }
+}
+
+/* ---------------------------- transform_reduce ---------------------------- */
+template <std::input_iterator Iter1, std::input_iterator Iter2, class T>
+constexpr T transform_reduce(Iter1 first1, Iter1 last1, Iter2 first2, T init) {
+  return detail::transform_reduce_segments(first1, last1, first2, std::move(init), std::plus<>(), std::multiplies<>());
+}
+
+template <std::input_iterator Iter1, std::input_iterator Iter2, class T, class BinaryReduceOp, class BinaryTransformOp>
+constexpr T transform_reduce(
+  Iter1 first1, Iter1 last1, Iter2 first2, T init, BinaryReduceOp reduce, BinaryTransformOp transform
+) {
+  return detail::transform_reduce_segments(first1, last1, first2, std::move(init), reduce, transform);
+}
+
+template <std::input_iterator Iter, class T, class BinaryReduceOp, class UnaryTransformOp>
+constexpr T transform_reduce(Iter first, Iter last, T init, BinaryReduceOp reduce, UnaryTransformOp transform) {
+  return detail::transform_reduce_segments(first, last, std::move(init), reduce, transform);
+}
+
+template <execution_policy ExecutionPolicy, std::forward_iterator Iter1, std::forward_iterator Iter2, class T, class BinaryReduceOp, class BinaryTransformOp>
+T transform_reduce(
+  ExecutionPolicy &&policy, Iter1 first1, Iter1 last1, Iter2 first2, T init, BinaryReduceOp reduce,
+  BinaryTransformOp transform
+) {
+  if constexpr (detail::runs_in_parallel<ExecutionPolicy, Iter1, Iter2>) {
+    return detail::parallel_reduce(
+      policy, static_cast<std::size_t>(last1 - first1), std::move(init), reduce,
+      [&](std::size_t b, std::size_t e) {
+        return detail::transform_reduce_segments(
+          first1 + b + 1, first1 + e, first2 + b + 1, T(transform(first1[b], first2[b])), reduce, transform
+        );
+      },
+      [&](T acc) {
+        return detail::transform_reduce_segments(first1, last1, first2, std::move(acc), reduce, transform);
+      }
+    );
+  } else {
+    return detail::transform_reduce_segments(first1, last1, first2, std::move(init), reduce, transform);
+  }
+}
+
+template <execution_policy ExecutionPolicy, std::forward_iterator Iter1, std::forward_iterator Iter2, class T>
+T transform_reduce(ExecutionPolicy &&policy, Iter1 first1, Iter1 last1, Iter2 first2, T init) {
+  return tinystl::transform_reduce(
+    std::forward<ExecutionPolicy>(policy), first1, last1, first2, std::move(init), std::plus<>(), std::multiplies<>()
+  );
+}
+
+template <execution_policy ExecutionPolicy, std::forward_iterator Iter, class T, class BinaryReduceOp, class UnaryTransformOp>
+T transform_reduce(
+  ExecutionPolicy &&policy, Iter first, Iter last, T init, BinaryReduceOp reduce, UnaryTransformOp transform
+) {
+  if constexpr (detail::runs_in_parallel<ExecutionPolicy, Iter>) {
+    return detail::parallel_reduce(
+      policy, static_cast<std::size_t>(last - first), std::move(init), reduce,
+      [&](std::size_t b, std::size_t e) {
+        return detail::transform_reduce_segments(first + b + 1, first + e, T(transform(first[b])), reduce, transform);
+      },
+      [&](T acc) { return detail::transform_reduce_segments(first, last, std::move(acc), reduce, transform); }
+    );
+  } else {
+    return detail::transform_reduce_segments(first, last, std::move(init), reduce, transform);
+  }
+}
+
+/* ----------------------------- inclusive_scan ----------------------------- */
+template <std::input_iterator Iter, class OutIter, class BinaryOp = std::plus<>>
+constexpr OutIter inclusive_scan(Iter first, Iter last, OutIter d_first, BinaryOp op = BinaryOp()) {
+  if (first == last) {
+    return d_first;
+  }
+  std::iter_value_t<Iter> acc = *first;
+  *d_first = acc;
+  return detail::inclusive_scan_segments(++first, last, ++d_first, acc, op);
+}
+
+template <std::input_iterator Iter, class OutIter, class BinaryOp, class T>
+constexpr OutIter inclusive_scan(Iter first, Iter last, OutIter d_first, BinaryOp op, T init) {
+  return detail::inclusive_scan_segments(first, last, d_first, init, op);
+}
+
+// The parallel scans read every input twice, once to reduce its piece and
+// once to scan it, and op must be associative. The output may be the input.
+template <execution_policy ExecutionPolicy, std::forward_iterator Iter, std::forward_iterator OutIter, class BinaryOp = std::plus<>>
+OutIter inclusive_scan(ExecutionPolicy &&policy, Iter first, Iter last, OutIter d_first, BinaryOp op = BinaryOp()) {
+  if constexpr (detail::runs_in_parallel<ExecutionPolicy, Iter, OutIter>) {
+    return detail::parallel_scan<std::iter_value_t<Iter>>(policy, first, last, d_first, std::nullopt, op, true);
+  } else {
+    return tinystl::inclusive_scan(first, last, d_first, op);
+  }
+}
+
+template <execution_policy ExecutionPolicy, std::forward_iterator Iter, std::forward_iterator OutIter, class BinaryOp, class T>
+OutIter inclusive_scan(ExecutionPolicy &&policy, Iter first, Iter last, OutIter d_first, BinaryOp op, T init) {
+  if constexpr (detail::runs_in_parallel<ExecutionPolicy, Iter, OutIter>) {
+    return detail::parallel_scan<T>(policy, first, last, d_first, std::move(init), op, true);
+  } else {
+    return tinystl::inclusive_scan(first, last, d_first, op, std::move(init));
+  }
+}
+
+/* ----------------------------- exclusive_scan ----------------------------- */
+template <std::input_iterator Iter, class OutIter, class T, class BinaryOp = std::plus<>>
+constexpr OutIter exclusive_scan(Iter first, Iter last, OutIter d_first, T init, BinaryOp op = BinaryOp()) {
+  return detail::exclusive_scan_segments(first, last, d_first, init, op);
+}
+
+template <execution_policy ExecutionPolicy, std::forward_iterator Iter, std::forward_iterator OutIter, class T, class BinaryOp = std::plus<>>
+OutIter exclusive_scan(ExecutionPolicy &&policy, Iter first, Iter last, OutIter d_first, T init, BinaryOp op = BinaryOp()) {
+  if constexpr (detail::runs_in_parallel<ExecutionPolicy, Iter, OutIter>) {
+    return detail::parallel_scan<T>(policy, first, last, d_first, std::move(init), op, false);
+  } else {
+    return tinystl::exclusive_scan(first, last, d_first, std::move(init), op);
+  }
+}
+
+} // namespace tinystl
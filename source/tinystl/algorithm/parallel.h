@@ -0,0 +1,83 @@
+#pragma once
+
+// Building blocks shared by the algorithms' parallel overloads.
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+#include "tinystl/execution/execution.h"
+
+namespace tinystl {
+
+namespace detail {
+
+// Below this many elements a range is not worth a task of its own.
+inline constexpr std::size_t parallel_min_grain = 1 << 12;
+
+// Aims for a few chunks per worker so that stealing can even out uneven
+// progress, without letting chunks shrink below min_grain.
+inline std::size_t parallel_grain(
+  const thread_pool &pool, std::size_t n,
+  std::size_t min_grain = parallel_min_grain
+) noexcept {
+  return std::max(min_grain, (n + 4 * pool.size() - 1) / (4 * pool.size()));
+}
+
+// Piece length under a deterministic policy; fixed, so that the split points
+// do not depend on the pool.
+inline constexpr std::size_t deterministic_grain = 1 << 14;
+
+// The piece length an algorithm splitting n elements under policy uses.
+template <class ExecutionPolicy>
+std::size_t policy_grain(
+  const ExecutionPolicy &policy, const thread_pool &pool, std::size_t n
+) noexcept {
+  return policy.is_deterministic() ? deterministic_grain : detail::parallel_grain(pool, n);
+}
+
+// Splits [begin, end) in halves, forking the upper half and descending into
+// the lower one, until pieces are at most grain long. Forked halves split
+// further on whichever worker steals them, so the pool fans out in
+// logarithmic depth instead of the caller enqueuing every chunk itself.
+template <class Body>
+void parallel_split(
+  task_group &group, std::size_t begin, std::size_t end, std::size_t grain,
+  Body &body
+) {
+  while (end - begin > grain) {
+    std::size_t mid = begin + (end - begin) / 2;
+    group.run([&group, mid, end, grain, &body] {
+      detail::parallel_split(group, mid, end, grain, body);
+    });
+    end = mid;
+  }
+  body(begin, end);
+}
+
+// Calls body(begin, end) over disjoint pieces covering [0, n), in parallel
+// when n is larger than grain, and returns once all have finished.
+template <class Body>
+void parallel_for(thread_pool &pool, std::size_t n, std::size_t grain, Body &&body) {
+  if (n <= grain || pool.size() < 2) {
+    if (n > 0) {
+      body(std::size_t(0), n);
+    }
+    return;
+  }
+
+  task_group group(pool);
+  detail::parallel_split(group, 0, n, grain, body);
+  group.wait();
+}
+
+// Whether an algorithm called with ExecutionPolicy over Iter splits its work.
+// Ranges that cannot be indexed in constant time run sequentially.
+template <class ExecutionPolicy, class... Iters>
+concept runs_in_parallel =
+  parallel_execution_policy<ExecutionPolicy> &&
+  (std::random_access_iterator<Iters> && ...);
+
+} // namespace detail
+
+} // namespace tinystl
@@ -0,0 +1,57 @@
+#pragma once
+
+// https://en.cppreference.com/w/cpp/algorithm/remove.html
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "tinystl/algorithm/search.h"
+#include "tinystl/algorithm/simd.h"
+
+namespace tinystl {
+
+template <std::forward_iterator Iter, class T>
+constexpr Iter remove(Iter first, Iter last, const T &value) {
+  if constexpr (detail::simd_value_search<Iter, T>) {
+    if (!std::is_constant_evaluated()) {
+      constexpr std::size_t size = sizeof(std::iter_value_t<Iter>);
+      auto *bytes = reinterpret_cast<unsigned char *>(std::to_address(first));
+      return first + detail::simd_remove<size>(
+                       bytes, static_cast<std::size_t>(last - first),
+                       detail::simd_bits(value)
+                     );
+    }
+  }
+  return std::remove(first, last, value);
+}
+
+// An arbitrary predicate cannot be vectorized. For trivially copyable
+// elements every element is copied to the output slot and the slot only
+// advances when it is kept, so the loop has no data-dependent branch for an
+// unpredictable predicate to mispredict.
+template <std::forward_iterator Iter, class Pred>
+constexpr Iter remove_if(Iter first, Iter last, Pred pred) {
+  if constexpr (std::contiguous_iterator<Iter> &&
+                std::is_trivially_copyable_v<std::iter_value_t<Iter>>) {
+    if (!std::is_constant_evaluated()) {
+      first = std::find_if(first, last, pred);
+      if (first == last) {
+        return first;
+      }
+      Iter out = first;
+      for (++first; first != last; ++first) {
+        bool keep = !pred(std::as_const(*first));
+        *out = *first;
+        out += keep;
+      }
+      return out;
+    }
+  }
+  return std::remove_if(first, last, pred);
+}
+
+} // namespace tinystl
@@ -0,0 +1,62 @@
+#pragma once
+
+// https://en.cppreference.com/w/cpp/algorithm/find.html
+// https://en.cppreference.com/w/cpp/algorithm/count.html
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+#include "tinystl/algorithm/simd.h"
+
+namespace tinystl {
+
+namespace detail {
+
+// Searching for a value of the element type itself; a value of another type
+// may compare equal through conversions the kernels would not reproduce.
+template <class Iter, class T>
+concept simd_value_search =
+  std::contiguous_iterator<Iter> && simd_scalar<std::iter_value_t<Iter>> &&
+  std::same_as<std::remove_cvref_t<T>, std::iter_value_t<Iter>>;
+
+template <class Iter>
+const unsigned char *simd_bytes(Iter it) noexcept {
+  return reinterpret_cast<const unsigned char *>(std::to_address(it));
+}
+
+} // namespace detail
+
+template <std::input_iterator Iter, class T>
+constexpr Iter find(Iter first, Iter last, const T &value) {
+  if constexpr (detail::simd_value_search<Iter, T>) {
+    if (!std::is_constant_evaluated()) {
+      constexpr std::size_t size = sizeof(std::iter_value_t<Iter>);
+      return first + detail::simd_find<size>(
+                       detail::simd_bytes(first),
+                       static_cast<std::size_t>(last - first),
+                       detail::simd_bits(value)
+                     );
+    }
+  }
+  return std::find(first, last, value);
+}
+
+template <std::input_iterator Iter, class T>
+constexpr std::iter_difference_t<Iter> count(Iter first, Iter last, const T &value) {
+  if constexpr (detail::simd_value_search<Iter, T>) {
+    if (!std::is_constant_evaluated()) {
+      constexpr std::size_t size = sizeof(std::iter_value_t<Iter>);
+      return static_cast<std::iter_difference_t<Iter>>(detail::simd_count<size>(
+        detail::simd_bytes(first), static_cast<std::size_t>(last - first),
+        detail::simd_bits(value)
+      ));
+    }
+  }
+  return std::count(first, last, value);
+}
+
+} // namespace tinystl
@@ -0,0 +1,977 @@
+#pragma once
+
+// Vectorized kernels behind find, count, mismatch and remove for contiguous
+// ranges of scalar elements, and behind floating-point reduce and
+// transform_reduce. The instruction set is chosen once per process from the
+// running CPU: AVX2 or SSE2 on x86, NEON on AArch64, and the plain standard
+// algorithms everywhere else.
+//
+// The search kernels work on raw bytes and element sizes of 1, 2, 4 or 8, so
+// one instantiation serves every integral, enum and pointer type of that
+// size. Scalar loads and stores go through std::memcpy to stay clear of
+// aliasing rules.
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define TINYSTL_SIMD_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define TINYSTL_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+// GCC and Clang only emit AVX2 instructions in functions marked for it; MSVC
+// accepts the intrinsics anywhere.
+#if defined(__GNUC__) || defined(__clang__)
+#define TINYSTL_TARGET_AVX2 __attribute__((target("avx2,bmi,popcnt")))
+#define TINYSTL_TARGET_SSE2 __attribute__((target("sse2")))
+#else
+#define TINYSTL_TARGET_AVX2
+#define TINYSTL_TARGET_SSE2
+#endif
+
+namespace tinystl {
+
+namespace detail {
+
+// Element types whose equality is equality of their object representation.
+// Floating point is left out: 0.0 == -0.0 and NaN != NaN.
+template <class T>
+concept simd_scalar =
+  (std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>) &&
+  (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+// Element types the floating-point sum kernels handle.
+template <class T>
+concept simd_float = std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+template <std::size_t S>
+using simd_uint = std::conditional_t<
+  S == 1, std::uint8_t,
+  std::conditional_t<
+    S == 2, std::uint16_t,
+    std::conditional_t<S == 4, std::uint32_t, std::uint64_t>>>;
+
+template <class T>
+simd_uint<sizeof(T)> simd_bits(const T &value) noexcept {
+  simd_uint<sizeof(T)> bits;
+  std::memcpy(&bits, &value, sizeof(T));
+  return bits;
+}
+
+template <std::size_t S>
+simd_uint<S> simd_load(const unsigned char *p) noexcept {
+  simd_uint<S> value;
+  std::memcpy(&value, p, S);
+  return value;
+}
+
+enum class simd_isa { scalar, sse2, avx2, neon };
+
+inline simd_isa detect_simd_isa() noexcept {
+#if defined(TINYSTL_SIMD_X86)
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    return simd_isa::avx2;
+  }
+  return __builtin_cpu_supports("sse2") ? simd_isa::sse2 : simd_isa::scalar;
+#else
+  int info[4];
+  __cpuid(info, 0);
+  const int max_leaf = info[0];
+  __cpuid(info, 1);
+  const bool sse2 = (info[3] >> 26) & 1;
+  const bool osxsave = (info[2] >> 27) & 1;
+  const bool avx = (info[2] >> 28) & 1;
+  if (max_leaf >= 7 && osxsave && avx && (_xgetbv(0) & 0x6) == 0x6) {
+    __cpuidex(info, 7, 0);
+    if ((info[1] >> 5) & 1) {
+      return simd_isa::avx2;
+    }
+  }
+  return sse2 ? simd_isa::sse2 : simd_isa::scalar;
+#endif
+#elif defined(TINYSTL_SIMD_NEON)
+  return simd_isa::neon;
+#else
+  return simd_isa::scalar;
+#endif
+}
+
+// The instruction set the dispatching kernels use.
+inline simd_isa active_simd_isa() noexcept {
+  static const simd_isa isa = detect_simd_isa();
+  return isa;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                               scalar kernels                               */
+/* -------------------------------------------------------------------------- */
+template <std::size_t S>
+std::size_t scalar_find(const unsigned char *p, std::size_t n, simd_uint<S> value) noexcept {
+  std::size_t i = 0;
+  while (i < n && simd_load<S>(p + i * S) != value) {
+    ++i;
+  }
+  return i;
+}
+
+template <std::size_t S>
+std::size_t scalar_count(const unsigned char *p, std::size_t n, simd_uint<S> value) noexcept {
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    count += simd_load<S>(p + i * S) == value;
+  }
+  return count;
+}
+
+inline std::size_t scalar_mismatch(const unsigned char *a, const unsigned char *b, std::size_t n) noexcept {
+  std::size_t i = 0;
+  while (i < n && a[i] == b[i]) {
+    ++i;
+  }
+  return i;
+}
+
+// Compacts elements from index `in` on, writing survivors from index `out`.
+template <std::size_t S>
+std::size_t scalar_remove(
+  unsigned char *p, std::size_t in, std::size_t out, std::size_t n,
+  simd_uint<S> value
+) noexcept {
+  for (; in < n; ++in) {
+    simd_uint<S> element = simd_load<S>(p + in * S);
+    std::memcpy(p + out * S, &element, S);
+    out += element != value;
+  }
+  return out;
+}
+
+// Floating-point sums keep 128 bytes of partial sums: lane j adds the
+// elements whose index is j modulo the lane count, starting from -0.0, the
+// identity of addition. The lanes are folded pairwise in one fixed order.
+// Every kernel follows this scheme, so a sum comes out bit for bit the same
+// whichever instruction set computed it.
+template <simd_float F>
+inline constexpr std::size_t simd_sum_lanes = 128 / sizeof(F);
+
+// Adds the elements left over after the last full block into the lanes and
+// folds them.
+template <simd_float F>
+F simd_sum_finish(F *lanes, const F *tail, std::size_t n) noexcept {
+  for (std::size_t j = 0; j < n; ++j) {
+    lanes[j] += tail[j];
+  }
+  for (std::size_t width = simd_sum_lanes<F> / 2; width > 0; width /= 2) {
+    for (std::size_t j = 0; j < width; ++j) {
+      lanes[j] += lanes[j + width];
+    }
+  }
+  return lanes[0];
+}
+
+template <simd_float F>
+F simd_dot_finish(F *lanes, const F *a, const F *b, std::size_t n) noexcept {
+  for (std::size_t j = 0; j < n; ++j) {
+    lanes[j] += a[j] * b[j];
+  }
+  return simd_sum_finish<F>(lanes, a, 0);
+}
+
+template <simd_float F>
+F scalar_sum(const F *p, std::size_t n) noexcept {
+  constexpr std::size_t lanes = simd_sum_lanes<F>;
+  F acc[lanes];
+  std::fill_n(acc, lanes, F(-0.0));
+  std::size_t i = 0;
+  for (; i + lanes <= n; i += lanes) {
+    for (std::size_t j = 0; j < lanes; ++j) {
+      acc[j] += p[i + j];
+    }
+  }
+  return simd_sum_finish<F>(acc, p + i, n - i);
+}
+
+template <simd_float F>
+F scalar_dot(const F *a, const F *b, std::size_t n) noexcept {
+  constexpr std::size_t lanes = simd_sum_lanes<F>;
+  F acc[lanes];
+  std::fill_n(acc, lanes, F(-0.0));
+  std::size_t i = 0;
+  for (; i + lanes <= n; i += lanes) {
+    for (std::size_t j = 0; j < lanes; ++j) {
+      acc[j] += a[i + j] * b[i + j];
+    }
+  }
+  return simd_dot_finish<F>(acc, a + i, b + i, n - i);
+}
+
+#if defined(TINYSTL_SIMD_X86)
+/* -------------------------------------------------------------------------- */
+/*                                AVX2 kernels                                */
+/* -------------------------------------------------------------------------- */
+// Masks come from movemask, one bit per byte, so an element of S bytes sets
+// S consecutive bits.
+
+template <std::size_t S>
+TINYSTL_TARGET_AVX2 inline __m256i avx2_broadcast(simd_uint<S> value) noexcept {
+  if constexpr (S == 1) {
+    return _mm256_set1_epi8(static_cast<char>(value));
+  } else if constexpr (S == 2) {
+    return _mm256_set1_epi16(static_cast<short>(value));
+  } else if constexpr (S == 4) {
+    return _mm256_set1_epi32(static_cast<int>(value));
+  } else {
+    return _mm256_set1_epi64x(static_cast<long long>(value));
+  }
+}
+
+template <std::size_t S>
+TINYSTL_TARGET_AVX2 inline std::uint32_t avx2_match(const unsigned char *p, __m256i needle) noexcept {
+  __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+  __m256i eq;
+  if constexpr (S == 1) {
+    eq = _mm256_cmpeq_epi8(block, needle);
+  } else if constexpr (S == 2) {
+    eq = _mm256_cmpeq_epi16(block, needle);
+  } else if constexpr (S == 4) {
+    eq = _mm256_cmpeq_epi32(block, needle);
+  } else {
+    eq = _mm256_cmpeq_epi64(block, needle);
+  }
+  return static_cast<std::uint32_t>(_mm256_movemask_epi8(eq));
+}
+
+template <std::size_t S>
+TINYSTL_TARGET_AVX2 std::size_t avx2_find(const unsigned char *p, std::size_t n, simd_uint<S> value) noexcept {
+  constexpr std::size_t lanes = 32 / S;
+  const __m256i needle = avx2_broadcast<S>(value);
+  std::size_t i = 0;
+  for (; i + lanes <= n; i += lanes) {
+    if (std::uint32_t mask = avx2_match<S>(p + i * S, needle)) {
+      return i + static_cast<std::size_t>(std::countr_zero(mask)) / S;
+    }
+  }
+  return i + scalar_find<S>(p + i * S, n - i, value);
+}
+
+// Compare results are all-ones lanes, so subtracting them counts matches per
+// lane. Lanes of one or two bytes are drained before they can overflow.
+template <std::size_t S>
+inline constexpr std::size_t simd_count_flush = S == 1 ? 255 : S == 2 ? 65535 : SIZE_MAX;
+
+template <std::size_t S>
+TINYSTL_TARGET_AVX2 std::size_t avx2_count(const unsigned char *p, std::size_t n, simd_uint<S> value) noexcept {
+  constexpr std::size_t lanes = 32 / S;
+  const __m256i needle = avx2_broadcast<S>(value);
+  std::size_t count = 0;
+  std::size_t i = 0;
+  while (i + lanes <= n) {
+    __m256i acc = _mm256_setzero_si256();
+    for (std::size_t k = 0; k < simd_count_flush<S> && i + lanes <= n; ++k, i += lanes) {
+      __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i * S));
+      if constexpr (S == 1) {
+        acc = _mm256_sub_epi8(acc, _mm256_cmpeq_epi8(block, needle));
+      } else if constexpr (S == 2) {
+        acc = _mm256_sub_epi16(acc, _mm256_cmpeq_epi16(block, needle));
+      } else if constexpr (S == 4) {
+        acc = _mm256_sub_epi32(acc, _mm256_cmpeq_epi32(block, needle));
+      } else {
+        acc = _mm256_sub_epi64(acc, _mm256_cmpeq_epi64(block, needle));
+      }
+    }
+    simd_uint<S> partial[lanes];
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(partial), acc);
+    for (simd_uint<S> c : partial) {
+      count += c;
+    }
+  }
+  return count + scalar_count<S>(p + i * S, n - i, value);
+}
+
+TINYSTL_TARGET_AVX2 inline std::size_t avx2_mismatch(const unsigned char *a, const unsigned char *b, std::size_t n) noexcept {
+  std::size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+    __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+    std::uint32_t mask = ~static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)));
+    if (mask != 0) {
+      return i + static_cast<std::size_t>(std::countr_zero(mask));
+    }
+  }
+  return i + scalar_mismatch(a + i, b + i, n - i);
+}
+
+// Blocks without a match move as one store; only blocks holding matches are
+// compacted element by element. Stores never run ahead of the block being
+// read, so the loads always see unmodified input.
+template <std::size_t S>
+TINYSTL_TARGET_AVX2 std::size_t avx2_remove(unsigned char *p, std::size_t n, simd_uint<S> value) noexcept {
+  constexpr std::size_t lanes = 32 / S;
+  std::size_t out = avx2_find<S>(p, n, value);
+  if (out == n) {
+    return n;
+  }
+
+  const __m256i needle = avx2_broadcast<S>(value);
+  std::size_t in = out + 1;
+  for (; in + lanes <= n; in += lanes) {
+    std::uint32_t mask = avx2_match<S>(p + in * S, needle);
+    if (mask == 0) {
+      __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + in * S));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(p + out * S), block);
+      out += lanes;
+    } else {
+      for (std::size_t j = 0; j < lanes; ++j) {
+        std::memmove(p + out * S, p + (in + j) * S, S);
+        out += ((mask >> (j * S)) & 1) == 0;
+      }
+    }
+  }
+  return scalar_remove<S>(p, in, out, n, value);
+}
+
+// Selected by specialization: vector types lose their attributes as template
+// arguments.
+template <simd_float F>
+struct avx2_float_register {
+  using type = __m256;
+};
+
+template <>
+struct avx2_float_register<double> {
+  using type = __m256d;
+};
+
+template <simd_float F>
+using avx2_float = typename avx2_float_register<F>::type;
+
+template <simd_float F>
+TINYSTL_TARGET_AVX2 inline avx2_float<F> avx2_float_set(F value) noexcept {
+  if constexpr (std::is_same_v<F, double>) {
+    return _mm256_set1_pd(value);
+  } else {
+    return _mm256_set1_ps(value);
+  }
+}
+
+template <simd_float F>
+TINYSTL_TARGET_AVX2 inline avx2_float<F> avx2_float_load(const F *p) noexcept {
+  if constexpr (std::is_same_v<F, double>) {
+    return _mm256_loadu_pd(p);
+  } else {
+    return _mm256_loadu_ps(p);
+  }
+}
+
+template <simd_float F>
+TINYSTL_TARGET_AVX2 inline avx2_float<F> avx2_float_add(avx2_float<F> a, avx2_float<F> b) noexcept {
+  if constexpr (std::is_same_v<F, double>) {
+    return _mm256_add_pd(a, b);
+  } else {
+    return _mm256_add_ps(a, b);
+  }
+}
+
+template <simd_float F>
+TINYSTL_TARGET_AVX2 inline avx2_float<F> avx2_float_mul(avx2_float<F> a, avx2_float<F> b) noexcept {
+  if constexpr (std::is_same_v<F, double>) {
+    return _mm256_mul_pd(a, b);
+  } else {
+    return _mm256_mul_ps(a, b);
+  }
+}
+
+template <simd_float F>
+TINYSTL_TARGET_AVX2 inline void avx2_float_store(F *p, avx2_float<F> a) noexcept {
+  if constexpr (std::is_same_v<F, double>) {
+    _mm256_storeu_pd(p, a);
+  } else {
+    _mm256_storeu_ps(p, a);
+  }
+}
+
+// Four registers of partial sums keep four additions in flight.
+template <simd_float F>
+TINYSTL_TARGET_AVX2 F avx2_sum(const F *p, std::size_t n) noexcept {
+  constexpr std::size_t lanes = simd_sum_lanes<F>;
+  constexpr std::size_t width = 32 / sizeof(F);
+  avx2_float<F> acc[lanes / width];
+  for (auto &a : acc) {
+    a = avx2_float_set<F>(F(-0.0));
+  }
+  std::size_t i = 0;
+  for (; i + lanes <= n; i += lanes) {
+    for (std::size_t r = 0; r < lanes / width; ++r) {
+      acc[r] = avx2_float_add<F>(acc[r], avx2_float_load<F>(p + i + r * width));
+    }
+  }
+  F partial[lanes];
+  for (std::size_t r = 0; r < lanes / width; ++r) {
+    avx2_float_store<F>(partial + r * width, acc[r]);
+  }
+  return simd_sum_finish<F>(partial, p + i, n - i);
+}
+
+template <simd_float F>
+TINYSTL_TARGET_AVX2 F avx2_dot(const F *a, const F *b, std::size_t n) noexcept {
+  constexpr std::size_t lanes = simd_sum_lanes<F>;
+  constexpr std::size_t width = 32 / sizeof(F);
+  avx2_float<F> acc[lanes / width];
+  for (auto &x : acc) {
+    x = avx2_float_set<F>(F(-0.0));
+  }
+  std::size_t i = 0;
+  for (; i + lanes <= n; i += lanes) {
+    for (std::size_t r = 0; r < lanes / width; ++r) {
+      std::size_t at = i + r * width;
+      acc[r] = avx2_float_add<F>(acc[r], avx2_float_mul<F>(avx2_float_load<F>(a + at), avx2_float_load<F>(b + at)));
+    }
+  }
+  F partial[lanes];
+  for (std::size_t r = 0; r < lanes / width; ++r) {
+    avx2_float_store<F>(partial + r * width, acc[r]);
+  }
+  return simd_dot_finish<F>(partial, a + i, b + i, n - i);
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                SSE2 kernels                                */
+/* -------------------------------------------------------------------------- */
+template <std::size_t S>
+TINYSTL_TARGET_SSE2 inline __m128i sse2_broadcast(simd_uint<S> value) noexcept {
+  if constexpr (S == 1) {
+    return _mm_set1_epi8(static_cast<char>(value));
+  } else if constexpr (S == 2) {
+    return _mm_set1_epi16(static_cast<short>(value));
+  } else if constexpr (S == 4) {
+    return _mm_set1_epi32(static_cast<int>(value));
+  } else {
+    return _mm_set1_epi64x(static_cast<long long>(value));
+  }
+}
+
+template <std::size_t S>
+TINYSTL_TARGET_SSE2 inline std::uint32_t sse2_match(const unsigned char *p, __m128i needle) noexcept {
+  __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+  __m128i eq;
+  if constexpr (S == 1) {
+    eq = _mm_cmpeq_epi8(block, needle);
+  } else if constexpr (S == 2) {
+    eq = _mm_cmpeq_epi16(block, needle);
+  } else if constexpr (S == 4) {
+    eq = _mm_cmpeq_epi32(block, needle);
+  } else {
+    // SSE2 has no 64-bit compare: a lane matches when both of its halves do.
+    eq = _mm_cmpeq_epi32(block, needle);
+    eq = _mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1)));
+  }
+  return static_cast<std::uint32_t>(_mm_movemask_epi8(eq));
+}
+
+template <std::size_t S>
+TINYSTL_TARGET_SSE2 std::size_t sse2_find(const unsigned char *p, std::size_t n, simd_uint<S> value) noexcept {
+  constexpr std::size_t lanes = 16 / S;
+  const __m128i needle = sse2_broadcast<S>(value);
+  std::size_t i = 0;
+  for (; i + lanes <= n; i += lanes) {
+    if (std::uint32_t mask = sse2_match<S>(p + i * S, needle)) {
+      return i + static_cast<std::size_t>(std::countr_zero(mask)) / S;
+    }
+  }
+  return i + scalar_find<S>(p + i * S, n - i, value);
+}
+
+template <std::size_t S>
+TINYSTL_TARGET_SSE2 std::size_t sse2_count(const unsigned char *p, std::size_t n, simd_uint<S> value) noexcept {
+  constexpr std::size_t lanes = 16 / S;
+  const __m128i needle = sse2_broadcast<S>(value);
+  std::size_t count = 0;
+  std::size_t i = 0;
+  while (i + lanes <= n) {
+    __m128i acc = _mm_setzero_si128();
+    for (std::size_t k = 0; k < simd_count_flush<S> && i + lanes <= n; ++k, i += lanes) {
+      __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i * S));
+      if constexpr (S == 1) {
+        acc = _mm_sub_epi8(acc, _mm_cmpeq_epi8(block, needle));
+      } else if constexpr (S == 2) {
+        acc = _mm_sub_epi16(acc, _mm_cmpeq_epi16(block, needle));
+      } else {
+        // Each matching 64-bit lane adds one to both of its 32-bit halves.
+        __m128i eq = _mm_cmpeq_epi32(block, needle);
+        if constexpr (S == 8) {
+          eq = _mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1)));
+        }
+        acc = _mm_sub_epi32(acc, eq);
+      }
+    }
+    if constexpr (S <= 2) {
+      simd_uint<S> partial[lanes];
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(partial), acc);
+      for (simd_uint<S> c : partial) {
+        count += c;
+      }
+    } else {
+      std::uint32_t partial[4];
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(partial), acc);
+      std::size_t sum = std::size_t(partial[0]) + partial[1] + partial[2] + partial[3];
+      count += S == 8 ? sum / 2 : sum;
+    }
+  }
+  return count + scalar_count<S>(p + i * S, n - i, value);
+}
+
+TINYSTL_TARGET_SSE2 inline std::size_t sse2_mismatch(const unsigned char *a, const unsigned char *b, std::size_t n) noexcept {
+  std::size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+    __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i));
+    std::uint32_t mask = ~static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, y))) & 0xffff;
+    if (mask != 0) {
+      return i + static_cast<std::size_t>(std::countr_zero(mask));
+    }
+  }
+  return i + scalar_mismatch(a + i, b + i, n - i);
+}
+
+template <std::size_t S>
+TINYSTL_TARGET_SSE2 std::size_t sse2_remove(unsigned char *p, std::size_t n, simd_uint<S> value) noexcept {
+  constexpr std::size_t lanes = 16 / S;
+  std::size_t out = sse2_find<S>(p, n, value);
+  if (out == n) {
+    return n;
+  }
+
+  const __m128i needle = sse2_broadcast<S>(value);
+  std::size_t in = out + 1;
+  for (; in + lanes <= n; in += lanes) {
+    std::uint32_t mask = sse2_match<S>(p + in * S, needle);
+    if (mask == 0) {
+      __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + in * S));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(p + out * S), block);
+      out += lanes;
+    } else {
+      for (std::size_t j = 0; j < lanes; ++j) {
+        std::memmove(p + out * S, p + (in + j) * S, S);
+        out += ((mask >> (j * S)) & 1) == 0;
+      }
+    }
+  }
+  return scalar_remove<S>(p, in, out, n, value);
+}
+
+template <simd_float F>
+struct sse2_float_register {
+  using type = __m128;
+};
+
+template <>
+struct sse2_float_register<double> {
+  using type = __m128d;
+};
+
+template <simd_float F>
+using sse2_float = typename sse2_float_register<F>::type;
+
+template <simd_float F>
+TINYSTL_TARGET_SSE2 inline sse2_float<F> sse2_float_set(F value) noexcept {
+  if constexpr (std::is_same_v<F, double>) {
+    return _mm_set1_pd(value);
+  } else {
+    return _mm_set1_ps(value);
+  }
+}
+
+template <simd_float F>
+TINYSTL_TARGET_SSE2 inline sse2_float<F> sse2_float_load(const F *p) noexcept {
+  if constexpr (std::is_same_v<F, double>) {
+    return _mm_loadu_pd(p);
+  } else {
+    return _mm_loadu_ps(p);
+  }
+}
+
+template <simd_float F>
+TINYSTL_TARGET_SSE2 inline sse2_float<F> sse2_float_add(sse2_float<F> a, sse2_float<F> b) noexcept {
+  if constexpr (std::is_same_v<F, double>) {
+    return _mm_add_pd(a, b);
+  } else {
+    return _mm_add_ps(a, b);
+  }
+}
+
+template <simd_float F>
+TINYSTL_TARGET_SSE2 inline sse2_float<F> sse2_float_mul(sse2_float<F> a, sse2_float<F> b) noexcept {
+  if constexpr (std::is_same_v<F, double>) {
+    return _mm_mul_pd(a, b);
+  } else {
+    return _mm_mul_ps(a, b);
+  }
+}
+
+template <simd_float F>
+TINYSTL_TARGET_SSE2 inline void sse2_float_store(F *p, sse2_float<F> a) noexcept {
+  if constexpr (std::is_same_v<F, double>) {
+    _mm_storeu_pd(p, a);
+  } else {
+    _mm_storeu_ps(p, a);
+  }
+}
+
+template <simd_float F>
+TINYSTL_TARGET_SSE2 F sse2_sum(const F *p, std::size_t n) noexcept {
+  constexpr std::size_t lanes = simd_sum_lanes<F>;
+  constexpr std::size_t width = 16 / sizeof(F);
+  sse2_float<F> acc[lanes / width];
+  for (auto &a : acc) {
+    a = sse2_float_set<F>(F(-0.0));
+  }
+  std::size_t i = 0;
+  for (; i + lanes <= n; i += lanes) {
+    for (std::size_t r = 0; r < lanes / width; ++r) {
+      acc[r] = sse2_float_add<F>(acc[r], sse2_float_load<F>(p + i + r * width));
+    }
+  }
+  F partial[lanes];
+  for (std::size_t r = 0; r < lanes / width; ++r) {
+    sse2_float_store<F>(partial + r * width, acc[r]);
+  }
+  return simd_sum_finish<F>(partial, p + i, n - i);
+}
+
+template <simd_float F>
+TINYSTL_TARGET_SSE2 F sse2_dot(const F *a, const F *b, std::size_t n) noexcept {
+  constexpr std::size_t lanes = simd_sum_lanes<F>;
+  constexpr std::size_t width = 16 / sizeof(F);
+  sse2_float<F> acc[lanes / width];
+  for (auto &x : acc) {
+    x = sse2_float_set<F>(F(-0.0));
+  }
+  std::size_t i = 0;
+  for (; i + lanes <= n; i += lanes) {
+    for (std::size_t r = 0; r < lanes / width; ++r) {
+      std::size_t at = i + r * width;
+      acc[r] = sse2_float_add<F>(acc[r], sse2_float_mul<F>(sse2_float_load<F>(a + at), sse2_float_load<F>(b + at)));
+    }
+  }
+  F partial[lanes];
+  for (std::size_t r = 0; r < lanes / width; ++r) {
+    sse2_float_store<F>(partial + r * width, acc[r]);
+  }
+  return simd_dot_finish<F>(partial, a + i, b + i, n - i);
+}
+#endif
+
+#if defined(TINYSTL_SIMD_NEON)
+/* -------------------------------------------------------------------------- */
+/*                                NEON kernels                                */
+/* -------------------------------------------------------------------------- */
+// NEON has no movemask. Narrowing each 16-bit pair of compare bytes by 4
+// packs the 16 byte results into a 64-bit mask, four bits per byte.
+
+inline std::uint64_t neon_mask(uint8x16_t eq) noexcept {
+  uint8x8_t packed = vshrn_n_u16(vreinterpretq_u16_u8(eq), 4);
+  return vget_lane_u64(vreinterpret_u64_u8(packed), 0);
+}
+
+template <std::size_t S>
+inline std::uint64_t neon_match(const unsigned char *p, simd_uint<S> value) noexcept {
+  if constexpr (S == 1) {
+    return neon_mask(vceqq_u8(vld1q_u8(p), vdupq_n_u8(value)));
+  } else if constexpr (S == 2) {
+    uint16x8_t block = vreinterpretq_u16_u8(vld1q_u8(p));
+    return neon_mask(vreinterpretq_u8_u16(vceqq_u16(block, vdupq_n_u16(value))));
+  } else if constexpr (S == 4) {
+    uint32x4_t block = vreinterpretq_u32_u8(vld1q_u8(p));
+    return neon_mask(vreinterpretq_u8_u32(vceqq_u32(block, vdupq_n_u32(value))));
+  } else {
+    uint64x2_t block = vreinterpretq_u64_u8(vld1q_u8(p));
+    return neon_mask(vreinterpretq_u8_u64(vceqq_u64(block, vdupq_n_u64(value))));
+  }
+}
+
+template <std::size_t S>
+std::size_t neon_find(const unsigned char *p, std::size_t n, simd_uint<S> value) noexcept {
+  constexpr std::size_t lanes = 16 / S;
+  std::size_t i = 0;
+  for (; i + lanes <= n; i += lanes) {
+    if (std::uint64_t mask = neon_match<S>(p + i * S, value)) {
+      return i + static_cast<std::size_t>(std::countr_zero(mask)) / (4 * S);
+    }
+  }
+  return i + scalar_find<S>(p + i * S, n - i, value);
+}
+
+template <std::size_t S>
+std::size_t neon_count(const unsigned char *p, std::size_t n, simd_uint<S> value) noexcept {
+  constexpr std::size_t lanes = 16 / S;
+  std::size_t bits = 0;
+  std::size_t i = 0;
+  for (; i + lanes <= n; i += lanes) {
+    bits += static_cast<std::size_t>(std::popcount(neon_match<S>(p + i * S, value)));
+  }
+  return bits / (4 * S) + scalar_count<S>(p + i * S, n - i, value);
+}
+
+inline std::size_t neon_mismatch(const unsigned char *a, const unsigned char *b, std::size_t n) noexcept {
+  std::size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    std::uint64_t mask = ~neon_mask(vceqq_u8(vld1q_u8(a + i), vld1q_u8(b + i)));
+    if (mask != 0) {
+      return i + static_cast<std::size_t>(std::countr_zero(mask)) / 4;
+    }
+  }
+  return i + scalar_mismatch(a + i, b + i, n - i);
+}
+
+template <std::size_t S>
+std::size_t neon_remove(unsigned char *p, std::size_t n, simd_uint<S> value) noexcept {
+  constexpr std::size_t lanes = 16 / S;
+  std::size_t out = neon_find<S>(p, n, value);
+  if (out == n) {
+    return n;
+  }
+
+  std::size_t in = out + 1;
+  for (; in + lanes <= n; in += lanes) {
+    std::uint64_t mask = neon_match<S>(p + in * S, value);
+    if (mask == 0) {
+      vst1q_u8(p + out * S, vld1q_u8(p + in * S));
+      out += lanes;
+    } else {
+      for (std::size_t j = 0; j < lanes; ++j) {
+        std::memmove(p + out * S, p + (in + j) * S, S);
+        out += ((mask >> (j * S * 4)) & 1) == 0;
+      }
+    }
+  }
+  return scalar_remove<S>(p, in, out, n, value);
+}
+
+template <simd_float F>
+struct neon_float_register {
+  using type = float32x4_t;
+};
+
+template <>
+struct neon_float_register<double> {
+  using type = float64x2_t;
+};
+
+template <simd_float F>
+using neon_float = typename neon_float_register<F>::type;
+
+template <simd_float F>
+inline neon_float<F> neon_float_set(F value) noexcept {
+  if constexpr (std::is_same_v<F, double>) {
+    return vdupq_n_f64(value);
+  } else {
+    return vdupq_n_f32(value);
+  }
+}
+
+template <simd_float F>
+inline neon_float<F> neon_float_load(const F *p) noexcept {
+  if constexpr (std::is_same_v<F, double>) {
+    return vld1q_f64(p);
+  } else {
+    return vld1q_f32(p);
+  }
+}
+
+template <simd_float F>
+inline neon_float<F> neon_float_add(neon_float<F> a, neon_float<F> b) noexcept {
+  if constexpr (std::is_same_v<F, double>) {
+    return vaddq_f64(a, b);
+  } else {
+    return vaddq_f32(a, b);
+  }
+}
+
+template <simd_float F>
+inline neon_float<F> neon_float_mul(neon_float<F> a, neon_float<F> b) noexcept {
+  if constexpr (std::is_same_v<F, double>) {
+    return vmulq_f64(a, b);
+  } else {
+    return vmulq_f32(a, b);
+  }
+}
+
+template <simd_float F>
+inline void neon_float_store(F *p, neon_float<F> a) noexcept {
+  if constexpr (std::is_same_v<F, double>) {
+    vst1q_f64(p, a);
+  } else {
+    vst1q_f32(p, a);
+  }
+}
+
+template <simd_float F>
+F neon_sum(const F *p, std::size_t n) noexcept {
+  constexpr std::size_t lanes = simd_sum_lanes<F>;
+  constexpr std::size_t width = 16 / sizeof(F);
+  neon_float<F> acc[lanes / width];
+  for (auto &a : acc) {
+    a = neon_float_set<F>(F(-0.0));
+  }
+  std::size_t i = 0;
+  for (; i + lanes <= n; i += lanes) {
+    for (std::size_t r = 0; r < lanes / width; ++r) {
+      acc[r] = neon_float_add<F>(acc[r], neon_float_load<F>(p + i + r * width));
+    }
+  }
+  F partial[lanes];
+  for (std::size_t r = 0; r < lanes / width; ++r) {
+    neon_float_store<F>(partial + r * width, acc[r]);
+  }
+  return simd_sum_finish<F>(partial, p + i, n - i);
+}
+
+template <simd_float F>
+F neon_dot(const F *a, const F *b, std::size_t n) noexcept {
+  constexpr std::size_t lanes = simd_sum_lanes<F>;
+  constexpr std::size_t width = 16 / sizeof(F);
+  neon_float<F> acc[lanes / width];
+  for (auto &x : acc) {
+    x = neon_float_set<F>(F(-0.0));
+  }
+  std::size_t i = 0;
+  for (; i + lanes <= n; i += lanes) {
+    for (std::size_t r = 0; r < lanes / width; ++r) {
+      std::size_t at = i + r * width;
+      acc[r] = neon_float_add<F>(acc[r], neon_float_mul<F>(neon_float_load<F>(a + at), neon_float_load<F>(b + at)));
+    }
+  }
+  F partial[lanes];
+  for (std::size_t r = 0; r < lanes / width; ++r) {
+    neon_float_store<F>(partial + r * width, acc[r]);
+  }
+  return simd_dot_finish<F>(partial, a + i, b + i, n - i);
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+/*                                 dispatchers                                */
+/* -------------------------------------------------------------------------- */
+// Index of the first element of p[0, n) equal to value, or n.
+template <std::size_t S>
+std::size_t simd_find(const unsigned char *p, std::size_t n, simd_uint<S> value) noexcept {
+#if defined(TINYSTL_SIMD_X86)
+  switch (active_simd_isa()) {
+  case simd_isa::avx2:
+    return avx2_find<S>(p, n, value);
+  case simd_isa::sse2:
+    return sse2_find<S>(p, n, value);
+  default:
+    break;
+  }
+#elif defined(TINYSTL_SIMD_NEON)
+  return neon_find<S>(p, n, value);
+#endif
+  return scalar_find<S>(p, n, value);
+}
+
+template <std::size_t S>
+std::size_t simd_count(const unsigned char *p, std::size_t n, simd_uint<S> value) noexcept {
+#if defined(TINYSTL_SIMD_X86)
+  switch (active_simd_isa()) {
+  case simd_isa::avx2:
+    return avx2_count<S>(p, n, value);
+  case simd_isa::sse2:
+    return sse2_count<S>(p, n, value);
+  default:
+    break;
+  }
+#elif defined(TINYSTL_SIMD_NEON)
+  return neon_count<S>(p, n, value);
+#endif
+  return scalar_count<S>(p, n, value);
+}
+
+// Index of the first differing byte of a[0, n) and b[0, n), or n.
+inline std::size_t simd_mismatch(const unsigned char *a, const unsigned char *b, std::size_t n) noexcept {
+#if defined(TINYSTL_SIMD_X86)
+  switch (active_simd_isa()) {
+  case simd_isa::avx2:
+    return avx2_mismatch(a, b, n);
+  case simd_isa::sse2:
+    return sse2_mismatch(a, b, n);
+  default:
+    break;
+  }
+#elif defined(TINYSTL_SIMD_NEON)
+  return neon_mismatch(a, b, n);
+#endif
+  return scalar_mismatch(a, b, n);
+}
+
+// Removes the elements equal to value and returns the new element count.
+template <std::size_t S>
+std::size_t simd_remove(unsigned char *p, std::size_t n, simd_uint<S> value) noexcept {
+#if defined(TINYSTL_SIMD_X86)
+  switch (active_simd_isa()) {
+  case simd_isa::avx2:
+    return avx2_remove<S>(p, n, value);
+  case simd_isa::sse2:
+    return sse2_remove<S>(p, n, value);
+  default:
+    break;
+  }
+#elif defined(TINYSTL_SIMD_NEON)
+  return neon_remove<S>(p, n, value);
+#endif
+  std::size_t out = scalar_find<S>(p, n, value);
+  return out == n ? n : scalar_remove<S>(p, out + 1, out, n, value);
+}
+
+// Sum of p[0, n), identical on every instruction set.
+template <simd_float F>
+F simd_sum(const F *p, std::size_t n) noexcept {
+#if defined(TINYSTL_SIMD_X86)
+  switch (active_simd_isa()) {
+  case simd_isa::avx2:
+    return avx2_sum<F>(p, n);
+  case simd_isa::sse2:
+    return sse2_sum<F>(p, n);
+  default:
+    break;
+  }
+#elif defined(TINYSTL_SIMD_NEON)
+  return neon_sum<F>(p, n);
+#endif
+  return scalar_sum<F>(p, n);
+}
+
+// Sum of a[i] * b[i] over [0, n). Identical on every instruction set unless
+// the compiler fuses the multiply into the add on some of them.
+template <simd_float F>
+F simd_dot(const F *a, const F *b, std::size_t n) noexcept {
+#if defined(TINYSTL_SIMD_X86)
+  switch (active_simd_isa()) {
+  case simd_isa::avx2:
+    return avx2_dot<F>(a, b, n);
+  case simd_isa::sse2:
+    return sse2_dot<F>(a, b, n);
+  default:
+    break;
+  }
+#elif defined(TINYSTL_SIMD_NEON)
+  return neon_dot<F>(a, b, n);
+#endif
+  return scalar_dot<F>(a, b, n);
+}
+
+} // namespace detail
+
+} // namespace tinystl
@@ -0,0 +1,526 @@
+#pragma once
+
+// https://en.cppreference.com/w/cpp/algorithm/sort.html
+// https://en.cppreference.com/w/cpp/algorithm/stable_sort.html
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "tinystl/execution/execution.h"
+
+namespace tinystl {
+
+namespace detail {
+
+/* -------------------------------------------------------------------------- */
+/*                              pattern-defeating                             */
+/*                                  quicksort                                 */
+/* -------------------------------------------------------------------------- */
+// Orson Peters' pdqsort: introsort with median-of-3/ninther pivots, a cheap
+// check for already partitioned input, a fast path for runs of equal keys,
+// and pattern-breaking swaps before falling back to heapsort.
+
+inline constexpr std::ptrdiff_t insertion_sort_threshold = 24;
+inline constexpr std::ptrdiff_t ninther_threshold = 128;
+inline constexpr std::ptrdiff_t partial_insertion_sort_limit = 8;
+
+template <class Iter, class Compare>
+void insertion_sort(Iter begin, Iter end, Compare &comp) {
+  using T = std::iter_value_t<Iter>;
+  if (begin == end) {
+    return;
+  }
+
+  for (Iter cur = begin + 1; cur != end; ++cur) {
+    Iter sift = cur;
+    Iter sift_1 = cur - 1;
+    if (comp(*sift, *sift_1)) {
+      T tmp = std::move(*sift);
+      do {
+        *sift-- = std::move(*sift_1);
+      } while (sift != begin && comp(tmp, *--sift_1));
+      *sift = std::move(tmp);
+    }
+  }
+}
+
+// Requires *(begin - 1) to be no greater than any element of [begin, end).
+template <class Iter, class Compare>
+void unguarded_insertion_sort(Iter begin, Iter end, Compare &comp) {
+  using T = std::iter_value_t<Iter>;
+  if (begin == end) {
+    return;
+  }
+
+  for (Iter cur = begin + 1; cur != end; ++cur) {
+    Iter sift = cur;
+    Iter sift_1 = cur - 1;
+    if (comp(*sift, *sift_1)) {
+      T tmp = std::move(*sift);
+      do {
+        *sift-- = std::move(*sift_1);
+      } while (comp(tmp, *--sift_1));
+      *sift = std::move(tmp);
+    }
+  }
+}
+
+// Insertion sort that gives up after a few element moves, reporting whether
+// it finished.
+template <class Iter, class Compare>
+bool partial_insertion_sort(Iter begin, Iter end, Compare &comp) {
+  using T = std::iter_value_t<Iter>;
+  if (begin == end) {
+    return true;
+  }
+
+  std::ptrdiff_t limit = 0;
+  for (Iter cur = begin + 1; cur != end; ++cur) {
+    Iter sift = cur;
+    Iter sift_1 = cur - 1;
+    if (comp(*sift, *sift_1)) {
+      T tmp = std::move(*sift);
+      do {
+        *sift-- = std::move(*sift_1);
+      } while (sift != begin && comp(tmp, *--sift_1));
+      *sift = std::move(tmp);
+      limit += cur - sift;
+    }
+    if (limit > partial_insertion_sort_limit) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <class Iter, class Compare>
+void sort2(Iter a, Iter b, Compare &comp) {
+  if (comp(*b, *a)) {
+    std::iter_swap(a, b);
+  }
+}
+
+template <class Iter, class Compare>
+void sort3(Iter a, Iter b, Iter c, Compare &comp) {
+  sort2(a, b, comp);
+  sort2(b, c, comp);
+  sort2(a, b, comp);
+}
+
+// Partitions around *begin, putting elements equal to the pivot on the right.
+// Returns the pivot's final position and whether the range was already
+// partitioned.
+template <class Iter, class Compare>
+std::pair<Iter, bool> partition_right(Iter begin, Iter end, Compare &comp) {
+  using T = std::iter_value_t<Iter>;
+  T pivot(std::move(*begin));
+  Iter first = begin;
+  Iter last = end;
+
+  // The median-of-3 guarantees an element >= pivot exists on the right.
+  while (comp(*++first, pivot)) {
+  }
+  if (first - 1 == begin) {
+    while (first < last && !comp(*--last, pivot)) {
+    }
+  } else {
+    while (!comp(*--last, pivot)) {
+    }
+  }
+
+  bool already_partitioned = first >= last;
+  while (first < last) {
+    std::iter_swap(first, last);
+    while (comp(*++first, pivot)) {
+    }
+    while (!comp(*--last, pivot)) {
+    }
+  }
+
+  Iter pivot_pos = first - 1;
+  *begin = std::move(*pivot_pos);
+  *pivot_pos = std::move(pivot);
+  return {pivot_pos, already_partitioned};
+}
+
+// Partitions around *begin, putting elements equal to the pivot on the left.
+// Used when the pivot equals the element just before the range, so all of
+// the left part is equal and needs no further sorting.
+template <class Iter, class Compare>
+Iter partition_left(Iter begin, Iter end, Compare &comp) {
+  using T = std::iter_value_t<Iter>;
+  T pivot(std::move(*begin));
+  Iter first = begin;
+  Iter last = end;
+
+  while (comp(pivot, *--last)) {
+  }
+  if (last + 1 == end) {
+    while (first < last && !comp(pivot, *++first)) {
+    }
+  } else {
+    while (!comp(pivot, *++first)) {
+    }
+  }
+
+  while (first < last) {
+    std::iter_swap(first, last);
+    while (comp(pivot, *--last)) {
+    }
+    while (!comp(pivot, *++first)) {
+    }
+  }
+
+  Iter pivot_pos = last;
+  *begin = std::move(*pivot_pos);
+  *pivot_pos = std::move(pivot);
+  return pivot_pos;
+}
+
+// Sorts [begin, end), handing the left part of each partition to
+// recurse(begin, pivot_pos, bad_allowed, leftmost) and looping on the right.
+// The sequential sort recurses directly; the parallel one may fork instead.
+template <class Iter, class Compare, class Recurse>
+void pdqsort_loop(
+  Iter begin, Iter end, Compare &comp, int bad_allowed, bool leftmost,
+  Recurse &&recurse
+) {
+  for (;;) {
+    std::ptrdiff_t size = end - begin;
+    if (size < insertion_sort_threshold) {
+      if (leftmost) {
+        insertion_sort(begin, end, comp);
+      } else {
+        unguarded_insertion_sort(begin, end, comp);
+      }
+      return;
+    }
+
+    std::ptrdiff_t s2 = size / 2;
+    if (size > ninther_threshold) {
+      sort3(begin, begin + s2, end - 1, comp);
+      sort3(begin + 1, begin + (s2 - 1), end - 2, comp);
+      sort3(begin + 2, begin + (s2 + 1), end - 3, comp);
+      sort3(begin + (s2 - 1), begin + s2, begin + (s2 + 1), comp);
+      std::iter_swap(begin, begin + s2);
+    } else {
+      sort3(begin + s2, begin, end - 1, comp);
+    }
+
+    if (!leftmost && !comp(*(begin - 1), *begin)) {
+      begin = partition_left(begin, end, comp) + 1;
+      continue;
+    }
+
+    auto [pivot_pos, already_partitioned] = partition_right(begin, end, comp);
+    std::ptrdiff_t l_size = pivot_pos - begin;
+    std::ptrdiff_t r_size = end - (pivot_pos + 1);
+
+    if (l_size < size / 8 || r_size < size / 8) {
+      if (--bad_allowed == 0) {
+        std::make_heap(begin, end, comp);
+        std::sort_heap(begin, end, comp);
+        return;
+      }
+
+      if (l_size >= insertion_sort_threshold) {
+        std::iter_swap(begin, begin + l_size / 4);
+        std::iter_swap(pivot_pos - 1, pivot_pos - l_size / 4);
+        if (l_size > ninther_threshold) {
+          std::iter_swap(begin + 1, begin + (l_size / 4 + 1));
+          std::iter_swap(begin + 2, begin + (l_size / 4 + 2));
+          std::iter_swap(pivot_pos - 2, pivot_pos - (l_size / 4 + 1));
+          std::iter_swap(pivot_pos - 3, pivot_pos - (l_size / 4 + 2));
+        }
+      }
+
+      if (r_size >= insertion_sort_threshold) {
+        std::iter_swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
+        std::iter_swap(end - 1, end - r_size / 4);
+        if (r_size > ninther_threshold) {
+          std::iter_swap(pivot_pos + 2, pivot_pos + (2 + r_size / 4));
+          std::iter_swap(pivot_pos + 3, pivot_pos + (3 + r_size / 4));
+          std::iter_swap(end - 2, end - (1 + r_size / 4));
+          std::iter_swap(end - 3, end - (2 + r_size / 4));
+        }
+      }
+    } else if (already_partitioned &&
+               partial_insertion_sort(begin, pivot_pos, comp) &&
+               partial_insertion_sort(pivot_pos + 1, end, comp)) {
+      return;
+    }
+
+    recurse(begin, pivot_pos, bad_allowed, leftmost);
+    begin = pivot_pos + 1;
+    leftmost = false;
+  }
+}
+
+template <class Iter>
+int pdqsort_bad_allowed(Iter begin, Iter end) {
+  return std::bit_width(static_cast<std::size_t>(end - begin));
+}
+
+template <class Iter, class Compare>
+void pdqsort(Iter begin, Iter end, Compare &comp, int bad_allowed, bool leftmost) {
+  pdqsort_loop(
+    begin, end, comp, bad_allowed, leftmost,
+    [&comp](Iter b, Iter e, int bad, bool left) {
+      detail::pdqsort(b, e, comp, bad, left);
+    }
+  );
+}
+
+template <class Iter, class Compare>
+void pdqsort(Iter begin, Iter end, Compare &comp) {
+  detail::pdqsort(begin, end, comp, pdqsort_bad_allowed(begin, end), true);
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                 radix sort                                 */
+/* -------------------------------------------------------------------------- */
+// LSD radix sort for arithmetic keys under the default ordering. Keys are
+// mapped to unsigned integers whose order matches operator<, then sorted one
+// byte at a time through a scratch buffer. A pass is skipped when every key
+// has the same byte in that position, so narrow value ranges cost few passes.
+// Radix sort is stable, so stable_sort uses it too.
+
+template <class T>
+concept radix_sortable =
+  std::is_arithmetic_v<T> && !std::same_as<T, bool> && sizeof(T) <= 8;
+
+template <class Compare, class T>
+concept default_ordering =
+  std::same_as<Compare, std::less<>> || std::same_as<Compare, std::less<T>> ||
+  std::same_as<Compare, std::ranges::less>;
+
+template <class Iter, class Compare>
+concept radix_sort_eligible =
+  std::contiguous_iterator<Iter> && radix_sortable<std::iter_value_t<Iter>> &&
+  default_ordering<Compare, std::iter_value_t<Iter>>;
+
+inline constexpr std::ptrdiff_t radix_sort_threshold = 1024;
+
+template <class T>
+using radix_key_t = std::conditional_t<
+  sizeof(T) == 1, std::uint8_t,
+  std::conditional_t<
+    sizeof(T) == 2, std::uint16_t,
+    std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>>>;
+
+template <class T>
+radix_key_t<T> radix_key(T value) noexcept {
+  using key_type = radix_key_t<T>;
+  constexpr key_type sign_bit = key_type(1) << (sizeof(T) * 8 - 1);
+
+  if constexpr (std::is_floating_point_v<T>) {
+    // -0.0 and +0.0 compare equal, so they must map to the same key for
+    // stable_sort to keep their relative order.
+    if (value == T(0)) {
+      value = T(0);
+    }
+    key_type bits = std::bit_cast<key_type>(value);
+    return (bits & sign_bit) ? static_cast<key_type>(~bits)
+                             : static_cast<key_type>(bits | sign_bit);
+  } else if constexpr (std::is_signed_v<T>) {
+    return static_cast<key_type>(static_cast<key_type>(value) ^ sign_bit);
+  } else {
+    return static_cast<key_type>(value);
+  }
+}
+
+template <class T>
+void radix_sort(T *first, T *last) {
+  constexpr std::size_t passes = sizeof(T);
+  const std::size_t n = static_cast<std::size_t>(last - first);
+
+  std::size_t counts[passes][256] = {};
+  for (T *p = first; p != last; ++p) {
+    auto key = radix_key(*p);
+    for (std::size_t pass = 0; pass < passes; ++pass) {
+      ++counts[pass][(key >> (pass * 8)) & 0xff];
+    }
+  }
+
+  auto buffer = std::make_unique_for_overwrite<T[]>(n);
+  T *src = first;
+  T *dst = buffer.get();
+  for (std::size_t pass = 0; pass < passes; ++pass) {
+    std::size_t *count = counts[pass];
+    if (std::find(count, count + 256, n) != count + 256) {
+      continue;
+    }
+
+    std::size_t offset = 0;
+    for (std::size_t digit = 0; digit < 256; ++digit) {
+      std::size_t c = count[digit];
+      count[digit] = offset;
+      offset += c;
+    }
+    for (T *p = src; p != src + n; ++p) {
+      dst[count[(radix_key(*p) >> (pass * 8)) & 0xff]++] = *p;
+    }
+    std::swap(src, dst);
+  }
+
+  if (src != first) {
+    std::copy(src, src + n, first);
+  }
+}
+
+/* -------------------------------------------------------------------------- */
+/*                               sequential sort                              */
+/* -------------------------------------------------------------------------- */
+template <class Iter, class Compare>
+void sort(Iter first, Iter last, Compare &comp) {
+  if constexpr (radix_sort_eligible<Iter, Compare>) {
+    if (last - first >= radix_sort_threshold) {
+      radix_sort(std::to_address(first), std::to_address(last));
+      return;
+    }
+  }
+  pdqsort(first, last, comp);
+}
+
+template <class Iter, class Compare>
+void stable_sort(Iter first, Iter last, Compare &comp) {
+  if constexpr (radix_sort_eligible<Iter, Compare>) {
+    if (last - first >= radix_sort_threshold) {
+      radix_sort(std::to_address(first), std::to_address(last));
+      return;
+    }
+  }
+  std::stable_sort(first, last, comp);
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                parallel sort                               */
+/* -------------------------------------------------------------------------- */
+// Below this many elements a partition is sorted on the thread that made it.
+inline constexpr std::ptrdiff_t parallel_sort_grain = 1 << 14;
+
+// Quicksort whose partitions above the grain size are forked into the task
+// group. Every fork sorts a range disjoint from the others, and the pivots
+// that separate them are never moved again, so unguarded insertion sort can
+// still read the element before its range.
+template <class Iter, class Compare>
+void parallel_pdqsort(
+  Iter begin, Iter end, Compare comp, int bad_allowed, bool leftmost,
+  task_group &group
+) {
+  if (end - begin <= parallel_sort_grain) {
+    if (leftmost) {
+      detail::sort(begin, end, comp);
+    } else {
+      pdqsort(begin, end, comp, bad_allowed, leftmost);
+    }
+    return;
+  }
+
+  pdqsort_loop(
+    begin, end, comp, bad_allowed, leftmost,
+    [&comp, &group](Iter b, Iter e, int bad, bool left) {
+      if (e - b > parallel_sort_grain) {
+        group.run([b, e, comp, bad, left, &group] {
+          parallel_pdqsort(b, e, comp, bad, left, group);
+        });
+      } else {
+        pdqsort(b, e, comp, bad, left);
+      }
+    }
+  );
+}
+
+template <class Iter, class Compare>
+void parallel_sort(thread_pool &pool, Iter first, Iter last, Compare &comp) {
+  if (last - first <= parallel_sort_grain || pool.size() < 2) {
+    detail::sort(first, last, comp);
+    return;
+  }
+
+  task_group group(pool);
+  group.run([&] {
+    parallel_pdqsort(
+      first, last, comp, pdqsort_bad_allowed(first, last), true, group
+    );
+  });
+  group.wait();
+}
+
+// Sorts equal-sized blocks in parallel, then merges neighbouring runs in
+// rounds, each round's merges running in parallel.
+template <class Iter, class Compare>
+void parallel_stable_sort(thread_pool &pool, Iter first, Iter last, Compare &comp) {
+  std::ptrdiff_t n = last - first;
+  std::ptrdiff_t blocks = static_cast<std::ptrdiff_t>(std::bit_ceil(pool.size()));
+  if (n <= parallel_sort_grain || blocks < 2) {
+    detail::stable_sort(first, last, comp);
+    return;
+  }
+
+  std::ptrdiff_t block = (n + blocks - 1) / blocks;
+  auto bound = [&](std::ptrdiff_t i) { return first + std::min(n, i * block); };
+
+  task_group group(pool);
+  for (std::ptrdiff_t i = 0; i < blocks; ++i) {
+    group.run([&, i] { detail::stable_sort(bound(i), bound(i + 1), comp); });
+  }
+  group.wait();
+
+  for (std::ptrdiff_t width = 1; width < blocks; width *= 2) {
+    for (std::ptrdiff_t i = 0; i + width < blocks; i += 2 * width) {
+      group.run([&, i, width] {
+        std::inplace_merge(
+          bound(i), bound(i + width), bound(std::min(blocks, i + 2 * width)),
+          comp
+        );
+      });
+    }
+    group.wait();
+  }
+}
+
+} // namespace detail
+
+/* -------------------------------------------------------------------------- */
+/*                                    sort                                    */
+/* -------------------------------------------------------------------------- */
+// Unstable sort: radix sort for arithmetic keys under the default ordering
+// on contiguous ranges, pdqsort otherwise.
+template <std::random_access_iterator Iter, class Compare = std::less<>>
+void sort(Iter first, Iter last, Compare comp = Compare()) {
+  detail::sort(first, last, comp);
+}
+
+template <execution_policy ExecutionPolicy, std::random_access_iterator Iter, class Compare = std::less<>>
+void sort(ExecutionPolicy &&policy, Iter first, Iter last, Compare comp = Compare()) {
+  if constexpr (std::is_same_v<std::remove_cvref_t<ExecutionPolicy>, execution::sequenced_policy>) {
+    detail::sort(first, last, comp);
+  } else {
+    detail::parallel_sort(policy.pool(), first, last, comp);
+  }
+}
+
+template <std::random_access_iterator Iter, class Compare = std::less<>>
+void stable_sort(Iter first, Iter last, Compare comp = Compare()) {
+  detail::stable_sort(first, last, comp);
+}
+
+template <execution_policy ExecutionPolicy, std::random_access_iterator Iter, class Compare = std::less<>>
+void stable_sort(ExecutionPolicy &&policy, Iter first, Iter last, Compare comp = Compare()) {
+  if constexpr (std::is_same_v<std::remove_cvref_t<ExecutionPolicy>, execution::sequenced_policy>) {
+    detail::stable_sort(first, last, comp);
+  } else {
+    detail::parallel_stable_sort(policy.pool(), first, last, comp);
+  }
+}
+
+} // namespace tinystl
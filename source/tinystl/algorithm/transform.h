@@ -0,0 +1,56 @@
+#pragma once
+
+// https://en.cppreference.com/w/cpp/algorithm/transform.html
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+#include "tinystl/algorithm/parallel.h"
+#include "tinystl/execution/execution.h"
+
+namespace tinystl {
+
+template <std::input_iterator Iter, class OutIter, class UnaryOp>
+constexpr OutIter transform(Iter first, Iter last, OutIter d_first, UnaryOp op) {
+  return std::transform(first, last, d_first, op);
+}
+
+template <std::input_iterator Iter1, std::input_iterator Iter2, class OutIter, class BinaryOp>
+constexpr OutIter
+transform(Iter1 first1, Iter1 last1, Iter2 first2, OutIter d_first, BinaryOp op) {
+  return std::transform(first1, last1, first2, d_first, op);
+}
+
+template <execution_policy ExecutionPolicy, std::forward_iterator Iter, std::forward_iterator OutIter, class UnaryOp>
+OutIter transform(ExecutionPolicy &&policy, Iter first, Iter last, OutIter d_first, UnaryOp op) {
+  if constexpr (detail::runs_in_parallel<ExecutionPolicy, Iter, OutIter>) {
+    thread_pool &pool = policy.pool();
+    std::size_t n = static_cast<std::size_t>(last - first);
+    detail::parallel_for(pool, n, detail::parallel_grain(pool, n), [&](std::size_t b, std::size_t e) {
+      std::transform(first + b, first + e, d_first + b, op);
+    });
+    return d_first + n;
+  } else {
+    return std::transform(first, last, d_first, op);
+  }
+}
+
+template <execution_policy ExecutionPolicy, std::forward_iterator Iter1, std::forward_iterator Iter2, std::forward_iterator OutIter, class BinaryOp>
+OutIter transform(
+  ExecutionPolicy &&policy, Iter1 first1, Iter1 last1, Iter2 first2,
+  OutIter d_first, BinaryOp op
+) {
+  if constexpr (detail::runs_in_parallel<ExecutionPolicy, Iter1, Iter2, OutIter>) {
+    thread_pool &pool = policy.pool();
+    std::size_t n = static_cast<std::size_t>(last1 - first1);
+    detail::parallel_for(pool, n, detail::parallel_grain(pool, n), [&](std::size_t b, std::size_t e) {
+      std::transform(first1 + b, first1 + e, first2 + b, d_first + b, op);
+    });
+    return d_first + n;
+  } else {
+    return std::transform(first1, last1, first2, d_first, op);
+  }
+}
+
+} // namespace tinystl
@@ -0,0 +1,281 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "tinystl/concurrent/cache_line.h"
+
+namespace tinystl {
+
+enum class queue_concurrency { spsc, mpsc, mpmc };
+
+// Bounded lock-free FIFO after Dmitry Vyukov's MPMC queue. Every slot carries
+// a sequence number that tells a producer whether the slot is free for its
+// ticket and a consumer whether it holds the value for its ticket, so an
+// operation costs one CAS on the shared index plus one release store on the
+// slot. A side with a single thread skips the CAS and keeps its index in a
+// plain store. Head and tail sit on their own cache lines.
+//
+// The capacity is rounded up to a power of two. Element moves must not throw:
+// a claimed slot cannot be given back to the other threads.
+template <
+  class T, queue_concurrency Concurrency = queue_concurrency::mpmc,
+  class Alloc = std::allocator<T>>
+class bounded_queue {
+  static_assert(
+    std::is_nothrow_move_constructible_v<T> && std::is_nothrow_destructible_v<T>,
+    "bounded_queue requires nothrow move construction and destruction"
+  );
+
+  struct slot {
+    std::atomic<std::size_t> sequence;
+    alignas(T) unsigned char storage[sizeof(T)];
+
+    T *value() noexcept { return std::launder(reinterpret_cast<T *>(storage)); }
+  };
+
+  using alloc_traits = std::allocator_traits<Alloc>;
+  using slot_alloc = typename alloc_traits::template rebind_alloc<slot>;
+  using slot_traits = std::allocator_traits<slot_alloc>;
+
+  static constexpr bool multi_producer = Concurrency != queue_concurrency::spsc;
+  static constexpr bool multi_consumer = Concurrency == queue_concurrency::mpmc;
+
+public:
+  using value_type = T;
+  using allocator_type = Alloc;
+  using size_type = std::size_t;
+
+  explicit bounded_queue(size_type capacity, const allocator_type &alloc = allocator_type());
+  ~bounded_queue();
+
+  bounded_queue(const bounded_queue &) = delete;
+  bounded_queue &operator=(const bounded_queue &) = delete;
+
+  allocator_type get_allocator() const noexcept { return m_alloc; }
+
+  // capacity
+  size_type capacity() const noexcept { return m_mask + 1; }
+  // Only a snapshot while other threads are pushing or popping.
+  size_type size() const noexcept;
+  bool empty() const noexcept { return this->size() == 0; }
+
+  // modifiers; the try_ forms return false instead of waiting
+  template <class... Args>
+  bool try_emplace(Args &&...args);
+  bool try_push(const value_type &value) { return this->try_emplace(value); }
+  bool try_push(value_type &&value) { return this->try_emplace(std::move(value)); }
+
+  std::optional<value_type> try_pop();
+  bool try_pop(value_type &out)
+    requires std::is_nothrow_move_assignable_v<value_type>;
+
+  template <class... Args>
+  void emplace(Args &&...args);
+  void push(const value_type &value) { this->emplace(value); }
+  void push(value_type &&value) { this->emplace(std::move(value)); }
+  value_type pop();
+
+private:
+  template <class... Args>
+  slot *claim_push(Args &&...args);
+  slot *claim_pop() noexcept;
+  void release_pop(slot *s) noexcept;
+
+private:
+  alignas(detail::cache_line_size) std::atomic<size_type> m_tail{0};
+  alignas(detail::cache_line_size) std::atomic<size_type> m_head{0};
+  alignas(detail::cache_line_size) slot *m_slots;
+  size_type m_mask;
+  [[no_unique_address]] allocator_type m_alloc;
+};
+
+template <class T, class Alloc = std::allocator<T>>
+using mpmc_queue = bounded_queue<T, queue_concurrency::mpmc, Alloc>;
+
+template <class T, class Alloc = std::allocator<T>>
+using mpsc_queue = bounded_queue<T, queue_concurrency::mpsc, Alloc>;
+
+template <class T, class Alloc = std::allocator<T>>
+using spsc_queue = bounded_queue<T, queue_concurrency::spsc, Alloc>;
+
+/* ------------------------------- constructor ------------------------------ */
+template <class T, queue_concurrency Concurrency, class Alloc>
+bounded_queue<T, Concurrency, Alloc>::bounded_queue(
+  size_type capacity, const allocator_type &alloc
+)
+  : m_mask(std::bit_ceil(std::max<size_type>(capacity, 2)) - 1), m_alloc(alloc) {
+  slot_alloc sa(m_alloc);
+  m_slots = std::to_address(slot_traits::allocate(sa, this->capacity()));
+  for (size_type i = 0; i <= m_mask; ++i) {
+    slot_traits::construct(sa, m_slots + i);
+    m_slots[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+/* ------------------------------- destructor ------------------------------- */
+template <class T, queue_concurrency Concurrency, class Alloc>
+bounded_queue<T, Concurrency, Alloc>::~bounded_queue() {
+  size_type head = m_head.load(std::memory_order_relaxed);
+  size_type tail = m_tail.load(std::memory_order_relaxed);
+  for (; head != tail; ++head) {
+    alloc_traits::destroy(m_alloc, m_slots[head & m_mask].value());
+  }
+
+  slot_alloc sa(m_alloc);
+  for (size_type i = 0; i <= m_mask; ++i) {
+    slot_traits::destroy(sa, m_slots + i);
+  }
+  slot_traits::deallocate(
+    sa, std::pointer_traits<typename slot_traits::pointer>::pointer_to(*m_slots),
+    this->capacity()
+  );
+}
+
+/* -------------------------------- capacity -------------------------------- */
+template <class T, queue_concurrency Concurrency, class Alloc>
+auto bounded_queue<T, Concurrency, Alloc>::size() const noexcept -> size_type {
+  size_type head = m_head.load(std::memory_order_acquire);
+  size_type tail = m_tail.load(std::memory_order_acquire);
+  // The two loads are not one snapshot; clamp what they can disagree on.
+  std::ptrdiff_t n = static_cast<std::ptrdiff_t>(tail - head);
+  return n < 0 ? 0 : std::min(static_cast<size_type>(n), this->capacity());
+}
+
+/* -------------------------------- modifiers ------------------------------- */
+template <class T, queue_concurrency Concurrency, class Alloc>
+template <class... Args>
+bool bounded_queue<T, Concurrency, Alloc>::try_emplace(Args &&...args) {
+  if constexpr (!std::is_nothrow_constructible_v<T, Args &&...>) {
+    // Build the value before claiming a slot so a throwing constructor
+    // leaves the queue untouched.
+    T value(std::forward<Args>(args)...);
+    return this->try_emplace(std::move(value));
+  } else {
+    return this->claim_push(std::forward<Args>(args)...) != nullptr;
+  }
+}
+
+template <class T, queue_concurrency Concurrency, class Alloc>
+auto bounded_queue<T, Concurrency, Alloc>::try_pop() -> std::optional<value_type> {
+  slot *s = this->claim_pop();
+  if (s == nullptr) {
+    return std::nullopt;
+  }
+  std::optional<value_type> out(std::move(*s->value()));
+  this->release_pop(s);
+  return out;
+}
+
+template <class T, queue_concurrency Concurrency, class Alloc>
+bool bounded_queue<T, Concurrency, Alloc>::try_pop(value_type &out)
+  requires std::is_nothrow_move_assignable_v<value_type>
+{
+  slot *s = this->claim_pop();
+  if (s == nullptr) {
+    return false;
+  }
+  out = std::move(*s->value());
+  this->release_pop(s);
+  return true;
+}
+
+template <class T, queue_concurrency Concurrency, class Alloc>
+template <class... Args>
+void bounded_queue<T, Concurrency, Alloc>::emplace(Args &&...args) {
+  T value(std::forward<Args>(args)...);
+  while (!this->try_emplace(std::move(value))) {
+    std::this_thread::yield();
+  }
+}
+
+template <class T, queue_concurrency Concurrency, class Alloc>
+auto bounded_queue<T, Concurrency, Alloc>::pop() -> value_type {
+  for (;;) {
+    if (std::optional<value_type> out = this->try_pop()) {
+      return std::move(*out);
+    }
+    std::this_thread::yield();
+  }
+}
+
+/* -------------------------------------------------------------------------- */
+/*                           private member functions                         */
+/* -------------------------------------------------------------------------- */
+
+// A slot at position pos is free for the producer holding ticket pos when its
+// sequence equals pos, and full for the consumer holding ticket pos when it
+// equals pos + 1. Anything behind means the ring is full (or empty); anything
+// ahead means another thread took the ticket first.
+template <class T, queue_concurrency Concurrency, class Alloc>
+template <class... Args>
+auto bounded_queue<T, Concurrency, Alloc>::claim_push(Args &&...args) -> slot * {
+  size_type pos = m_tail.load(std::memory_order_relaxed);
+  slot *s;
+  for (;;) {
+    s = m_slots + (pos & m_mask);
+    size_type seq = s->sequence.load(std::memory_order_acquire);
+    auto diff = static_cast<std::ptrdiff_t>(seq - pos);
+    if (diff == 0) {
+      if constexpr (multi_producer) {
+        if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else {
+        m_tail.store(pos + 1, std::memory_order_relaxed);
+        break;
+      }
+    } else if (diff < 0) {
+      return nullptr;
+    } else {
+      pos = m_tail.load(std::memory_order_relaxed);
+    }
+  }
+
+  alloc_traits::construct(m_alloc, s->value(), std::forward<Args>(args)...);
+  s->sequence.store(pos + 1, std::memory_order_release);
+  return s;
+}
+
+template <class T, queue_concurrency Concurrency, class Alloc>
+auto bounded_queue<T, Concurrency, Alloc>::claim_pop() noexcept -> slot * {
+  size_type pos = m_head.load(std::memory_order_relaxed);
+  for (;;) {
+    slot *s = m_slots + (pos & m_mask);
+    size_type seq = s->sequence.load(std::memory_order_acquire);
+    auto diff = static_cast<std::ptrdiff_t>(seq - (pos + 1));
+    if (diff == 0) {
+      if constexpr (multi_consumer) {
+        if (m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          return s;
+        }
+      } else {
+        m_head.store(pos + 1, std::memory_order_relaxed);
+        return s;
+      }
+    } else if (diff < 0) {
+      return nullptr;
+    } else {
+      pos = m_head.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+// Hands the slot to the producer one lap ahead.
+template <class T, queue_concurrency Concurrency, class Alloc>
+void bounded_queue<T, Concurrency, Alloc>::release_pop(slot *s) noexcept {
+  alloc_traits::destroy(m_alloc, s->value());
+  size_type seq = s->sequence.load(std::memory_order_relaxed);
+  s->sequence.store(seq + m_mask, std::memory_order_release);
+}
+
+} // namespace tinystl
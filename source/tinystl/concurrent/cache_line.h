@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstddef>
+
+namespace tinystl::detail {
+
+// Fixed rather than std::hardware_destructive_interference_size, whose value
+// may differ between translation units and which GCC warns about using.
+inline constexpr std::size_t cache_line_size = 64;
+
+} // namespace tinystl::detail
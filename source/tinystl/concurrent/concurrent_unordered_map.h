@@ -0,0 +1,660 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <numeric>
+#include <optional>
+#include <shared_mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "tinystl/concurrent/cache_line.h"
+#include "tinystl/memory/epoch.h"
+
+namespace tinystl {
+
+namespace detail {
+
+// Finalizer from MurmurHash3. std::hash is the identity for integers on the
+// common standard libraries, which would put consecutive keys into one shard
+// and one probe run.
+inline std::uint64_t mix_hash(std::uint64_t h) noexcept {
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+// A trivially copyable object kept as machine words so that a reader racing
+// with a writer copies it with relaxed atomic loads instead of a data race.
+template <class U>
+struct seqlock_words {
+  static constexpr std::size_t count = (sizeof(U) + 7) / 8;
+
+  std::uint64_t words[count];
+
+  void store(const U &value) noexcept {
+    std::uint64_t buf[count] = {};
+    std::memcpy(buf, std::addressof(value), sizeof(U));
+    for (std::size_t i = 0; i < count; ++i) {
+      std::atomic_ref<std::uint64_t>(words[i]).store(buf[i], std::memory_order_relaxed);
+    }
+  }
+
+  U load() const noexcept {
+    std::uint64_t buf[count];
+    for (std::size_t i = 0; i < count; ++i) {
+      buf[i] = std::atomic_ref<std::uint64_t>(const_cast<std::uint64_t &>(words[i]))
+                 .load(std::memory_order_relaxed);
+    }
+    alignas(U) unsigned char bytes[sizeof(U)];
+    std::memcpy(bytes, buf, sizeof(U));
+    return *std::launder(reinterpret_cast<U *>(bytes));
+  }
+};
+
+} // namespace detail
+
+// A hash map split into independently locked shards, each an open-addressing
+// table with one control byte per slot (empty, erased, or seven bits of the
+// hash). The top bits of the mixed hash pick the shard, so writers to
+// different shards never contend.
+//
+// When Key and T are trivially copyable, lookups take no lock at all: each
+// shard carries a sequence counter that writers make odd while they work,
+// and a reader copies the key and value out and retries if the counter
+// moved. Readers pin the map's epoch domain, and a table replaced by a
+// rehash is retired to it and freed once no reader can still be probing
+// it. KeyEqual may see a torn key on a
+// read that is about to be retried, so it must not follow pointers. Other
+// key and value types are read under a shared lock on the shard.
+//
+// Lookups return copies rather than references, since an element may be
+// erased as soon as the shard is unlocked.
+template <
+  class Key, class T, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>,
+  class Alloc = std::allocator<std::pair<const Key, T>>>
+class concurrent_unordered_map {
+public:
+  static constexpr bool lock_free_reads =
+    std::is_trivially_copyable_v<Key> && std::is_trivially_copyable_v<T>;
+
+private:
+  struct entry {
+    Key key;
+    T mapped;
+  };
+
+  struct packed_entry {
+    detail::seqlock_words<Key> key;
+    detail::seqlock_words<T> mapped;
+  };
+
+  using slot_type = std::conditional_t<lock_free_reads, packed_entry, entry>;
+
+  struct table {
+    std::size_t mask;
+    std::atomic<std::uint8_t> *ctrl;
+    slot_type *slots;
+  };
+
+  struct alignas(detail::cache_line_size) shard {
+    std::atomic<std::uint64_t> version{0};
+    std::atomic<table *> current{nullptr};
+    std::atomic<std::size_t> size{0};
+    std::size_t erased = 0;
+    std::conditional_t<lock_free_reads, std::mutex, std::shared_mutex> mutex;
+  };
+
+  using alloc_traits = std::allocator_traits<Alloc>;
+  using table_alloc = typename alloc_traits::template rebind_alloc<table>;
+  using ctrl_alloc = typename alloc_traits::template rebind_alloc<std::atomic<std::uint8_t>>;
+  using slot_alloc = typename alloc_traits::template rebind_alloc<slot_type>;
+
+  static constexpr std::uint8_t empty_slot = 0;
+  static constexpr std::uint8_t erased_slot = 1;
+  static constexpr std::size_t min_capacity = 16;
+  static constexpr std::size_t max_shards = std::size_t(1) << 16;
+
+public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Alloc;
+
+  // construct/destroy
+  concurrent_unordered_map() : concurrent_unordered_map(default_shard_count()) {}
+  explicit concurrent_unordered_map(
+    size_type shard_count, const Hash &hash = Hash(), const KeyEqual &equal = KeyEqual(),
+    const Alloc &alloc = Alloc()
+  );
+  ~concurrent_unordered_map();
+
+  concurrent_unordered_map(const concurrent_unordered_map &) = delete;
+  concurrent_unordered_map &operator=(const concurrent_unordered_map &) = delete;
+
+  allocator_type get_allocator() const { return m_alloc; }
+  hasher hash_function() const { return m_hash; }
+  key_equal key_eq() const { return m_equal; }
+
+  // A few shards per hardware thread keeps two writers from meeting on one
+  // shard most of the time.
+  static size_type default_shard_count() noexcept;
+
+  // capacity
+  // Only a snapshot while other threads are inserting or erasing.
+  size_type size() const noexcept;
+  bool empty() const noexcept { return this->size() == 0; }
+  size_type shard_count() const noexcept { return m_shard_mask + 1; }
+  void reserve(size_type n);
+
+  // lookup
+  std::optional<mapped_type> find(const key_type &key) const;
+  bool contains(const key_type &key) const { return this->find(key).has_value(); }
+
+  // modifiers; each returns whether a new element was inserted or removed
+  bool insert(const key_type &key, const mapped_type &value);
+  bool insert_or_assign(const key_type &key, const mapped_type &value);
+  bool erase(const key_type &key);
+
+  // Inserts a range of key/value pairs, taking each shard's lock once for
+  // all the elements that land in it. Returns how many were new.
+  template <std::forward_iterator ForwardIter>
+  size_type insert(ForwardIter first, ForwardIter last);
+
+  void clear();
+
+private:
+  // Makes the version odd for the lifetime of a write so optimistic readers
+  // retry, and even again however the write ends.
+  class write_section {
+  public:
+    explicit write_section(shard &s) noexcept;
+    ~write_section();
+
+  private:
+    shard &m_shard;
+    std::uint64_t m_version;
+  };
+
+  std::uint64_t hash_of(const key_type &key) const {
+    return detail::mix_hash(static_cast<std::uint64_t>(m_hash(key)));
+  }
+  shard &shard_for(std::uint64_t h) const noexcept {
+    return m_shards[(h >> 40) & m_shard_mask];
+  }
+  static std::uint8_t tag_of(std::uint64_t h) noexcept {
+    return static_cast<std::uint8_t>(0x80 | (h & 0x7f));
+  }
+
+  static const Key &key_of(const entry &e) noexcept { return e.key; }
+  static Key key_of(const packed_entry &e) noexcept { return e.key.load(); }
+
+  // Reader side.
+  std::optional<mapped_type> find_in(const table *t, std::uint64_t h, const key_type &key) const;
+
+  // Writer side; the shard is locked by the caller.
+  bool insert_locked(shard &s, std::uint64_t h, const key_type &key, const mapped_type &value, bool assign);
+  void rehash_locked(shard &s, size_type capacity);
+  void place(table *t, std::size_t pos, std::uint8_t tag, const key_type &key, const mapped_type &value);
+
+  table *make_table(size_type capacity);
+  void destroy_table(table *t) noexcept;
+
+private:
+  std::unique_ptr<shard[]> m_shards;
+  size_type m_shard_mask;
+  [[no_unique_address]] Hash m_hash;
+  [[no_unique_address]] KeyEqual m_equal;
+  [[no_unique_address]] Alloc m_alloc;
+  // Declared last so that retired tables are freed while the allocator is
+  // still alive.
+  mutable epoch_domain m_epochs;
+};
+
+/* -------------------------------------------------------------------------- */
+/*                           public member functions                          */
+/* -------------------------------------------------------------------------- */
+
+/* -------------------------------- construct ------------------------------- */
+template <class Key, class T, class Hash, class KeyEqual, class Alloc>
+concurrent_unordered_map<Key, T, Hash, KeyEqual, Alloc>::concurrent_unordered_map(
+  size_type shard_count, const Hash &hash, const KeyEqual &equal, const Alloc &alloc
+)
+  : m_shard_mask(std::bit_ceil(std::clamp<size_type>(shard_count, 1, max_shards)) - 1),
+    m_hash(hash), m_equal(equal), m_alloc(alloc) {
+  m_shards = std::make_unique<shard[]>(m_shard_mask + 1);
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Alloc>
+concurrent_unordered_map<Key, T, Hash, KeyEqual, Alloc>::~concurrent_unordered_map() {
+  for (size_type i = 0; i <= m_shard_mask; ++i) {
+    if (table *t = m_shards[i].current.load(std::memory_order_relaxed)) {
+      this->destroy_table(t);
+    }
+  }
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Alloc>
+auto concurrent_unordered_map<Key, T, Hash, KeyEqual, Alloc>::default_shard_count() noexcept
+  -> size_type {
+  return std::bit_ceil(std::max<size_type>(8, 4 * size_type(std::thread::hardware_concurrency())));
+}
+
+/* -------------------------------- capacity -------------------------------- */
+template <class Key, class T, class Hash, class KeyEqual, class Alloc>
+auto concurrent_unordered_map<Key, T, Hash, KeyEqual, Alloc>::size() const noexcept
+  -> size_type {
+  size_type n = 0;
+  for (size_type i = 0; i <= m_shard_mask; ++i) {
+    n += m_shards[i].size.load(std::memory_order_relaxed);
+  }
+  return n;
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Alloc>
+void concurrent_unordered_map<Key, T, Hash, KeyEqual, Alloc>::reserve(size_type n) {
+  // Shards fill evenly under a decent hash, so each gets an equal share.
+  size_type per_shard = n / this->shard_count() + 1;
+  size_type capacity = std::bit_ceil(std::max(min_capacity, per_shard * 8 / 7 + 1));
+  for (size_type i = 0; i <= m_shard_mask; ++i) {
+    shard &s = m_shards[i];
+    std::unique_lock lock(s.mutex);
+    table *t = s.current.load(std::memory_order_relaxed);
+    if (t == nullptr || t->mask + 1 < capacity) {
+      write_section section(s);
+      this->rehash_locked(s, capacity);
+    }
+  }
+}
+
+/* --------------------------------- lookup --------------------------------- */
+template <class Key, class T, class Hash, class KeyEqual, class Alloc>
+auto concurrent_unordered_map<Key, T, Hash, KeyEqual, Alloc>::find(const key_type &key) const
+  -> std::optional<mapped_type> {
+  std::uint64_t h = this->hash_of(key);
+  shard &s = this->shard_for(h);
+
+  if constexpr (lock_free_reads) {
+    auto guard = m_epochs.pin();
+    for (;;) {
+      std::uint64_t version = s.version.load(std::memory_order_acquire);
+      if (version & 1) {
+        std::this_thread::yield();
+        continue;
+      }
+      std::optional<mapped_type> out =
+        this->find_in(s.current.load(std::memory_order_acquire), h, key);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (s.version.load(std::memory_order_relaxed) == version) {
+        return out;
+      }
+    }
+  } else {
+    std::shared_lock lock(s.mutex);
+    return this->find_in(s.current.load(std::memory_order_relaxed), h, key);
+  }
+}
+
+/* -------------------------------- modifiers ------------------------------- */
+template <class Key, class T, class Hash, class KeyEqual, class Alloc>
+bool concurrent_unordered_map<Key, T, Hash, KeyEqual, Alloc>::insert(
+  const key_type &key, const mapped_type &value
+) {
+  std::uint64_t h = this->hash_of(key);
+  shard &s = this->shard_for(h);
+  std::unique_lock lock(s.mutex);
+  write_section section(s);
+  return this->insert_locked(s, h, key, value, false);
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Alloc>
+bool concurrent_unordered_map<Key, T, Hash, KeyEqual, Alloc>::insert_or_assign(
+  const key_type &key, const mapped_type &value
+) {
+  std::uint64_t h = this->hash_of(key);
+  shard &s = this->shard_for(h);
+  std::unique_lock lock(s.mutex);
+  write_section section(s);
+  return this->insert_locked(s, h, key, value, true);
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Alloc>
+bool concurrent_unordered_map<Key, T, Hash, KeyEqual, Alloc>::erase(const key_type &key) {
+  std::uint64_t h = this->hash_of(key);
+  shard &s = this->shard_for(h);
+  std::unique_lock lock(s.mutex);
+  table *t = s.current.load(std::memory_order_relaxed);
+  if (t == nullptr) {
+    return false;
+  }
+
+  std::uint8_t tag = tag_of(h);
+  for (std::size_t pos = (h >> 7) & t->mask, n = 0; n <= t->mask; pos = (pos + 1) & t->mask, ++n) {
+    std::uint8_t c = t->ctrl[pos].load(std::memory_order_relaxed);
+    if (c == empty_slot) {
+      return false;
+    }
+    if (c == tag && m_equal(key_of(t->slots[pos]), key)) {
+      write_section section(s);
+      t->ctrl[pos].store(erased_slot, std::memory_order_relaxed);
+      if constexpr (!lock_free_reads) {
+        slot_alloc sa(m_alloc);
+        std::allocator_traits<slot_alloc>::destroy(sa, t->slots + pos);
+      }
+      s.size.fetch_sub(1, std::memory_order_relaxed);
+      ++s.erased;
+      return true;
+    }
+  }
+  return false;
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Alloc>
+template <std::forward_iterator ForwardIter>
+auto concurrent_unordered_map<Key, T, Hash, KeyEqual, Alloc>::insert(
+  ForwardIter first, ForwardIter last
+) -> size_type {
+  // Bucket the elements by shard first, with their hashes, so each shard is
+  // visited once.
+  struct pending {
+    std::uint64_t hash;
+    ForwardIter it;
+  };
+  std::vector<size_type> offsets(this->shard_count() + 1, 0);
+  std::vector<std::uint64_t> hashes;
+  for (ForwardIter it = first; it != last; ++it) {
+    const auto &[key, value] = *it;
+    hashes.push_back(this->hash_of(key));
+    ++offsets[((hashes.back() >> 40) & m_shard_mask) + 1];
+  }
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+  std::vector<pending> order(hashes.size(), pending{0, first});
+  std::vector<size_type> fill(offsets.begin(), offsets.end() - 1);
+  size_type i = 0;
+  for (ForwardIter it = first; it != last; ++it, ++i) {
+    order[fill[(hashes[i] >> 40) & m_shard_mask]++] = pending{hashes[i], it};
+  }
+
+  size_type inserted = 0;
+  for (size_type k = 0; k <= m_shard_mask; ++k) {
+    if (offsets[k] == offsets[k + 1]) {
+      continue;
+    }
+    shard &s = m_shards[k];
+    std::unique_lock lock(s.mutex);
+    write_section section(s);
+    for (size_type j = offsets[k]; j != offsets[k + 1]; ++j) {
+      const auto &[key, value] = *order[j].it;
+      inserted += this->insert_locked(s, order[j].hash, key, value, false);
+    }
+  }
+  return inserted;
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Alloc>
+void concurrent_unordered_map<Key, T, Hash, KeyEqual, Alloc>::clear() {
+  for (size_type i = 0; i <= m_shard_mask; ++i) {
+    shard &s = m_shards[i];
+    std::unique_lock lock(s.mutex);
+    table *t = s.current.load(std::memory_order_relaxed);
+    if (t == nullptr) {
+      continue;
+    }
+    write_section section(s);
+    slot_alloc sa(m_alloc);
+    for (std::size_t pos = 0; pos <= t->mask; ++pos) {
+      std::uint8_t c = t->ctrl[pos].load(std::memory_order_relaxed);
+      if constexpr (!lock_free_reads) {
+        if (c & 0x80) {
+          std::allocator_traits<slot_alloc>::destroy(sa, t->slots + pos);
+        }
+      }
+      t->ctrl[pos].store(empty_slot, std::memory_order_relaxed);
+    }
+    s.size.store(0, std::memory_order_relaxed);
+    s.erased = 0;
+  }
+}
+
+/* -------------------------------------------------------------------------- */
+/*                          private member functions                          */
+/* -------------------------------------------------------------------------- */
+template <class Key, class T, class Hash, class KeyEqual, class Alloc>
+concurrent_unordered_map<Key, T, Hash, KeyEqual, Alloc>::write_section::write_section(
+  shard &s
+) noexcept
+  : m_shard(s), m_version(s.version.load(std::memory_order_relaxed)) {
+  if constexpr (lock_free_reads) {
+    m_shard.version.store(m_version + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+  }
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Alloc>
+concurrent_unordered_map<Key, T, Hash, KeyEqual, Alloc>::write_section::~write_section() {
+  if constexpr (lock_free_reads) {
+    m_shard.version.store(m_version + 2, std::memory_order_release);
+  }
+}
+
+// A probe that runs into an empty slot has seen the whole run the key could
+// be in. The step bound keeps a reader on a torn table from looping forever.
+template <class Key, class T, class Hash, class KeyEqual, class Alloc>
+auto concurrent_unordered_map<Key, T, Hash, KeyEqual, Alloc>::find_in(
+  const table *t, std::uint64_t h, const key_type &key
+) const -> std::optional<mapped_type> {
+  if (t == nullptr) {
+    return std::nullopt;
+  }
+  std::uint8_t tag = tag_of(h);
+  for (std::size_t pos = (h >> 7) & t->mask, n = 0; n <= t->mask; pos = (pos + 1) & t->mask, ++n) {
+    std::uint8_t c = t->ctrl[pos].load(std::memory_order_relaxed);
+    if (c == empty_slot) {
+      break;
+    }
+    if (c == tag && m_equal(key_of(t->slots[pos]), key)) {
+      if constexpr (lock_free_reads) {
+        return t->slots[pos].mapped.load();
+      } else {
+        return t->slots[pos].mapped;
+      }
+    }
+  }
+  return std::nullopt;
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Alloc>
+bool concurrent_unordered_map<Key, T, Hash, KeyEqual, Alloc>::insert_locked(
+  shard &s, std::uint64_t h, const key_type &key, const mapped_type &value, bool assign
+) {
+  table *t = s.current.load(std::memory_order_relaxed);
+  size_type size = s.size.load(std::memory_order_relaxed);
+  // Keep at least one slot in eight empty, erased slots included, so probes
+  // stay short and always end.
+  if (t == nullptr || (size + s.erased + 1) * 8 > (t->mask + 1) * 7) {
+    size_type capacity = t == nullptr ? min_capacity : t->mask + 1;
+    if ((size + 1) * 2 > capacity) {
+      capacity *= 2;
+    }
+    this->rehash_locked(s, capacity);
+    t = s.current.load(std::memory_order_relaxed);
+  }
+
+  std::uint8_t tag = tag_of(h);
+  std::size_t target = t->mask + 1;
+  for (std::size_t pos = (h >> 7) & t->mask;; pos = (pos + 1) & t->mask) {
+    std::uint8_t c = t->ctrl[pos].load(std::memory_order_relaxed);
+    if (c == empty_slot) {
+      if (target > t->mask) {
+        target = pos;
+      }
+      break;
+    }
+    if (c == erased_slot) {
+      if (target > t->mask) {
+        target = pos;
+      }
+    } else if (c == tag && m_equal(key_of(t->slots[pos]), key)) {
+      if (assign) {
+        if constexpr (lock_free_reads) {
+          t->slots[pos].mapped.store(value);
+        } else {
+          t->slots[pos].mapped = value;
+        }
+      }
+      return false;
+    }
+  }
+
+  if (t->ctrl[target].load(std::memory_order_relaxed) == erased_slot) {
+    --s.erased;
+  }
+  this->place(t, target, tag, key, value);
+  s.size.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+// With lock-free readers the old table is retired to the epoch domain, since
+// a reader may still be probing it; otherwise its elements move over and it
+// is freed at once.
+template <class Key, class T, class Hash, class KeyEqual, class Alloc>
+void concurrent_unordered_map<Key, T, Hash, KeyEqual, Alloc>::rehash_locked(
+  shard &s, size_type capacity
+) {
+  table *old = s.current.load(std::memory_order_relaxed);
+  table *fresh = this->make_table(capacity);
+
+  if (old != nullptr) {
+    slot_alloc sa(m_alloc);
+    for (std::size_t pos = 0; pos <= old->mask; ++pos) {
+      std::uint8_t c = old->ctrl[pos].load(std::memory_order_relaxed);
+      if (!(c & 0x80)) {
+        continue;
+      }
+      slot_type &from = old->slots[pos];
+      std::uint64_t h = this->hash_of(key_of(from));
+      std::size_t to = (h >> 7) & fresh->mask;
+      while (fresh->ctrl[to].load(std::memory_order_relaxed) != empty_slot) {
+        to = (to + 1) & fresh->mask;
+      }
+      if constexpr (lock_free_reads) {
+        fresh->slots[to] = from;
+      } else {
+        std::allocator_traits<slot_alloc>::construct(sa, fresh->slots + to, std::move(from));
+        std::allocator_traits<slot_alloc>::destroy(sa, std::addressof(from));
+      }
+      fresh->ctrl[to].store(c, std::memory_order_relaxed);
+    }
+  }
+
+  if constexpr (lock_free_reads) {
+    if (old != nullptr) {
+      // Retiring before publishing is safe: the epoch cannot move two steps
+      // on while this guard is pinned. Failing here leaves the old table in
+      // place.
+      auto guard = m_epochs.pin();
+      try {
+        guard.defer([this, old] { this->destroy_table(old); });
+      } catch (...) {
+        this->destroy_table(fresh);
+        throw;
+      }
+    }
+  } else if (old != nullptr) {
+    // Every element has moved out; only the storage is left.
+    std::fill_n(old->ctrl, old->mask + 1, empty_slot);
+    this->destroy_table(old);
+  }
+  s.erased = 0;
+  s.current.store(fresh, std::memory_order_release);
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Alloc>
+void concurrent_unordered_map<Key, T, Hash, KeyEqual, Alloc>::place(
+  table *t, std::size_t pos, std::uint8_t tag, const key_type &key, const mapped_type &value
+) {
+  if constexpr (lock_free_reads) {
+    t->slots[pos].key.store(key);
+    t->slots[pos].mapped.store(value);
+  } else {
+    slot_alloc sa(m_alloc);
+    std::allocator_traits<slot_alloc>::construct(sa, t->slots + pos, key, value);
+  }
+  t->ctrl[pos].store(tag, std::memory_order_relaxed);
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Alloc>
+auto concurrent_unordered_map<Key, T, Hash, KeyEqual, Alloc>::make_table(size_type capacity)
+  -> table * {
+  table_alloc ta(m_alloc);
+  ctrl_alloc ca(m_alloc);
+  slot_alloc sa(m_alloc);
+
+  table *t = std::to_address(std::allocator_traits<table_alloc>::allocate(ta, 1));
+  t->mask = capacity - 1;
+  t->ctrl = nullptr;
+  t->slots = nullptr;
+  try {
+    t->ctrl = std::to_address(std::allocator_traits<ctrl_alloc>::allocate(ca, capacity));
+    for (size_type i = 0; i < capacity; ++i) {
+      std::allocator_traits<ctrl_alloc>::construct(ca, t->ctrl + i, empty_slot);
+    }
+    t->slots = std::to_address(std::allocator_traits<slot_alloc>::allocate(sa, capacity));
+  } catch (...) {
+    this->destroy_table(t);
+    throw;
+  }
+  return t;
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Alloc>
+void concurrent_unordered_map<Key, T, Hash, KeyEqual, Alloc>::destroy_table(table *t) noexcept {
+  table_alloc ta(m_alloc);
+  ctrl_alloc ca(m_alloc);
+  slot_alloc sa(m_alloc);
+  size_type capacity = t->mask + 1;
+
+  if (t->slots != nullptr) {
+    if constexpr (!lock_free_reads) {
+      for (size_type i = 0; i < capacity; ++i) {
+        if (t->ctrl[i].load(std::memory_order_relaxed) & 0x80) {
+          std::allocator_traits<slot_alloc>::destroy(sa, t->slots + i);
+        }
+      }
+    }
+    std::allocator_traits<slot_alloc>::deallocate(
+      sa, std::pointer_traits<typename std::allocator_traits<slot_alloc>::pointer>::pointer_to(*t->slots),
+      capacity
+    );
+  }
+  if (t->ctrl != nullptr) {
+    std::allocator_traits<ctrl_alloc>::deallocate(
+      ca, std::pointer_traits<typename std::allocator_traits<ctrl_alloc>::pointer>::pointer_to(*t->ctrl),
+      capacity
+    );
+  }
+  std::allocator_traits<table_alloc>::deallocate(
+    ta, std::pointer_traits<typename std::allocator_traits<table_alloc>::pointer>::pointer_to(*t), 1
+  );
+}
+
+} // namespace tinystl
@@ -0,0 +1,555 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "tinystl/concurrent/cache_line.h"
+#include "tinystl/container/segmented_vector.h"
+
+namespace tinystl {
+
+// An append-only sequence that any number of threads can grow at once. It
+// shares segmented_vector's chunk layout and iterators, so elements never
+// move, and the segmented algorithms walk it chunk by chunk.
+//
+// Growing is lock-free: a thread first makes sure the chunks it may need
+// exist, installing missing ones with a CAS, and then claims its index range
+// with a CAS on the claimed count. Since every chunk is allocated before any
+// index in it is handed out, nothing can fail once a range is claimed.
+// After constructing its elements the thread sets their bits in the chunk's
+// ready bitmap and pushes size() forward over every ready element that
+// follows it. No thread waits for a slower one: a range finished early is
+// published by whoever completes the gap in front of it. size() therefore
+// only ever covers fully constructed elements, and concurrent readers may use
+// operator[], at(), and iterators anywhere below a size() they observed.
+//
+// Construction after the claim cannot be undone. Single elements whose
+// constructor may throw are built on the side and moved in; bulk growth
+// needs nothrow construction. clear(), copying, and destruction must not run
+// alongside other operations.
+template <class T, class Alloc = std::allocator<T>>
+class concurrent_vector {
+  static_assert(
+    std::is_nothrow_move_constructible_v<T>,
+    "concurrent_vector requires nothrow move construction"
+  );
+
+  using alloc_traits = std::allocator_traits<Alloc>;
+  using layout = detail::geometric_segments<segmented_vector_first_chunk<T>::value>;
+
+  using ready_word = std::atomic<std::uint64_t>;
+  using word_alloc = typename alloc_traits::template rebind_alloc<ready_word>;
+  using word_traits = std::allocator_traits<word_alloc>;
+
+  static constexpr std::size_t word_bits = 64;
+
+public:
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+
+  using allocator_type = Alloc;
+
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  using pointer = value_type *;
+  using const_pointer = const value_type *;
+
+  using iterator = segmented_vector_iterator<T, layout>;
+  using const_iterator = segmented_vector_iterator<const T, layout>;
+
+  // construct/copy/destroy
+  concurrent_vector() : concurrent_vector(Alloc()) {}
+  explicit concurrent_vector(const Alloc &alloc);
+  template <std::forward_iterator ForwardIter>
+    requires std::constructible_from<T, std::iter_reference_t<ForwardIter>>
+  concurrent_vector(ForwardIter first, ForwardIter last, const Alloc &alloc = Alloc());
+  concurrent_vector(std::initializer_list<value_type> init, const Alloc &alloc = Alloc());
+  concurrent_vector(const concurrent_vector &other);
+  concurrent_vector(concurrent_vector &&other) noexcept;
+
+  ~concurrent_vector();
+
+  concurrent_vector &operator=(const concurrent_vector &) = delete;
+  concurrent_vector &operator=(concurrent_vector &&) = delete;
+
+  allocator_type get_allocator() const { return m_alloc; }
+
+  // element access
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos) noexcept;
+  const_reference operator[](size_type pos) const noexcept;
+  reference front() noexcept { return (*this)[0]; }
+  const_reference front() const noexcept { return (*this)[0]; }
+  reference back() noexcept { return (*this)[this->size() - 1]; }
+  const_reference back() const noexcept { return (*this)[this->size() - 1]; }
+
+  // iterators
+  iterator begin() noexcept { return iterator(m_chunks, 0, m_chunks[0]); }
+  const_iterator begin() const noexcept {
+    return const_iterator(m_chunks, 0, m_chunks[0]);
+  }
+  const_iterator cbegin() const noexcept { return this->begin(); }
+  iterator end() noexcept { return this->iterator_at(this->size()); }
+  const_iterator end() const noexcept;
+  const_iterator cend() const noexcept { return this->end(); }
+
+  // capacity
+  bool empty() const noexcept { return this->size() == 0; }
+  size_type size() const noexcept { return m_size.load(std::memory_order_acquire); }
+  size_type max_size() const noexcept;
+  size_type capacity() const noexcept;
+  void reserve(size_type n);
+
+  // modifiers
+  iterator push_back(const_reference val) { return this->emplace_back(val); }
+  iterator push_back(value_type &&val) { return this->emplace_back(std::move(val)); }
+  template <class... Args>
+  iterator emplace_back(Args &&...args);
+
+  // Appends n elements as one contiguous index range and returns an iterator
+  // to the first of them.
+  iterator grow_by(size_type n)
+    requires std::is_nothrow_default_constructible_v<T>;
+  iterator grow_by(size_type n, const_reference val)
+    requires std::is_nothrow_copy_constructible_v<T>;
+  template <std::forward_iterator ForwardIter>
+    requires std::is_nothrow_constructible_v<T, std::iter_reference_t<ForwardIter>>
+  iterator grow_by(ForwardIter first, ForwardIter last);
+
+  void clear() noexcept;
+
+private:
+  void throw_length_error() const;
+  void throw_out_of_range() const;
+
+  std::atomic_ref<pointer> chunk_ref(size_type chunk) const noexcept {
+    return std::atomic_ref<pointer>(const_cast<pointer &>(m_chunks[chunk]));
+  }
+
+  std::atomic_ref<ready_word *> ready_ref(size_type chunk) const noexcept {
+    return std::atomic_ref<ready_word *>(const_cast<ready_word *&>(m_ready[chunk]));
+  }
+
+  static constexpr size_type ready_words(size_type chunk) noexcept {
+    return (layout::chunk_size(chunk) + word_bits - 1) / word_bits;
+  }
+
+  pointer slot(size_type pos) const noexcept {
+    size_type chunk = layout::chunk_of(pos);
+    return m_chunks[chunk] + (pos - layout::chunk_start(chunk));
+  }
+
+  iterator iterator_at(size_type pos) noexcept {
+    size_type chunk = layout::chunk_of(pos);
+    return iterator(m_chunks, chunk, this->slot(pos));
+  }
+
+  // Makes sure every chunk up to and including the one holding index last
+  // exists.
+  void ensure_chunks(size_type from, size_type last);
+
+  // Reserves [first, first + n) and returns first.
+  size_type claim(size_type n);
+
+  // Marks [first, first + n) as constructed.
+  void mark_ready(size_type first, size_type n) noexcept;
+
+  // Moves size() over the ready elements that directly follow it.
+  void advance_size() noexcept;
+
+  template <class Construct>
+  iterator append(size_type n, Construct construct);
+
+  void destroy_elements() noexcept;
+
+private:
+  // One spare null entry past the last chunk lets iterators step onto it.
+  pointer m_chunks[layout::max_chunks + 1] = {};
+  // One bit per element, set once the element is constructed.
+  ready_word *m_ready[layout::max_chunks] = {};
+  alignas(detail::cache_line_size) std::atomic<size_type> m_claimed{0};
+  alignas(detail::cache_line_size) std::atomic<size_type> m_size{0};
+  [[no_unique_address]] Alloc m_alloc;
+};
+
+/* -------------------------------------------------------------------------- */
+/*                           public member functions                          */
+/* -------------------------------------------------------------------------- */
+
+/* -------------------------------- construct ------------------------------- */
+template <class T, class Alloc>
+concurrent_vector<T, Alloc>::concurrent_vector(const Alloc &alloc) : m_alloc(alloc) {
+  // The chunk holding index size() always exists, so begin() and end() of
+  // an empty vector agree with what a concurrent push_back installs.
+  this->ensure_chunks(0, 0);
+}
+
+template <class T, class Alloc>
+template <std::forward_iterator ForwardIter>
+  requires std::constructible_from<T, std::iter_reference_t<ForwardIter>>
+concurrent_vector<T, Alloc>::concurrent_vector(
+  ForwardIter first, ForwardIter last, const Alloc &alloc
+)
+  : concurrent_vector(alloc) {
+  // No other thread can see the vector yet, so the elements are built one
+  // at a time and a throwing constructor unwinds through the destructor.
+  size_type n = static_cast<size_type>(std::distance(first, last));
+  this->reserve(n);
+  for (; first != last; ++first) {
+    this->emplace_back(*first);
+  }
+}
+
+template <class T, class Alloc>
+concurrent_vector<T, Alloc>::concurrent_vector(
+  std::initializer_list<value_type> init, const Alloc &alloc
+)
+  : concurrent_vector(init.begin(), init.end(), alloc) {}
+
+template <class T, class Alloc>
+concurrent_vector<T, Alloc>::concurrent_vector(const concurrent_vector &other)
+  : concurrent_vector(
+      other.begin(), other.end(),
+      alloc_traits::select_on_container_copy_construction(other.m_alloc)
+    ) {}
+
+template <class T, class Alloc>
+concurrent_vector<T, Alloc>::concurrent_vector(concurrent_vector &&other) noexcept
+  : m_alloc(std::move(other.m_alloc)) {
+  std::copy(std::begin(other.m_chunks), std::end(other.m_chunks), m_chunks);
+  std::fill(std::begin(other.m_chunks), std::end(other.m_chunks), nullptr);
+  std::copy(std::begin(other.m_ready), std::end(other.m_ready), m_ready);
+  std::fill(std::begin(other.m_ready), std::end(other.m_ready), nullptr);
+  m_claimed.store(other.m_claimed.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+  m_size.store(other.m_size.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+template <class T, class Alloc>
+concurrent_vector<T, Alloc>::~concurrent_vector() {
+  this->destroy_elements();
+
+  word_alloc words(m_alloc);
+  for (size_type chunk = 0; chunk < layout::max_chunks; ++chunk) {
+    if (m_chunks[chunk] != nullptr) {
+      alloc_traits::deallocate(
+        m_alloc,
+        std::pointer_traits<typename alloc_traits::pointer>::pointer_to(*m_chunks[chunk]),
+        layout::chunk_size(chunk)
+      );
+    }
+    if (m_ready[chunk] != nullptr) {
+      word_traits::deallocate(
+        words,
+        std::pointer_traits<typename word_traits::pointer>::pointer_to(*m_ready[chunk]),
+        ready_words(chunk)
+      );
+    }
+  }
+}
+
+/* ----------------------------- element access ----------------------------- */
+template <class T, class Alloc>
+typename concurrent_vector<T, Alloc>::reference
+concurrent_vector<T, Alloc>::at(size_type pos) {
+  if (pos >= this->size()) {
+    this->throw_out_of_range();
+  }
+  return *this->slot(pos);
+}
+
+template <class T, class Alloc>
+typename concurrent_vector<T, Alloc>::const_reference
+concurrent_vector<T, Alloc>::at(size_type pos) const {
+  if (pos >= this->size()) {
+    this->throw_out_of_range();
+  }
+  return *this->slot(pos);
+}
+
+template <class T, class Alloc>
+typename concurrent_vector<T, Alloc>::reference
+concurrent_vector<T, Alloc>::operator[](size_type pos) noexcept {
+  assert(pos < this->size() && "concurrent_vector[] index out of bounds");
+  return *this->slot(pos);
+}
+
+template <class T, class Alloc>
+typename concurrent_vector<T, Alloc>::const_reference
+concurrent_vector<T, Alloc>::operator[](size_type pos) const noexcept {
+  assert(pos < this->size() && "concurrent_vector[] index out of bounds");
+  return *this->slot(pos);
+}
+
+/* -------------------------------- iterators ------------------------------- */
+template <class T, class Alloc>
+typename concurrent_vector<T, Alloc>::const_iterator
+concurrent_vector<T, Alloc>::end() const noexcept {
+  size_type pos = this->size();
+  return const_iterator(m_chunks, layout::chunk_of(pos), this->slot(pos));
+}
+
+/* -------------------------------- capacity -------------------------------- */
+template <class T, class Alloc>
+typename concurrent_vector<T, Alloc>::size_type
+concurrent_vector<T, Alloc>::max_size() const noexcept {
+  // The chunk holding index size() must exist, so the last chunk is never
+  // filled completely.
+  return std::min<size_type>(
+    layout::chunk_start(layout::max_chunks) - 1, alloc_traits::max_size(m_alloc)
+  );
+}
+
+template <class T, class Alloc>
+typename concurrent_vector<T, Alloc>::size_type
+concurrent_vector<T, Alloc>::capacity() const noexcept {
+  // Chunks are installed in order, so the allocated ones form a prefix.
+  size_type chunk = layout::chunk_of(m_claimed.load(std::memory_order_relaxed));
+  while (chunk < layout::max_chunks &&
+         this->chunk_ref(chunk).load(std::memory_order_acquire) != nullptr) {
+    ++chunk;
+  }
+  return layout::chunk_start(chunk);
+}
+
+template <class T, class Alloc>
+void concurrent_vector<T, Alloc>::reserve(size_type n) {
+  if (n > this->max_size()) {
+    this->throw_length_error();
+  }
+  if (n != 0) {
+    this->ensure_chunks(m_claimed.load(std::memory_order_relaxed), n - 1);
+  }
+}
+
+/* -------------------------------- modifiers ------------------------------- */
+template <class T, class Alloc>
+template <class... Args>
+typename concurrent_vector<T, Alloc>::iterator
+concurrent_vector<T, Alloc>::emplace_back(Args &&...args) {
+  if constexpr (!std::is_nothrow_constructible_v<T, Args &&...>) {
+    T value(std::forward<Args>(args)...);
+    return this->emplace_back(std::move(value));
+  } else {
+    return this->append(1, [&](pointer p) {
+      alloc_traits::construct(m_alloc, p, std::forward<Args>(args)...);
+    });
+  }
+}
+
+template <class T, class Alloc>
+typename concurrent_vector<T, Alloc>::iterator
+concurrent_vector<T, Alloc>::grow_by(size_type n)
+  requires std::is_nothrow_default_constructible_v<T>
+{
+  return this->append(n, [&](pointer p) {
+    alloc_traits::construct(m_alloc, p);
+  });
+}
+
+template <class T, class Alloc>
+typename concurrent_vector<T, Alloc>::iterator
+concurrent_vector<T, Alloc>::grow_by(size_type n, const_reference val)
+  requires std::is_nothrow_copy_constructible_v<T>
+{
+  return this->append(n, [&](pointer p) {
+    alloc_traits::construct(m_alloc, p, val);
+  });
+}
+
+template <class T, class Alloc>
+template <std::forward_iterator ForwardIter>
+  requires std::is_nothrow_constructible_v<T, std::iter_reference_t<ForwardIter>>
+typename concurrent_vector<T, Alloc>::iterator
+concurrent_vector<T, Alloc>::grow_by(ForwardIter first, ForwardIter last) {
+  size_type n = static_cast<size_type>(std::distance(first, last));
+  return this->append(n, [&](pointer p) {
+    alloc_traits::construct(m_alloc, p, *first);
+    ++first;
+  });
+}
+
+template <class T, class Alloc>
+void concurrent_vector<T, Alloc>::clear() noexcept {
+  this->destroy_elements();
+  size_type n = m_size.load(std::memory_order_relaxed);
+  for (size_type chunk = 0; chunk < layout::max_chunks && layout::chunk_start(chunk) < n; ++chunk) {
+    for (size_type w = 0; w < ready_words(chunk); ++w) {
+      m_ready[chunk][w].store(0, std::memory_order_relaxed);
+    }
+  }
+  m_size.store(0, std::memory_order_relaxed);
+  m_claimed.store(0, std::memory_order_relaxed);
+}
+
+/* -------------------------------------------------------------------------- */
+/*                          private member functions                          */
+/* -------------------------------------------------------------------------- */
+template <class T, class Alloc>
+void concurrent_vector<T, Alloc>::throw_length_error() const {
+  throw std::length_error("concurrent_vector");
+}
+
+template <class T, class Alloc>
+void concurrent_vector<T, Alloc>::throw_out_of_range() const {
+  throw std::out_of_range("concurrent_vector");
+}
+
+// Walking up from a chunk that is known to exist keeps the allocated chunks
+// a prefix: a thread only installs chunk k after seeing chunk k - 1. A
+// chunk's bitmap goes in before the chunk itself.
+template <class T, class Alloc>
+void concurrent_vector<T, Alloc>::ensure_chunks(size_type from, size_type last) {
+  for (size_type chunk = layout::chunk_of(from); chunk <= layout::chunk_of(last); ++chunk) {
+    std::atomic_ref<ready_word *> ready = this->ready_ref(chunk);
+    if (ready.load(std::memory_order_acquire) == nullptr) {
+      word_alloc words(m_alloc);
+      ready_word *fresh = std::to_address(word_traits::allocate(words, ready_words(chunk)));
+      for (size_type w = 0; w < ready_words(chunk); ++w) {
+        word_traits::construct(words, fresh + w, 0);
+      }
+      ready_word *expected = nullptr;
+      if (!ready.compare_exchange_strong(
+            expected, fresh, std::memory_order_acq_rel, std::memory_order_acquire
+          )) {
+        word_traits::deallocate(
+          words, std::pointer_traits<typename word_traits::pointer>::pointer_to(*fresh),
+          ready_words(chunk)
+        );
+      }
+    }
+
+    std::atomic_ref<pointer> ref = this->chunk_ref(chunk);
+    if (ref.load(std::memory_order_acquire) != nullptr) {
+      continue;
+    }
+
+    pointer fresh = std::to_address(alloc_traits::allocate(m_alloc, layout::chunk_size(chunk)));
+    pointer expected = nullptr;
+    if (!ref.compare_exchange_strong(
+          expected, fresh, std::memory_order_acq_rel, std::memory_order_acquire
+        )) {
+      alloc_traits::deallocate(
+        m_alloc, std::pointer_traits<typename alloc_traits::pointer>::pointer_to(*fresh),
+        layout::chunk_size(chunk)
+      );
+    }
+  }
+}
+
+template <class T, class Alloc>
+typename concurrent_vector<T, Alloc>::size_type
+concurrent_vector<T, Alloc>::claim(size_type n) {
+  size_type first = m_claimed.load(std::memory_order_relaxed);
+  for (;;) {
+    if (n > this->max_size() - first) {
+      this->throw_length_error();
+    }
+    // Allocation may throw, so it happens before the range is taken.
+    this->ensure_chunks(first, first + n);
+    if (m_claimed.compare_exchange_weak(
+          first, first + n, std::memory_order_relaxed, std::memory_order_relaxed
+        )) {
+      return first;
+    }
+  }
+}
+
+// Words never straddle chunks: a chunk is either a multiple of 64 elements
+// or smaller than one word.
+template <class T, class Alloc>
+void concurrent_vector<T, Alloc>::mark_ready(size_type first, size_type n) noexcept {
+  for (size_type pos = first, last = first + n; pos != last;) {
+    size_type chunk = layout::chunk_of(pos);
+    size_type offset = pos - layout::chunk_start(chunk);
+    size_type bit = offset % word_bits;
+    size_type count = std::min({last - pos, word_bits - bit, layout::chunk_size(chunk) - offset});
+    std::uint64_t mask = count == word_bits ? ~std::uint64_t(0) : (std::uint64_t(1) << count) - 1;
+    m_ready[chunk][offset / word_bits].fetch_or(mask << bit, std::memory_order_release);
+    pos += count;
+  }
+}
+
+// Whoever sets the bits just past size() also moves size() over them, and
+// every thread tries after setting its own, so no ready range is left behind.
+template <class T, class Alloc>
+void concurrent_vector<T, Alloc>::advance_size() noexcept {
+  size_type size = m_size.load(std::memory_order_acquire);
+  for (;;) {
+    size_type end = size;
+    for (size_type chunk = layout::chunk_of(end); chunk < layout::max_chunks;
+         chunk = layout::chunk_of(end)) {
+      ready_word *words = this->ready_ref(chunk).load(std::memory_order_acquire);
+      if (words == nullptr) {
+        break;
+      }
+      size_type offset = end - layout::chunk_start(chunk);
+      size_type bit = offset % word_bits;
+      std::uint64_t bits = words[offset / word_bits].load(std::memory_order_acquire) >> bit;
+      size_type ready = static_cast<size_type>(std::countr_one(bits));
+      end += ready;
+      if (ready < std::min(word_bits - bit, layout::chunk_size(chunk) - offset)) {
+        break;
+      }
+    }
+
+    if (end == size) {
+      return;
+    }
+    if (m_size.compare_exchange_weak(
+          size, end, std::memory_order_acq_rel, std::memory_order_acquire
+        )) {
+      size = end;
+    }
+  }
+}
+
+template <class T, class Alloc>
+template <class Construct>
+typename concurrent_vector<T, Alloc>::iterator
+concurrent_vector<T, Alloc>::append(size_type n, Construct construct) {
+  size_type first = this->claim(n);
+  iterator it = this->iterator_at(first);
+  // Builds chunk by chunk so each run is a plain pointer loop.
+  for_each_segment(it, it + static_cast<difference_type>(n), [&](pointer b, pointer e) {
+    for (; b != e; ++b) {
+      construct(b);
+    }
+  });
+  if (m_size.load(std::memory_order_relaxed) == first) {
+    // Nobody can move size() past elements whose bits are still clear, so
+    // a range that starts at size() is published directly.
+    m_size.store(first + n, std::memory_order_release);
+  } else {
+    this->mark_ready(first, n);
+  }
+  this->advance_size();
+  return it;
+}
+
+template <class T, class Alloc>
+void concurrent_vector<T, Alloc>::destroy_elements() noexcept {
+  if constexpr (!std::is_trivially_destructible_v<T>) {
+    size_type n = m_size.load(std::memory_order_relaxed);
+    for_each_segment(this->begin(), this->iterator_at(n), [&](pointer b, pointer e) {
+      for (; b != e; ++b) {
+        alloc_traits::destroy(m_alloc, b);
+      }
+    });
+  }
+}
+
+} // namespace tinystl
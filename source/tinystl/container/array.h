@@ -7,6 +7,8 @@
 #include <iterator>
 #include <stdexcept>
 
+#include "tinystl/algorithm/compare.h"
+
 namespace tinystl {
 template <class T, std::size_t N>
 struct array {
@@ -112,12 +114,12 @@ struct array {
 // Non-member functions
 template <class T, std::size_t N>
 constexpr bool operator==(const array<T, N> &lhs, const array<T, N> &rhs) {
-  return std::equal(lhs.begin(), lhs.end(), rhs.begin());
+  return tinystl::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
 
 template <class T, std::size_t N>
 constexpr auto operator<=>(const array<T, N> &lhs, const array<T, N> &rhs) {
-  return std::lexicographical_compare_three_way(
+  return tinystl::lexicographical_compare_three_way(
     lhs.data(), lhs.data() + N, rhs.data(), rhs.data() + N,
     std::compare_three_way{}
   );
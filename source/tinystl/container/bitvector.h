@@ -0,0 +1,676 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+
+#include <tinystl/container/vector.h>
+
+namespace tinystl {
+
+using bit_word = std::uint64_t;
+
+inline constexpr std::size_t bits_per_word = std::numeric_limits<bit_word>::digits;
+
+namespace detail {
+
+// Word-at-a-time kernels shared by bitvector's bulk operations. They are plain
+// loops over 64-bit words with no cross-iteration dependency, which the
+// compiler turns into SSE/AVX/NEON code at -O2 and above.
+inline std::size_t bit_count(const bit_word *words, std::size_t n) noexcept {
+  // Four independent accumulators keep the popcount units busy instead of
+  // serialising on a single sum.
+  std::size_t c0 = 0, c1 = 0, c2 = 0, c3 = 0;
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    c0 += static_cast<std::size_t>(std::popcount(words[i]));
+    c1 += static_cast<std::size_t>(std::popcount(words[i + 1]));
+    c2 += static_cast<std::size_t>(std::popcount(words[i + 2]));
+    c3 += static_cast<std::size_t>(std::popcount(words[i + 3]));
+  }
+  for (; i < n; ++i) {
+    c0 += static_cast<std::size_t>(std::popcount(words[i]));
+  }
+  return c0 + c1 + c2 + c3;
+}
+
+inline void bit_and(bit_word *dst, const bit_word *src, std::size_t n) noexcept {
+  for (std::size_t i = 0; i < n; ++i) {
+    dst[i] &= src[i];
+  }
+}
+
+inline void bit_or(bit_word *dst, const bit_word *src, std::size_t n) noexcept {
+  for (std::size_t i = 0; i < n; ++i) {
+    dst[i] |= src[i];
+  }
+}
+
+inline void bit_xor(bit_word *dst, const bit_word *src, std::size_t n) noexcept {
+  for (std::size_t i = 0; i < n; ++i) {
+    dst[i] ^= src[i];
+  }
+}
+
+inline void
+bit_and_not(bit_word *dst, const bit_word *src, std::size_t n) noexcept {
+  for (std::size_t i = 0; i < n; ++i) {
+    dst[i] &= ~src[i];
+  }
+}
+
+inline void bit_not(bit_word *dst, std::size_t n) noexcept {
+  for (std::size_t i = 0; i < n; ++i) {
+    dst[i] = ~dst[i];
+  }
+}
+
+} // namespace detail
+
+// Proxy returned by bitvector's non-const operator[] and iterators.
+class bit_reference {
+public:
+  constexpr bit_reference(bit_word *word, bit_word mask) noexcept
+    : m_word(word), m_mask(mask) {}
+  constexpr bit_reference(const bit_reference &) noexcept = default;
+
+  constexpr operator bool() const noexcept { return (*m_word & m_mask) != 0; }
+  constexpr bool operator~() const noexcept { return (*m_word & m_mask) == 0; }
+
+  constexpr bit_reference &operator=(bool val) noexcept {
+    if (val) {
+      *m_word |= m_mask;
+    } else {
+      *m_word &= ~m_mask;
+    }
+    return *this;
+  }
+
+  constexpr bit_reference &operator=(const bit_reference &other) noexcept {
+    return *this = static_cast<bool>(other);
+  }
+
+  constexpr void flip() noexcept { *m_word ^= m_mask; }
+
+  friend constexpr void swap(bit_reference x, bit_reference y) noexcept {
+    bool tmp = x;
+    x = static_cast<bool>(y);
+    y = tmp;
+  }
+
+private:
+  bit_word *m_word;
+  bit_word m_mask;
+};
+
+template <bool IsConst>
+class bit_iterator {
+  using word_pointer = std::conditional_t<IsConst, const bit_word *, bit_word *>;
+
+public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = bool;
+  using difference_type = std::ptrdiff_t;
+  using pointer = void;
+  using reference = std::conditional_t<IsConst, bool, bit_reference>;
+
+  constexpr bit_iterator() noexcept = default;
+  constexpr bit_iterator(word_pointer word, unsigned bit) noexcept
+    : m_word(word), m_bit(bit) {}
+  template <bool OtherConst>
+    requires(IsConst && !OtherConst)
+  constexpr bit_iterator(const bit_iterator<OtherConst> &it) noexcept
+    : m_word(it.m_word), m_bit(it.m_bit) {}
+
+  constexpr reference operator*() const noexcept {
+    if constexpr (IsConst) {
+      return ((*m_word >> m_bit) & 1) != 0;
+    } else {
+      return bit_reference(m_word, bit_word(1) << m_bit);
+    }
+  }
+
+  constexpr reference operator[](difference_type n) const noexcept {
+    return *(*this + n);
+  }
+
+  constexpr bit_iterator &operator++() noexcept {
+    if (++m_bit == bits_per_word) {
+      ++m_word;
+      m_bit = 0;
+    }
+    return *this;
+  }
+
+  constexpr bit_iterator operator++(int) noexcept {
+    bit_iterator tmp = *this;
+    ++*this;
+    return tmp;
+  }
+
+  constexpr bit_iterator &operator--() noexcept {
+    if (m_bit-- == 0) {
+      --m_word;
+      m_bit = bits_per_word - 1;
+    }
+    return *this;
+  }
+
+  constexpr bit_iterator operator--(int) noexcept {
+    bit_iterator tmp = *this;
+    --*this;
+    return tmp;
+  }
+
+  constexpr bit_iterator &operator+=(difference_type n) noexcept {
+    constexpr auto word_bits = static_cast<difference_type>(bits_per_word);
+    difference_type pos = static_cast<difference_type>(m_bit) + n;
+    difference_type words = pos >= 0 ? pos / word_bits
+                                     : -((word_bits - 1 - pos) / word_bits);
+    m_word += words;
+    m_bit = static_cast<unsigned>(pos - words * word_bits);
+    return *this;
+  }
+
+  constexpr bit_iterator &operator-=(difference_type n) noexcept {
+    return *this += -n;
+  }
+
+  friend constexpr bit_iterator
+  operator+(bit_iterator it, difference_type n) noexcept {
+    return it += n;
+  }
+
+  friend constexpr bit_iterator
+  operator+(difference_type n, bit_iterator it) noexcept {
+    return it += n;
+  }
+
+  friend constexpr bit_iterator
+  operator-(bit_iterator it, difference_type n) noexcept {
+    return it -= n;
+  }
+
+  friend constexpr difference_type
+  operator-(const bit_iterator &x, const bit_iterator &y) noexcept {
+    return (x.m_word - y.m_word) * static_cast<difference_type>(bits_per_word) +
+           static_cast<difference_type>(x.m_bit) -
+           static_cast<difference_type>(y.m_bit);
+  }
+
+  friend constexpr bool
+  operator==(const bit_iterator &x, const bit_iterator &y) noexcept {
+    return x.m_word == y.m_word && x.m_bit == y.m_bit;
+  }
+
+  friend constexpr std::strong_ordering
+  operator<=>(const bit_iterator &x, const bit_iterator &y) noexcept {
+    if (auto cmp = x.m_word <=> y.m_word; cmp != 0) {
+      return cmp;
+    }
+    return x.m_bit <=> y.m_bit;
+  }
+
+private:
+  friend class bit_iterator<true>;
+
+  word_pointer m_word = nullptr;
+  unsigned m_bit = 0;
+};
+
+// A dynamic sequence of bits packed 64 to a word. It offers the vector<bool>
+// interface plus bitset-style whole-word operations: count(), find_first()/
+// find_next() and in-place AND/OR/XOR/ANDNOT against another bitvector.
+//
+// Bits past size() in the last word are kept at zero, so count() and
+// comparisons can work on whole words without masking.
+template <class Alloc = std::allocator<bool>>
+class bitvector {
+  using word_allocator =
+    typename std::allocator_traits<Alloc>::template rebind_alloc<bit_word>;
+  using word_vector = vector<bit_word, word_allocator>;
+
+public:
+  using value_type = bool;
+  using reference = bit_reference;
+  using const_reference = bool;
+
+  using allocator_type = Alloc;
+
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  using iterator = bit_iterator<false>;
+  using const_iterator = bit_iterator<true>;
+
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  using word_type = bit_word;
+
+  static constexpr size_type npos = static_cast<size_type>(-1);
+
+  // construct/copy/destroy
+  bitvector() = default;
+  explicit bitvector(const Alloc &alloc);
+  explicit bitvector(size_type n, bool val = false, const Alloc &alloc = Alloc());
+  template <std::input_iterator InputIter>
+    requires std::convertible_to<std::iter_reference_t<InputIter>, bool>
+  bitvector(InputIter first, InputIter last, const Alloc &alloc = Alloc());
+  bitvector(std::initializer_list<bool> init, const Alloc &alloc = Alloc());
+
+  allocator_type get_allocator() const { return Alloc(m_words.get_allocator()); }
+
+  // element access
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  const_reference test(size_type pos) const;
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference front() { return (*this)[0]; }
+  const_reference front() const { return (*this)[0]; }
+  reference back() { return (*this)[m_size - 1]; }
+  const_reference back() const { return (*this)[m_size - 1]; }
+
+  // The packed representation, least significant bit first.
+  std::span<word_type> words() noexcept {
+    return {m_words.data(), m_words.size()};
+  }
+  std::span<const word_type> words() const noexcept {
+    return {m_words.data(), m_words.size()};
+  }
+
+  // iterators
+  iterator begin() noexcept { return iterator(m_words.data(), 0); }
+  const_iterator begin() const noexcept {
+    return const_iterator(m_words.data(), 0);
+  }
+  const_iterator cbegin() const noexcept { return this->begin(); }
+  iterator end() noexcept {
+    return this->begin() + static_cast<difference_type>(m_size);
+  }
+  const_iterator end() const noexcept {
+    return this->begin() + static_cast<difference_type>(m_size);
+  }
+  const_iterator cend() const noexcept { return this->end(); }
+  reverse_iterator rbegin() noexcept { return reverse_iterator(this->end()); }
+  const_reverse_iterator rbegin() const noexcept {
+    return const_reverse_iterator(this->end());
+  }
+  reverse_iterator rend() noexcept { return reverse_iterator(this->begin()); }
+  const_reverse_iterator rend() const noexcept {
+    return const_reverse_iterator(this->begin());
+  }
+
+  // capacity
+  bool empty() const noexcept { return m_size == 0; }
+  size_type size() const noexcept { return m_size; }
+  size_type max_size() const noexcept { return m_words.max_size(); }
+  size_type capacity() const noexcept {
+    return m_words.capacity() * bits_per_word;
+  }
+  void reserve(size_type n) { m_words.reserve(word_count(n)); }
+  void shrink_to_fit() { m_words.shrink_to_fit(); }
+
+  // modifiers
+  void clear() noexcept;
+  void push_back(bool val);
+  void pop_back();
+  void resize(size_type n, bool val = false);
+  void swap(bitvector &other) noexcept;
+
+  bitvector &set() noexcept;
+  bitvector &set(size_type pos, bool val = true);
+  bitvector &reset() noexcept;
+  bitvector &reset(size_type pos);
+  bitvector &flip() noexcept;
+  bitvector &flip(size_type pos);
+
+  // bit operations
+  size_type count() const noexcept;
+  bool any() const noexcept;
+  bool all() const noexcept;
+  bool none() const noexcept { return !this->any(); }
+  size_type find_first() const noexcept;
+  size_type find_next(size_type pos) const noexcept;
+
+  // The operands must have the same size.
+  bitvector &operator&=(const bitvector &other) noexcept;
+  bitvector &operator|=(const bitvector &other) noexcept;
+  bitvector &operator^=(const bitvector &other) noexcept;
+  bitvector &and_not(const bitvector &other) noexcept;
+
+  template <class A>
+  friend bool operator==(const bitvector<A> &lhs, const bitvector<A> &rhs);
+
+private:
+  static size_type word_count(size_type bits) noexcept {
+    return (bits + bits_per_word - 1) / bits_per_word;
+  }
+
+  static word_type bit_mask(size_type pos) noexcept {
+    return word_type(1) << (pos % bits_per_word);
+  }
+
+  void throw_out_of_range() const;
+
+  // Zeroes the bits of the last word that lie past size().
+  void clear_unused_bits() noexcept;
+
+  size_type find_from_word(size_type index, word_type word) const noexcept;
+
+private:
+  word_vector m_words;
+  size_type m_size = 0;
+};
+
+template <class Alloc>
+bool operator==(const bitvector<Alloc> &lhs, const bitvector<Alloc> &rhs) {
+  return lhs.m_size == rhs.m_size && lhs.m_words == rhs.m_words;
+}
+
+template <class Alloc>
+bitvector<Alloc>
+operator&(const bitvector<Alloc> &lhs, const bitvector<Alloc> &rhs) {
+  bitvector<Alloc> result(lhs);
+  result &= rhs;
+  return result;
+}
+
+template <class Alloc>
+bitvector<Alloc>
+operator|(const bitvector<Alloc> &lhs, const bitvector<Alloc> &rhs) {
+  bitvector<Alloc> result(lhs);
+  result |= rhs;
+  return result;
+}
+
+template <class Alloc>
+bitvector<Alloc>
+operator^(const bitvector<Alloc> &lhs, const bitvector<Alloc> &rhs) {
+  bitvector<Alloc> result(lhs);
+  result ^= rhs;
+  return result;
+}
+
+template <class Alloc>
+bitvector<Alloc> operator~(const bitvector<Alloc> &bits) {
+  bitvector<Alloc> result(bits);
+  result.flip();
+  return result;
+}
+
+template <class Alloc>
+void swap(bitvector<Alloc> &lhs, bitvector<Alloc> &rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+/* -------------------------------------------------------------------------- */
+/*                           public member functions                          */
+/* -------------------------------------------------------------------------- */
+
+/* -------------------------------- construct ------------------------------- */
+template <class Alloc>
+bitvector<Alloc>::bitvector(const Alloc &alloc)
+  : m_words(word_allocator(alloc)) {}
+
+template <class Alloc>
+bitvector<Alloc>::bitvector(size_type n, bool val, const Alloc &alloc)
+  : m_words(word_count(n), val ? ~word_type(0) : word_type(0), word_allocator(alloc)),
+    m_size(n) {
+  this->clear_unused_bits();
+}
+
+template <class Alloc>
+template <std::input_iterator InputIter>
+  requires std::convertible_to<std::iter_reference_t<InputIter>, bool>
+bitvector<Alloc>::bitvector(InputIter first, InputIter last, const Alloc &alloc)
+  : m_words(word_allocator(alloc)) {
+  if constexpr (std::forward_iterator<InputIter>) {
+    this->reserve(static_cast<size_type>(std::distance(first, last)));
+  }
+  for (; first != last; ++first) {
+    this->push_back(static_cast<bool>(*first));
+  }
+}
+
+template <class Alloc>
+bitvector<Alloc>::bitvector(std::initializer_list<bool> init, const Alloc &alloc)
+  : bitvector(init.begin(), init.end(), alloc) {}
+
+/* ----------------------------- element access ----------------------------- */
+template <class Alloc>
+typename bitvector<Alloc>::reference
+bitvector<Alloc>::operator[](size_type pos) {
+  assert(pos < m_size && "bitvector[] index out of bounds");
+  return reference(&m_words[pos / bits_per_word], bit_mask(pos));
+}
+
+template <class Alloc>
+typename bitvector<Alloc>::const_reference
+bitvector<Alloc>::operator[](size_type pos) const {
+  assert(pos < m_size && "bitvector[] index out of bounds");
+  return (m_words[pos / bits_per_word] & bit_mask(pos)) != 0;
+}
+
+template <class Alloc>
+typename bitvector<Alloc>::const_reference
+bitvector<Alloc>::test(size_type pos) const {
+  if (pos >= m_size) {
+    this->throw_out_of_range();
+  }
+  return (*this)[pos];
+}
+
+template <class Alloc>
+typename bitvector<Alloc>::reference bitvector<Alloc>::at(size_type pos) {
+  if (pos >= m_size) {
+    this->throw_out_of_range();
+  }
+  return (*this)[pos];
+}
+
+template <class Alloc>
+typename bitvector<Alloc>::const_reference
+bitvector<Alloc>::at(size_type pos) const {
+  return this->test(pos);
+}
+
+/* -------------------------------- modifiers ------------------------------- */
+template <class Alloc>
+void bitvector<Alloc>::clear() noexcept {
+  m_words.clear();
+  m_size = 0;
+}
+
+template <class Alloc>
+void bitvector<Alloc>::push_back(bool val) {
+  if (m_size % bits_per_word == 0) {
+    m_words.push_back(0);
+  }
+  if (val) {
+    m_words.back() |= bit_mask(m_size);
+  }
+  ++m_size;
+}
+
+template <class Alloc>
+void bitvector<Alloc>::pop_back() {
+  assert(!this->empty() && "bitvector::pop_back called on an empty bitvector");
+  --m_size;
+  if (m_size % bits_per_word == 0) {
+    m_words.pop_back();
+  } else {
+    m_words.back() &= ~bit_mask(m_size);
+  }
+}
+
+template <class Alloc>
+void bitvector<Alloc>::resize(size_type n, bool val) {
+  if (n > m_size && val) {
+    // Fill the tail of the current last word before adding whole words.
+    if (m_size % bits_per_word != 0) {
+      m_words.back() |= ~word_type(0) << (m_size % bits_per_word);
+    }
+    m_words.resize(word_count(n), ~word_type(0));
+  } else {
+    m_words.resize(word_count(n), 0);
+  }
+  m_size = n;
+  this->clear_unused_bits();
+}
+
+template <class Alloc>
+void bitvector<Alloc>::swap(bitvector &other) noexcept {
+  m_words.swap(other.m_words);
+  std::swap(m_size, other.m_size);
+}
+
+template <class Alloc>
+bitvector<Alloc> &bitvector<Alloc>::set() noexcept {
+  std::fill(m_words.begin(), m_words.end(), ~word_type(0));
+  this->clear_unused_bits();
+  return *this;
+}
+
+template <class Alloc>
+bitvector<Alloc> &bitvector<Alloc>::set(size_type pos, bool val) {
+  this->at(pos) = val;
+  return *this;
+}
+
+template <class Alloc>
+bitvector<Alloc> &bitvector<Alloc>::reset() noexcept {
+  std::fill(m_words.begin(), m_words.end(), word_type(0));
+  return *this;
+}
+
+template <class Alloc>
+bitvector<Alloc> &bitvector<Alloc>::reset(size_type pos) {
+  this->at(pos) = false;
+  return *this;
+}
+
+template <class Alloc>
+bitvector<Alloc> &bitvector<Alloc>::flip() noexcept {
+  detail::bit_not(m_words.data(), m_words.size());
+  this->clear_unused_bits();
+  return *this;
+}
+
+template <class Alloc>
+bitvector<Alloc> &bitvector<Alloc>::flip(size_type pos) {
+  this->at(pos).flip();
+  return *this;
+}
+
+/* ------------------------------ bit operations ---------------------------- */
+template <class Alloc>
+typename bitvector<Alloc>::size_type bitvector<Alloc>::count() const noexcept {
+  return detail::bit_count(m_words.data(), m_words.size());
+}
+
+template <class Alloc>
+bool bitvector<Alloc>::any() const noexcept {
+  return std::any_of(m_words.begin(), m_words.end(), [](word_type w) {
+    return w != 0;
+  });
+}
+
+template <class Alloc>
+bool bitvector<Alloc>::all() const noexcept {
+  size_type full = m_size / bits_per_word;
+  for (size_type i = 0; i < full; ++i) {
+    if (m_words[i] != ~word_type(0)) {
+      return false;
+    }
+  }
+  size_type tail = m_size % bits_per_word;
+  return tail == 0 || m_words[full] == (word_type(1) << tail) - 1;
+}
+
+template <class Alloc>
+typename bitvector<Alloc>::size_type
+bitvector<Alloc>::find_first() const noexcept {
+  return m_words.empty() ? npos : this->find_from_word(0, m_words[0]);
+}
+
+template <class Alloc>
+typename bitvector<Alloc>::size_type
+bitvector<Alloc>::find_next(size_type pos) const noexcept {
+  ++pos;
+  if (pos >= m_size) {
+    return npos;
+  }
+  size_type index = pos / bits_per_word;
+  word_type word = m_words[index] & (~word_type(0) << (pos % bits_per_word));
+  return this->find_from_word(index, word);
+}
+
+template <class Alloc>
+bitvector<Alloc> &bitvector<Alloc>::operator&=(const bitvector &other) noexcept {
+  assert(m_size == other.m_size && "bitvector operands differ in size");
+  detail::bit_and(m_words.data(), other.m_words.data(), m_words.size());
+  return *this;
+}
+
+template <class Alloc>
+bitvector<Alloc> &bitvector<Alloc>::operator|=(const bitvector &other) noexcept {
+  assert(m_size == other.m_size && "bitvector operands differ in size");
+  detail::bit_or(m_words.data(), other.m_words.data(), m_words.size());
+  return *this;
+}
+
+template <class Alloc>
+bitvector<Alloc> &bitvector<Alloc>::operator^=(const bitvector &other) noexcept {
+  assert(m_size == other.m_size && "bitvector operands differ in size");
+  detail::bit_xor(m_words.data(), other.m_words.data(), m_words.size());
+  return *this;
+}
+
+template <class Alloc>
+bitvector<Alloc> &bitvector<Alloc>::and_not(const bitvector &other) noexcept {
+  assert(m_size == other.m_size && "bitvector operands differ in size");
+  detail::bit_and_not(m_words.data(), other.m_words.data(), m_words.size());
+  return *this;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                          private member functions                          */
+/* -------------------------------------------------------------------------- */
+template <class Alloc>
+void bitvector<Alloc>::throw_out_of_range() const {
+  throw std::out_of_range("bitvector");
+}
+
+template <class Alloc>
+void bitvector<Alloc>::clear_unused_bits() noexcept {
+  size_type tail = m_size % bits_per_word;
+  if (tail != 0) {
+    m_words.back() &= (word_type(1) << tail) - 1;
+  }
+}
+
+template <class Alloc>
+typename bitvector<Alloc>::size_type
+bitvector<Alloc>::find_from_word(size_type index, word_type word) const noexcept {
+  while (word == 0) {
+    if (++index == m_words.size()) {
+      return npos;
+    }
+    word = m_words[index];
+  }
+  return index * bits_per_word + static_cast<size_type>(std::countr_zero(word));
+}
+
+} // namespace tinystl
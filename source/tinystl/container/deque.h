@@ -4,6 +4,7 @@
 #include <iterator>
 #include <memory>
 
+#include "tinystl/container/introspection.h"
 #include "tinystl/container/split_buffer.h"
 #include "tinystl/container/vector.h"
 #include "tinystl/iterator/segmented_iterator.h"
@@ -199,7 +200,7 @@ public:
 };
 
 template <class T, class Alloc = std::allocator<T>>
-class deque {
+class deque : public introspection::tracked<deque<T, Alloc>> {
   using alloc_traits = std::allocator_traits<Alloc>;
 
   using pointer_allocator =
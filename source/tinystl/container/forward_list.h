@@ -0,0 +1,964 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+namespace tinystl {
+
+struct forward_list_node_base {
+  forward_list_node_base *m_next;
+};
+
+template <class T>
+struct forward_list_node : forward_list_node_base {
+  // the value is constructed separately through the allocator
+  union {
+    T m_value;
+  };
+
+  forward_list_node() noexcept {}
+  ~forward_list_node() {}
+};
+
+template <class T, class Pointer, class Reference>
+class forward_list_iterator {
+public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using reference = Reference;
+  using pointer = Pointer;
+
+  forward_list_iterator() = default;
+  template <class P, class R>
+    requires std::is_convertible_v<P, pointer>
+  forward_list_iterator(const forward_list_iterator<T, P, R> &it) noexcept
+    : m_node(it.m_node) {}
+
+  reference operator*() const {
+    return static_cast<forward_list_node<T> *>(m_node)->m_value;
+  }
+  pointer operator->() const { return std::addressof(**this); }
+
+  forward_list_iterator &operator++() {
+    m_node = m_node->m_next;
+    return *this;
+  }
+
+  forward_list_iterator operator++(int) {
+    forward_list_iterator tmp = *this;
+    m_node = m_node->m_next;
+    return tmp;
+  }
+
+  friend bool
+  operator==(const forward_list_iterator &x, const forward_list_iterator &y) {
+    return x.m_node == y.m_node;
+  }
+
+private:
+  explicit forward_list_iterator(forward_list_node_base *n) noexcept
+    : m_node(n) {}
+
+  template <class, class>
+  friend class forward_list;
+
+  template <class, class, class>
+  friend class forward_list_iterator;
+
+private:
+  forward_list_node_base *m_node = nullptr;
+};
+
+template <class T, class Alloc = std::allocator<T>>
+class forward_list {
+  using alloc_traits = std::allocator_traits<Alloc>;
+
+  using node_base = forward_list_node_base;
+  using node_type = forward_list_node<T>;
+  using node_allocator = typename alloc_traits::template rebind_alloc<node_type>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+public:
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+
+  using allocator_type = Alloc;
+
+  using size_type = typename alloc_traits::size_type;
+  using difference_type = typename alloc_traits::difference_type;
+
+  using pointer = typename alloc_traits::pointer;
+  using const_pointer = typename alloc_traits::const_pointer;
+
+  using iterator = forward_list_iterator<T, T *, T &>;
+  using const_iterator = forward_list_iterator<T, const T *, const T &>;
+
+  // construct/copy/destroy
+  forward_list() = default;
+  explicit forward_list(const Alloc &alloc) noexcept;
+  explicit forward_list(size_type n, const Alloc &alloc = Alloc());
+  forward_list(size_type n, const_reference val, const Alloc &alloc = Alloc());
+  template <std::input_iterator InputIter>
+    requires std::constructible_from<T, std::iter_reference_t<InputIter>>
+  forward_list(InputIter first, InputIter last, const Alloc &alloc = Alloc());
+  forward_list(const forward_list &other);
+  forward_list(const forward_list &other, const Alloc &alloc);
+  forward_list(forward_list &&other) noexcept;
+  forward_list(forward_list &&other, const Alloc &alloc);
+  forward_list(
+    std::initializer_list<value_type> init, const Alloc &alloc = Alloc()
+  );
+
+  ~forward_list();
+
+  forward_list &operator=(const forward_list &other);
+  forward_list &operator=(forward_list &&other) noexcept(
+    alloc_traits::propagate_on_container_move_assignment::value ||
+    alloc_traits::is_always_equal::value
+  );
+  forward_list &operator=(std::initializer_list<value_type> init);
+
+  void assign(size_type n, const_reference val);
+  template <std::input_iterator InputIter>
+    requires std::constructible_from<T, std::iter_reference_t<InputIter>>
+  void assign(InputIter first, InputIter last);
+  void assign(std::initializer_list<value_type> init);
+
+  allocator_type get_allocator() const noexcept;
+
+  // element access
+  reference front();
+  const_reference front() const;
+
+  // iterators
+  iterator before_begin() noexcept { return iterator(&m_head); }
+  const_iterator before_begin() const noexcept {
+    return const_iterator(const_cast<node_base *>(&m_head));
+  }
+  const_iterator cbefore_begin() const noexcept { return this->before_begin(); }
+  iterator begin() noexcept { return iterator(m_head.m_next); }
+  const_iterator begin() const noexcept { return const_iterator(m_head.m_next); }
+  const_iterator cbegin() const noexcept { return this->begin(); }
+  iterator end() noexcept { return iterator(nullptr); }
+  const_iterator end() const noexcept { return const_iterator(nullptr); }
+  const_iterator cend() const noexcept { return this->end(); }
+
+  // capacity
+  bool empty() const noexcept { return m_head.m_next == nullptr; }
+  size_type max_size() const noexcept;
+
+  // modifiers
+  void clear() noexcept;
+  iterator insert_after(const_iterator pos, const_reference val);
+  iterator insert_after(const_iterator pos, value_type &&val);
+  iterator insert_after(const_iterator pos, size_type n, const_reference val);
+  template <std::input_iterator InputIter>
+    requires std::constructible_from<T, std::iter_reference_t<InputIter>>
+  iterator insert_after(const_iterator pos, InputIter first, InputIter last);
+  iterator insert_after(const_iterator pos, std::initializer_list<T> init);
+  template <class... Args>
+  iterator emplace_after(const_iterator pos, Args &&...args);
+  iterator erase_after(const_iterator pos);
+  iterator erase_after(const_iterator first, const_iterator last);
+  void push_front(const_reference val);
+  void push_front(value_type &&val);
+  template <class... Args>
+  reference emplace_front(Args &&...args);
+  void pop_front();
+  void resize(size_type n);
+  void resize(size_type n, const_reference val);
+  void swap(forward_list &other) noexcept(
+    alloc_traits::propagate_on_container_swap::value ||
+    alloc_traits::is_always_equal::value
+  );
+
+  // operations
+  void merge(forward_list &other);
+  void merge(forward_list &&other);
+  template <class Compare>
+  void merge(forward_list &other, Compare comp);
+  template <class Compare>
+  void merge(forward_list &&other, Compare comp);
+  void splice_after(const_iterator pos, forward_list &other);
+  void splice_after(const_iterator pos, forward_list &&other);
+  void splice_after(const_iterator pos, forward_list &other, const_iterator it);
+  void
+  splice_after(const_iterator pos, forward_list &&other, const_iterator it);
+  void splice_after(
+    const_iterator pos, forward_list &other, const_iterator first,
+    const_iterator last
+  );
+  void splice_after(
+    const_iterator pos, forward_list &&other, const_iterator first,
+    const_iterator last
+  );
+  size_type remove(const_reference val);
+  template <class Pred>
+  size_type remove_if(Pred pred);
+  void reverse() noexcept;
+  size_type unique();
+  template <class BinaryPred>
+  size_type unique(BinaryPred pred);
+  void sort();
+  template <class Compare>
+  void sort(Compare comp);
+
+private:
+  template <class... Args>
+  node_type *create_node(Args &&...args);
+  void destroy_node(node_base *n) noexcept;
+  void destroy_chain(node_base *first) noexcept;
+
+  template <class... Args>
+  iterator insert_n_after(const_iterator pos, size_type n, const Args &...args);
+
+  template <class Compare>
+  static node_base *merge_chains(node_base *a, node_base *b, Compare &comp);
+  template <class Compare>
+  static node_base *merge_sort(node_base *head, size_type n, Compare &comp);
+
+private:
+  node_allocator m_alloc;
+  node_base m_head{nullptr};
+};
+
+template <class T, class Alloc>
+bool operator==(
+  const forward_list<T, Alloc> &lhs, const forward_list<T, Alloc> &rhs
+) {
+  return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <class T, class Alloc>
+auto operator<=>(
+  const forward_list<T, Alloc> &lhs, const forward_list<T, Alloc> &rhs
+) {
+  return std::lexicographical_compare_three_way(
+    lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), std::compare_three_way()
+  );
+}
+
+template <class T, class Alloc>
+void swap(forward_list<T, Alloc> &lhs, forward_list<T, Alloc> &rhs) noexcept(
+  noexcept(lhs.swap(rhs))
+) {
+  lhs.swap(rhs);
+}
+
+template <class T, class Alloc, class U>
+typename forward_list<T, Alloc>::size_type
+erase(forward_list<T, Alloc> &c, const U &val) {
+  return c.remove_if([&](const T &elem) { return elem == val; });
+}
+
+template <class T, class Alloc, class Pred>
+typename forward_list<T, Alloc>::size_type
+erase_if(forward_list<T, Alloc> &c, Pred pred) {
+  return c.remove_if(pred);
+}
+
+/* -------------------------------------------------------------------------- */
+/*                           public member functions                          */
+/* -------------------------------------------------------------------------- */
+
+/* -------------------------------- construct ------------------------------- */
+template <class T, class Alloc>
+forward_list<T, Alloc>::forward_list(const Alloc &alloc) noexcept
+  : m_alloc(alloc) {}
+
+template <class T, class Alloc>
+forward_list<T, Alloc>::forward_list(size_type n, const Alloc &alloc)
+  : m_alloc(alloc) {
+  this->insert_n_after(this->cbefore_begin(), n);
+}
+
+template <class T, class Alloc>
+forward_list<T, Alloc>::forward_list(
+  size_type n, const_reference val, const Alloc &alloc
+)
+  : m_alloc(alloc) {
+  this->insert_n_after(this->cbefore_begin(), n, val);
+}
+
+template <class T, class Alloc>
+template <std::input_iterator InputIter>
+  requires std::constructible_from<T, std::iter_reference_t<InputIter>>
+forward_list<T, Alloc>::forward_list(
+  InputIter first, InputIter last, const Alloc &alloc
+)
+  : m_alloc(alloc) {
+  this->insert_after(this->cbefore_begin(), first, last);
+}
+
+template <class T, class Alloc>
+forward_list<T, Alloc>::forward_list(const forward_list &other)
+  : m_alloc(node_traits::select_on_container_copy_construction(other.m_alloc)
+    ) {
+  this->insert_after(this->cbefore_begin(), other.begin(), other.end());
+}
+
+template <class T, class Alloc>
+forward_list<T, Alloc>::forward_list(
+  const forward_list &other, const Alloc &alloc
+)
+  : m_alloc(alloc) {
+  this->insert_after(this->cbefore_begin(), other.begin(), other.end());
+}
+
+template <class T, class Alloc>
+forward_list<T, Alloc>::forward_list(forward_list &&other) noexcept
+  : m_alloc(std::move(other.m_alloc)) {
+  m_head.m_next = other.m_head.m_next;
+  other.m_head.m_next = nullptr;
+}
+
+template <class T, class Alloc>
+forward_list<T, Alloc>::forward_list(forward_list &&other, const Alloc &alloc)
+  : m_alloc(alloc) {
+  if (m_alloc == other.m_alloc) {
+    m_head.m_next = other.m_head.m_next;
+    other.m_head.m_next = nullptr;
+  } else {
+    this->insert_after(
+      this->cbefore_begin(), std::make_move_iterator(other.begin()),
+      std::make_move_iterator(other.end())
+    );
+  }
+}
+
+template <class T, class Alloc>
+forward_list<T, Alloc>::forward_list(
+  std::initializer_list<value_type> init, const Alloc &alloc
+)
+  : m_alloc(alloc) {
+  this->insert_after(this->cbefore_begin(), init.begin(), init.end());
+}
+
+/* ------------------------------- destructor ------------------------------- */
+template <class T, class Alloc>
+forward_list<T, Alloc>::~forward_list() {
+  this->clear();
+}
+
+/* -------------------------------- operator= ------------------------------- */
+template <class T, class Alloc>
+forward_list<T, Alloc> &
+forward_list<T, Alloc>::operator=(const forward_list &other) {
+  if (this != std::addressof(other)) {
+    if constexpr (node_traits::propagate_on_container_copy_assignment::value) {
+      if (m_alloc != other.m_alloc) {
+        this->clear();
+      }
+      m_alloc = other.m_alloc;
+    }
+
+    this->assign(other.begin(), other.end());
+  }
+
+  return *this;
+}
+
+template <class T, class Alloc>
+forward_list<T, Alloc> &
+forward_list<T, Alloc>::operator=(forward_list &&other) noexcept(
+  alloc_traits::propagate_on_container_move_assignment::value ||
+  alloc_traits::is_always_equal::value
+) {
+  if (this == std::addressof(other)) {
+    return *this;
+  }
+
+  if constexpr (node_traits::propagate_on_container_move_assignment::value) {
+    this->clear();
+    m_alloc = std::move(other.m_alloc);
+    m_head.m_next = other.m_head.m_next;
+    other.m_head.m_next = nullptr;
+  } else {
+    if (m_alloc == other.m_alloc) {
+      this->clear();
+      m_head.m_next = other.m_head.m_next;
+      other.m_head.m_next = nullptr;
+    } else {
+      this->assign(
+        std::make_move_iterator(other.begin()),
+        std::make_move_iterator(other.end())
+      );
+    }
+  }
+
+  return *this;
+}
+
+template <class T, class Alloc>
+forward_list<T, Alloc> &
+forward_list<T, Alloc>::operator=(std::initializer_list<value_type> init) {
+  this->assign(init.begin(), init.end());
+  return *this;
+}
+
+/* --------------------------------- assign --------------------------------- */
+template <class T, class Alloc>
+void forward_list<T, Alloc>::assign(size_type n, const_reference val) {
+  // reuse the existing nodes before allocating new ones
+  iterator prev = this->before_begin();
+  iterator it = this->begin();
+  for (; n > 0 && it != this->end(); --n, ++it, ++prev) {
+    *it = val;
+  }
+
+  if (n > 0) {
+    this->insert_n_after(prev, n, val);
+  } else {
+    this->erase_after(prev, this->end());
+  }
+}
+
+template <class T, class Alloc>
+template <std::input_iterator InputIter>
+  requires std::constructible_from<T, std::iter_reference_t<InputIter>>
+void forward_list<T, Alloc>::assign(InputIter first, InputIter last) {
+  iterator prev = this->before_begin();
+  iterator it = this->begin();
+  for (; first != last && it != this->end(); ++first, ++it, ++prev) {
+    *it = *first;
+  }
+
+  if (first != last) {
+    this->insert_after(prev, first, last);
+  } else {
+    this->erase_after(prev, this->end());
+  }
+}
+
+template <class T, class Alloc>
+void forward_list<T, Alloc>::assign(std::initializer_list<value_type> init) {
+  this->assign(init.begin(), init.end());
+}
+
+template <class T, class Alloc>
+typename forward_list<T, Alloc>::allocator_type
+forward_list<T, Alloc>::get_allocator() const noexcept {
+  return allocator_type(m_alloc);
+}
+
+/* ----------------------------- element access ----------------------------- */
+template <class T, class Alloc>
+typename forward_list<T, Alloc>::reference forward_list<T, Alloc>::front() {
+  assert(!this->empty() && "front() called on an empty forward_list");
+  return *this->begin();
+}
+
+template <class T, class Alloc>
+typename forward_list<T, Alloc>::const_reference
+forward_list<T, Alloc>::front() const {
+  assert(!this->empty() && "front() called on an empty forward_list");
+  return *this->begin();
+}
+
+/* -------------------------------- capacity -------------------------------- */
+template <class T, class Alloc>
+typename forward_list<T, Alloc>::size_type
+forward_list<T, Alloc>::max_size() const noexcept {
+  return std::min<size_type>(
+    node_traits::max_size(m_alloc), std::numeric_limits<difference_type>::max()
+  );
+}
+
+/* -------------------------------- modifiers ------------------------------- */
+template <class T, class Alloc>
+void forward_list<T, Alloc>::clear() noexcept {
+  this->destroy_chain(m_head.m_next);
+  m_head.m_next = nullptr;
+}
+
+template <class T, class Alloc>
+typename forward_list<T, Alloc>::iterator
+forward_list<T, Alloc>::insert_after(const_iterator pos, const_reference val) {
+  return this->emplace_after(pos, val);
+}
+
+template <class T, class Alloc>
+typename forward_list<T, Alloc>::iterator
+forward_list<T, Alloc>::insert_after(const_iterator pos, value_type &&val) {
+  return this->emplace_after(pos, std::move(val));
+}
+
+template <class T, class Alloc>
+typename forward_list<T, Alloc>::iterator forward_list<T, Alloc>::insert_after(
+  const_iterator pos, size_type n, const_reference val
+) {
+  return this->insert_n_after(pos, n, val);
+}
+
+template <class T, class Alloc>
+template <std::input_iterator InputIter>
+  requires std::constructible_from<T, std::iter_reference_t<InputIter>>
+typename forward_list<T, Alloc>::iterator forward_list<T, Alloc>::insert_after(
+  const_iterator pos, InputIter first, InputIter last
+) {
+  node_base *p = pos.m_node;
+  if (first == last) {
+    return iterator(p);
+  }
+
+  // build the chain off-list so a throwing constructor leaves *this intact
+  node_base *head = this->create_node(*first);
+  node_base *tail = head;
+  try {
+    for (++first; first != last; ++first) {
+      tail->m_next = this->create_node(*first);
+      tail = tail->m_next;
+    }
+  } catch (...) {
+    tail->m_next = nullptr;
+    this->destroy_chain(head);
+    throw;
+  }
+
+  tail->m_next = p->m_next;
+  p->m_next = head;
+  return iterator(tail);
+}
+
+template <class T, class Alloc>
+typename forward_list<T, Alloc>::iterator forward_list<T, Alloc>::insert_after(
+  const_iterator pos, std::initializer_list<T> init
+) {
+  return this->insert_after(pos, init.begin(), init.end());
+}
+
+template <class T, class Alloc>
+template <class... Args>
+typename forward_list<T, Alloc>::iterator
+forward_list<T, Alloc>::emplace_after(const_iterator pos, Args &&...args) {
+  node_base *p = pos.m_node;
+  node_base *n = this->create_node(std::forward<Args>(args)...);
+  n->m_next = p->m_next;
+  p->m_next = n;
+  return iterator(n);
+}
+
+template <class T, class Alloc>
+typename forward_list<T, Alloc>::iterator
+forward_list<T, Alloc>::erase_after(const_iterator pos) {
+  node_base *p = pos.m_node;
+  assert(p->m_next != nullptr && "forward_list::erase_after called on the last element");
+
+  node_base *n = p->m_next;
+  p->m_next = n->m_next;
+  this->destroy_node(n);
+  return iterator(p->m_next);
+}
+
+template <class T, class Alloc>
+typename forward_list<T, Alloc>::iterator
+forward_list<T, Alloc>::erase_after(const_iterator first, const_iterator last) {
+  node_base *f = first.m_node;
+  node_base *l = last.m_node;
+  node_base *n = f->m_next;
+  while (n != l) {
+    node_base *next = n->m_next;
+    this->destroy_node(n);
+    n = next;
+  }
+  f->m_next = l;
+  return iterator(l);
+}
+
+template <class T, class Alloc>
+void forward_list<T, Alloc>::push_front(const_reference val) {
+  this->emplace_front(val);
+}
+
+template <class T, class Alloc>
+void forward_list<T, Alloc>::push_front(value_type &&val) {
+  this->emplace_front(std::move(val));
+}
+
+template <class T, class Alloc>
+template <class... Args>
+typename forward_list<T, Alloc>::reference
+forward_list<T, Alloc>::emplace_front(Args &&...args) {
+  return *this->emplace_after(this->cbefore_begin(), std::forward<Args>(args)...);
+}
+
+template <class T, class Alloc>
+void forward_list<T, Alloc>::pop_front() {
+  assert(!this->empty() && "forward_list::pop_front called on an empty list");
+  this->erase_after(this->cbefore_begin());
+}
+
+template <class T, class Alloc>
+void forward_list<T, Alloc>::resize(size_type n) {
+  iterator prev = this->before_begin();
+  for (; n > 0 && std::next(prev) != this->end(); --n) {
+    ++prev;
+  }
+
+  if (n > 0) {
+    this->insert_n_after(prev, n);
+  } else {
+    this->erase_after(prev, this->end());
+  }
+}
+
+template <class T, class Alloc>
+void forward_list<T, Alloc>::resize(size_type n, const_reference val) {
+  iterator prev = this->before_begin();
+  for (; n > 0 && std::next(prev) != this->end(); --n) {
+    ++prev;
+  }
+
+  if (n > 0) {
+    this->insert_n_after(prev, n, val);
+  } else {
+    this->erase_after(prev, this->end());
+  }
+}
+
+template <class T, class Alloc>
+void forward_list<T, Alloc>::swap(forward_list &other) noexcept(
+  alloc_traits::propagate_on_container_swap::value ||
+  alloc_traits::is_always_equal::value
+) {
+  assert(
+    node_traits::propagate_on_container_swap::value ||
+    m_alloc == other.m_alloc &&
+      "forward_list::swap: Either propagate_on_container_swap must be true or "
+      "the allocators must compare equal"
+  );
+
+  std::swap(m_head.m_next, other.m_head.m_next);
+  if constexpr (node_traits::propagate_on_container_swap::value) {
+    std::swap(m_alloc, other.m_alloc);
+  }
+}
+
+/* ------------------------------- operations ------------------------------- */
+template <class T, class Alloc>
+void forward_list<T, Alloc>::merge(forward_list &other) {
+  this->merge(other, std::less<>());
+}
+
+template <class T, class Alloc>
+void forward_list<T, Alloc>::merge(forward_list &&other) {
+  this->merge(other, std::less<>());
+}
+
+template <class T, class Alloc>
+template <class Compare>
+void forward_list<T, Alloc>::merge(forward_list &other, Compare comp) {
+  if (this == std::addressof(other)) {
+    return;
+  }
+  assert(m_alloc == other.m_alloc && "forward_list::merge with unequal allocators");
+
+  m_head.m_next = merge_chains(m_head.m_next, other.m_head.m_next, comp);
+  other.m_head.m_next = nullptr;
+}
+
+template <class T, class Alloc>
+template <class Compare>
+void forward_list<T, Alloc>::merge(forward_list &&other, Compare comp) {
+  this->merge(other, comp);
+}
+
+template <class T, class Alloc>
+void forward_list<T, Alloc>::splice_after(
+  const_iterator pos, forward_list &other
+) {
+  assert(m_alloc == other.m_alloc && "forward_list::splice_after with unequal allocators");
+
+  if (!other.empty()) {
+    node_base *p = pos.m_node;
+    node_base *last = other.m_head.m_next;
+    while (last->m_next != nullptr) {
+      last = last->m_next;
+    }
+    last->m_next = p->m_next;
+    p->m_next = other.m_head.m_next;
+    other.m_head.m_next = nullptr;
+  }
+}
+
+template <class T, class Alloc>
+void forward_list<T, Alloc>::splice_after(
+  const_iterator pos, forward_list &&other
+) {
+  this->splice_after(pos, other);
+}
+
+template <class T, class Alloc>
+void forward_list<T, Alloc>::splice_after(
+  const_iterator pos, forward_list &other, const_iterator it
+) {
+  assert(m_alloc == other.m_alloc && "forward_list::splice_after with unequal allocators");
+
+  // move the element after `it`
+  node_base *p = pos.m_node;
+  node_base *before = it.m_node;
+  if (p == before || p == before->m_next) {
+    return;
+  }
+
+  node_base *n = before->m_next;
+  before->m_next = n->m_next;
+  n->m_next = p->m_next;
+  p->m_next = n;
+}
+
+template <class T, class Alloc>
+void forward_list<T, Alloc>::splice_after(
+  const_iterator pos, forward_list &&other, const_iterator it
+) {
+  this->splice_after(pos, other, it);
+}
+
+template <class T, class Alloc>
+void forward_list<T, Alloc>::splice_after(
+  const_iterator pos, forward_list &other, const_iterator first,
+  const_iterator last
+) {
+  assert(m_alloc == other.m_alloc && "forward_list::splice_after with unequal allocators");
+
+  // move the open range (first, last)
+  node_base *f = first.m_node;
+  node_base *l = last.m_node;
+  if (f->m_next == l || pos.m_node == f) {
+    return;
+  }
+
+  node_base *tail = f;
+  while (tail->m_next != l) {
+    tail = tail->m_next;
+  }
+
+  node_base *p = pos.m_node;
+  tail->m_next = p->m_next;
+  p->m_next = f->m_next;
+  f->m_next = l;
+}
+
+template <class T, class Alloc>
+void forward_list<T, Alloc>::splice_after(
+  const_iterator pos, forward_list &&other, const_iterator first,
+  const_iterator last
+) {
+  this->splice_after(pos, other, first, last);
+}
+
+template <class T, class Alloc>
+typename forward_list<T, Alloc>::size_type
+forward_list<T, Alloc>::remove(const_reference val) {
+  return this->remove_if([&](const_reference elem) { return elem == val; });
+}
+
+template <class T, class Alloc>
+template <class Pred>
+typename forward_list<T, Alloc>::size_type
+forward_list<T, Alloc>::remove_if(Pred pred) {
+  // `pred` may refer to an element of this list, so the removed nodes are
+  // collected first and destroyed only once the scan is over
+  node_base removed{nullptr};
+  node_base *removed_tail = &removed;
+  size_type n = 0;
+
+  node_base *prev = &m_head;
+  while (prev->m_next != nullptr) {
+    node_base *cur = prev->m_next;
+    if (pred(static_cast<node_type *>(cur)->m_value)) {
+      prev->m_next = cur->m_next;
+      cur->m_next = nullptr;
+      removed_tail->m_next = cur;
+      removed_tail = cur;
+      ++n;
+    } else {
+      prev = cur;
+    }
+  }
+
+  this->destroy_chain(removed.m_next);
+  return n;
+}
+
+template <class T, class Alloc>
+void forward_list<T, Alloc>::reverse() noexcept {
+  node_base *prev = nullptr;
+  node_base *cur = m_head.m_next;
+  while (cur != nullptr) {
+    node_base *next = cur->m_next;
+    cur->m_next = prev;
+    prev = cur;
+    cur = next;
+  }
+  m_head.m_next = prev;
+}
+
+template <class T, class Alloc>
+typename forward_list<T, Alloc>::size_type forward_list<T, Alloc>::unique() {
+  return this->unique(std::equal_to<>());
+}
+
+template <class T, class Alloc>
+template <class BinaryPred>
+typename forward_list<T, Alloc>::size_type
+forward_list<T, Alloc>::unique(BinaryPred pred) {
+  node_base removed{nullptr};
+  node_base *removed_tail = &removed;
+  size_type n = 0;
+
+  for (node_base *first = m_head.m_next; first != nullptr;
+       first = first->m_next) {
+    while (first->m_next != nullptr &&
+           pred(
+             static_cast<node_type *>(first)->m_value,
+             static_cast<node_type *>(first->m_next)->m_value
+           )) {
+      node_base *dup = first->m_next;
+      first->m_next = dup->m_next;
+      dup->m_next = nullptr;
+      removed_tail->m_next = dup;
+      removed_tail = dup;
+      ++n;
+    }
+  }
+
+  this->destroy_chain(removed.m_next);
+  return n;
+}
+
+template <class T, class Alloc>
+void forward_list<T, Alloc>::sort() {
+  this->sort(std::less<>());
+}
+
+template <class T, class Alloc>
+template <class Compare>
+void forward_list<T, Alloc>::sort(Compare comp) {
+  size_type n = static_cast<size_type>(std::distance(this->begin(), this->end()));
+  if (n > 1) {
+    m_head.m_next = merge_sort(m_head.m_next, n, comp);
+  }
+}
+
+/* -------------------------------------------------------------------------- */
+/*                          private member functions                          */
+/* -------------------------------------------------------------------------- */
+template <class T, class Alloc>
+template <class... Args>
+typename forward_list<T, Alloc>::node_type *
+forward_list<T, Alloc>::create_node(Args &&...args) {
+  node_type *n = std::to_address(node_traits::allocate(m_alloc, 1));
+  std::construct_at(n);
+  try {
+    node_traits::construct(
+      m_alloc, std::addressof(n->m_value), std::forward<Args>(args)...
+    );
+  } catch (...) {
+    std::destroy_at(n);
+    node_traits::deallocate(m_alloc, n, 1);
+    throw;
+  }
+  n->m_next = nullptr;
+  return n;
+}
+
+template <class T, class Alloc>
+void forward_list<T, Alloc>::destroy_node(node_base *n) noexcept {
+  node_type *node = static_cast<node_type *>(n);
+  node_traits::destroy(m_alloc, std::addressof(node->m_value));
+  std::destroy_at(node);
+  node_traits::deallocate(m_alloc, node, 1);
+}
+
+template <class T, class Alloc>
+void forward_list<T, Alloc>::destroy_chain(node_base *first) noexcept {
+  while (first != nullptr) {
+    node_base *next = first->m_next;
+    this->destroy_node(first);
+    first = next;
+  }
+}
+
+template <class T, class Alloc>
+template <class... Args>
+typename forward_list<T, Alloc>::iterator forward_list<T, Alloc>::insert_n_after(
+  const_iterator pos, size_type n, const Args &...args
+) {
+  node_base *p = pos.m_node;
+  if (n == 0) {
+    return iterator(p);
+  }
+
+  node_base *head = this->create_node(args...);
+  node_base *tail = head;
+  try {
+    for (size_type i = 1; i < n; ++i) {
+      tail->m_next = this->create_node(args...);
+      tail = tail->m_next;
+    }
+  } catch (...) {
+    this->destroy_chain(head);
+    throw;
+  }
+
+  tail->m_next = p->m_next;
+  p->m_next = head;
+  return iterator(tail);
+}
+
+template <class T, class Alloc>
+template <class Compare>
+typename forward_list<T, Alloc>::node_base *
+forward_list<T, Alloc>::merge_chains(node_base *a, node_base *b, Compare &comp) {
+  // stable merge: take from the left chain unless the right one is smaller
+  node_base result{nullptr};
+  node_base *out = &result;
+  while (a != nullptr && b != nullptr) {
+    if (comp(
+          static_cast<node_type *>(b)->m_value,
+          static_cast<node_type *>(a)->m_value
+        )) {
+      out->m_next = b;
+      b = b->m_next;
+    } else {
+      out->m_next = a;
+      a = a->m_next;
+    }
+    out = out->m_next;
+  }
+  out->m_next = a != nullptr ? a : b;
+  return result.m_next;
+}
+
+template <class T, class Alloc>
+template <class Compare>
+typename forward_list<T, Alloc>::node_base *
+forward_list<T, Alloc>::merge_sort(node_base *head, size_type n, Compare &comp) {
+  if (n == 1) {
+    head->m_next = nullptr;
+    return head;
+  }
+
+  size_type half = n / 2;
+  node_base *mid = head;
+  for (size_type i = 0; i < half; ++i) {
+    mid = mid->m_next;
+  }
+
+  node_base *a = merge_sort(head, half, comp);
+  node_base *b = merge_sort(mid, n - half, comp);
+  return merge_chains(a, b, comp);
+}
+
+} // namespace tinystl
@@ -0,0 +1,733 @@
+#pragma once
+
+// https://en.cppreference.com/w/cpp/container/inplace_vector.html
+
+#include <algorithm>
+#include <cassert>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+
+#include "tinystl/algorithm/compare.h"
+#include "tinystl/algorithm/remove.h"
+
+namespace tinystl {
+
+namespace detail {
+
+// Smallest unsigned type that can count to N, so an inplace_vector<char, 16>
+// is 17 bytes rather than 24.
+template <std::size_t N>
+using inplace_size_t = std::conditional_t<
+  (N <= std::numeric_limits<std::uint8_t>::max()), std::uint8_t,
+  std::conditional_t<
+    (N <= std::numeric_limits<std::uint16_t>::max()), std::uint16_t,
+    std::conditional_t<
+      (N <= std::numeric_limits<std::uint32_t>::max()), std::uint32_t,
+      std::size_t>>>;
+
+// Trivial element types live in a plain array that constant evaluation can
+// read and write directly. The slots are left uninitialized at run time and
+// zeroed at compile time, where every byte of a constexpr object must be set.
+template <class T, std::size_t N, bool = std::is_trivial_v<T>>
+struct inplace_storage {
+  constexpr inplace_storage() noexcept {
+    if (std::is_constant_evaluated()) {
+      for (std::size_t i = 0; i < N; ++i) {
+        m_data[i] = T();
+      }
+    }
+  }
+
+  constexpr T *data() noexcept { return m_data; }
+  constexpr const T *data() const noexcept { return m_data; }
+
+  T m_data[N];
+};
+
+// Any other type sits in a union so that slots past size() hold no object.
+// Copying the storage is only used, and only trivial, when T is trivially
+// copyable; inplace_vector copies element by element otherwise.
+template <class T, std::size_t N>
+struct inplace_storage<T, N, false> {
+  constexpr inplace_storage() noexcept {}
+  inplace_storage(const inplace_storage &) = default;
+  inplace_storage(inplace_storage &&) = default;
+  inplace_storage &operator=(const inplace_storage &) = default;
+  inplace_storage &operator=(inplace_storage &&) = default;
+  ~inplace_storage()
+    requires std::is_trivially_destructible_v<T>
+  = default;
+  constexpr ~inplace_storage() {}
+
+  constexpr T *data() noexcept { return m_data; }
+  constexpr const T *data() const noexcept { return m_data; }
+
+  union {
+    T m_data[N];
+  };
+};
+
+template <class T>
+struct inplace_empty_storage {
+  constexpr T *data() noexcept { return nullptr; }
+  constexpr const T *data() const noexcept { return nullptr; }
+};
+
+} // namespace detail
+
+// A vector with a fixed capacity N stored inline: it never touches the heap,
+// and running out of room throws std::bad_alloc like a failed allocation
+// would. try_push_back() reports a full container with nullptr instead, and
+// unchecked_push_back() leaves the check to the caller.
+//
+// Copy, move and destruction are trivial whenever they are trivial for T, so
+// an inplace_vector of trivially copyable elements is itself trivially
+// copyable and can be memcpy'd. For trivial T every member is constexpr.
+template <class T, std::size_t N>
+class inplace_vector {
+  using storage_type = std::conditional_t<
+    N == 0, detail::inplace_empty_storage<T>, detail::inplace_storage<T, N>>;
+
+public:
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  using pointer = value_type *;
+  using const_pointer = const value_type *;
+
+  using iterator = pointer;
+  using const_iterator = const_pointer;
+
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  // construct/copy/destroy
+  constexpr inplace_vector() noexcept = default;
+  constexpr explicit inplace_vector(size_type n);
+  constexpr inplace_vector(size_type n, const_reference val);
+  template <std::input_iterator InputIter>
+    requires std::constructible_from<T, std::iter_reference_t<InputIter>>
+  constexpr inplace_vector(InputIter first, InputIter last);
+  constexpr inplace_vector(std::initializer_list<value_type> init);
+
+  constexpr inplace_vector(const inplace_vector &)
+    requires std::is_trivially_copy_constructible_v<T>
+  = default;
+  constexpr inplace_vector(const inplace_vector &other);
+  constexpr inplace_vector(inplace_vector &&)
+    requires std::is_trivially_move_constructible_v<T>
+  = default;
+  constexpr inplace_vector(inplace_vector &&other) noexcept(
+    std::is_nothrow_move_constructible_v<T>
+  );
+
+  constexpr ~inplace_vector()
+    requires std::is_trivially_destructible_v<T>
+  = default;
+  constexpr ~inplace_vector();
+
+  constexpr inplace_vector &operator=(const inplace_vector &)
+    requires std::is_trivially_copy_constructible_v<T> &&
+             std::is_trivially_copy_assignable_v<T> &&
+             std::is_trivially_destructible_v<T>
+  = default;
+  constexpr inplace_vector &operator=(const inplace_vector &other);
+  constexpr inplace_vector &operator=(inplace_vector &&)
+    requires std::is_trivially_move_constructible_v<T> &&
+             std::is_trivially_move_assignable_v<T> &&
+             std::is_trivially_destructible_v<T>
+  = default;
+  constexpr inplace_vector &operator=(inplace_vector &&other) noexcept(
+    std::is_nothrow_move_assignable_v<T> &&
+    std::is_nothrow_move_constructible_v<T>
+  );
+  constexpr inplace_vector &operator=(std::initializer_list<value_type> init);
+
+  constexpr void assign(size_type n, const_reference val);
+  template <std::input_iterator InputIter>
+    requires std::constructible_from<T, std::iter_reference_t<InputIter>>
+  constexpr void assign(InputIter first, InputIter last);
+  constexpr void assign(std::initializer_list<value_type> init);
+
+  // element access
+  constexpr reference at(size_type pos);
+  constexpr const_reference at(size_type pos) const;
+  constexpr reference operator[](size_type pos);
+  constexpr const_reference operator[](size_type pos) const;
+  constexpr reference front();
+  constexpr const_reference front() const;
+  constexpr reference back();
+  constexpr const_reference back() const;
+  constexpr pointer data() noexcept { return m_storage.data(); }
+  constexpr const_pointer data() const noexcept { return m_storage.data(); }
+
+  // iterators
+  constexpr iterator begin() noexcept { return this->data(); }
+  constexpr const_iterator begin() const noexcept { return this->data(); }
+  constexpr const_iterator cbegin() const noexcept { return this->data(); }
+  constexpr iterator end() noexcept { return this->data() + m_size; }
+  constexpr const_iterator end() const noexcept { return this->data() + m_size; }
+  constexpr const_iterator cend() const noexcept { return this->end(); }
+  constexpr reverse_iterator rbegin() noexcept {
+    return reverse_iterator(this->end());
+  }
+  constexpr const_reverse_iterator rbegin() const noexcept {
+    return const_reverse_iterator(this->end());
+  }
+  constexpr const_reverse_iterator crbegin() const noexcept {
+    return this->rbegin();
+  }
+  constexpr reverse_iterator rend() noexcept {
+    return reverse_iterator(this->begin());
+  }
+  constexpr const_reverse_iterator rend() const noexcept {
+    return const_reverse_iterator(this->begin());
+  }
+  constexpr const_reverse_iterator crend() const noexcept {
+    return this->rend();
+  }
+
+  // capacity
+  constexpr bool empty() const noexcept { return m_size == 0; }
+  constexpr size_type size() const noexcept { return m_size; }
+  static constexpr size_type max_size() noexcept { return N; }
+  static constexpr size_type capacity() noexcept { return N; }
+  constexpr void resize(size_type n);
+  constexpr void resize(size_type n, const_reference val);
+  static constexpr void reserve(size_type n);
+  static constexpr void shrink_to_fit() noexcept {}
+
+  // modifiers
+  template <class... Args>
+  constexpr reference emplace_back(Args &&...args);
+  constexpr reference push_back(const_reference val);
+  constexpr reference push_back(value_type &&val);
+
+  template <class... Args>
+  constexpr pointer try_emplace_back(Args &&...args);
+  constexpr pointer try_push_back(const_reference val);
+  constexpr pointer try_push_back(value_type &&val);
+
+  template <class... Args>
+  constexpr reference unchecked_emplace_back(Args &&...args);
+  constexpr reference unchecked_push_back(const_reference val);
+  constexpr reference unchecked_push_back(value_type &&val);
+
+  template <class... Args>
+  constexpr iterator emplace(const_iterator pos, Args &&...args);
+  constexpr iterator insert(const_iterator pos, const_reference val);
+  constexpr iterator insert(const_iterator pos, value_type &&val);
+  constexpr iterator insert(const_iterator pos, size_type n, const_reference val);
+  template <std::input_iterator InputIter>
+    requires std::constructible_from<T, std::iter_reference_t<InputIter>>
+  constexpr iterator insert(const_iterator pos, InputIter first, InputIter last);
+  constexpr iterator insert(const_iterator pos, std::initializer_list<T> init);
+
+  constexpr void pop_back();
+  constexpr void clear() noexcept;
+  constexpr iterator erase(const_iterator pos);
+  constexpr iterator erase(const_iterator first, const_iterator last);
+  constexpr void swap(inplace_vector &other) noexcept(
+    std::is_nothrow_swappable_v<T> && std::is_nothrow_move_constructible_v<T>
+  );
+
+private:
+  [[noreturn]] static void throw_bad_alloc();
+  [[noreturn]] static void throw_out_of_range();
+
+  constexpr void destruct(pointer new_last) noexcept;
+
+  // Inserting appends at end() and then rotates the elements past old_size
+  // into place at pos, so no slot is ever constructed twice.
+  constexpr iterator rotate_into(const_iterator pos, size_type old_size);
+
+private:
+  storage_type m_storage;
+  detail::inplace_size_t<N> m_size = 0;
+};
+
+template <class T, std::size_t N>
+constexpr bool
+operator==(const inplace_vector<T, N> &lhs, const inplace_vector<T, N> &rhs) {
+  return tinystl::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <class T, std::size_t N>
+constexpr auto
+operator<=>(const inplace_vector<T, N> &lhs, const inplace_vector<T, N> &rhs) {
+  return tinystl::lexicographical_compare_three_way(
+    lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), std::compare_three_way()
+  );
+}
+
+template <class T, std::size_t N>
+constexpr void swap(inplace_vector<T, N> &lhs, inplace_vector<T, N> &rhs) noexcept(
+  noexcept(lhs.swap(rhs))
+) {
+  lhs.swap(rhs);
+}
+
+template <class T, std::size_t N, class U>
+constexpr typename inplace_vector<T, N>::size_type
+erase(inplace_vector<T, N> &c, const U &val) {
+  typename inplace_vector<T, N>::size_type old_sz = c.size();
+  c.erase(tinystl::remove(c.begin(), c.end(), val), c.end());
+  return old_sz - c.size();
+}
+
+template <class T, std::size_t N, class Pred>
+constexpr typename inplace_vector<T, N>::size_type
+erase_if(inplace_vector<T, N> &c, Pred pred) {
+  typename inplace_vector<T, N>::size_type old_sz = c.size();
+  c.erase(tinystl::remove_if(c.begin(), c.end(), pred), c.end());
+  return old_sz - c.size();
+}
+
+/* -------------------------------------------------------------------------- */
+/*                           public member functions                          */
+/* -------------------------------------------------------------------------- */
+
+/* -------------------------------- construct ------------------------------- */
+template <class T, std::size_t N>
+constexpr inplace_vector<T, N>::inplace_vector(size_type n) {
+  this->resize(n);
+}
+
+template <class T, std::size_t N>
+constexpr inplace_vector<T, N>::inplace_vector(size_type n, const_reference val) {
+  this->resize(n, val);
+}
+
+template <class T, std::size_t N>
+template <std::input_iterator InputIter>
+  requires std::constructible_from<T, std::iter_reference_t<InputIter>>
+constexpr inplace_vector<T, N>::inplace_vector(InputIter first, InputIter last) {
+  for (; first != last; ++first) {
+    this->emplace_back(*first);
+  }
+}
+
+template <class T, std::size_t N>
+constexpr inplace_vector<T, N>::inplace_vector(
+  std::initializer_list<value_type> init
+)
+  : inplace_vector(init.begin(), init.end()) {}
+
+template <class T, std::size_t N>
+constexpr inplace_vector<T, N>::inplace_vector(const inplace_vector &other) {
+  std::uninitialized_copy(other.begin(), other.end(), this->data());
+  m_size = other.m_size;
+}
+
+template <class T, std::size_t N>
+constexpr inplace_vector<T, N>::inplace_vector(inplace_vector &&other) noexcept(
+  std::is_nothrow_move_constructible_v<T>
+) {
+  std::uninitialized_move(other.begin(), other.end(), this->data());
+  m_size = other.m_size;
+}
+
+template <class T, std::size_t N>
+constexpr inplace_vector<T, N>::~inplace_vector() {
+  this->destruct(this->begin());
+}
+
+template <class T, std::size_t N>
+constexpr inplace_vector<T, N> &
+inplace_vector<T, N>::operator=(const inplace_vector &other) {
+  if (this != std::addressof(other)) {
+    this->assign(other.begin(), other.end());
+  }
+  return *this;
+}
+
+template <class T, std::size_t N>
+constexpr inplace_vector<T, N> &
+inplace_vector<T, N>::operator=(inplace_vector &&other) noexcept(
+  std::is_nothrow_move_assignable_v<T> &&
+  std::is_nothrow_move_constructible_v<T>
+) {
+  if (this != std::addressof(other)) {
+    this->assign(
+      std::make_move_iterator(other.begin()),
+      std::make_move_iterator(other.end())
+    );
+  }
+  return *this;
+}
+
+template <class T, std::size_t N>
+constexpr inplace_vector<T, N> &
+inplace_vector<T, N>::operator=(std::initializer_list<value_type> init) {
+  this->assign(init.begin(), init.end());
+  return *this;
+}
+
+/* --------------------------------- assign --------------------------------- */
+template <class T, std::size_t N>
+constexpr void inplace_vector<T, N>::assign(size_type n, const_reference val) {
+  if (n > N) {
+    throw_bad_alloc();
+  }
+
+  size_type common = std::min<size_type>(n, m_size);
+  std::fill_n(this->begin(), common, val);
+  if (n > m_size) {
+    this->resize(n, val);
+  } else {
+    this->destruct(this->begin() + n);
+  }
+}
+
+template <class T, std::size_t N>
+template <std::input_iterator InputIter>
+  requires std::constructible_from<T, std::iter_reference_t<InputIter>>
+constexpr void inplace_vector<T, N>::assign(InputIter first, InputIter last) {
+  if constexpr (std::forward_iterator<InputIter>) {
+    if (static_cast<size_type>(std::distance(first, last)) > N) {
+      throw_bad_alloc();
+    }
+  }
+
+  pointer p = this->begin();
+  for (; first != last && p != this->end(); ++first, ++p) {
+    *p = *first;
+  }
+  this->destruct(p);
+  for (; first != last; ++first) {
+    this->emplace_back(*first);
+  }
+}
+
+template <class T, std::size_t N>
+constexpr void
+inplace_vector<T, N>::assign(std::initializer_list<value_type> init) {
+  this->assign(init.begin(), init.end());
+}
+
+/* ----------------------------- element access ----------------------------- */
+template <class T, std::size_t N>
+constexpr typename inplace_vector<T, N>::reference
+inplace_vector<T, N>::at(size_type pos) {
+  if (pos >= this->size()) {
+    throw_out_of_range();
+  }
+  return this->data()[pos];
+}
+
+template <class T, std::size_t N>
+constexpr typename inplace_vector<T, N>::const_reference
+inplace_vector<T, N>::at(size_type pos) const {
+  if (pos >= this->size()) {
+    throw_out_of_range();
+  }
+  return this->data()[pos];
+}
+
+template <class T, std::size_t N>
+constexpr typename inplace_vector<T, N>::reference
+inplace_vector<T, N>::operator[](size_type pos) {
+  assert(pos < this->size() && "inplace_vector[] index out of bounds");
+  return this->data()[pos];
+}
+
+template <class T, std::size_t N>
+constexpr typename inplace_vector<T, N>::const_reference
+inplace_vector<T, N>::operator[](size_type pos) const {
+  assert(pos < this->size() && "inplace_vector[] index out of bounds");
+  return this->data()[pos];
+}
+
+template <class T, std::size_t N>
+constexpr typename inplace_vector<T, N>::reference inplace_vector<T, N>::front() {
+  assert(!this->empty() && "front() called on an empty inplace_vector");
+  return this->data()[0];
+}
+
+template <class T, std::size_t N>
+constexpr typename inplace_vector<T, N>::const_reference
+inplace_vector<T, N>::front() const {
+  assert(!this->empty() && "front() called on an empty inplace_vector");
+  return this->data()[0];
+}
+
+template <class T, std::size_t N>
+constexpr typename inplace_vector<T, N>::reference inplace_vector<T, N>::back() {
+  assert(!this->empty() && "back() called on an empty inplace_vector");
+  return this->data()[m_size - 1];
+}
+
+template <class T, std::size_t N>
+constexpr typename inplace_vector<T, N>::const_reference
+inplace_vector<T, N>::back() const {
+  assert(!this->empty() && "back() called on an empty inplace_vector");
+  return this->data()[m_size - 1];
+}
+
+/* -------------------------------- capacity -------------------------------- */
+template <class T, std::size_t N>
+constexpr void inplace_vector<T, N>::resize(size_type n) {
+  if (n > N) {
+    throw_bad_alloc();
+  }
+
+  if (n < m_size) {
+    this->destruct(this->begin() + n);
+  } else {
+    while (m_size < n) {
+      this->unchecked_emplace_back();
+    }
+  }
+}
+
+template <class T, std::size_t N>
+constexpr void inplace_vector<T, N>::resize(size_type n, const_reference val) {
+  if (n > N) {
+    throw_bad_alloc();
+  }
+
+  if (n < m_size) {
+    this->destruct(this->begin() + n);
+  } else {
+    while (m_size < n) {
+      this->unchecked_emplace_back(val);
+    }
+  }
+}
+
+template <class T, std::size_t N>
+constexpr void inplace_vector<T, N>::reserve(size_type n) {
+  if (n > N) {
+    throw_bad_alloc();
+  }
+}
+
+/* -------------------------------- modifiers ------------------------------- */
+template <class T, std::size_t N>
+template <class... Args>
+constexpr typename inplace_vector<T, N>::reference
+inplace_vector<T, N>::emplace_back(Args &&...args) {
+  if (m_size == N) {
+    throw_bad_alloc();
+  }
+  return this->unchecked_emplace_back(std::forward<Args>(args)...);
+}
+
+template <class T, std::size_t N>
+constexpr typename inplace_vector<T, N>::reference
+inplace_vector<T, N>::push_back(const_reference val) {
+  return this->emplace_back(val);
+}
+
+template <class T, std::size_t N>
+constexpr typename inplace_vector<T, N>::reference
+inplace_vector<T, N>::push_back(value_type &&val) {
+  return this->emplace_back(std::move(val));
+}
+
+template <class T, std::size_t N>
+template <class... Args>
+constexpr typename inplace_vector<T, N>::pointer
+inplace_vector<T, N>::try_emplace_back(Args &&...args) {
+  if (m_size == N) {
+    return nullptr;
+  }
+  return std::addressof(this->unchecked_emplace_back(std::forward<Args>(args)...)
+  );
+}
+
+template <class T, std::size_t N>
+constexpr typename inplace_vector<T, N>::pointer
+inplace_vector<T, N>::try_push_back(const_reference val) {
+  return this->try_emplace_back(val);
+}
+
+template <class T, std::size_t N>
+constexpr typename inplace_vector<T, N>::pointer
+inplace_vector<T, N>::try_push_back(value_type &&val) {
+  return this->try_emplace_back(std::move(val));
+}
+
+template <class T, std::size_t N>
+template <class... Args>
+constexpr typename inplace_vector<T, N>::reference
+inplace_vector<T, N>::unchecked_emplace_back(Args &&...args) {
+  assert(m_size < N && "unchecked_emplace_back() called on a full inplace_vector");
+  pointer p = std::construct_at(this->end(), std::forward<Args>(args)...);
+  ++m_size;
+  return *p;
+}
+
+template <class T, std::size_t N>
+constexpr typename inplace_vector<T, N>::reference
+inplace_vector<T, N>::unchecked_push_back(const_reference val) {
+  return this->unchecked_emplace_back(val);
+}
+
+template <class T, std::size_t N>
+constexpr typename inplace_vector<T, N>::reference
+inplace_vector<T, N>::unchecked_push_back(value_type &&val) {
+  return this->unchecked_emplace_back(std::move(val));
+}
+
+template <class T, std::size_t N>
+template <class... Args>
+constexpr typename inplace_vector<T, N>::iterator
+inplace_vector<T, N>::emplace(const_iterator pos, Args &&...args) {
+  size_type old_size = m_size;
+  this->emplace_back(std::forward<Args>(args)...);
+  return this->rotate_into(pos, old_size);
+}
+
+template <class T, std::size_t N>
+constexpr typename inplace_vector<T, N>::iterator
+inplace_vector<T, N>::insert(const_iterator pos, const_reference val) {
+  return this->emplace(pos, val);
+}
+
+template <class T, std::size_t N>
+constexpr typename inplace_vector<T, N>::iterator
+inplace_vector<T, N>::insert(const_iterator pos, value_type &&val) {
+  return this->emplace(pos, std::move(val));
+}
+
+template <class T, std::size_t N>
+constexpr typename inplace_vector<T, N>::iterator
+inplace_vector<T, N>::insert(const_iterator pos, size_type n, const_reference val) {
+  if (n > N - m_size) {
+    throw_bad_alloc();
+  }
+
+  size_type old_size = m_size;
+  try {
+    for (size_type i = 0; i < n; ++i) {
+      this->unchecked_emplace_back(val);
+    }
+  } catch (...) {
+    this->destruct(this->begin() + old_size);
+    throw;
+  }
+  return this->rotate_into(pos, old_size);
+}
+
+template <class T, std::size_t N>
+template <std::input_iterator InputIter>
+  requires std::constructible_from<T, std::iter_reference_t<InputIter>>
+constexpr typename inplace_vector<T, N>::iterator inplace_vector<T, N>::insert(
+  const_iterator pos, InputIter first, InputIter last
+) {
+  if constexpr (std::forward_iterator<InputIter>) {
+    if (static_cast<size_type>(std::distance(first, last)) > N - m_size) {
+      throw_bad_alloc();
+    }
+  }
+
+  size_type old_size = m_size;
+  try {
+    for (; first != last; ++first) {
+      this->emplace_back(*first);
+    }
+  } catch (...) {
+    this->destruct(this->begin() + old_size);
+    throw;
+  }
+  return this->rotate_into(pos, old_size);
+}
+
+template <class T, std::size_t N>
+constexpr typename inplace_vector<T, N>::iterator
+inplace_vector<T, N>::insert(const_iterator pos, std::initializer_list<T> init) {
+  return this->insert(pos, init.begin(), init.end());
+}
+
+template <class T, std::size_t N>
+constexpr void inplace_vector<T, N>::pop_back() {
+  assert(!this->empty() && "inplace_vector::pop_back called on an empty inplace_vector");
+  this->destruct(this->end() - 1);
+}
+
+template <class T, std::size_t N>
+constexpr void inplace_vector<T, N>::clear() noexcept {
+  this->destruct(this->begin());
+}
+
+template <class T, std::size_t N>
+constexpr typename inplace_vector<T, N>::iterator
+inplace_vector<T, N>::erase(const_iterator pos) {
+  assert(pos != this->end() && "inplace_vector::erase(iterator) called with a non-dereferenceable iterator");
+  return this->erase(pos, pos + 1);
+}
+
+template <class T, std::size_t N>
+constexpr typename inplace_vector<T, N>::iterator
+inplace_vector<T, N>::erase(const_iterator first, const_iterator last) {
+  assert(first <= last && "inplace_vector::erase(first, last) called with invalid range");
+
+  pointer p = this->begin() + (first - this->cbegin());
+  if (first != last) {
+    this->destruct(std::move(p + (last - first), this->end(), p));
+  }
+  return p;
+}
+
+template <class T, std::size_t N>
+constexpr void inplace_vector<T, N>::swap(inplace_vector &other) noexcept(
+  std::is_nothrow_swappable_v<T> && std::is_nothrow_move_constructible_v<T>
+) {
+  inplace_vector *shorter = this;
+  inplace_vector *longer = std::addressof(other);
+  if (shorter->m_size > longer->m_size) {
+    std::swap(shorter, longer);
+  }
+
+  pointer mid = std::swap_ranges(shorter->begin(), shorter->end(), longer->begin());
+  size_type common = shorter->m_size;
+  for (pointer p = mid; p != longer->end(); ++p) {
+    shorter->unchecked_emplace_back(std::move(*p));
+  }
+  longer->destruct(longer->begin() + common);
+}
+
+/* -------------------------------------------------------------------------- */
+/*                          private member functions                          */
+/* -------------------------------------------------------------------------- */
+template <class T, std::size_t N>
+void inplace_vector<T, N>::throw_bad_alloc() {
+  throw std::bad_alloc();
+}
+
+template <class T, std::size_t N>
+void inplace_vector<T, N>::throw_out_of_range() {
+  throw std::out_of_range("inplace_vector");
+}
+
+template <class T, std::size_t N>
+constexpr void inplace_vector<T, N>::destruct(pointer new_last) noexcept {
+  if constexpr (!std::is_trivially_destructible_v<T>) {
+    std::destroy(new_last, this->end());
+  }
+  m_size = static_cast<detail::inplace_size_t<N>>(new_last - this->begin());
+}
+
+template <class T, std::size_t N>
+constexpr typename inplace_vector<T, N>::iterator
+inplace_vector<T, N>::rotate_into(const_iterator pos, size_type old_size) {
+  pointer p = this->begin() + (pos - this->cbegin());
+  std::rotate(p, this->begin() + old_size, this->end());
+  return p;
+}
+
+} // namespace tinystl
@@ -0,0 +1,332 @@
+#pragma once
+
+// Opt-in memory introspection for the growable containers. Built with
+// TINYSTL_ENABLE_INTROSPECTION, every vector, split_buffer and deque links
+// itself into a process-wide registry and counts its reallocations, the
+// bytes those moved and its peak capacity; the summaries and dump() show
+// how much of what the live containers allocated is slack. Without the
+// macro the hook is an empty base class and every notification an empty
+// inline function, so the containers are unchanged.
+//
+// The registry reads size() and capacity() of the live containers, so take
+// a summary while they are not being modified on other threads.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(TINYSTL_ENABLE_INTROSPECTION)
+#include <mutex>
+#include <typeinfo>
+#if defined(__GNUG__)
+#include <cstdlib>
+#include <cxxabi.h>
+#include <memory>
+#endif
+#endif
+
+namespace tinystl::introspection {
+
+inline constexpr bool enabled =
+#if defined(TINYSTL_ENABLE_INTROSPECTION)
+  true;
+#else
+  false;
+#endif
+
+// One live container, or the sum over a group of them. Sizes are in
+// elements except where the name says bytes; peak_capacity is the largest
+// capacity any container in the group ever had.
+struct container_stats {
+  std::string type;
+  std::string tag;
+  std::size_t containers = 0;
+  std::size_t size = 0;
+  std::size_t capacity = 0;
+  std::size_t allocated_bytes = 0;
+  std::size_t slack_bytes = 0;
+  std::size_t reallocations = 0;
+  std::size_t bytes_moved = 0;
+  std::size_t peak_capacity = 0;
+};
+
+namespace detail {
+
+#if defined(TINYSTL_ENABLE_INTROSPECTION)
+struct node;
+
+struct type_record {
+  std::string name;
+  std::size_t element_size;
+  void (*read)(const node &, std::size_t &size, std::size_t &capacity);
+};
+
+struct links {
+  links *prev = nullptr;
+  links *next = nullptr;
+};
+
+// The registration of one container; it links itself into the registry for
+// as long as it lives. Statistics describe one object, so a copy starts
+// its own.
+struct node : links {
+  explicit node(const type_record *t);
+  node(const node &other) : node(other.type) {}
+  node &operator=(const node &) noexcept { return *this; }
+  ~node();
+
+  const type_record *type;
+  const char *tag = nullptr;
+  std::size_t reallocations = 0;
+  std::size_t bytes_moved = 0;
+  std::size_t peak_capacity = 0;
+};
+
+// A circular intrusive list of the live containers. It is never destroyed,
+// so containers with static storage duration can still unlink themselves
+// during exit.
+class registry {
+public:
+  static registry &instance() {
+    static registry *r = new registry;
+    return *r;
+  }
+
+  void link(node &n) {
+    std::lock_guard lock(m_mutex);
+    n.prev = &m_head;
+    n.next = m_head.next;
+    m_head.next->prev = &n;
+    m_head.next = &n;
+  }
+
+  void unlink(node &n) {
+    std::lock_guard lock(m_mutex);
+    n.prev->next = n.next;
+    n.next->prev = n.prev;
+  }
+
+  std::vector<container_stats> snapshot() {
+    std::vector<container_stats> result;
+    std::lock_guard lock(m_mutex);
+    for (links *l = m_head.next; l != &m_head; l = l->next) {
+      const node *n = static_cast<const node *>(l);
+      container_stats s;
+      s.type = n->type->name;
+      s.tag = n->tag != nullptr ? n->tag : "";
+      s.containers = 1;
+      n->type->read(*n, s.size, s.capacity);
+      s.allocated_bytes = s.capacity * n->type->element_size;
+      s.slack_bytes = (s.capacity - s.size) * n->type->element_size;
+      s.reallocations = n->reallocations;
+      s.bytes_moved = n->bytes_moved;
+      s.peak_capacity = std::max(n->peak_capacity, s.capacity);
+      result.push_back(std::move(s));
+    }
+    return result;
+  }
+
+private:
+  registry() { m_head.prev = m_head.next = &m_head; }
+
+  std::mutex m_mutex;
+  links m_head;
+};
+
+inline node::node(const type_record *t) : type(t) {
+  registry::instance().link(*this);
+}
+
+inline node::~node() { registry::instance().unlink(*this); }
+
+template <class T>
+std::string type_name() {
+  const char *name = typeid(T).name();
+#if defined(__GNUG__)
+  int status = 0;
+  std::unique_ptr<char, void (*)(void *)> demangled(
+    abi::__cxa_demangle(name, nullptr, nullptr, &status), std::free
+  );
+  if (status == 0) {
+    return demangled.get();
+  }
+#endif
+  return name;
+}
+#endif
+
+} // namespace detail
+
+// The public base through which a container is registered; Container
+// provides size(), and capacity() where it has one. With Track false, or
+// introspection disabled, the base is empty.
+template <class Container, bool Track = true>
+class tracked {
+protected:
+  void note_allocation(std::size_t) noexcept {}
+  void note_reallocation(std::size_t, std::size_t, std::size_t) noexcept {}
+
+private:
+  template <class C, bool B>
+  friend void set_tag(tracked<C, B> &, const char *) noexcept;
+  void set_tag(const char *) noexcept {}
+};
+
+#if defined(TINYSTL_ENABLE_INTROSPECTION)
+template <class Container>
+class tracked<Container, true> : private detail::node {
+protected:
+  tracked() : detail::node(&record()) {}
+
+  // Storage for new_capacity elements obtained without moving any.
+  void note_allocation(std::size_t new_capacity) noexcept {
+    this->peak_capacity = std::max(this->peak_capacity, new_capacity);
+  }
+
+  // Storage of old_capacity elements replaced by a buffer of new_capacity,
+  // moving bytes_moved bytes of elements into it. Replacing no storage is
+  // just an allocation.
+  void note_reallocation(
+    std::size_t old_capacity, std::size_t new_capacity,
+    std::size_t bytes_moved
+  ) noexcept {
+    if (old_capacity != 0) {
+      ++this->reallocations;
+      this->bytes_moved += bytes_moved;
+    }
+    this->note_allocation(new_capacity);
+  }
+
+private:
+  template <class C, bool B>
+  friend void set_tag(tracked<C, B> &, const char *) noexcept;
+  void set_tag(const char *tag) noexcept { this->tag = tag; }
+
+  static const detail::type_record &record() {
+    static const detail::type_record r{
+      detail::type_name<Container>(), sizeof(typename Container::value_type),
+      &tracked::read
+    };
+    return r;
+  }
+
+  static void read(const detail::node &n, std::size_t &size, std::size_t &cap) {
+    const Container &c =
+      static_cast<const Container &>(static_cast<const tracked &>(n));
+    size = c.size();
+    if constexpr (requires { c.capacity(); }) {
+      cap = c.capacity();
+    } else {
+      cap = size;
+    }
+  }
+};
+#endif
+
+// Labels a container in the summaries, e.g. with the subsystem that owns it.
+// The string is not copied and must outlive the container.
+template <class Container, bool Track>
+void set_tag(tracked<Container, Track> &c, const char *tag) noexcept {
+  c.set_tag(tag);
+}
+
+// One entry per live container, newest first.
+inline std::vector<container_stats> snapshot() {
+#if defined(TINYSTL_ENABLE_INTROSPECTION)
+  return detail::registry::instance().snapshot();
+#else
+  return {};
+#endif
+}
+
+namespace detail {
+
+template <class Key>
+std::vector<container_stats> group(Key key) {
+  std::map<std::string, container_stats> groups;
+  for (container_stats &s : introspection::snapshot()) {
+    container_stats &g = groups[key(s)];
+    g.containers += s.containers;
+    g.size += s.size;
+    g.capacity += s.capacity;
+    g.allocated_bytes += s.allocated_bytes;
+    g.slack_bytes += s.slack_bytes;
+    g.reallocations += s.reallocations;
+    g.bytes_moved += s.bytes_moved;
+    g.peak_capacity = std::max(g.peak_capacity, s.peak_capacity);
+    if (g.containers == s.containers) {
+      g.type = std::move(s.type);
+      g.tag = std::move(s.tag);
+    } else {
+      if (g.type != s.type) {
+        g.type.clear();
+      }
+      if (g.tag != s.tag) {
+        g.tag.clear();
+      }
+    }
+  }
+
+  std::vector<container_stats> result;
+  for (auto &entry : groups) {
+    result.push_back(std::move(entry.second));
+  }
+  std::sort(result.begin(), result.end(), [](const auto &a, const auto &b) {
+    return a.slack_bytes > b.slack_bytes;
+  });
+  return result;
+}
+
+inline void print(
+  std::FILE *out, const char *title, const std::vector<container_stats> &rows,
+  std::string container_stats::*label
+) {
+  std::fprintf(
+    out, "%s\n%8s %12s %12s %14s %14s %8s %14s %12s  %s\n", title, "count",
+    "size", "capacity", "bytes", "slack bytes", "reallocs", "bytes moved",
+    "peak cap", "name"
+  );
+  for (const container_stats &s : rows) {
+    std::fprintf(
+      out, "%8zu %12zu %12zu %14zu %14zu %8zu %14zu %12zu  %s\n", s.containers,
+      s.size, s.capacity, s.allocated_bytes, s.slack_bytes, s.reallocations,
+      s.bytes_moved, s.peak_capacity,
+      (s.*label).empty() ? "(untagged)" : (s.*label).c_str()
+    );
+  }
+}
+
+} // namespace detail
+
+// Live containers grouped by their type or by their tag, most slack first.
+inline std::vector<container_stats> summary_by_type() {
+  return detail::group([](const container_stats &s) { return s.type; });
+}
+
+inline std::vector<container_stats> summary_by_tag() {
+  return detail::group([](const container_stats &s) { return s.tag; });
+}
+
+inline void dump(std::FILE *out = stderr) {
+  if constexpr (!enabled) {
+    std::fprintf(
+      out, "tinystl introspection is disabled "
+           "(build with TINYSTL_ENABLE_INTROSPECTION)\n"
+    );
+  } else {
+    detail::print(
+      out, "tinystl containers by type", summary_by_type(),
+      &container_stats::type
+    );
+    detail::print(
+      out, "tinystl containers by tag", summary_by_tag(),
+      &container_stats::tag
+    );
+  }
+}
+
+} // namespace tinystl::introspection
@@ -0,0 +1,395 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+namespace tinystl {
+
+// Link field embedded in the elements of an intrusive_list. An object can be
+// in several lists at once by deriving from one hook per list, told apart by
+// the Tag parameter:
+//
+//   struct lru_tag {};
+//   struct bucket_tag {};
+//   struct entry : intrusive_list_hook<lru_tag>,
+//                  intrusive_list_hook<bucket_tag> { ... };
+//
+// Copying an element does not copy its links.
+template <class Tag = void>
+class intrusive_list_hook {
+public:
+  intrusive_list_hook() noexcept = default;
+  intrusive_list_hook(const intrusive_list_hook &) noexcept {}
+  intrusive_list_hook &operator=(const intrusive_list_hook &) noexcept {
+    return *this;
+  }
+
+  ~intrusive_list_hook() {
+    assert(!this->is_linked() && "destroying an element still in an intrusive_list");
+  }
+
+  bool is_linked() const noexcept { return m_next != nullptr; }
+
+private:
+  template <class, class>
+  friend class intrusive_list;
+
+  template <class, class, class>
+  friend class intrusive_list_iterator;
+
+  intrusive_list_hook *m_prev = nullptr;
+  intrusive_list_hook *m_next = nullptr;
+};
+
+template <class T, class Tag, class Reference>
+class intrusive_list_iterator {
+  using hook = intrusive_list_hook<Tag>;
+
+public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = std::remove_const_t<T>;
+  using difference_type = std::ptrdiff_t;
+  using reference = Reference;
+  using pointer = std::add_pointer_t<Reference>;
+
+  intrusive_list_iterator() = default;
+  template <class U, class R>
+    requires std::is_convertible_v<U *, T *>
+  intrusive_list_iterator(const intrusive_list_iterator<U, Tag, R> &it) noexcept
+    : m_node(it.m_node) {}
+
+  reference operator*() const { return static_cast<reference>(*m_node); }
+  pointer operator->() const { return std::addressof(**this); }
+
+  intrusive_list_iterator &operator++() {
+    m_node = m_node->m_next;
+    return *this;
+  }
+
+  intrusive_list_iterator operator++(int) {
+    intrusive_list_iterator tmp = *this;
+    m_node = m_node->m_next;
+    return tmp;
+  }
+
+  intrusive_list_iterator &operator--() {
+    m_node = m_node->m_prev;
+    return *this;
+  }
+
+  intrusive_list_iterator operator--(int) {
+    intrusive_list_iterator tmp = *this;
+    m_node = m_node->m_prev;
+    return tmp;
+  }
+
+  friend bool operator==(
+    const intrusive_list_iterator &x, const intrusive_list_iterator &y
+  ) {
+    return x.m_node == y.m_node;
+  }
+
+private:
+  explicit intrusive_list_iterator(hook *n) noexcept : m_node(n) {}
+
+  template <class, class>
+  friend class intrusive_list;
+
+  template <class, class, class>
+  friend class intrusive_list_iterator;
+
+private:
+  hook *m_node = nullptr;
+};
+
+// A doubly-linked list that threads elements it does not own. Inserting and
+// erasing never allocate, iterator_to() turns an element back into an
+// iterator in O(1), and splice() moves elements between lists in O(1). The
+// caller keeps every element alive while it is linked.
+template <class T, class Tag = void>
+class intrusive_list {
+  using hook = intrusive_list_hook<Tag>;
+
+  static_assert(
+    std::is_base_of_v<hook, T>,
+    "intrusive_list<T, Tag> requires T to derive from intrusive_list_hook<Tag>"
+  );
+
+public:
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  using pointer = value_type *;
+  using const_pointer = const value_type *;
+
+  using iterator = intrusive_list_iterator<T, Tag, T &>;
+  using const_iterator = intrusive_list_iterator<const T, Tag, const T &>;
+
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  intrusive_list() noexcept { this->reset(); }
+  intrusive_list(const intrusive_list &) = delete;
+  intrusive_list(intrusive_list &&other) noexcept;
+
+  ~intrusive_list() {
+    this->clear();
+    m_end.m_prev = m_end.m_next = nullptr;
+  }
+
+  intrusive_list &operator=(const intrusive_list &) = delete;
+  intrusive_list &operator=(intrusive_list &&other) noexcept;
+
+  // element access
+  reference front() {
+    assert(!this->empty() && "front() called on an empty intrusive_list");
+    return static_cast<reference>(*m_end.m_next);
+  }
+  const_reference front() const {
+    assert(!this->empty() && "front() called on an empty intrusive_list");
+    return static_cast<const_reference>(*m_end.m_next);
+  }
+  reference back() {
+    assert(!this->empty() && "back() called on an empty intrusive_list");
+    return static_cast<reference>(*m_end.m_prev);
+  }
+  const_reference back() const {
+    assert(!this->empty() && "back() called on an empty intrusive_list");
+    return static_cast<const_reference>(*m_end.m_prev);
+  }
+
+  // iterators
+  iterator begin() noexcept { return iterator(m_end.m_next); }
+  const_iterator begin() const noexcept { return const_iterator(m_end.m_next); }
+  const_iterator cbegin() const noexcept { return this->begin(); }
+  iterator end() noexcept { return iterator(&m_end); }
+  const_iterator end() const noexcept {
+    return const_iterator(const_cast<hook *>(&m_end));
+  }
+  const_iterator cend() const noexcept { return this->end(); }
+  reverse_iterator rbegin() noexcept { return reverse_iterator(this->end()); }
+  const_reverse_iterator rbegin() const noexcept {
+    return const_reverse_iterator(this->end());
+  }
+  reverse_iterator rend() noexcept { return reverse_iterator(this->begin()); }
+  const_reverse_iterator rend() const noexcept {
+    return const_reverse_iterator(this->begin());
+  }
+
+  iterator iterator_to(reference elem) noexcept {
+    assert(static_cast<hook &>(elem).is_linked() && "iterator_to on an unlinked element");
+    return iterator(std::addressof(static_cast<hook &>(elem)));
+  }
+  const_iterator iterator_to(const_reference elem) const noexcept {
+    assert(static_cast<const hook &>(elem).is_linked() && "iterator_to on an unlinked element");
+    return const_iterator(
+      const_cast<hook *>(std::addressof(static_cast<const hook &>(elem)))
+    );
+  }
+
+  // capacity
+  bool empty() const noexcept { return m_size == 0; }
+  size_type size() const noexcept { return m_size; }
+
+  // modifiers
+  void clear() noexcept;
+  iterator insert(const_iterator pos, reference elem) noexcept;
+  iterator erase(const_iterator pos) noexcept;
+  iterator erase(const_iterator first, const_iterator last) noexcept;
+  void push_back(reference elem) noexcept { this->insert(this->cend(), elem); }
+  void pop_back() noexcept {
+    assert(!this->empty() && "pop_back() called on an empty intrusive_list");
+    this->erase(const_iterator(m_end.m_prev));
+  }
+  void push_front(reference elem) noexcept {
+    this->insert(this->cbegin(), elem);
+  }
+  void pop_front() noexcept {
+    assert(!this->empty() && "pop_front() called on an empty intrusive_list");
+    this->erase(this->cbegin());
+  }
+  void swap(intrusive_list &other) noexcept;
+
+  // operations
+  void splice(const_iterator pos, intrusive_list &other) noexcept;
+  void splice(const_iterator pos, intrusive_list &other, const_iterator it) noexcept;
+  void splice(
+    const_iterator pos, intrusive_list &other, const_iterator first,
+    const_iterator last
+  ) noexcept;
+
+private:
+  void reset() noexcept {
+    m_end.m_prev = m_end.m_next = &m_end;
+    m_size = 0;
+  }
+
+  void steal(intrusive_list &other) noexcept;
+
+  static void unlink(hook *first, hook *last) noexcept {
+    first->m_prev->m_next = last;
+    last->m_prev = first->m_prev;
+  }
+
+  static void link_before(hook *pos, hook *first, hook *last) noexcept {
+    hook *prev = pos->m_prev;
+    prev->m_next = first;
+    first->m_prev = prev;
+    pos->m_prev = last;
+    last->m_next = pos;
+  }
+
+private:
+  hook m_end;
+  size_type m_size = 0;
+};
+
+template <class T, class Tag>
+void swap(intrusive_list<T, Tag> &lhs, intrusive_list<T, Tag> &rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+/* -------------------------------------------------------------------------- */
+/*                           public member functions                          */
+/* -------------------------------------------------------------------------- */
+template <class T, class Tag>
+intrusive_list<T, Tag>::intrusive_list(intrusive_list &&other) noexcept {
+  this->steal(other);
+}
+
+template <class T, class Tag>
+intrusive_list<T, Tag> &
+intrusive_list<T, Tag>::operator=(intrusive_list &&other) noexcept {
+  if (this != std::addressof(other)) {
+    this->clear();
+    this->steal(other);
+  }
+  return *this;
+}
+
+template <class T, class Tag>
+void intrusive_list<T, Tag>::clear() noexcept {
+  hook *n = m_end.m_next;
+  while (n != &m_end) {
+    hook *next = n->m_next;
+    n->m_prev = n->m_next = nullptr;
+    n = next;
+  }
+  this->reset();
+}
+
+template <class T, class Tag>
+typename intrusive_list<T, Tag>::iterator
+intrusive_list<T, Tag>::insert(const_iterator pos, reference elem) noexcept {
+  hook *n = std::addressof(static_cast<hook &>(elem));
+  assert(!n->is_linked() && "inserting an element that is already linked");
+
+  link_before(pos.m_node, n, n);
+  ++m_size;
+  return iterator(n);
+}
+
+template <class T, class Tag>
+typename intrusive_list<T, Tag>::iterator
+intrusive_list<T, Tag>::erase(const_iterator pos) noexcept {
+  assert(pos != this->end() && "intrusive_list::erase(iterator) called with a non-dereferenceable iterator");
+
+  hook *n = pos.m_node;
+  hook *next = n->m_next;
+  unlink(n, next);
+  n->m_prev = n->m_next = nullptr;
+  --m_size;
+  return iterator(next);
+}
+
+template <class T, class Tag>
+typename intrusive_list<T, Tag>::iterator
+intrusive_list<T, Tag>::erase(const_iterator first, const_iterator last) noexcept {
+  while (first != last) {
+    first = this->erase(first);
+  }
+  return iterator(last.m_node);
+}
+
+template <class T, class Tag>
+void intrusive_list<T, Tag>::swap(intrusive_list &other) noexcept {
+  intrusive_list tmp(std::move(other));
+  other.steal(*this);
+  this->steal(tmp);
+}
+
+template <class T, class Tag>
+void intrusive_list<T, Tag>::splice(
+  const_iterator pos, intrusive_list &other
+) noexcept {
+  if (this != std::addressof(other) && !other.empty()) {
+    hook *first = other.m_end.m_next;
+    hook *last = other.m_end.m_prev;
+    link_before(pos.m_node, first, last);
+    m_size += other.m_size;
+    other.reset();
+  }
+}
+
+template <class T, class Tag>
+void intrusive_list<T, Tag>::splice(
+  const_iterator pos, intrusive_list &other, const_iterator it
+) noexcept {
+  hook *n = it.m_node;
+  if (pos.m_node == n || pos.m_node == n->m_next) {
+    return;
+  }
+
+  unlink(n, n->m_next);
+  link_before(pos.m_node, n, n);
+  --other.m_size;
+  ++m_size;
+}
+
+template <class T, class Tag>
+void intrusive_list<T, Tag>::splice(
+  const_iterator pos, intrusive_list &other, const_iterator first,
+  const_iterator last
+) noexcept {
+  if (first == last || pos == last) {
+    return;
+  }
+
+  if (this != std::addressof(other)) {
+    size_type n = static_cast<size_type>(std::distance(first, last));
+    other.m_size -= n;
+    m_size += n;
+  }
+
+  hook *f = first.m_node;
+  hook *tail = last.m_node->m_prev;
+  unlink(f, last.m_node);
+  link_before(pos.m_node, f, tail);
+}
+
+/* -------------------------------------------------------------------------- */
+/*                          private member functions                          */
+/* -------------------------------------------------------------------------- */
+template <class T, class Tag>
+void intrusive_list<T, Tag>::steal(intrusive_list &other) noexcept {
+  if (other.empty()) {
+    this->reset();
+    return;
+  }
+
+  m_end.m_next = other.m_end.m_next;
+  m_end.m_prev = other.m_end.m_prev;
+  m_end.m_next->m_prev = &m_end;
+  m_end.m_prev->m_next = &m_end;
+  m_size = other.m_size;
+  other.reset();
+}
+
+} // namespace tinystl
@@ -0,0 +1,1088 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+namespace tinystl {
+
+struct list_node_base {
+  list_node_base *m_prev;
+  list_node_base *m_next;
+};
+
+template <class T>
+struct list_node : list_node_base {
+  // the value is constructed separately through the allocator
+  union {
+    T m_value;
+  };
+
+  list_node() noexcept {}
+  ~list_node() {}
+};
+
+template <class T, class Pointer, class Reference>
+class list_iterator {
+public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using reference = Reference;
+  using pointer = Pointer;
+
+  list_iterator() = default;
+  template <class P, class R>
+    requires std::is_convertible_v<P, pointer>
+  list_iterator(const list_iterator<T, P, R> &it) noexcept
+    : m_node(it.m_node) {}
+
+  reference operator*() const {
+    return static_cast<list_node<T> *>(m_node)->m_value;
+  }
+  pointer operator->() const { return std::addressof(**this); }
+
+  list_iterator &operator++() {
+    m_node = m_node->m_next;
+    return *this;
+  }
+
+  list_iterator operator++(int) {
+    list_iterator tmp = *this;
+    m_node = m_node->m_next;
+    return tmp;
+  }
+
+  list_iterator &operator--() {
+    m_node = m_node->m_prev;
+    return *this;
+  }
+
+  list_iterator operator--(int) {
+    list_iterator tmp = *this;
+    m_node = m_node->m_prev;
+    return tmp;
+  }
+
+  friend bool operator==(const list_iterator &x, const list_iterator &y) {
+    return x.m_node == y.m_node;
+  }
+
+private:
+  explicit list_iterator(list_node_base *n) noexcept : m_node(n) {}
+
+  template <class, class>
+  friend class list;
+
+  template <class, class, class>
+  friend class list_iterator;
+
+private:
+  list_node_base *m_node = nullptr;
+};
+
+template <class T, class Alloc = std::allocator<T>>
+class list {
+  using alloc_traits = std::allocator_traits<Alloc>;
+
+  using node_type = list_node<T>;
+  using node_allocator = typename alloc_traits::template rebind_alloc<node_type>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+public:
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+
+  using allocator_type = Alloc;
+
+  using size_type = typename alloc_traits::size_type;
+  using difference_type = typename alloc_traits::difference_type;
+
+  using pointer = typename alloc_traits::pointer;
+  using const_pointer = typename alloc_traits::const_pointer;
+
+  using iterator = list_iterator<T, T *, T &>;
+  using const_iterator = list_iterator<T, const T *, const T &>;
+
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  // construct/copy/destroy
+  list() = default;
+  explicit list(const Alloc &alloc) noexcept;
+  explicit list(size_type n, const Alloc &alloc = Alloc());
+  list(size_type n, const_reference val, const Alloc &alloc = Alloc());
+  template <std::input_iterator InputIter>
+    requires std::constructible_from<T, std::iter_reference_t<InputIter>>
+  list(InputIter first, InputIter last, const Alloc &alloc = Alloc());
+  list(const list &other);
+  list(const list &other, const Alloc &alloc);
+  list(list &&other) noexcept;
+  list(list &&other, const Alloc &alloc);
+  list(std::initializer_list<value_type> init, const Alloc &alloc = Alloc());
+
+  ~list();
+
+  list &operator=(const list &other);
+  list &operator=(list &&other) noexcept(
+    alloc_traits::propagate_on_container_move_assignment::value ||
+    alloc_traits::is_always_equal::value
+  );
+  list &operator=(std::initializer_list<value_type> init);
+
+  void assign(size_type n, const_reference val);
+  template <std::input_iterator InputIter>
+    requires std::constructible_from<T, std::iter_reference_t<InputIter>>
+  void assign(InputIter first, InputIter last);
+  void assign(std::initializer_list<value_type> init);
+
+  allocator_type get_allocator() const noexcept;
+
+  // element access
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+
+  // iterators
+  iterator begin() noexcept { return iterator(m_end.m_next); }
+  const_iterator begin() const noexcept { return const_iterator(m_end.m_next); }
+  const_iterator cbegin() const noexcept { return this->begin(); }
+  iterator end() noexcept { return iterator(&m_end); }
+  const_iterator end() const noexcept { return const_iterator(this->end_node()); }
+  const_iterator cend() const noexcept { return this->end(); }
+  reverse_iterator rbegin() noexcept { return reverse_iterator(this->end()); }
+  const_reverse_iterator rbegin() const noexcept {
+    return const_reverse_iterator(this->end());
+  }
+  const_reverse_iterator crbegin() const noexcept { return this->rbegin(); }
+  reverse_iterator rend() noexcept { return reverse_iterator(this->begin()); }
+  const_reverse_iterator rend() const noexcept {
+    return const_reverse_iterator(this->begin());
+  }
+  const_reverse_iterator crend() const noexcept { return this->rend(); }
+
+  // capacity
+  bool empty() const noexcept { return m_size == 0; }
+  size_type size() const noexcept { return m_size; }
+  size_type max_size() const noexcept;
+
+  // modifiers
+  void clear() noexcept;
+  iterator insert(const_iterator pos, const_reference val);
+  iterator insert(const_iterator pos, value_type &&val);
+  iterator insert(const_iterator pos, size_type n, const_reference val);
+  template <std::input_iterator InputIter>
+    requires std::constructible_from<T, std::iter_reference_t<InputIter>>
+  iterator insert(const_iterator pos, InputIter first, InputIter last);
+  iterator insert(const_iterator pos, std::initializer_list<T> init);
+  template <class... Args>
+  iterator emplace(const_iterator pos, Args &&...args);
+  iterator erase(const_iterator pos);
+  iterator erase(const_iterator first, const_iterator last);
+  void push_back(const_reference val);
+  void push_back(value_type &&val);
+  template <class... Args>
+  reference emplace_back(Args &&...args);
+  void pop_back();
+  void push_front(const_reference val);
+  void push_front(value_type &&val);
+  template <class... Args>
+  reference emplace_front(Args &&...args);
+  void pop_front();
+  void resize(size_type n);
+  void resize(size_type n, const_reference val);
+  void swap(list &other) noexcept(
+    alloc_traits::propagate_on_container_swap::value ||
+    alloc_traits::is_always_equal::value
+  );
+
+  // operations
+  void merge(list &other);
+  void merge(list &&other);
+  template <class Compare>
+  void merge(list &other, Compare comp);
+  template <class Compare>
+  void merge(list &&other, Compare comp);
+  void splice(const_iterator pos, list &other);
+  void splice(const_iterator pos, list &&other);
+  void splice(const_iterator pos, list &other, const_iterator it);
+  void splice(const_iterator pos, list &&other, const_iterator it);
+  void splice(
+    const_iterator pos, list &other, const_iterator first, const_iterator last
+  );
+  void splice(
+    const_iterator pos, list &&other, const_iterator first, const_iterator last
+  );
+  size_type remove(const_reference val);
+  template <class Pred>
+  size_type remove_if(Pred pred);
+  void reverse() noexcept;
+  size_type unique();
+  template <class BinaryPred>
+  size_type unique(BinaryPred pred);
+  void sort();
+  template <class Compare>
+  void sort(Compare comp);
+
+private:
+  list_node_base *end_node() const noexcept {
+    return const_cast<list_node_base *>(&m_end);
+  }
+
+  template <class... Args>
+  node_type *create_node(Args &&...args);
+  void destroy_node(list_node_base *n) noexcept;
+  void destroy_chain(list_node_base *first, list_node_base *last) noexcept;
+
+  template <class... Args>
+  list_node_base *
+  make_chain(size_type n, list_node_base *&tail, const Args &...args);
+  template <class InputIter, class Sentinel>
+  list_node_base *make_chain(
+    InputIter first, Sentinel last, list_node_base *&tail, size_type &n
+  );
+
+  static void link_before(
+    list_node_base *pos, list_node_base *first, list_node_base *last
+  ) noexcept;
+  static void transfer(
+    list_node_base *pos, list_node_base *first, list_node_base *last
+  ) noexcept;
+
+  template <class Compare>
+  static list_node_base *
+  merge_sort(list_node_base *head, size_type n, Compare &comp);
+
+  void steal(list &other) noexcept;
+
+private:
+  node_allocator m_alloc;
+  list_node_base m_end{&m_end, &m_end};
+  size_type m_size = 0;
+};
+
+template <class T, class Alloc>
+bool operator==(const list<T, Alloc> &lhs, const list<T, Alloc> &rhs) {
+  return lhs.size() == rhs.size() &&
+         std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class T, class Alloc>
+auto operator<=>(const list<T, Alloc> &lhs, const list<T, Alloc> &rhs) {
+  return std::lexicographical_compare_three_way(
+    lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), std::compare_three_way()
+  );
+}
+
+template <class T, class Alloc>
+void swap(list<T, Alloc> &lhs, list<T, Alloc> &rhs) noexcept(
+  noexcept(lhs.swap(rhs))
+) {
+  lhs.swap(rhs);
+}
+
+template <class T, class Alloc, class U>
+typename list<T, Alloc>::size_type erase(list<T, Alloc> &c, const U &val) {
+  return c.remove_if([&](const T &elem) { return elem == val; });
+}
+
+template <class T, class Alloc, class Pred>
+typename list<T, Alloc>::size_type erase_if(list<T, Alloc> &c, Pred pred) {
+  return c.remove_if(pred);
+}
+
+/* -------------------------------------------------------------------------- */
+/*                           public member functions                          */
+/* -------------------------------------------------------------------------- */
+
+/* -------------------------------- construct ------------------------------- */
+template <class T, class Alloc>
+list<T, Alloc>::list(const Alloc &alloc) noexcept : m_alloc(alloc) {}
+
+template <class T, class Alloc>
+list<T, Alloc>::list(size_type n, const Alloc &alloc) : m_alloc(alloc) {
+  if (n > 0) {
+    list_node_base *tail;
+    list_node_base *head = this->make_chain(n, tail);
+    link_before(&m_end, head, tail);
+    m_size = n;
+  }
+}
+
+template <class T, class Alloc>
+list<T, Alloc>::list(size_type n, const_reference val, const Alloc &alloc)
+  : m_alloc(alloc) {
+  if (n > 0) {
+    list_node_base *tail;
+    list_node_base *head = this->make_chain(n, tail, val);
+    link_before(&m_end, head, tail);
+    m_size = n;
+  }
+}
+
+template <class T, class Alloc>
+template <std::input_iterator InputIter>
+  requires std::constructible_from<T, std::iter_reference_t<InputIter>>
+list<T, Alloc>::list(InputIter first, InputIter last, const Alloc &alloc)
+  : m_alloc(alloc) {
+  this->insert(this->cend(), first, last);
+}
+
+template <class T, class Alloc>
+list<T, Alloc>::list(const list &other)
+  : m_alloc(node_traits::select_on_container_copy_construction(other.m_alloc)
+    ) {
+  this->insert(this->cend(), other.begin(), other.end());
+}
+
+template <class T, class Alloc>
+list<T, Alloc>::list(const list &other, const Alloc &alloc) : m_alloc(alloc) {
+  this->insert(this->cend(), other.begin(), other.end());
+}
+
+template <class T, class Alloc>
+list<T, Alloc>::list(list &&other) noexcept
+  : m_alloc(std::move(other.m_alloc)) {
+  this->steal(other);
+}
+
+template <class T, class Alloc>
+list<T, Alloc>::list(list &&other, const Alloc &alloc) : m_alloc(alloc) {
+  if (m_alloc == other.m_alloc) {
+    this->steal(other);
+  } else {
+    this->insert(
+      this->cend(), std::make_move_iterator(other.begin()),
+      std::make_move_iterator(other.end())
+    );
+  }
+}
+
+template <class T, class Alloc>
+list<T, Alloc>::list(std::initializer_list<value_type> init, const Alloc &alloc)
+  : m_alloc(alloc) {
+  this->insert(this->cend(), init.begin(), init.end());
+}
+
+/* ------------------------------- destructor ------------------------------- */
+template <class T, class Alloc>
+list<T, Alloc>::~list() {
+  this->clear();
+}
+
+/* -------------------------------- operator= ------------------------------- */
+template <class T, class Alloc>
+list<T, Alloc> &list<T, Alloc>::operator=(const list &other) {
+  if (this != std::addressof(other)) {
+    if constexpr (node_traits::propagate_on_container_copy_assignment::value) {
+      if (m_alloc != other.m_alloc) {
+        this->clear();
+      }
+      m_alloc = other.m_alloc;
+    }
+
+    this->assign(other.begin(), other.end());
+  }
+
+  return *this;
+}
+
+template <class T, class Alloc>
+list<T, Alloc> &list<T, Alloc>::operator=(list &&other) noexcept(
+  alloc_traits::propagate_on_container_move_assignment::value ||
+  alloc_traits::is_always_equal::value
+) {
+  if (this == std::addressof(other)) {
+    return *this;
+  }
+
+  if constexpr (node_traits::propagate_on_container_move_assignment::value) {
+    this->clear();
+    m_alloc = std::move(other.m_alloc);
+    this->steal(other);
+  } else {
+    if (m_alloc == other.m_alloc) {
+      this->clear();
+      this->steal(other);
+    } else {
+      this->assign(
+        std::make_move_iterator(other.begin()),
+        std::make_move_iterator(other.end())
+      );
+    }
+  }
+
+  return *this;
+}
+
+template <class T, class Alloc>
+list<T, Alloc> &list<T, Alloc>::operator=(std::initializer_list<value_type> init
+) {
+  this->assign(init.begin(), init.end());
+  return *this;
+}
+
+/* --------------------------------- assign --------------------------------- */
+template <class T, class Alloc>
+void list<T, Alloc>::assign(size_type n, const_reference val) {
+  // reuse the existing nodes before allocating new ones
+  iterator it = this->begin();
+  for (; n > 0 && it != this->end(); --n, ++it) {
+    *it = val;
+  }
+
+  if (n > 0) {
+    this->insert(this->cend(), n, val);
+  } else {
+    this->erase(it, this->end());
+  }
+}
+
+template <class T, class Alloc>
+template <std::input_iterator InputIter>
+  requires std::constructible_from<T, std::iter_reference_t<InputIter>>
+void list<T, Alloc>::assign(InputIter first, InputIter last) {
+  iterator it = this->begin();
+  for (; first != last && it != this->end(); ++first, ++it) {
+    *it = *first;
+  }
+
+  if (first != last) {
+    this->insert(this->cend(), first, last);
+  } else {
+    this->erase(it, this->end());
+  }
+}
+
+template <class T, class Alloc>
+void list<T, Alloc>::assign(std::initializer_list<value_type> init) {
+  this->assign(init.begin(), init.end());
+}
+
+template <class T, class Alloc>
+typename list<T, Alloc>::allocator_type
+list<T, Alloc>::get_allocator() const noexcept {
+  return allocator_type(m_alloc);
+}
+
+/* ----------------------------- element access ----------------------------- */
+template <class T, class Alloc>
+typename list<T, Alloc>::reference list<T, Alloc>::front() {
+  assert(!this->empty() && "front() called on an empty list");
+  return *this->begin();
+}
+
+template <class T, class Alloc>
+typename list<T, Alloc>::const_reference list<T, Alloc>::front() const {
+  assert(!this->empty() && "front() called on an empty list");
+  return *this->begin();
+}
+
+template <class T, class Alloc>
+typename list<T, Alloc>::reference list<T, Alloc>::back() {
+  assert(!this->empty() && "back() called on an empty list");
+  return *std::prev(this->end());
+}
+
+template <class T, class Alloc>
+typename list<T, Alloc>::const_reference list<T, Alloc>::back() const {
+  assert(!this->empty() && "back() called on an empty list");
+  return *std::prev(this->end());
+}
+
+/* -------------------------------- capacity -------------------------------- */
+template <class T, class Alloc>
+typename list<T, Alloc>::size_type list<T, Alloc>::max_size() const noexcept {
+  return std::min<size_type>(
+    node_traits::max_size(m_alloc), std::numeric_limits<difference_type>::max()
+  );
+}
+
+/* -------------------------------- modifiers ------------------------------- */
+template <class T, class Alloc>
+void list<T, Alloc>::clear() noexcept {
+  if (m_size > 0) {
+    this->destroy_chain(m_end.m_next, m_end.m_prev);
+    m_end.m_prev = m_end.m_next = &m_end;
+    m_size = 0;
+  }
+}
+
+template <class T, class Alloc>
+typename list<T, Alloc>::iterator
+list<T, Alloc>::insert(const_iterator pos, const_reference val) {
+  return this->emplace(pos, val);
+}
+
+template <class T, class Alloc>
+typename list<T, Alloc>::iterator
+list<T, Alloc>::insert(const_iterator pos, value_type &&val) {
+  return this->emplace(pos, std::move(val));
+}
+
+template <class T, class Alloc>
+typename list<T, Alloc>::iterator
+list<T, Alloc>::insert(const_iterator pos, size_type n, const_reference val) {
+  if (n == 0) {
+    return iterator(pos.m_node);
+  }
+
+  list_node_base *tail;
+  list_node_base *head = this->make_chain(n, tail, val);
+  link_before(pos.m_node, head, tail);
+  m_size += n;
+  return iterator(head);
+}
+
+template <class T, class Alloc>
+template <std::input_iterator InputIter>
+  requires std::constructible_from<T, std::iter_reference_t<InputIter>>
+typename list<T, Alloc>::iterator
+list<T, Alloc>::insert(const_iterator pos, InputIter first, InputIter last) {
+  size_type n = 0;
+  list_node_base *tail;
+  list_node_base *head = this->make_chain(first, last, tail, n);
+  if (n == 0) {
+    return iterator(pos.m_node);
+  }
+
+  link_before(pos.m_node, head, tail);
+  m_size += n;
+  return iterator(head);
+}
+
+template <class T, class Alloc>
+typename list<T, Alloc>::iterator
+list<T, Alloc>::insert(const_iterator pos, std::initializer_list<T> init) {
+  return this->insert(pos, init.begin(), init.end());
+}
+
+template <class T, class Alloc>
+template <class... Args>
+typename list<T, Alloc>::iterator
+list<T, Alloc>::emplace(const_iterator pos, Args &&...args) {
+  node_type *n = this->create_node(std::forward<Args>(args)...);
+  link_before(pos.m_node, n, n);
+  ++m_size;
+  return iterator(n);
+}
+
+template <class T, class Alloc>
+typename list<T, Alloc>::iterator list<T, Alloc>::erase(const_iterator pos) {
+  assert(pos != this->end() && "list::erase(iterator) called with a non-dereferenceable iterator");
+
+  list_node_base *n = pos.m_node;
+  list_node_base *next = n->m_next;
+  n->m_prev->m_next = next;
+  next->m_prev = n->m_prev;
+  this->destroy_node(n);
+  --m_size;
+  return iterator(next);
+}
+
+template <class T, class Alloc>
+typename list<T, Alloc>::iterator
+list<T, Alloc>::erase(const_iterator first, const_iterator last) {
+  if (first != last) {
+    list_node_base *f = first.m_node;
+    list_node_base *l = last.m_node;
+    f->m_prev->m_next = l;
+    l->m_prev = f->m_prev;
+    while (f != l) {
+      list_node_base *next = f->m_next;
+      this->destroy_node(f);
+      --m_size;
+      f = next;
+    }
+  }
+  return iterator(last.m_node);
+}
+
+template <class T, class Alloc>
+void list<T, Alloc>::push_back(const_reference val) {
+  this->emplace_back(val);
+}
+
+template <class T, class Alloc>
+void list<T, Alloc>::push_back(value_type &&val) {
+  this->emplace_back(std::move(val));
+}
+
+template <class T, class Alloc>
+template <class... Args>
+typename list<T, Alloc>::reference list<T, Alloc>::emplace_back(Args &&...args
+) {
+  return *this->emplace(this->cend(), std::forward<Args>(args)...);
+}
+
+template <class T, class Alloc>
+void list<T, Alloc>::pop_back() {
+  assert(!this->empty() && "list::pop_back called on an empty list");
+  this->erase(const_iterator(m_end.m_prev));
+}
+
+template <class T, class Alloc>
+void list<T, Alloc>::push_front(const_reference val) {
+  this->emplace_front(val);
+}
+
+template <class T, class Alloc>
+void list<T, Alloc>::push_front(value_type &&val) {
+  this->emplace_front(std::move(val));
+}
+
+template <class T, class Alloc>
+template <class... Args>
+typename list<T, Alloc>::reference
+list<T, Alloc>::emplace_front(Args &&...args) {
+  return *this->emplace(this->cbegin(), std::forward<Args>(args)...);
+}
+
+template <class T, class Alloc>
+void list<T, Alloc>::pop_front() {
+  assert(!this->empty() && "list::pop_front called on an empty list");
+  this->erase(this->cbegin());
+}
+
+template <class T, class Alloc>
+void list<T, Alloc>::resize(size_type n) {
+  if (n < m_size) {
+    this->erase(std::next(this->cbegin(), n), this->cend());
+  } else if (n > m_size) {
+    list_node_base *tail;
+    list_node_base *head = this->make_chain(n - m_size, tail);
+    link_before(&m_end, head, tail);
+    m_size = n;
+  }
+}
+
+template <class T, class Alloc>
+void list<T, Alloc>::resize(size_type n, const_reference val) {
+  if (n < m_size) {
+    this->erase(std::next(this->cbegin(), n), this->cend());
+  } else if (n > m_size) {
+    this->insert(this->cend(), n - m_size, val);
+  }
+}
+
+template <class T, class Alloc>
+void list<T, Alloc>::swap(list &other) noexcept(
+  alloc_traits::propagate_on_container_swap::value ||
+  alloc_traits::is_always_equal::value
+) {
+  assert(
+    node_traits::propagate_on_container_swap::value ||
+    m_alloc == other.m_alloc &&
+      "list::swap: Either propagate_on_container_swap must be true or the "
+      "allocators must compare equal"
+  );
+
+  // the sentinels live inside the lists, so the node chains are re-hooked
+  // rather than swapped
+  size_type n = m_size;
+  list_node_base *first = m_end.m_next;
+  list_node_base *last = m_end.m_prev;
+  this->steal(other);
+  if (n > 0) {
+    other.m_end.m_next = first;
+    other.m_end.m_prev = last;
+    first->m_prev = &other.m_end;
+    last->m_next = &other.m_end;
+    other.m_size = n;
+  }
+
+  if constexpr (node_traits::propagate_on_container_swap::value) {
+    std::swap(m_alloc, other.m_alloc);
+  }
+}
+
+/* ------------------------------- operations ------------------------------- */
+template <class T, class Alloc>
+void list<T, Alloc>::merge(list &other) {
+  this->merge(other, std::less<>());
+}
+
+template <class T, class Alloc>
+void list<T, Alloc>::merge(list &&other) {
+  this->merge(other, std::less<>());
+}
+
+template <class T, class Alloc>
+template <class Compare>
+void list<T, Alloc>::merge(list &other, Compare comp) {
+  if (this == std::addressof(other)) {
+    return;
+  }
+  assert(m_alloc == other.m_alloc && "list::merge with unequal allocators");
+
+  list_node_base *f1 = m_end.m_next;
+  list_node_base *f2 = other.m_end.m_next;
+  list_node_base *e2 = &other.m_end;
+  while (f1 != &m_end && f2 != e2) {
+    if (comp(
+          static_cast<node_type *>(f2)->m_value,
+          static_cast<node_type *>(f1)->m_value
+        )) {
+      // move the whole run of other's elements that sort before *f1
+      list_node_base *run_end = f2->m_next;
+      while (run_end != e2 &&
+             comp(
+               static_cast<node_type *>(run_end)->m_value,
+               static_cast<node_type *>(f1)->m_value
+             )) {
+        run_end = run_end->m_next;
+      }
+      transfer(f1, f2, run_end);
+      f2 = run_end;
+    } else {
+      f1 = f1->m_next;
+    }
+  }
+
+  if (f2 != e2) {
+    transfer(&m_end, f2, e2);
+  }
+
+  m_size += other.m_size;
+  other.m_size = 0;
+}
+
+template <class T, class Alloc>
+template <class Compare>
+void list<T, Alloc>::merge(list &&other, Compare comp) {
+  this->merge(other, comp);
+}
+
+template <class T, class Alloc>
+void list<T, Alloc>::splice(const_iterator pos, list &other) {
+  assert(this != std::addressof(other) && "list::splice of a list into itself");
+  assert(m_alloc == other.m_alloc && "list::splice with unequal allocators");
+
+  if (!other.empty()) {
+    transfer(pos.m_node, other.m_end.m_next, &other.m_end);
+    m_size += other.m_size;
+    other.m_size = 0;
+  }
+}
+
+template <class T, class Alloc>
+void list<T, Alloc>::splice(const_iterator pos, list &&other) {
+  this->splice(pos, other);
+}
+
+template <class T, class Alloc>
+void list<T, Alloc>::splice(
+  const_iterator pos, list &other, const_iterator it
+) {
+  assert(m_alloc == other.m_alloc && "list::splice with unequal allocators");
+
+  list_node_base *n = it.m_node;
+  if (pos.m_node != n && pos.m_node != n->m_next) {
+    transfer(pos.m_node, n, n->m_next);
+    --other.m_size;
+    ++m_size;
+  }
+}
+
+template <class T, class Alloc>
+void list<T, Alloc>::splice(
+  const_iterator pos, list &&other, const_iterator it
+) {
+  this->splice(pos, other, it);
+}
+
+template <class T, class Alloc>
+void list<T, Alloc>::splice(
+  const_iterator pos, list &other, const_iterator first, const_iterator last
+) {
+  assert(m_alloc == other.m_alloc && "list::splice with unequal allocators");
+
+  if (first == last) {
+    return;
+  }
+
+  // only a transfer between two lists needs the element count
+  if (this != std::addressof(other)) {
+    size_type n = static_cast<size_type>(std::distance(first, last));
+    other.m_size -= n;
+    m_size += n;
+  }
+  transfer(pos.m_node, first.m_node, last.m_node);
+}
+
+template <class T, class Alloc>
+void list<T, Alloc>::splice(
+  const_iterator pos, list &&other, const_iterator first, const_iterator last
+) {
+  this->splice(pos, other, first, last);
+}
+
+template <class T, class Alloc>
+typename list<T, Alloc>::size_type list<T, Alloc>::remove(const_reference val
+) {
+  return this->remove_if([&](const_reference elem) { return elem == val; });
+}
+
+template <class T, class Alloc>
+template <class Pred>
+typename list<T, Alloc>::size_type list<T, Alloc>::remove_if(Pred pred) {
+  // `pred` may refer to an element of this list, so the removed nodes are
+  // collected first and destroyed only once the scan is over
+  list removed(this->get_allocator());
+  for (const_iterator it = this->cbegin(); it != this->cend();) {
+    if (pred(*it)) {
+      const_iterator last = std::next(it);
+      while (last != this->cend() && pred(*last)) {
+        ++last;
+      }
+      removed.splice(removed.cend(), *this, it, last);
+      it = last;
+    } else {
+      ++it;
+    }
+  }
+  return removed.size();
+}
+
+template <class T, class Alloc>
+void list<T, Alloc>::reverse() noexcept {
+  list_node_base *n = &m_end;
+  do {
+    std::swap(n->m_prev, n->m_next);
+    n = n->m_prev;
+  } while (n != &m_end);
+}
+
+template <class T, class Alloc>
+typename list<T, Alloc>::size_type list<T, Alloc>::unique() {
+  return this->unique(std::equal_to<>());
+}
+
+template <class T, class Alloc>
+template <class BinaryPred>
+typename list<T, Alloc>::size_type list<T, Alloc>::unique(BinaryPred pred) {
+  list removed(this->get_allocator());
+  for (const_iterator it = this->cbegin(); it != this->cend();) {
+    const_iterator last = std::next(it);
+    while (last != this->cend() && pred(*it, *last)) {
+      ++last;
+    }
+    if (std::next(it) != last) {
+      removed.splice(removed.cend(), *this, std::next(it), last);
+    }
+    it = last;
+  }
+  return removed.size();
+}
+
+template <class T, class Alloc>
+void list<T, Alloc>::sort() {
+  this->sort(std::less<>());
+}
+
+template <class T, class Alloc>
+template <class Compare>
+void list<T, Alloc>::sort(Compare comp) {
+  if (m_size < 2) {
+    return;
+  }
+
+  // sort the nodes as a null-terminated singly linked chain, then restore the
+  // back links
+  m_end.m_prev->m_next = nullptr;
+  list_node_base *head = merge_sort(m_end.m_next, m_size, comp);
+
+  list_node_base *prev = &m_end;
+  for (list_node_base *n = head; n != nullptr; n = n->m_next) {
+    n->m_prev = prev;
+    prev = n;
+  }
+  m_end.m_next = head;
+  m_end.m_prev = prev;
+  prev->m_next = &m_end;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                          private member functions                          */
+/* -------------------------------------------------------------------------- */
+template <class T, class Alloc>
+template <class... Args>
+typename list<T, Alloc>::node_type *
+list<T, Alloc>::create_node(Args &&...args) {
+  node_type *n = std::to_address(node_traits::allocate(m_alloc, 1));
+  std::construct_at(n);
+  try {
+    node_traits::construct(
+      m_alloc, std::addressof(n->m_value), std::forward<Args>(args)...
+    );
+  } catch (...) {
+    std::destroy_at(n);
+    node_traits::deallocate(m_alloc, n, 1);
+    throw;
+  }
+  return n;
+}
+
+template <class T, class Alloc>
+void list<T, Alloc>::destroy_node(list_node_base *n) noexcept {
+  node_type *node = static_cast<node_type *>(n);
+  node_traits::destroy(m_alloc, std::addressof(node->m_value));
+  std::destroy_at(node);
+  node_traits::deallocate(m_alloc, node, 1);
+}
+
+template <class T, class Alloc>
+void list<T, Alloc>::destroy_chain(
+  list_node_base *first, list_node_base *last
+) noexcept {
+  for (;;) {
+    list_node_base *next = first->m_next;
+    bool done = first == last;
+    this->destroy_node(first);
+    if (done) {
+      break;
+    }
+    first = next;
+  }
+}
+
+template <class T, class Alloc>
+template <class... Args>
+list_node_base *list<T, Alloc>::make_chain(
+  size_type n, list_node_base *&tail, const Args &...args
+) {
+  list_node_base *head = this->create_node(args...);
+  tail = head;
+  try {
+    for (size_type i = 1; i < n; ++i) {
+      list_node_base *node = this->create_node(args...);
+      tail->m_next = node;
+      node->m_prev = tail;
+      tail = node;
+    }
+  } catch (...) {
+    this->destroy_chain(head, tail);
+    throw;
+  }
+  return head;
+}
+
+template <class T, class Alloc>
+template <class InputIter, class Sentinel>
+list_node_base *list<T, Alloc>::make_chain(
+  InputIter first, Sentinel last, list_node_base *&tail, size_type &n
+) {
+  n = 0;
+  if (first == last) {
+    return nullptr;
+  }
+
+  list_node_base *head = this->create_node(*first);
+  tail = head;
+  n = 1;
+  try {
+    for (++first; first != last; ++first, ++n) {
+      list_node_base *node = this->create_node(*first);
+      tail->m_next = node;
+      node->m_prev = tail;
+      tail = node;
+    }
+  } catch (...) {
+    this->destroy_chain(head, tail);
+    throw;
+  }
+  return head;
+}
+
+template <class T, class Alloc>
+void list<T, Alloc>::link_before(
+  list_node_base *pos, list_node_base *first, list_node_base *last
+) noexcept {
+  list_node_base *prev = pos->m_prev;
+  prev->m_next = first;
+  first->m_prev = prev;
+  pos->m_prev = last;
+  last->m_next = pos;
+}
+
+template <class T, class Alloc>
+void list<T, Alloc>::transfer(
+  list_node_base *pos, list_node_base *first, list_node_base *last
+) noexcept {
+  // move [first, last) in front of pos; the nodes may come from any list
+  if (pos == last) {
+    return;
+  }
+
+  list_node_base *tail = last->m_prev;
+  first->m_prev->m_next = last;
+  last->m_prev = first->m_prev;
+  link_before(pos, first, tail);
+}
+
+template <class T, class Alloc>
+template <class Compare>
+list_node_base *
+list<T, Alloc>::merge_sort(list_node_base *head, size_type n, Compare &comp) {
+  if (n == 1) {
+    head->m_next = nullptr;
+    return head;
+  }
+
+  size_type half = n / 2;
+  list_node_base *mid = head;
+  for (size_type i = 0; i < half; ++i) {
+    mid = mid->m_next;
+  }
+
+  list_node_base *a = merge_sort(head, half, comp);
+  list_node_base *b = merge_sort(mid, n - half, comp);
+
+  // stable merge: take from the left run unless the right one is smaller
+  list_node_base result{nullptr, nullptr};
+  list_node_base *out = &result;
+  while (a != nullptr && b != nullptr) {
+    if (comp(
+          static_cast<node_type *>(b)->m_value,
+          static_cast<node_type *>(a)->m_value
+        )) {
+      out->m_next = b;
+      b = b->m_next;
+    } else {
+      out->m_next = a;
+      a = a->m_next;
+    }
+    out = out->m_next;
+  }
+  out->m_next = a != nullptr ? a : b;
+  return result.m_next;
+}
+
+template <class T, class Alloc>
+void list<T, Alloc>::steal(list &other) noexcept {
+  if (other.m_size == 0) {
+    m_end.m_prev = m_end.m_next = &m_end;
+    m_size = 0;
+    return;
+  }
+
+  m_end.m_next = other.m_end.m_next;
+  m_end.m_prev = other.m_end.m_prev;
+  m_end.m_next->m_prev = &m_end;
+  m_end.m_prev->m_next = &m_end;
+  m_size = other.m_size;
+
+  other.m_end.m_prev = other.m_end.m_next = &other.m_end;
+  other.m_size = 0;
+}
+
+} // namespace tinystl
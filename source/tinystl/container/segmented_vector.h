@@ -0,0 +1,716 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "tinystl/container/slow_path.h"
+#include "tinystl/iterator/segmented_iterator.h"
+
+namespace tinystl {
+
+namespace detail {
+
+// Chunk k holds FirstChunk << k elements and starts at index
+// FirstChunk * (2^k - 1), so an index maps to its chunk with one bit_width
+// and the table of chunk pointers never needs more than a machine word's
+// worth of entries.
+template <std::size_t FirstChunk>
+struct geometric_segments {
+  static_assert(std::has_single_bit(FirstChunk), "FirstChunk must be a power of two");
+
+  static constexpr std::size_t shift = std::countr_zero(FirstChunk);
+  static constexpr std::size_t max_chunks =
+    std::numeric_limits<std::size_t>::digits - shift - 1;
+
+  static constexpr std::size_t chunk_of(std::size_t index) noexcept {
+    return static_cast<std::size_t>(std::bit_width((index >> shift) + 1)) - 1;
+  }
+
+  static constexpr std::size_t chunk_start(std::size_t chunk) noexcept {
+    return ((std::size_t(1) << chunk) - 1) << shift;
+  }
+
+  static constexpr std::size_t chunk_size(std::size_t chunk) noexcept {
+    return FirstChunk << chunk;
+  }
+};
+
+} // namespace detail
+
+template <class ValueType>
+struct segmented_vector_first_chunk {
+  static constexpr std::size_t value =
+    std::bit_floor(std::max<std::size_t>(4096 / sizeof(ValueType), 1));
+};
+
+// Walks one chunk after another; local iterators are plain pointers.
+template <class T, class Layout>
+class segmented_vector_segment {
+public:
+  segmented_vector_segment() = default;
+  segmented_vector_segment(T *const *chunks, std::size_t index) noexcept
+    : m_chunks(chunks), m_index(index) {}
+
+  T *const *chunks() const noexcept { return m_chunks; }
+  std::size_t index() const noexcept { return m_index; }
+  T *begin() const noexcept { return m_chunks[m_index]; }
+  T *end() const noexcept { return this->begin() + Layout::chunk_size(m_index); }
+
+  segmented_vector_segment &operator++() noexcept {
+    ++m_index;
+    return *this;
+  }
+
+  segmented_vector_segment &operator--() noexcept {
+    --m_index;
+    return *this;
+  }
+
+  friend bool operator==(
+    const segmented_vector_segment &x, const segmented_vector_segment &y
+  ) noexcept {
+    return x.m_index == y.m_index;
+  }
+
+private:
+  T *const *m_chunks = nullptr;
+  std::size_t m_index = 0;
+};
+
+template <class T, class Layout>
+class segmented_vector_iterator {
+public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = std::remove_const_t<T>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T *;
+  using reference = T &;
+
+  segmented_vector_iterator() = default;
+  segmented_vector_iterator(T *const *chunks, std::size_t segment, T *ptr) noexcept
+    : m_chunks(chunks), m_segment(segment), m_ptr(ptr) {}
+  template <class U>
+    requires std::is_convertible_v<U *, T *>
+  segmented_vector_iterator(const segmented_vector_iterator<U, Layout> &it) noexcept
+    : m_chunks(it.m_chunks), m_segment(it.m_segment), m_ptr(it.m_ptr) {}
+
+  reference operator*() const { return *m_ptr; }
+  pointer operator->() const { return m_ptr; }
+  reference operator[](difference_type n) const { return *(*this + n); }
+
+  segmented_vector_iterator &operator++() {
+    if (++m_ptr == m_chunks[m_segment] + Layout::chunk_size(m_segment)) {
+      ++m_segment;
+      m_ptr = m_chunks[m_segment];
+    }
+    return *this;
+  }
+
+  segmented_vector_iterator operator++(int) {
+    segmented_vector_iterator tmp = *this;
+    ++*this;
+    return tmp;
+  }
+
+  segmented_vector_iterator &operator--() {
+    if (m_ptr == m_chunks[m_segment]) {
+      --m_segment;
+      m_ptr = m_chunks[m_segment] + Layout::chunk_size(m_segment);
+    }
+    --m_ptr;
+    return *this;
+  }
+
+  segmented_vector_iterator operator--(int) {
+    segmented_vector_iterator tmp = *this;
+    --*this;
+    return tmp;
+  }
+
+  segmented_vector_iterator &operator+=(difference_type n) {
+    std::size_t pos = this->index() + static_cast<std::size_t>(n);
+    m_segment = Layout::chunk_of(pos);
+    m_ptr = m_chunks[m_segment] + (pos - Layout::chunk_start(m_segment));
+    return *this;
+  }
+
+  segmented_vector_iterator &operator-=(difference_type n) {
+    return *this += -n;
+  }
+
+  friend segmented_vector_iterator
+  operator+(segmented_vector_iterator it, difference_type n) {
+    return it += n;
+  }
+
+  friend segmented_vector_iterator
+  operator+(difference_type n, segmented_vector_iterator it) {
+    return it += n;
+  }
+
+  friend segmented_vector_iterator
+  operator-(segmented_vector_iterator it, difference_type n) {
+    return it -= n;
+  }
+
+  friend difference_type operator-(
+    const segmented_vector_iterator &x, const segmented_vector_iterator &y
+  ) {
+    return static_cast<difference_type>(x.index() - y.index());
+  }
+
+  friend bool operator==(
+    const segmented_vector_iterator &x, const segmented_vector_iterator &y
+  ) {
+    return x.m_segment == y.m_segment && x.m_ptr == y.m_ptr;
+  }
+
+  friend std::strong_ordering operator<=>(
+    const segmented_vector_iterator &x, const segmented_vector_iterator &y
+  ) {
+    return x.index() <=> y.index();
+  }
+
+private:
+  std::size_t index() const noexcept {
+    return Layout::chunk_start(m_segment) +
+           static_cast<std::size_t>(m_ptr - m_chunks[m_segment]);
+  }
+
+  template <class, class>
+  friend class segmented_vector_iterator;
+
+  template <class>
+  friend struct segmented_iterator_traits;
+
+private:
+  T *const *m_chunks = nullptr;
+  std::size_t m_segment = 0;
+  T *m_ptr = nullptr;
+};
+
+template <class T, class Layout>
+struct segmented_iterator_traits<segmented_vector_iterator<T, Layout>> {
+private:
+  using Iterator = segmented_vector_iterator<T, Layout>;
+
+public:
+  using segment_iterator = segmented_vector_segment<T, Layout>;
+  using local_iterator = T *;
+
+  static segment_iterator segment(Iterator iter) {
+    return segment_iterator(iter.m_chunks, iter.m_segment);
+  }
+  static local_iterator local(Iterator iter) { return iter.m_ptr; }
+
+  static local_iterator begin(segment_iterator iter) { return iter.begin(); }
+  static local_iterator end(segment_iterator iter) { return iter.end(); }
+
+  static Iterator compose(segment_iterator segment, local_iterator local) {
+    if (local == segment.end()) {
+      ++segment;
+      local = segment.begin();
+    }
+    return Iterator(segment.chunks(), segment.index(), local);
+  }
+};
+
+// An append-only sequence that grows by allocating chunks of geometrically
+// increasing size and never moves an element once constructed. Indexing is
+// O(1), pointers and references stay valid until the element is popped, and
+// growing never needs more memory than the new chunk. Iterators stay valid
+// across push_back but refer to the container's chunk table, so they do not
+// survive a move or swap of the container itself.
+template <class T, class Alloc = std::allocator<T>>
+class segmented_vector {
+  using alloc_traits = std::allocator_traits<Alloc>;
+  using layout = detail::geometric_segments<segmented_vector_first_chunk<T>::value>;
+
+public:
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+
+  using allocator_type = Alloc;
+
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  using pointer = value_type *;
+  using const_pointer = const value_type *;
+
+  using iterator = segmented_vector_iterator<T, layout>;
+  using const_iterator = segmented_vector_iterator<const T, layout>;
+
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  // construct/copy/destroy
+  segmented_vector() noexcept(noexcept(Alloc())) = default;
+  explicit segmented_vector(const Alloc &alloc) noexcept;
+  explicit segmented_vector(size_type n, const Alloc &alloc = Alloc());
+  segmented_vector(size_type n, const_reference val, const Alloc &alloc = Alloc());
+  template <std::input_iterator InputIter>
+    requires std::constructible_from<T, std::iter_reference_t<InputIter>>
+  segmented_vector(InputIter first, InputIter last, const Alloc &alloc = Alloc());
+  segmented_vector(std::initializer_list<value_type> init, const Alloc &alloc = Alloc());
+  segmented_vector(const segmented_vector &other);
+  segmented_vector(segmented_vector &&other) noexcept;
+
+  ~segmented_vector();
+
+  segmented_vector &operator=(const segmented_vector &other);
+  segmented_vector &operator=(segmented_vector &&other) noexcept(
+    alloc_traits::propagate_on_container_move_assignment::value ||
+    alloc_traits::is_always_equal::value
+  );
+
+  allocator_type get_allocator() const { return m_alloc; }
+
+  // element access
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  reference front() { return (*this)[0]; }
+  const_reference front() const { return (*this)[0]; }
+  reference back() { return (*this)[m_size - 1]; }
+  const_reference back() const { return (*this)[m_size - 1]; }
+
+  // iterators
+  iterator begin() noexcept { return iterator(m_chunks, 0, m_chunks[0]); }
+  const_iterator begin() const noexcept {
+    return const_iterator(m_chunks, 0, m_chunks[0]);
+  }
+  const_iterator cbegin() const noexcept { return this->begin(); }
+  iterator end() noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cend() const noexcept { return this->end(); }
+  reverse_iterator rbegin() noexcept { return reverse_iterator(this->end()); }
+  const_reverse_iterator rbegin() const noexcept {
+    return const_reverse_iterator(this->end());
+  }
+  reverse_iterator rend() noexcept { return reverse_iterator(this->begin()); }
+  const_reverse_iterator rend() const noexcept {
+    return const_reverse_iterator(this->begin());
+  }
+
+  // capacity
+  bool empty() const noexcept { return m_size == 0; }
+  size_type size() const noexcept { return m_size; }
+  size_type max_size() const noexcept;
+  size_type capacity() const noexcept {
+    return layout::chunk_start(m_chunk_count);
+  }
+  size_type chunk_count() const noexcept { return m_chunk_count; }
+  void reserve(size_type n);
+  void shrink_to_fit() noexcept;
+
+  // modifiers
+  void clear() noexcept { this->destruct(0); }
+  void push_back(const_reference val) { this->emplace_back(val); }
+  void push_back(value_type &&val) { this->emplace_back(std::move(val)); }
+  template <class... Args>
+  reference emplace_back(Args &&...args);
+  void pop_back();
+  void resize(size_type n);
+  void resize(size_type n, const_reference val);
+  void swap(segmented_vector &other) noexcept(
+    alloc_traits::propagate_on_container_swap::value ||
+    alloc_traits::is_always_equal::value
+  );
+
+private:
+  [[noreturn]] static void throw_length_error();
+  [[noreturn]] static void throw_out_of_range();
+
+  void add_chunk();
+
+  // Destroys the elements from index new_size on.
+  void destruct(size_type new_size) noexcept;
+
+  // Destroys every element and frees every chunk.
+  void release() noexcept;
+
+  void steal(segmented_vector &other) noexcept;
+
+  template <class InputIter>
+  void append(InputIter first, InputIter last);
+
+private:
+  // One spare null entry past the last chunk lets iterators step onto it.
+  pointer m_chunks[layout::max_chunks + 1] = {};
+  size_type m_chunk_count = 0;
+  size_type m_size = 0;
+  [[no_unique_address]] Alloc m_alloc;
+};
+
+template <class T, class Alloc>
+bool operator==(
+  const segmented_vector<T, Alloc> &lhs, const segmented_vector<T, Alloc> &rhs
+) {
+  return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class T, class Alloc>
+auto operator<=>(
+  const segmented_vector<T, Alloc> &lhs, const segmented_vector<T, Alloc> &rhs
+) {
+  return std::lexicographical_compare_three_way(
+    lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), std::compare_three_way()
+  );
+}
+
+template <class T, class Alloc>
+void swap(segmented_vector<T, Alloc> &lhs, segmented_vector<T, Alloc> &rhs) noexcept(
+  noexcept(lhs.swap(rhs))
+) {
+  lhs.swap(rhs);
+}
+
+/* -------------------------------------------------------------------------- */
+/*                           public member functions                          */
+/* -------------------------------------------------------------------------- */
+
+/* -------------------------------- construct ------------------------------- */
+template <class T, class Alloc>
+segmented_vector<T, Alloc>::segmented_vector(const Alloc &alloc) noexcept
+  : m_alloc(alloc) {}
+
+template <class T, class Alloc>
+segmented_vector<T, Alloc>::segmented_vector(size_type n, const Alloc &alloc)
+  : m_alloc(alloc) {
+  try {
+    this->resize(n);
+  } catch (...) {
+    this->release();
+    throw;
+  }
+}
+
+template <class T, class Alloc>
+segmented_vector<T, Alloc>::segmented_vector(
+  size_type n, const_reference val, const Alloc &alloc
+)
+  : m_alloc(alloc) {
+  try {
+    this->resize(n, val);
+  } catch (...) {
+    this->release();
+    throw;
+  }
+}
+
+template <class T, class Alloc>
+template <std::input_iterator InputIter>
+  requires std::constructible_from<T, std::iter_reference_t<InputIter>>
+segmented_vector<T, Alloc>::segmented_vector(
+  InputIter first, InputIter last, const Alloc &alloc
+)
+  : m_alloc(alloc) {
+  this->append(first, last);
+}
+
+template <class T, class Alloc>
+segmented_vector<T, Alloc>::segmented_vector(
+  std::initializer_list<value_type> init, const Alloc &alloc
+)
+  : m_alloc(alloc) {
+  this->append(init.begin(), init.end());
+}
+
+template <class T, class Alloc>
+segmented_vector<T, Alloc>::segmented_vector(const segmented_vector &other)
+  : m_alloc(alloc_traits::select_on_container_copy_construction(other.m_alloc)) {
+  this->append(other.begin(), other.end());
+}
+
+template <class T, class Alloc>
+segmented_vector<T, Alloc>::segmented_vector(segmented_vector &&other) noexcept
+  : m_alloc(std::move(other.m_alloc)) {
+  this->steal(other);
+}
+
+template <class T, class Alloc>
+segmented_vector<T, Alloc>::~segmented_vector() {
+  this->release();
+}
+
+template <class T, class Alloc>
+segmented_vector<T, Alloc> &
+segmented_vector<T, Alloc>::operator=(const segmented_vector &other) {
+  if (this != std::addressof(other)) {
+    if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+      if (m_alloc != other.m_alloc) {
+        this->release();
+      }
+      m_alloc = other.m_alloc;
+    }
+    this->clear();
+    this->append(other.begin(), other.end());
+  }
+  return *this;
+}
+
+template <class T, class Alloc>
+segmented_vector<T, Alloc> &
+segmented_vector<T, Alloc>::operator=(segmented_vector &&other) noexcept(
+  alloc_traits::propagate_on_container_move_assignment::value ||
+  alloc_traits::is_always_equal::value
+) {
+  if (this == std::addressof(other)) {
+    return *this;
+  }
+
+  if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+    this->release();
+    m_alloc = std::move(other.m_alloc);
+    this->steal(other);
+  } else {
+    if (m_alloc == other.m_alloc) {
+      this->release();
+      this->steal(other);
+    } else {
+      this->clear();
+      this->append(
+        std::make_move_iterator(other.begin()),
+        std::make_move_iterator(other.end())
+      );
+    }
+  }
+  return *this;
+}
+
+/* ----------------------------- element access ----------------------------- */
+template <class T, class Alloc>
+typename segmented_vector<T, Alloc>::reference
+segmented_vector<T, Alloc>::at(size_type pos) {
+  if (pos >= m_size) {
+    this->throw_out_of_range();
+  }
+  return (*this)[pos];
+}
+
+template <class T, class Alloc>
+typename segmented_vector<T, Alloc>::const_reference
+segmented_vector<T, Alloc>::at(size_type pos) const {
+  if (pos >= m_size) {
+    this->throw_out_of_range();
+  }
+  return (*this)[pos];
+}
+
+template <class T, class Alloc>
+typename segmented_vector<T, Alloc>::reference
+segmented_vector<T, Alloc>::operator[](size_type pos) {
+  assert(pos < m_size && "segmented_vector[] index out of bounds");
+  size_type chunk = layout::chunk_of(pos);
+  return m_chunks[chunk][pos - layout::chunk_start(chunk)];
+}
+
+template <class T, class Alloc>
+typename segmented_vector<T, Alloc>::const_reference
+segmented_vector<T, Alloc>::operator[](size_type pos) const {
+  assert(pos < m_size && "segmented_vector[] index out of bounds");
+  size_type chunk = layout::chunk_of(pos);
+  return m_chunks[chunk][pos - layout::chunk_start(chunk)];
+}
+
+/* -------------------------------- iterators ------------------------------- */
+template <class T, class Alloc>
+typename segmented_vector<T, Alloc>::iterator
+segmented_vector<T, Alloc>::end() noexcept {
+  size_type chunk = layout::chunk_of(m_size);
+  return iterator(m_chunks, chunk, m_chunks[chunk] + (m_size - layout::chunk_start(chunk)));
+}
+
+template <class T, class Alloc>
+typename segmented_vector<T, Alloc>::const_iterator
+segmented_vector<T, Alloc>::end() const noexcept {
+  size_type chunk = layout::chunk_of(m_size);
+  return const_iterator(
+    m_chunks, chunk, m_chunks[chunk] + (m_size - layout::chunk_start(chunk))
+  );
+}
+
+/* -------------------------------- capacity -------------------------------- */
+template <class T, class Alloc>
+typename segmented_vector<T, Alloc>::size_type
+segmented_vector<T, Alloc>::max_size() const noexcept {
+  return std::min<size_type>(
+    layout::chunk_start(layout::max_chunks), alloc_traits::max_size(m_alloc)
+  );
+}
+
+template <class T, class Alloc>
+void segmented_vector<T, Alloc>::reserve(size_type n) {
+  if (n > this->max_size()) {
+    this->throw_length_error();
+  }
+  while (this->capacity() < n) {
+    this->add_chunk();
+  }
+}
+
+template <class T, class Alloc>
+void segmented_vector<T, Alloc>::shrink_to_fit() noexcept {
+  size_type needed = m_size == 0 ? 0 : layout::chunk_of(m_size - 1) + 1;
+  while (m_chunk_count > needed) {
+    --m_chunk_count;
+    alloc_traits::deallocate(
+      m_alloc,
+      std::pointer_traits<typename alloc_traits::pointer>::pointer_to(
+        *m_chunks[m_chunk_count]
+      ),
+      layout::chunk_size(m_chunk_count)
+    );
+    m_chunks[m_chunk_count] = nullptr;
+  }
+}
+
+/* -------------------------------- modifiers ------------------------------- */
+template <class T, class Alloc>
+template <class... Args>
+typename segmented_vector<T, Alloc>::reference
+segmented_vector<T, Alloc>::emplace_back(Args &&...args) {
+  if (m_size == this->capacity()) {
+    this->add_chunk();
+  }
+
+  size_type chunk = layout::chunk_of(m_size);
+  pointer p = m_chunks[chunk] + (m_size - layout::chunk_start(chunk));
+  alloc_traits::construct(m_alloc, p, std::forward<Args>(args)...);
+  ++m_size;
+  return *p;
+}
+
+template <class T, class Alloc>
+void segmented_vector<T, Alloc>::pop_back() {
+  assert(!this->empty() && "segmented_vector::pop_back called on an empty segmented_vector");
+  this->destruct(m_size - 1);
+}
+
+template <class T, class Alloc>
+void segmented_vector<T, Alloc>::resize(size_type n) {
+  if (n < m_size) {
+    this->destruct(n);
+    return;
+  }
+  this->reserve(n);
+  while (m_size < n) {
+    this->emplace_back();
+  }
+}
+
+template <class T, class Alloc>
+void segmented_vector<T, Alloc>::resize(size_type n, const_reference val) {
+  if (n < m_size) {
+    this->destruct(n);
+    return;
+  }
+  this->reserve(n);
+  while (m_size < n) {
+    this->emplace_back(val);
+  }
+}
+
+template <class T, class Alloc>
+void segmented_vector<T, Alloc>::swap(segmented_vector &other) noexcept(
+  alloc_traits::propagate_on_container_swap::value ||
+  alloc_traits::is_always_equal::value
+) {
+  if constexpr (alloc_traits::propagate_on_container_swap::value) {
+    std::swap(m_alloc, other.m_alloc);
+  } else {
+    assert(m_alloc == other.m_alloc && "swapping segmented_vectors with unequal allocators");
+  }
+  std::swap_ranges(
+    m_chunks, m_chunks + std::max(m_chunk_count, other.m_chunk_count),
+    other.m_chunks
+  );
+  std::swap(m_chunk_count, other.m_chunk_count);
+  std::swap(m_size, other.m_size);
+}
+
+/* -------------------------------------------------------------------------- */
+/*                          private member functions                          */
+/* -------------------------------------------------------------------------- */
+template <class T, class Alloc>
+void segmented_vector<T, Alloc>::throw_length_error() {
+  detail::throw_length_error("segmented_vector");
+}
+
+template <class T, class Alloc>
+void segmented_vector<T, Alloc>::throw_out_of_range() {
+  detail::throw_out_of_range("segmented_vector");
+}
+
+template <class T, class Alloc>
+void segmented_vector<T, Alloc>::add_chunk() {
+  if (m_chunk_count == layout::max_chunks) {
+    this->throw_length_error();
+  }
+  m_chunks[m_chunk_count] = std::to_address(
+    alloc_traits::allocate(m_alloc, layout::chunk_size(m_chunk_count))
+  );
+  ++m_chunk_count;
+}
+
+template <class T, class Alloc>
+void segmented_vector<T, Alloc>::destruct(size_type new_size) noexcept {
+  if constexpr (!std::is_trivially_destructible_v<T>) {
+    while (m_size > new_size) {
+      --m_size;
+      size_type chunk = layout::chunk_of(m_size);
+      alloc_traits::destroy(m_alloc, m_chunks[chunk] + (m_size - layout::chunk_start(chunk)));
+    }
+  }
+  m_size = new_size;
+}
+
+template <class T, class Alloc>
+void segmented_vector<T, Alloc>::release() noexcept {
+  this->clear();
+  this->shrink_to_fit();
+}
+
+template <class T, class Alloc>
+void segmented_vector<T, Alloc>::steal(segmented_vector &other) noexcept {
+  std::copy(other.m_chunks, other.m_chunks + other.m_chunk_count, m_chunks);
+  std::fill(other.m_chunks, other.m_chunks + other.m_chunk_count, nullptr);
+  m_chunk_count = std::exchange(other.m_chunk_count, 0);
+  m_size = std::exchange(other.m_size, 0);
+}
+
+template <class T, class Alloc>
+template <class InputIter>
+void segmented_vector<T, Alloc>::append(InputIter first, InputIter last) {
+  size_type old_size = m_size;
+  try {
+    if constexpr (std::forward_iterator<InputIter>) {
+      this->reserve(m_size + static_cast<size_type>(std::distance(first, last)));
+    }
+    for (; first != last; ++first) {
+      this->emplace_back(*first);
+    }
+  } catch (...) {
+    this->destruct(old_size);
+    if (old_size == 0) {
+      this->shrink_to_fit();
+    }
+    throw;
+  }
+}
+
+} // namespace tinystl
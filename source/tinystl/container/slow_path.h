@@ -0,0 +1,57 @@
+#pragma once
+
+// Non-template slow paths shared by the containers. Every vector<T> used to
+// carry its own copy of the growth policy and the throw sites; as plain
+// functions they are emitted once per program instead of once per T.
+//
+// Defining TINYSTL_OPTIMIZE_SIZE also keeps the growth policy and the
+// reallocating members out of line, trading a call on the slow path for
+// smaller callers.
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define TINYSTL_NOINLINE __attribute__((noinline))
+#define TINYSTL_COLD __attribute__((noinline, cold))
+#elif defined(_MSC_VER)
+#define TINYSTL_NOINLINE __declspec(noinline)
+#define TINYSTL_COLD __declspec(noinline)
+#else
+#define TINYSTL_NOINLINE
+#define TINYSTL_COLD
+#endif
+
+#if defined(TINYSTL_OPTIMIZE_SIZE)
+#define TINYSTL_SIZE_NOINLINE TINYSTL_NOINLINE
+#else
+#define TINYSTL_SIZE_NOINLINE
+#endif
+
+namespace tinystl::detail {
+
+[[noreturn]] TINYSTL_COLD inline void throw_length_error(const char *what) {
+  throw std::length_error(what);
+}
+
+[[noreturn]] TINYSTL_COLD inline void throw_out_of_range(const char *what) {
+  throw std::out_of_range(what);
+}
+
+// Geometric growth: double the capacity, but at least to `required` and at
+// most to `max_size`.
+TINYSTL_SIZE_NOINLINE inline std::size_t recommend_capacity(
+  std::size_t capacity, std::size_t required, std::size_t max_size,
+  const char *what
+) {
+  if (required > max_size) {
+    throw_length_error(what);
+  }
+  if (capacity >= max_size / 2) {
+    return max_size;
+  }
+  return std::max(2 * capacity, required);
+}
+
+} // namespace tinystl::detail
@@ -0,0 +1,460 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "tinystl/container/vector.h"
+
+namespace tinystl {
+
+// A structure-of-arrays sequence: row i of soa_vector<A, B, C> is spread over
+// three contiguous columns vector<A>, vector<B>, vector<C>. Loops that touch a
+// single member stream through one column instead of striding over whole
+// rows. Rows are accessed through proxy references (std::tuple<Ts &...>).
+template <class... Ts>
+class soa_vector;
+
+template <class Container, class Reference>
+class soa_iterator {
+  template <class, class>
+  friend class soa_iterator;
+
+public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = typename Container::value_type;
+  using difference_type = typename Container::difference_type;
+  using reference = Reference;
+  using pointer = void;
+
+  soa_iterator() = default;
+  soa_iterator(Container *c, difference_type pos) noexcept
+    : m_container(c), m_pos(pos) {}
+  template <class C, class R>
+    requires std::is_convertible_v<C *, Container *>
+  soa_iterator(const soa_iterator<C, R> &it) noexcept
+    : m_container(it.m_container), m_pos(it.m_pos) {}
+
+  reference operator*() const {
+    return m_container->row(static_cast<std::size_t>(m_pos));
+  }
+  reference operator[](difference_type n) const { return *(*this + n); }
+
+  soa_iterator &operator++() {
+    ++m_pos;
+    return *this;
+  }
+  soa_iterator operator++(int) {
+    soa_iterator tmp = *this;
+    ++m_pos;
+    return tmp;
+  }
+  soa_iterator &operator--() {
+    --m_pos;
+    return *this;
+  }
+  soa_iterator operator--(int) {
+    soa_iterator tmp = *this;
+    --m_pos;
+    return tmp;
+  }
+
+  soa_iterator &operator+=(difference_type n) {
+    m_pos += n;
+    return *this;
+  }
+  soa_iterator &operator-=(difference_type n) {
+    m_pos -= n;
+    return *this;
+  }
+  soa_iterator operator+(difference_type n) const {
+    return soa_iterator(m_container, m_pos + n);
+  }
+  soa_iterator operator-(difference_type n) const {
+    return soa_iterator(m_container, m_pos - n);
+  }
+  friend soa_iterator operator+(difference_type n, const soa_iterator &it) {
+    return it + n;
+  }
+  friend difference_type
+  operator-(const soa_iterator &x, const soa_iterator &y) {
+    return x.m_pos - y.m_pos;
+  }
+
+  friend bool operator==(const soa_iterator &x, const soa_iterator &y) {
+    return x.m_pos == y.m_pos;
+  }
+  friend auto operator<=>(const soa_iterator &x, const soa_iterator &y) {
+    return x.m_pos <=> y.m_pos;
+  }
+
+  difference_type index() const noexcept { return m_pos; }
+
+private:
+  Container *m_container = nullptr;
+  difference_type m_pos = 0;
+};
+
+template <class... Ts>
+class soa_vector {
+  static_assert(sizeof...(Ts) > 0, "soa_vector needs at least one column");
+
+  template <std::size_t I>
+  using column_type = vector<std::tuple_element_t<I, std::tuple<Ts...>>>;
+
+  using index_sequence = std::index_sequence_for<Ts...>;
+
+public:
+  using value_type = std::tuple<Ts...>;
+  using reference = std::tuple<Ts &...>;
+  using const_reference = std::tuple<const Ts &...>;
+
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  using iterator = soa_iterator<soa_vector, reference>;
+  using const_iterator = soa_iterator<const soa_vector, const_reference>;
+
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  template <std::size_t I>
+  using element_type = std::tuple_element_t<I, std::tuple<Ts...>>;
+
+  // construct/copy/destroy
+  soa_vector() = default;
+  explicit soa_vector(size_type n);
+  soa_vector(size_type n, const Ts &...vals);
+  soa_vector(std::initializer_list<value_type> init);
+
+  // element access
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos) { return this->row(pos); }
+  const_reference operator[](size_type pos) const { return this->row(pos); }
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+
+  reference row(size_type pos) {
+    return this->row_impl(pos, index_sequence{});
+  }
+  const_reference row(size_type pos) const {
+    return this->row_impl(pos, index_sequence{});
+  }
+
+  // column access
+  template <std::size_t I>
+  std::span<element_type<I>> column() noexcept {
+    auto &c = std::get<I>(m_columns);
+    return std::span<element_type<I>>(c.data(), c.size());
+  }
+  template <std::size_t I>
+  std::span<const element_type<I>> column() const noexcept {
+    const auto &c = std::get<I>(m_columns);
+    return std::span<const element_type<I>>(c.data(), c.size());
+  }
+  template <std::size_t I>
+  element_type<I> *data() noexcept {
+    return std::get<I>(m_columns).data();
+  }
+  template <std::size_t I>
+  const element_type<I> *data() const noexcept {
+    return std::get<I>(m_columns).data();
+  }
+
+  // iterators
+  iterator begin() noexcept { return iterator(this, 0); }
+  const_iterator begin() const noexcept { return const_iterator(this, 0); }
+  const_iterator cbegin() const noexcept { return this->begin(); }
+  iterator end() noexcept {
+    return iterator(this, static_cast<difference_type>(this->size()));
+  }
+  const_iterator end() const noexcept {
+    return const_iterator(this, static_cast<difference_type>(this->size()));
+  }
+  const_iterator cend() const noexcept { return this->end(); }
+  reverse_iterator rbegin() noexcept { return reverse_iterator(this->end()); }
+  const_reverse_iterator rbegin() const noexcept {
+    return const_reverse_iterator(this->end());
+  }
+  reverse_iterator rend() noexcept { return reverse_iterator(this->begin()); }
+  const_reverse_iterator rend() const noexcept {
+    return const_reverse_iterator(this->begin());
+  }
+
+  // capacity
+  bool empty() const noexcept { return std::get<0>(m_columns).empty(); }
+  size_type size() const noexcept { return std::get<0>(m_columns).size(); }
+  size_type max_size() const noexcept;
+  size_type capacity() const noexcept;
+  void reserve(size_type n);
+  void shrink_to_fit();
+
+  // modifiers
+  void clear() noexcept;
+  void push_back(const value_type &val);
+  void push_back(value_type &&val);
+  template <class... Args>
+    requires(sizeof...(Args) == sizeof...(Ts))
+  reference emplace_back(Args &&...args);
+  void pop_back();
+  iterator erase(const_iterator pos);
+  iterator erase(const_iterator first, const_iterator last);
+  void resize(size_type n);
+  void swap(soa_vector &other) noexcept;
+
+private:
+  template <std::size_t... Is>
+  reference row_impl(size_type pos, std::index_sequence<Is...>) {
+    assert(pos < this->size() && "soa_vector[] index out of bounds");
+    return reference(std::get<Is>(m_columns)[pos]...);
+  }
+  template <std::size_t... Is>
+  const_reference row_impl(size_type pos, std::index_sequence<Is...>) const {
+    assert(pos < this->size() && "soa_vector[] index out of bounds");
+    return const_reference(std::get<Is>(m_columns)[pos]...);
+  }
+
+  template <std::size_t... Is, class... Args>
+  void emplace_back_impl(std::index_sequence<Is...>, Args &&...args);
+
+  template <std::size_t... Is>
+  void pop_back_columns(size_type ncols, std::index_sequence<Is...>) noexcept;
+
+  template <class F>
+  void for_each_column(F &&f) {
+    std::apply([&](auto &...cols) { (f(cols), ...); }, m_columns);
+  }
+  template <class F>
+  void for_each_column(F &&f) const {
+    std::apply([&](const auto &...cols) { (f(cols), ...); }, m_columns);
+  }
+
+  void throw_out_of_range() const;
+
+private:
+  std::tuple<vector<Ts>...> m_columns;
+};
+
+template <class... Ts>
+bool operator==(const soa_vector<Ts...> &lhs, const soa_vector<Ts...> &rhs) {
+  return lhs.size() == rhs.size() &&
+         std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class... Ts>
+void swap(soa_vector<Ts...> &lhs, soa_vector<Ts...> &rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+/* -------------------------------------------------------------------------- */
+/*                           public member functions                          */
+/* -------------------------------------------------------------------------- */
+
+/* -------------------------------- construct ------------------------------- */
+template <class... Ts>
+soa_vector<Ts...>::soa_vector(size_type n) : m_columns(vector<Ts>(n)...) {}
+
+template <class... Ts>
+soa_vector<Ts...>::soa_vector(size_type n, const Ts &...vals)
+  : m_columns(vector<Ts>(n, vals)...) {}
+
+template <class... Ts>
+soa_vector<Ts...>::soa_vector(std::initializer_list<value_type> init) {
+  this->reserve(init.size());
+  for (const value_type &val : init) {
+    this->push_back(val);
+  }
+}
+
+/* ----------------------------- element access ----------------------------- */
+template <class... Ts>
+typename soa_vector<Ts...>::reference soa_vector<Ts...>::at(size_type pos) {
+  if (pos >= this->size()) {
+    this->throw_out_of_range();
+  }
+  return this->row(pos);
+}
+
+template <class... Ts>
+typename soa_vector<Ts...>::const_reference
+soa_vector<Ts...>::at(size_type pos) const {
+  if (pos >= this->size()) {
+    this->throw_out_of_range();
+  }
+  return this->row(pos);
+}
+
+template <class... Ts>
+typename soa_vector<Ts...>::reference soa_vector<Ts...>::front() {
+  assert(!this->empty() && "front() called on an empty soa_vector");
+  return this->row(0);
+}
+
+template <class... Ts>
+typename soa_vector<Ts...>::const_reference soa_vector<Ts...>::front() const {
+  assert(!this->empty() && "front() called on an empty soa_vector");
+  return this->row(0);
+}
+
+template <class... Ts>
+typename soa_vector<Ts...>::reference soa_vector<Ts...>::back() {
+  assert(!this->empty() && "back() called on an empty soa_vector");
+  return this->row(this->size() - 1);
+}
+
+template <class... Ts>
+typename soa_vector<Ts...>::const_reference soa_vector<Ts...>::back() const {
+  assert(!this->empty() && "back() called on an empty soa_vector");
+  return this->row(this->size() - 1);
+}
+
+/* -------------------------------- capacity -------------------------------- */
+template <class... Ts>
+typename soa_vector<Ts...>::size_type
+soa_vector<Ts...>::max_size() const noexcept {
+  size_type n = std::get<0>(m_columns).max_size();
+  this->for_each_column([&](const auto &c) {
+    n = std::min<size_type>(n, c.max_size());
+  });
+  return n;
+}
+
+template <class... Ts>
+typename soa_vector<Ts...>::size_type
+soa_vector<Ts...>::capacity() const noexcept {
+  // columns grow in lockstep, but a reserve() that threw half way may have
+  // left some of them larger than the others
+  size_type n = std::get<0>(m_columns).capacity();
+  this->for_each_column([&](const auto &c) {
+    n = std::min<size_type>(n, c.capacity());
+  });
+  return n;
+}
+
+template <class... Ts>
+void soa_vector<Ts...>::reserve(size_type n) {
+  this->for_each_column([&](auto &c) { c.reserve(n); });
+}
+
+template <class... Ts>
+void soa_vector<Ts...>::shrink_to_fit() {
+  this->for_each_column([](auto &c) { c.shrink_to_fit(); });
+}
+
+/* -------------------------------- modifiers ------------------------------- */
+template <class... Ts>
+void soa_vector<Ts...>::clear() noexcept {
+  this->for_each_column([](auto &c) { c.clear(); });
+}
+
+template <class... Ts>
+void soa_vector<Ts...>::push_back(const value_type &val) {
+  std::apply(
+    [&](const Ts &...vals) {
+      this->emplace_back_impl(index_sequence{}, vals...);
+    },
+    val
+  );
+}
+
+template <class... Ts>
+void soa_vector<Ts...>::push_back(value_type &&val) {
+  std::apply(
+    [&](Ts &...vals) {
+      this->emplace_back_impl(index_sequence{}, std::move(vals)...);
+    },
+    val
+  );
+}
+
+template <class... Ts>
+template <class... Args>
+  requires(sizeof...(Args) == sizeof...(Ts))
+typename soa_vector<Ts...>::reference
+soa_vector<Ts...>::emplace_back(Args &&...args) {
+  this->emplace_back_impl(index_sequence{}, std::forward<Args>(args)...);
+  return this->back();
+}
+
+template <class... Ts>
+void soa_vector<Ts...>::pop_back() {
+  assert(!this->empty() && "soa_vector::pop_back called on an empty vector");
+  this->pop_back_columns(sizeof...(Ts), index_sequence{});
+}
+
+template <class... Ts>
+typename soa_vector<Ts...>::iterator
+soa_vector<Ts...>::erase(const_iterator pos) {
+  return this->erase(pos, pos + 1);
+}
+
+template <class... Ts>
+typename soa_vector<Ts...>::iterator
+soa_vector<Ts...>::erase(const_iterator first, const_iterator last) {
+  assert(first <= last && "soa_vector::erase(first, last) called with invalid range");
+
+  difference_type f = first.index();
+  difference_type l = last.index();
+  this->for_each_column([&](auto &c) {
+    c.erase(c.cbegin() + f, c.cbegin() + l);
+  });
+  return iterator(this, f);
+}
+
+template <class... Ts>
+void soa_vector<Ts...>::resize(size_type n) {
+  this->for_each_column([&](auto &c) { c.resize(n); });
+}
+
+template <class... Ts>
+void soa_vector<Ts...>::swap(soa_vector &other) noexcept {
+  std::apply(
+    [&](auto &...lhs) {
+      std::apply([&](auto &...rhs) { (lhs.swap(rhs), ...); }, other.m_columns);
+    },
+    m_columns
+  );
+}
+
+/* -------------------------------------------------------------------------- */
+/*                          private member functions                          */
+/* -------------------------------------------------------------------------- */
+template <class... Ts>
+template <std::size_t... Is, class... Args>
+void soa_vector<Ts...>::emplace_back_impl(
+  std::index_sequence<Is...>, Args &&...args
+) {
+  // Append column by column; if one of them throws, drop the elements that
+  // were already appended to the earlier columns so all columns stay the
+  // same length.
+  size_type done = 0;
+  try {
+    ((std::get<Is>(m_columns).emplace_back(std::forward<Args>(args)), ++done),
+     ...);
+  } catch (...) {
+    this->pop_back_columns(done, index_sequence{});
+    throw;
+  }
+}
+
+template <class... Ts>
+template <std::size_t... Is>
+void soa_vector<Ts...>::pop_back_columns(
+  size_type ncols, std::index_sequence<Is...>
+) noexcept {
+  ((Is < ncols ? std::get<Is>(m_columns).pop_back() : void()), ...);
+}
+
+template <class... Ts>
+void soa_vector<Ts...>::throw_out_of_range() const {
+  throw std::out_of_range("soa_vector");
+}
+
+} // namespace tinystl
@@ -1,15 +1,24 @@
 #pragma once
 
 #include <algorithm>
+#include <cassert>
+#include <concepts>
 #include <iterator>
 #include <memory>
 #include <type_traits>
 
+#include "tinystl/container/introspection.h"
+#include "tinystl/container/trace.h"
+#include "tinystl/iterator/concepts.h"
 #include "tinystl/memory/swap_allocator.h"
 
 namespace tinystl {
+
+// The temporary buffers used for growth hold an allocator reference and
+// stay out of the introspection registry.
 template <class T, class Alloc>
-class split_buffer {
+class split_buffer : public introspection::tracked<
+                       split_buffer<T, Alloc>, !std::is_reference_v<Alloc>> {
   using alloc_rr = std::remove_reference_t<Alloc>;
   using alloc_traits = std::allocator_traits<alloc_rr>;
 
@@ -103,6 +112,10 @@ public:
   );
 
 private:
+  // Growing builds the new buffer as a split_buffer<T, Alloc &>.
+  template <class, class>
+  friend class split_buffer;
+
   void swap_without_alloc(split_buffer<value_type, alloc_rr &> &other) noexcept;
 
   void copy_without_alloc(const split_buffer &other) noexcept(
@@ -113,8 +126,11 @@ private:
 
   void construct_at_end(size_type n);
   void construct_at_end(size_type n, const_reference x);
-  template <std::forward_iterator ForwardIter>
-    requires std::constructible_from<T, std::iter_reference_t<ForwardIter>>
+  // Multipass rather than forward_iterator, so that the move_iterators of
+  // the relocation loops below are accepted.
+  template <std::input_iterator ForwardIter>
+    requires detail::multipass_iterator<ForwardIter> &&
+             std::constructible_from<T, std::iter_reference_t<ForwardIter>>
   void construct_at_end(ForwardIter first, ForwardIter last);
 
   template <class Iterator, class Sentinel>
@@ -125,6 +141,15 @@ private:
 
   void destruct_at_begin(pointer new_begin);
 
+  void slide_to(pointer new_begin);
+  // Sliding moves every element to open half of the spare room at the
+  // other end, which keeps pushes amortized O(1) only while that room is
+  // a fair share of the size; past that it is cheaper to grow.
+  bool slide_pays_off(difference_type spare) const noexcept {
+    return spare > 0 &&
+           2 * spare >= static_cast<difference_type>(this->size());
+  }
+
   void destruct_at_end(pointer new_end) noexcept;
 
   bool invariants() const;
@@ -160,6 +185,7 @@ split_buffer<T, Alloc>::split_buffer(
 
   if (cap > 0) {
     m_front_cap = alloc_traits::allocate(m_alloc, cap);
+    this->note_allocation(cap);
   }
 
   m_begin = m_front_cap + start;
@@ -190,6 +216,7 @@ split_buffer<T, Alloc>::split_buffer(split_buffer &&c, const alloc_rr &a)
   } else {
     size_type sz = c.size();
     m_front_cap = alloc_traits::allocate(m_alloc, sz);
+    this->note_allocation(sz);
     m_begin = m_front_cap;
     m_end = m_front_cap;
     m_back_cap = m_front_cap + sz;
@@ -230,11 +257,15 @@ void split_buffer<T, Alloc>::shrink_to_fit() noexcept {
   size_type cap = this->capacity();
   size_type sz = this->size();
   if (cap > sz) {
+    trace::span timed(
+      trace::event_kind::shrink, "split_buffer", sizeof(value_type), sz, cap, sz
+    );
     split_buffer<value_type, alloc_rr &> sb(sz, 0, m_alloc);
     if (sb.capacity() < cap) {
       sb.construct_at_end(
         std::make_move_iterator(m_begin), std::make_move_iterator(m_end)
       );
+      this->note_reallocation(cap, sz, sz * sizeof(value_type));
       this->swap_without_alloc(sb);
     }
   }
@@ -246,17 +277,22 @@ template <class... Args>
 void split_buffer<T, Alloc>::emplace_front(Args &&...args) {
   if (this->front_spare() == 0) {
     difference_type d = this->back_spare();
-    if (d > 0) {
+    if (this->slide_pays_off(d)) {
       d = (d + 1) / 2;
-      pointer new_end = m_end + d;
-      m_begin = std::move_backward(m_begin, m_end, new_end);
-      m_end = new_end;
+      this->slide_to(m_begin + d);
     } else {
       size_type sz = std::max<size_type>(2 * this->capacity(), 1);
+      trace::span timed(
+        trace::event_kind::grow, "split_buffer", sizeof(value_type),
+        this->size(), this->capacity(), sz
+      );
       split_buffer<value_type, alloc_rr &> sb(sz, (sz + 3) / 4, m_alloc);
       sb.construct_at_end(
         std::make_move_iterator(m_begin), std::make_move_iterator(m_end)
       );
+      this->note_reallocation(
+        this->capacity(), sz, this->size() * sizeof(value_type)
+      );
       this->swap_without_alloc(sb);
     }
   }
@@ -272,17 +308,22 @@ template <class... Args>
 void split_buffer<T, Alloc>::emplace_back(Args &&...args) {
   if (this->back_spare() == 0) {
     difference_type d = this->front_spare();
-    if (this->front_spare() > 0) {
+    if (this->slide_pays_off(d)) {
       d = (d + 1) / 2;
-      pointer new_begin = m_begin - d;
-      m_end = std::move(m_begin, m_end, new_begin);
-      m_begin = new_begin;
+      this->slide_to(m_begin - d);
     } else {
       size_type sz = std::max<size_type>(2 * this->capacity(), 1);
+      trace::span timed(
+        trace::event_kind::grow, "split_buffer", sizeof(value_type),
+        this->size(), this->capacity(), sz
+      );
       split_buffer<value_type, alloc_rr &> sb(sz, sz / 4, m_alloc);
       sb.construct_at_end(
         std::make_move_iterator(m_begin), std::make_move_iterator(m_end)
       );
+      this->note_reallocation(
+        this->capacity(), sz, this->size() * sizeof(value_type)
+      );
       this->swap_without_alloc(sb);
     }
   }
@@ -293,6 +334,42 @@ void split_buffer<T, Alloc>::emplace_back(Args &&...args) {
   ++m_end;
 }
 
+// Moves the elements within the buffer so that they start at new_begin.
+// The slots they move into are raw storage, so each element is constructed
+// at its new place and the old one destroyed, walking away from the
+// overlap; assigning into those slots is only valid for trivial types.
+template <class T, class Alloc>
+void split_buffer<T, Alloc>::slide_to(pointer new_begin) {
+  const difference_type n = m_end - m_begin;
+  trace::span timed(
+    trace::event_kind::relocate, "split_buffer", sizeof(value_type),
+    static_cast<size_type>(n), this->capacity(), this->capacity()
+  );
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    if (new_begin < m_begin) {
+      std::move(m_begin, m_end, new_begin);
+    } else {
+      std::move_backward(m_begin, m_end, new_begin + n);
+    }
+  } else if (new_begin < m_begin) {
+    for (difference_type i = 0; i < n; ++i) {
+      alloc_traits::construct(
+        m_alloc, std::to_address(new_begin + i), std::move(m_begin[i])
+      );
+      alloc_traits::destroy(m_alloc, std::to_address(m_begin + i));
+    }
+  } else {
+    for (difference_type i = n; i-- > 0;) {
+      alloc_traits::construct(
+        m_alloc, std::to_address(new_begin + i), std::move(m_begin[i])
+      );
+      alloc_traits::destroy(m_alloc, std::to_address(m_begin + i));
+    }
+  }
+  m_begin = new_begin;
+  m_end = new_begin + n;
+}
+
 template <class T, class Alloc>
 void split_buffer<T, Alloc>::pop_front() {
   this->destruct_at_begin(m_begin + 1);
@@ -361,8 +438,9 @@ void split_buffer<T, Alloc>::construct_at_end(size_type n, const_reference x) {
 }
 
 template <class T, class Alloc>
-template <std::forward_iterator ForwardIter>
-  requires std::constructible_from<T, std::iter_reference_t<ForwardIter>>
+template <std::input_iterator ForwardIter>
+  requires detail::multipass_iterator<ForwardIter> &&
+           std::constructible_from<T, std::iter_reference_t<ForwardIter>>
 void split_buffer<T, Alloc>::construct_at_end(
   ForwardIter first, ForwardIter last
 ) {
@@ -378,7 +456,11 @@ void split_buffer<T, Alloc>::construct_at_end_with_sentinel(
     if (this->back_spare() == 0) {
       size_type old_cap = this->capacity();
       size_type new_cap = std::max<size_type>(2 * old_cap, 8);
-      split_buffer buf(new_cap, 0, m_alloc);
+      trace::span timed(
+        trace::event_kind::grow, "split_buffer", sizeof(value_type),
+        this->size(), old_cap, new_cap
+      );
+      split_buffer<value_type, alloc_rr &> buf(new_cap, 0, m_alloc);
 
       for (pointer p = m_begin; p != m_end; ++p) {
         alloc_traits::construct(
@@ -386,7 +468,10 @@ void split_buffer<T, Alloc>::construct_at_end_with_sentinel(
         );
         ++buf.m_end;
       }
-      this->swap(buf);
+      this->note_reallocation(
+        old_cap, new_cap, this->size() * sizeof(value_type)
+      );
+      this->swap_without_alloc(buf);
     }
 
     alloc_traits::construct(m_alloc, std::to_address(m_end), *first);
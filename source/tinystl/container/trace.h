@@ -0,0 +1,160 @@
+#pragma once
+
+// Trace hooks on the container paths that allocate or move many elements:
+// growing, shrinking, relocating in place and bulk copies. Each hook reports
+// one event with the sizes involved and how long the operation took.
+//
+// Tracing is off unless TINYSTL_ENABLE_TRACING is defined; then a hook is an
+// empty object and the containers compile as if it were not there. When on,
+// events go to the backend named by TINYSTL_TRACE_BACKEND, a type with
+//
+//   static void record(const tinystl::trace::event &) noexcept;
+//
+// (for example one that fires a USDT probe or forwards to an existing
+// tracer), or by default to ring_backend, which keeps them in a lock-free
+// in-memory queue for offline analysis. The backend must not allocate from
+// a traced container, or it would trace itself. Bulk copies smaller than
+// TINYSTL_TRACE_MIN_COPY_BYTES (4 KiB by default) are not reported.
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(TINYSTL_ENABLE_TRACING) && !defined(TINYSTL_TRACE_BACKEND)
+#include <atomic>
+
+#include "tinystl/concurrent/bounded_queue.h"
+#endif
+
+namespace tinystl::trace {
+
+inline constexpr bool enabled =
+#if defined(TINYSTL_ENABLE_TRACING)
+  true;
+#else
+  false;
+#endif
+
+enum class event_kind : std::uint8_t {
+  grow,      // storage replaced by a larger buffer
+  shrink,    // storage replaced by a smaller buffer
+  relocate,  // elements moved within the same buffer
+  bulk_copy, // a whole container copied into new storage
+};
+
+// Capacities and the element count are in elements; elements is how many
+// the operation moved or copied. Times are steady_clock nanoseconds.
+struct event {
+  event_kind kind;
+  const char *container;
+  std::size_t element_size;
+  std::size_t elements;
+  std::size_t old_capacity;
+  std::size_t new_capacity;
+  std::uint64_t start_ns;
+  std::uint64_t duration_ns;
+
+  std::size_t bytes() const noexcept { return elements * element_size; }
+};
+
+#if !defined(TINYSTL_TRACE_MIN_COPY_BYTES)
+#define TINYSTL_TRACE_MIN_COPY_BYTES 4096
+#endif
+
+#if defined(TINYSTL_ENABLE_TRACING) && !defined(TINYSTL_TRACE_BACKEND)
+#if !defined(TINYSTL_TRACE_RING_CAPACITY)
+#define TINYSTL_TRACE_RING_CAPACITY 16384
+#endif
+
+// Events from every thread land in one bounded MPSC queue that is allocated
+// on first use. When it is full, new events are dropped and counted rather
+// than blocking the container; drain it from one thread at a time.
+class ring_backend {
+public:
+  static void record(const event &e) noexcept {
+    if (!queue().try_push(e)) {
+      s_dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  // Calls f(event) for every buffered event, oldest first; returns how many.
+  template <class F>
+  static std::size_t drain(F f) {
+    std::size_t n = 0;
+    event e;
+    while (queue().try_pop(e)) {
+      f(e);
+      ++n;
+    }
+    return n;
+  }
+
+  static std::size_t dropped() noexcept {
+    return s_dropped.load(std::memory_order_relaxed);
+  }
+
+private:
+  static mpsc_queue<event> &queue() {
+    static mpsc_queue<event> q(TINYSTL_TRACE_RING_CAPACITY);
+    return q;
+  }
+
+  static inline std::atomic<std::size_t> s_dropped{0};
+};
+
+using backend = ring_backend;
+#elif defined(TINYSTL_ENABLE_TRACING)
+using backend = TINYSTL_TRACE_BACKEND;
+#endif
+
+// Times the enclosing operation and reports it when it goes out of scope.
+// The element count can be corrected before then, once it is known.
+class span {
+public:
+#if defined(TINYSTL_ENABLE_TRACING)
+  span(
+    event_kind kind, const char *container, std::size_t element_size,
+    std::size_t elements, std::size_t old_capacity, std::size_t new_capacity
+  ) noexcept
+    : m_event{kind,         container,    element_size, elements,
+              old_capacity, new_capacity, now(),        0} {}
+
+  span(const span &) = delete;
+  span &operator=(const span &) = delete;
+
+  ~span() {
+    if (m_event.kind == event_kind::bulk_copy &&
+        m_event.bytes() < TINYSTL_TRACE_MIN_COPY_BYTES) {
+      return;
+    }
+    m_event.duration_ns = now() - m_event.start_ns;
+    backend::record(m_event);
+  }
+
+  void set_elements(std::size_t n) noexcept { m_event.elements = n; }
+
+private:
+  static std::uint64_t now() noexcept {
+    return static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()
+      )
+        .count()
+    );
+  }
+
+  event m_event;
+#else
+  constexpr span(
+    event_kind, const char *, std::size_t, std::size_t, std::size_t,
+    std::size_t
+  ) noexcept {}
+
+  span(const span &) = delete;
+  span &operator=(const span &) = delete;
+
+  constexpr void set_elements(std::size_t) noexcept {}
+#endif
+};
+
+} // namespace tinystl::trace
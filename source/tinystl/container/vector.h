@@ -1,16 +1,46 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
+#include <cassert>
 #include <concepts>
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "tinystl/algorithm/compare.h"
+#include "tinystl/algorithm/parallel.h"
+#include "tinystl/algorithm/remove.h"
+#include "tinystl/container/introspection.h"
+#include "tinystl/container/slow_path.h"
+#include "tinystl/container/trace.h"
+#include "tinystl/execution/execution.h"
+#include "tinystl/iterator/concepts.h"
 
 namespace tinystl {
 
+namespace detail {
+
+// Copying [first, first + n) into raw storage can be a single block copy:
+// the elements are trivially copyable, laid out contiguously, and Alloc
+// leaves construction to the default placement new.
+template <class Iter, class T, class Alloc>
+concept bitwise_copyable_range =
+  std::is_trivially_copyable_v<T> && std::contiguous_iterator<Iter> &&
+  std::same_as<std::iter_value_t<Iter>, T> &&
+  !requires(Alloc &alloc, T *p, std::iter_reference_t<Iter> ref) {
+    alloc.construct(p, ref);
+  };
+
+} // namespace detail
+
 template <class T, class Alloc = std::allocator<T>>
-class vector {
+class vector : public introspection::tracked<vector<T, Alloc>> {
   using alloc_traits = std::allocator_traits<Alloc>;
 
 public:
@@ -37,12 +67,13 @@ public:
   explicit vector(const Alloc &alloc) noexcept;
   explicit vector(size_type n, const Alloc &alloc = Alloc());
   vector(size_type n, const_reference val, const Alloc &alloc = Alloc());
-  template <std::forward_iterator ForwardIter>
-    requires std::constructible_from<T, std::iter_reference_t<ForwardIter>>
+  template <std::input_iterator ForwardIter>
+    requires detail::multipass_iterator<ForwardIter> &&
+             std::constructible_from<T, std::iter_reference_t<ForwardIter>>
   vector(ForwardIter first, ForwardIter last, const Alloc &alloc = Alloc());
   template <std::input_iterator InputIter>
     requires std::constructible_from<T, std::iter_reference_t<InputIter>> &&
-             (!std::forward_iterator<InputIter>) &&
+             (!detail::multipass_iterator<InputIter>) &&
              (std::movable<T> || std::copyable<T>)
   vector(InputIter first, InputIter last, const Alloc &alloc = Alloc());
   vector(const vector &other);
@@ -51,6 +82,26 @@ public:
   vector(vector &&other, const Alloc &alloc);
   vector(std::initializer_list<value_type> init, const Alloc &alloc = Alloc());
 
+  // Bulk constructors that split element construction across the policy's
+  // pool, so each thread also first-touches (and on NUMA systems places)
+  // the pages it writes. If an element constructor throws, exactly the
+  // elements built so far are destroyed before the exception propagates.
+  template <execution_policy ExecutionPolicy>
+  vector(ExecutionPolicy &&policy, size_type n, const Alloc &alloc = Alloc());
+  template <execution_policy ExecutionPolicy>
+  vector(
+    ExecutionPolicy &&policy, size_type n, const_reference val,
+    const Alloc &alloc = Alloc()
+  );
+  template <execution_policy ExecutionPolicy, std::random_access_iterator RandomIter>
+    requires std::constructible_from<T, std::iter_reference_t<RandomIter>>
+  vector(
+    ExecutionPolicy &&policy, RandomIter first, RandomIter last,
+    const Alloc &alloc = Alloc()
+  );
+  template <execution_policy ExecutionPolicy>
+  vector(ExecutionPolicy &&policy, const vector &other);
+
   ~vector();
 
   vector &operator=(const vector &other);
@@ -58,14 +109,20 @@ public:
   vector &operator=(std::initializer_list<value_type> init);
 
   void assign(size_type n, const_reference val);
-  template <std::forward_iterator ForwardIter>
-    requires std::constructible_from<T, std::iter_reference_t<ForwardIter>>
+  template <std::input_iterator ForwardIter>
+    requires detail::multipass_iterator<ForwardIter> &&
+             std::constructible_from<T, std::iter_reference_t<ForwardIter>>
   void assign(ForwardIter first, ForwardIter last);
   template <std::input_iterator InputIter>
     requires std::constructible_from<T, std::iter_reference_t<InputIter>> &&
-             (!std::forward_iterator<InputIter>)
+             (!detail::multipass_iterator<InputIter>)
   void assign(InputIter first, InputIter last);
   void assign(std::initializer_list<value_type> ilist);
+  template <execution_policy ExecutionPolicy>
+  void assign(ExecutionPolicy &&policy, size_type n, const_reference val);
+  template <execution_policy ExecutionPolicy, std::random_access_iterator RandomIter>
+    requires std::constructible_from<T, std::iter_reference_t<RandomIter>>
+  void assign(ExecutionPolicy &&policy, RandomIter first, RandomIter last);
 
   allocator_type get_allocator() const;
 
@@ -108,12 +165,13 @@ public:
   iterator insert(const_iterator pos, const_reference val);
   iterator insert(const_iterator pos, value_type &&val);
   iterator insert(const_iterator pos, size_type n, const_reference val);
-  template <std::forward_iterator ForwardIter>
-    requires std::constructible_from<T, std::iter_reference_t<ForwardIter>>
+  template <std::input_iterator ForwardIter>
+    requires detail::multipass_iterator<ForwardIter> &&
+             std::constructible_from<T, std::iter_reference_t<ForwardIter>>
   iterator insert(const_iterator pos, ForwardIter first, ForwardIter last);
   template <std::input_iterator InputIter>
     requires std::constructible_from<T, std::iter_reference_t<InputIter>> &&
-             (!std::forward_iterator<InputIter>)
+             (!detail::multipass_iterator<InputIter>)
   iterator insert(const_iterator pos, InputIter first, InputIter last);
   iterator insert(const_iterator pos, std::initializer_list<T> init);
   template <class... Args>
@@ -133,11 +191,14 @@ public:
   );
 
 private:
-  void throw_length_error();
-  void throw_out_of_range();
+  [[noreturn]] static void throw_length_error();
+  [[noreturn]] static void throw_out_of_range();
 
   size_type recommend(size_type new_size);
 
+  template <class... Args>
+  void emplace_back_slow(Args &&...args);
+
   void allocate(size_type n);
 
   void deallocate();
@@ -146,6 +207,12 @@ private:
   void construct(size_type n, const_reference val);
   template <class InputIter, class Sentinel>
   void construct(InputIter first, Sentinel last, size_type n);
+  template <class ExecutionPolicy, class ConstructAt>
+  void parallel_construct(
+    ExecutionPolicy &policy, size_type n, ConstructAt construct_at
+  );
+  void destroy_range(pointer first, pointer last) noexcept;
+  void adopt(vector &other) noexcept;
 
   void destruct(pointer new_last);
 
@@ -160,12 +227,12 @@ private:
 
 template <class T, class Alloc>
 bool operator==(const vector<T, Alloc> &lhs, const vector<T, Alloc> &rhs) {
-  return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+  return lhs.size() == rhs.size() && tinystl::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
 
 template <class T, class Alloc>
 auto operator<=>(const vector<T, Alloc> &lhs, const vector<T, Alloc> &rhs) {
-  return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), std::compare_three_way());
+  return tinystl::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), std::compare_three_way());
 }
 
 template <class T, class Alloc>
@@ -176,14 +243,14 @@ void swap(vector<T, Alloc> &lhs, vector<T, Alloc> &rhs) noexcept {
 template <class T, class Alloc, class U>
 typename vector<T, Alloc>::size_type erase(vector<T, Alloc> &c, const U &val) {
   typename vector<T, Alloc>::size_type old_sz = c.size();
-  c.erase(std::remove(c.begin(), c.end(), val), c.end());
+  c.erase(tinystl::remove(c.begin(), c.end(), val), c.end());
   return old_sz - c.size();
 }
 
 template <class T, class Alloc, class Pred>
 typename vector<T, Alloc>::size_type erase_if(vector<T, Alloc> &c, Pred pred) {
   typename vector<T, Alloc>::size_type old_sz = c.size();
-  c.erase(std::remove_if(c.begin(), c.end(), pred), c.end());
+  c.erase(tinystl::remove_if(c.begin(), c.end(), pred), c.end());
   return old_sz - c.size();
 }
 
@@ -217,8 +284,9 @@ vector<T, Alloc>::vector(size_type n, const_reference val, const Alloc &alloc)
 }
 
 template <class T, class Alloc>
-template <std::forward_iterator ForwardIter>
-  requires std::constructible_from<T, std::iter_reference_t<ForwardIter>>
+template <std::input_iterator ForwardIter>
+  requires detail::multipass_iterator<ForwardIter> &&
+           std::constructible_from<T, std::iter_reference_t<ForwardIter>>
 vector<T, Alloc>::vector(
   ForwardIter first, ForwardIter last, const Alloc &alloc
 )
@@ -233,9 +301,10 @@ vector<T, Alloc>::vector(
 template <class T, class Alloc>
 template <std::input_iterator InputIter>
   requires std::constructible_from<T, std::iter_reference_t<InputIter>> &&
-           (!std::forward_iterator<InputIter>) &&
+           (!detail::multipass_iterator<InputIter>) &&
            (std::movable<T> || std::copyable<T>)
-vector<T, Alloc>::vector(InputIter first, InputIter last, const Alloc &alloc) {
+vector<T, Alloc>::vector(InputIter first, InputIter last, const Alloc &alloc)
+  : m_alloc(alloc) {
   for (; first != last; ++first) {
     this->emplace_back(*first);
   }
@@ -248,6 +317,9 @@ vector<T, Alloc>::vector(const vector &other)
     ) {
   size_type n = other.size();
   if (n > 0) {
+    trace::span timed(
+      trace::event_kind::bulk_copy, "vector", sizeof(value_type), n, 0, n
+    );
     this->allocate(n);
     this->construct(other.begin(), other.end(), n);
   }
@@ -258,6 +330,9 @@ vector<T, Alloc>::vector(const vector &other, const Alloc &alloc)
   : m_alloc(alloc) {
   size_type n = other.size();
   if (n > 0) {
+    trace::span timed(
+      trace::event_kind::bulk_copy, "vector", sizeof(value_type), n, 0, n
+    );
     this->allocate(n);
     this->construct(other.begin(), other.end(), n);
   }
@@ -303,6 +378,69 @@ vector<T, Alloc>::vector(
   }
 }
 
+template <class T, class Alloc>
+template <execution_policy ExecutionPolicy>
+vector<T, Alloc>::vector(
+  ExecutionPolicy &&policy, size_type n, const Alloc &alloc
+)
+  : m_alloc(alloc) {
+  if (n > 0) {
+    this->allocate(n);
+    this->parallel_construct(
+      policy, n,
+      [this](pointer p, size_type) noexcept(
+        std::is_nothrow_default_constructible_v<T>
+      ) { alloc_traits::construct(m_alloc, std::to_address(p)); }
+    );
+  }
+}
+
+template <class T, class Alloc>
+template <execution_policy ExecutionPolicy>
+vector<T, Alloc>::vector(
+  ExecutionPolicy &&policy, size_type n, const_reference val,
+  const Alloc &alloc
+)
+  : m_alloc(alloc) {
+  if (n > 0) {
+    this->allocate(n);
+    this->parallel_construct(
+      policy, n,
+      [this, &val](pointer p, size_type) noexcept(
+        std::is_nothrow_copy_constructible_v<T>
+      ) { alloc_traits::construct(m_alloc, std::to_address(p), val); }
+    );
+  }
+}
+
+template <class T, class Alloc>
+template <execution_policy ExecutionPolicy, std::random_access_iterator RandomIter>
+  requires std::constructible_from<T, std::iter_reference_t<RandomIter>>
+vector<T, Alloc>::vector(
+  ExecutionPolicy &&policy, RandomIter first, RandomIter last,
+  const Alloc &alloc
+)
+  : m_alloc(alloc) {
+  size_type n = static_cast<size_type>(last - first);
+  if (n > 0) {
+    this->allocate(n);
+    this->parallel_construct(
+      policy, n,
+      [this, first](pointer p, size_type i) noexcept(
+        std::is_nothrow_constructible_v<T, std::iter_reference_t<RandomIter>>
+      ) { alloc_traits::construct(m_alloc, std::to_address(p), first[i]); }
+    );
+  }
+}
+
+template <class T, class Alloc>
+template <execution_policy ExecutionPolicy>
+vector<T, Alloc>::vector(ExecutionPolicy &&policy, const vector &other)
+  : vector(
+      policy, other.begin(), other.end(),
+      alloc_traits::select_on_container_copy_construction(other.m_alloc)
+    ) {}
+
 /* ------------------------------- destructor ------------------------------- */
 template <class T, class Alloc>
 vector<T, Alloc>::~vector() {
@@ -325,6 +463,10 @@ vector<T, Alloc> &vector<T, Alloc>::operator=(const vector &other) {
       m_alloc = other.m_alloc;
     }
 
+    trace::span timed(
+      trace::event_kind::bulk_copy, "vector", sizeof(value_type), other.size(),
+      this->capacity(), std::max(this->capacity(), other.size())
+    );
     this->assign(other.begin(), other.end());
   }
 
@@ -333,7 +475,13 @@ vector<T, Alloc> &vector<T, Alloc>::operator=(const vector &other) {
 
 template <class T, class Alloc>
 vector<T, Alloc> &vector<T, Alloc>::operator=(vector &&other) {
+  if (this == std::addressof(other)) {
+    return *this;
+  }
+
   if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+    // Release the old buffer with the allocator that obtained it.
+    this->clear();
     this->deallocate();
     m_alloc = std::move(other.m_alloc);
     this->m_begin = other.m_begin;
@@ -347,11 +495,7 @@ vector<T, Alloc> &vector<T, Alloc>::operator=(vector &&other) {
         std::make_move_iterator(other.end())
       );
     } else {
-      this->deallocate();
-      this->m_begin = other.m_begin;
-      this->m_end = other.m_end;
-      this->m_cap = other.m_cap;
-      other.m_begin = other.m_end = other.m_cap = nullptr;
+      this->adopt(other);
     }
   }
 
@@ -377,16 +521,18 @@ void vector<T, Alloc>::assign(size_type n, const_reference val) {
       this->destruct(m_begin + n);
     }
   } else {
-    this->destruct(m_begin);
-    this->deallocate();
-    this->allocate(this->recommend(n));
-    this->construct(n, val);
+    // Fill a fresh buffer before releasing the old one, which val may be in.
+    vector tmp(m_alloc);
+    tmp.allocate(this->recommend(n));
+    tmp.construct(n, val);
+    this->adopt(tmp);
   }
 }
 
 template <class T, class Alloc>
-template <std::forward_iterator ForwardIter>
-  requires std::constructible_from<T, std::iter_reference_t<ForwardIter>>
+template <std::input_iterator ForwardIter>
+  requires detail::multipass_iterator<ForwardIter> &&
+           std::constructible_from<T, std::iter_reference_t<ForwardIter>>
 void vector<T, Alloc>::assign(ForwardIter first, ForwardIter last) {
   size_type n = static_cast<size_type>(std::distance(first, last));
   if (n <= this->capacity()) {
@@ -410,7 +556,7 @@ void vector<T, Alloc>::assign(ForwardIter first, ForwardIter last) {
 template <class T, class Alloc>
 template <std::input_iterator InputIter>
   requires std::constructible_from<T, std::iter_reference_t<InputIter>> &&
-           (!std::forward_iterator<InputIter>)
+           (!detail::multipass_iterator<InputIter>)
 void vector<T, Alloc>::assign(InputIter first, InputIter last) {
   pointer cur = m_begin;
   for (; cur != m_end && first != last; ++cur, ++first) {
@@ -431,6 +577,51 @@ void vector<T, Alloc>::assign(std::initializer_list<value_type> init) {
   assign(init.begin(), init.end());
 }
 
+// Reuses the buffer when it is large enough; otherwise the new contents are
+// built in a fresh buffer first, which also keeps val alive if it refers to
+// an element of this vector.
+template <class T, class Alloc>
+template <execution_policy ExecutionPolicy>
+void vector<T, Alloc>::assign(
+  ExecutionPolicy &&policy, size_type n, const_reference val
+) {
+  const T *addr = std::addressof(val);
+  bool aliases = addr >= std::to_address(m_begin) && addr < std::to_address(m_end);
+  if (n > this->capacity() || aliases) {
+    vector tmp(policy, n, val, m_alloc);
+    this->adopt(tmp);
+  } else {
+    this->clear();
+    this->parallel_construct(
+      policy, n,
+      [this, &val](pointer p, size_type) noexcept(
+        std::is_nothrow_copy_constructible_v<T>
+      ) { alloc_traits::construct(m_alloc, std::to_address(p), val); }
+    );
+  }
+}
+
+template <class T, class Alloc>
+template <execution_policy ExecutionPolicy, std::random_access_iterator RandomIter>
+  requires std::constructible_from<T, std::iter_reference_t<RandomIter>>
+void vector<T, Alloc>::assign(
+  ExecutionPolicy &&policy, RandomIter first, RandomIter last
+) {
+  size_type n = static_cast<size_type>(last - first);
+  if (n > this->capacity()) {
+    vector tmp(policy, first, last, m_alloc);
+    this->adopt(tmp);
+  } else {
+    this->clear();
+    this->parallel_construct(
+      policy, n,
+      [this, first](pointer p, size_type i) noexcept(
+        std::is_nothrow_constructible_v<T, std::iter_reference_t<RandomIter>>
+      ) { alloc_traits::construct(m_alloc, std::to_address(p), first[i]); }
+    );
+  }
+}
+
 /* ----------------------------- element access ----------------------------- */
 template <class T, class Alloc>
 Alloc vector<T, Alloc>::get_allocator() const {
@@ -593,13 +784,20 @@ vector<T, Alloc>::max_size() const noexcept {
 }
 
 template <class T, class Alloc>
-void vector<T, Alloc>::reserve(size_type n) {
+TINYSTL_SIZE_NOINLINE void vector<T, Alloc>::reserve(size_type n) {
   if (n > this->capacity()) {
     if (n > this->max_size()) {
       this->throw_length_error();
     }
 
+    trace::span timed(
+      trace::event_kind::grow, "vector", sizeof(value_type), this->size(),
+      this->capacity(), n
+    );
     pointer new_begin = alloc_traits::allocate(m_alloc, n);
+    this->note_reallocation(
+      this->capacity(), n, this->size() * sizeof(value_type)
+    );
     pointer new_end = new_begin;
     pointer new_cap = new_begin + n;
 
@@ -627,7 +825,7 @@ vector<T, Alloc>::capacity() const noexcept {
 }
 
 template <class T, class Alloc>
-void vector<T, Alloc>::shrink_to_fit() {
+TINYSTL_SIZE_NOINLINE void vector<T, Alloc>::shrink_to_fit() {
   if (this->capacity() > this->size()) {
     size_type sz = this->size();
     if (sz == 0) {
@@ -635,7 +833,14 @@ void vector<T, Alloc>::shrink_to_fit() {
       return;
     }
 
+    trace::span timed(
+      trace::event_kind::shrink, "vector", sizeof(value_type), this->size(),
+      this->capacity(), sz
+    );
     pointer new_begin = alloc_traits::allocate(m_alloc, sz);
+    this->note_reallocation(
+      this->capacity(), sz, this->size() * sizeof(value_type)
+    );
     pointer new_end = new_begin;
     pointer new_cap = new_begin + sz;
 
@@ -669,31 +874,36 @@ vector<T, Alloc>::insert(const_iterator pos, const_reference val) {
     if (p == m_end) {
       this->construct(1, val);
     } else {
-      this->move_to_insert(p, m_end, p + 1);
-
-      const_pointer pval = std::pointer_traits<pointer>::pointer_to(val);
-      const_pointer pp = std::to_address(p);
-      const_pointer pend = std::to_address(m_end);
-      if (!(pp <= pval && pval < pend)) {
+      // val may be an element at or after p, which moves up one slot.
+      const value_type *pval = std::addressof(val);
+      if (std::to_address(p) <= pval && pval < std::to_address(m_end)) {
         pval += 1;
       }
 
-      *p = val;
+      this->move_to_insert(p, m_end, p + 1);
+      *p = *pval;
     }
   } else {
     size_type sz = this->recommend(this->size() + 1);
+    trace::span timed(
+      trace::event_kind::grow, "vector", sizeof(value_type), this->size(),
+      this->capacity(), sz
+    );
     pointer new_begin = alloc_traits::allocate(m_alloc, sz);
-    pointer new_end = new_begin;
+    this->note_reallocation(
+      this->capacity(), sz, this->size() * sizeof(value_type)
+    );
     pointer new_cap = new_begin + sz;
 
+    // val may be an element that is about to move, so copy it first.
+    alloc_traits::construct(m_alloc, new_begin + offset, val);
+
     if constexpr (std::is_nothrow_move_constructible_v<value_type>) {
-      new_end = std::uninitialized_move(m_begin, p, new_begin);
+      std::uninitialized_move(m_begin, p, new_begin);
     } else {
-      new_end = std::uninitialized_copy(m_begin, p, new_begin);
+      std::uninitialized_copy(m_begin, p, new_begin);
     }
-
-    alloc_traits::construct(m_alloc, new_end, val);
-    ++new_end;
+    pointer new_end = new_begin + offset + 1;
 
     if constexpr (std::is_nothrow_move_constructible_v<value_type>) {
       new_end = std::uninitialized_move(p, m_end, new_end);
@@ -729,18 +939,24 @@ vector<T, Alloc>::insert(const_iterator pos, value_type &&val) {
     }
   } else {
     size_type sz = this->recommend(this->size() + 1);
+    trace::span timed(
+      trace::event_kind::grow, "vector", sizeof(value_type), this->size(),
+      this->capacity(), sz
+    );
     pointer new_begin = alloc_traits::allocate(m_alloc, sz);
-    pointer new_end = new_begin;
+    this->note_reallocation(
+      this->capacity(), sz, this->size() * sizeof(value_type)
+    );
     pointer new_cap = new_begin + sz;
 
+    alloc_traits::construct(m_alloc, new_begin + offset, std::move(val));
+
     if constexpr (std::is_nothrow_move_constructible_v<value_type>) {
-      new_end = std::uninitialized_move(m_begin, p, new_begin);
+      std::uninitialized_move(m_begin, p, new_begin);
     } else {
-      new_end = std::uninitialized_copy(m_begin, p, new_begin);
+      std::uninitialized_copy(m_begin, p, new_begin);
     }
-
-    alloc_traits::construct(m_alloc, new_end, std::move(val));
-    ++new_end;
+    pointer new_end = new_begin + offset + 1;
 
     if constexpr (std::is_nothrow_move_constructible_v<value_type>) {
       new_end = std::uninitialized_move(p, m_end, new_end);
@@ -777,32 +993,37 @@ vector<T, Alloc>::insert(const_iterator pos, size_type n, const_reference val) {
       }
 
       if (n > 0) {
-        this->move_to_insert(p, old_end, p + old_n);
-
-        const_pointer pval = std::pointer_traits<const_pointer>::pointer_to(val);
-        const_pointer pp = std::to_address(p);
-        const_pointer pend = std::to_address(m_end);
-        if (!(pp <= pval && pval < pend)) {
+        const value_type *pval = std::addressof(val);
+        if (std::to_address(p) <= pval && pval < std::to_address(old_end)) {
           pval += old_n;
         }
+
+        this->move_to_insert(p, old_end, p + old_n);
         std::fill_n(p, n, *pval);
       }
     } else {
       size_type sz = this->recommend(this->size() + n);
+      trace::span timed(
+        trace::event_kind::grow, "vector", sizeof(value_type), this->size(),
+        this->capacity(), sz
+      );
       pointer new_begin = alloc_traits::allocate(m_alloc, sz);
-      pointer new_end = new_begin;
+      this->note_reallocation(
+        this->capacity(), sz, this->size() * sizeof(value_type)
+      );
       pointer new_cap = new_begin + sz;
 
-      if constexpr (std::is_nothrow_move_constructible_v<value_type>) {
-        new_end = std::uninitialized_move(m_begin, p, new_begin);
-      } else {
-        new_end = std::uninitialized_copy(m_begin, p, new_begin);
+      // val may be an element that is about to move, so copy it first.
+      for (size_type i = 0; i < n; ++i) {
+        alloc_traits::construct(m_alloc, new_begin + offset + i, val);
       }
 
-      for (size_type i = 0; i < n; ++i) {
-        alloc_traits::construct(m_alloc, new_end, val);
-        ++new_end;
+      if constexpr (std::is_nothrow_move_constructible_v<value_type>) {
+        std::uninitialized_move(m_begin, p, new_begin);
+      } else {
+        std::uninitialized_copy(m_begin, p, new_begin);
       }
+      pointer new_end = new_begin + offset + n;
 
       if constexpr (std::is_nothrow_move_constructible_v<value_type>) {
         new_end = std::uninitialized_move(p, m_end, new_end);
@@ -825,8 +1046,9 @@ vector<T, Alloc>::insert(const_iterator pos, size_type n, const_reference val) {
 }
 
 template <class T, class Alloc>
-template <std::forward_iterator ForwardIter>
-  requires std::constructible_from<T, std::iter_reference_t<ForwardIter>>
+template <std::input_iterator ForwardIter>
+  requires detail::multipass_iterator<ForwardIter> &&
+           std::constructible_from<T, std::iter_reference_t<ForwardIter>>
 typename vector<T, Alloc>::iterator vector<T, Alloc>::insert(
   const_iterator pos, ForwardIter first, ForwardIter last
 ) {
@@ -835,22 +1057,30 @@ typename vector<T, Alloc>::iterator vector<T, Alloc>::insert(
 
   difference_type n = std::distance(first, last);
   if (n > 0) {
-    if (n <= static_cast<size_type>(m_cap - m_end)) {
+    if (n <= m_cap - m_end) {
       pointer old_end = m_end;
+      difference_type old_n = n;
 
-      size_type dx = static_cast<size_type>(m_end - p);
+      difference_type dx = m_end - p;
       if (n > dx) {
         ForwardIter m = std::next(first, dx);
-        this->construct(m, last, n - dx);
+        this->construct(m, last, static_cast<size_type>(n - dx));
         n = dx;
       }
       if (n > 0) {
-        this->move_to_insert(p, old_end, p + n);
+        this->move_to_insert(p, old_end, p + old_n);
         std::copy_n(first, n, p);
       }
     } else {
       size_type sz = this->recommend(this->size() + n);
+      trace::span timed(
+        trace::event_kind::grow, "vector", sizeof(value_type), this->size(),
+        this->capacity(), sz
+      );
       pointer new_begin = alloc_traits::allocate(m_alloc, sz);
+      this->note_reallocation(
+        this->capacity(), sz, this->size() * sizeof(value_type)
+      );
       pointer new_end = new_begin;
       pointer new_cap = new_begin + sz;
 
@@ -889,23 +1119,21 @@ typename vector<T, Alloc>::iterator vector<T, Alloc>::insert(
 template <class T, class Alloc>
 template <std::input_iterator InputIter>
   requires std::constructible_from<T, std::iter_reference_t<InputIter>> &&
-           (!std::forward_iterator<InputIter>)
+           (!detail::multipass_iterator<InputIter>)
 typename vector<T, Alloc>::iterator
 vector<T, Alloc>::insert(const_iterator pos, InputIter first, InputIter last) {
   difference_type offset = std::distance(this->cbegin(), pos);
-  pointer p = m_begin + offset;
 
-  pointer old_end = m_end;
+  // Appending may reallocate, so the split point is kept as an offset.
+  difference_type old_size = m_end - m_begin;
 
   for (; first != last; ++first) {
     this->emplace_back(*first);
   }
 
-  std::rotate(p, old_end, m_end);
-
-  p = m_begin + offset;
+  std::rotate(m_begin + offset, m_begin + old_size, m_end);
 
-  return iterator(p);
+  return iterator(m_begin + offset);
 }
 
 template <class T, class Alloc>
@@ -925,23 +1153,35 @@ vector<T, Alloc>::emplace(const_iterator pos, Args &&...args) {
       alloc_traits::construct(m_alloc, p, std::forward<Args>(args)...);
       ++m_end;
     } else {
+      // Build the value before the shift: p holds a live element, and args
+      // may refer to one that is about to move.
+      value_type tmp(std::forward<Args>(args)...);
       this->move_to_insert(p, m_end, p + 1);
-      alloc_traits::construct(m_alloc, p, std::forward<Args>(args)...);
+      *p = std::move(tmp);
     }
   } else {
     size_type sz = this->recommend(this->size() + 1);
+    trace::span timed(
+      trace::event_kind::grow, "vector", sizeof(value_type), this->size(),
+      this->capacity(), sz
+    );
     pointer new_begin = alloc_traits::allocate(m_alloc, sz);
-    pointer new_end = new_begin;
+    this->note_reallocation(
+      this->capacity(), sz, this->size() * sizeof(value_type)
+    );
     pointer new_cap = new_begin + sz;
 
+    // args may refer to an element that is about to move: construct first.
+    alloc_traits::construct(
+      m_alloc, new_begin + offset, std::forward<Args>(args)...
+    );
+
     if constexpr (std::is_nothrow_move_constructible_v<value_type>) {
-      new_end = std::uninitialized_move(m_begin, p, new_begin);
+      std::uninitialized_move(m_begin, p, new_begin);
     } else {
-      new_end = std::uninitialized_copy(m_begin, p, new_begin);
+      std::uninitialized_copy(m_begin, p, new_begin);
     }
-
-    alloc_traits::construct(m_alloc, new_end, std::forward<Args>(args)...);
-    ++new_end;
+    pointer new_end = new_begin + offset + 1;
 
     if constexpr (std::is_nothrow_move_constructible_v<value_type>) {
       new_end = std::uninitialized_move(p, m_end, new_end);
@@ -1004,26 +1244,7 @@ vector<T, Alloc>::emplace_back(Args &&...args) {
     alloc_traits::construct(m_alloc, std::to_address(m_end), std::forward<Args>(args)...);
     ++m_end;
   } else {
-    size_type sz = this->recommend(this->size() + 1);
-    pointer new_begin = alloc_traits::allocate(m_alloc, sz);
-    pointer new_end = new_begin;
-    pointer new_cap = new_begin + sz;
-
-    if constexpr (std::is_move_constructible_v<value_type>) {
-      new_end = std::uninitialized_move(m_begin, m_end, new_begin);
-    } else {
-      new_end = std::uninitialized_copy(m_begin, m_end, new_begin);
-    }
-
-    alloc_traits::construct(m_alloc, new_end, std::forward<Args>(args)...);
-    ++new_end;
-
-    this->destruct(m_begin);
-    this->deallocate();
-
-    m_begin = new_begin;
-    m_end = new_end;
-    m_cap = new_cap;
+    this->emplace_back_slow(std::forward<Args>(args)...);
   }
 
   return *(m_end - 1);
@@ -1045,7 +1266,14 @@ void vector<T, Alloc>::resize(size_type new_sz) {
       this->construct(n);
     } else {
       size_type sz = this->recommend(this->size() + n);
+      trace::span timed(
+        trace::event_kind::grow, "vector", sizeof(value_type), this->size(),
+        this->capacity(), sz
+      );
       pointer new_begin = alloc_traits::allocate(m_alloc, sz);
+      this->note_reallocation(
+        this->capacity(), sz, this->size() * sizeof(value_type)
+      );
       pointer new_end = new_begin;
       pointer new_cap = new_begin + sz;
 
@@ -1082,20 +1310,28 @@ void vector<T, Alloc>::resize(size_type new_sz, const_reference val) {
       this->construct(n, val);
     } else {
       size_type sz = this->recommend(this->size() + n);
+      trace::span timed(
+        trace::event_kind::grow, "vector", sizeof(value_type), this->size(),
+        this->capacity(), sz
+      );
       pointer new_begin = alloc_traits::allocate(m_alloc, sz);
-      pointer new_end = new_begin;
+      this->note_reallocation(
+        this->capacity(), sz, this->size() * sizeof(value_type)
+      );
       pointer new_cap = new_begin + sz;
+      pointer old_end = new_begin + this->size();
 
-      if constexpr (std::is_move_constructible_v<value_type>) {
-        new_end = std::uninitialized_move(m_begin, m_end, new_begin);
-      } else {
-        new_end = std::uninitialized_copy(m_begin, m_end, new_begin);
+      // val may be an element that is about to move, so copy it first.
+      for (size_type i = 0; i < n; ++i) {
+        alloc_traits::construct(m_alloc, old_end + i, val);
       }
 
-      for (size_type i = 0; i < n; ++i) {
-        alloc_traits::construct(m_alloc, new_end, val);
-        ++new_end;
+      if constexpr (std::is_move_constructible_v<value_type>) {
+        std::uninitialized_move(m_begin, m_end, new_begin);
+      } else {
+        std::uninitialized_copy(m_begin, m_end, new_begin);
       }
+      pointer new_end = old_end + n;
 
       this->destruct(m_begin);
       this->deallocate();
@@ -1134,28 +1370,68 @@ void vector<T, Alloc>::swap(vector &other) noexcept(
 /* -------------------------------------------------------------------------- */
 template <class T, class Alloc>
 void vector<T, Alloc>::throw_length_error() {
-  throw std::length_error("vector");
+  detail::throw_length_error("vector");
 }
 
 template <class T, class Alloc>
 void vector<T, Alloc>::throw_out_of_range() {
-  throw std::out_of_range("vector");
+  detail::throw_out_of_range("vector");
 }
 
 template <class T, class Alloc>
 typename vector<T, Alloc>::size_type
 vector<T, Alloc>::recommend(size_type new_size) {
-  const size_type max_size = this->max_size();
-  if (new_size > max_size) {
-    this->throw_length_error();
+  return static_cast<size_type>(detail::recommend_capacity(
+    this->capacity(), new_size, this->max_size(), "vector"
+  ));
+}
+
+// The reallocating half of emplace_back, kept apart so the fast path stays
+// small enough to inline. The new element is constructed before the old
+// ones move, since args may refer to one of them.
+template <class T, class Alloc>
+template <class... Args>
+TINYSTL_SIZE_NOINLINE void vector<T, Alloc>::emplace_back_slow(Args &&...args) {
+  size_type sz = this->recommend(this->size() + 1);
+  trace::span timed(
+    trace::event_kind::grow, "vector", sizeof(value_type), this->size(),
+    this->capacity(), sz
+  );
+  pointer new_begin = alloc_traits::allocate(m_alloc, sz);
+  this->note_reallocation(
+    this->capacity(), sz, this->size() * sizeof(value_type)
+  );
+  pointer new_end = new_begin + this->size();
+  pointer new_cap = new_begin + sz;
+
+  try {
+    alloc_traits::construct(
+      m_alloc, std::to_address(new_end), std::forward<Args>(args)...
+    );
+  } catch (...) {
+    alloc_traits::deallocate(m_alloc, new_begin, sz);
+    throw;
   }
 
-  const size_type cap = this->capacity();
-  if (cap >= max_size / 2) {
-    return max_size;
+  try {
+    if constexpr (std::is_move_constructible_v<value_type>) {
+      std::uninitialized_move(m_begin, m_end, new_begin);
+    } else {
+      std::uninitialized_copy(m_begin, m_end, new_begin);
+    }
+  } catch (...) {
+    alloc_traits::destroy(m_alloc, std::to_address(new_end));
+    alloc_traits::deallocate(m_alloc, new_begin, sz);
+    throw;
   }
+  ++new_end;
 
-  return std::max<size_type>(2 * cap, new_size);
+  this->destruct(m_begin);
+  this->deallocate();
+
+  m_begin = new_begin;
+  m_end = new_end;
+  m_cap = new_cap;
 }
 
 template <class T, class Alloc>
@@ -1164,6 +1440,8 @@ void vector<T, Alloc>::allocate(size_type n) {
     this->throw_length_error();
   } else {
     m_begin = alloc_traits::allocate(m_alloc, n);
+    this->note_allocation(n);
+    m_end = m_begin;
     m_cap = m_begin + n;
   }
 }
@@ -1178,7 +1456,6 @@ void vector<T, Alloc>::deallocate() {
 
 template <class T, class Alloc>
 void vector<T, Alloc>::construct(size_type n) {
-  m_end = m_begin;
   for (size_type i = 0; i < n; ++i) {
     alloc_traits::construct(m_alloc, m_end);
     ++m_end;
@@ -1187,7 +1464,6 @@ void vector<T, Alloc>::construct(size_type n) {
 
 template <class T, class Alloc>
 void vector<T, Alloc>::construct(size_type n, const_reference val) {
-  m_end = m_begin;
   for (size_type i = 0; i < n; ++i) {
     alloc_traits::construct(m_alloc, m_end, val);
     ++m_end;
@@ -1198,14 +1474,114 @@ template <class T, class Alloc>
 template <class InputIter, class Sentinel>
 void vector<T, Alloc>::construct(InputIter first, Sentinel last, size_type n) {
   // FIXME: check last and n
-  m_end = m_begin;
-  for (size_type i = 0; i < n; ++i) {
-    alloc_traits::construct(m_alloc, m_end, *first);
-    ++m_end;
-    ++first;
+  if constexpr (detail::bitwise_copyable_range<InputIter, T, Alloc>) {
+    std::uninitialized_copy_n(
+      std::to_address(first), n, std::to_address(m_end)
+    );
+    m_end += n;
+  } else {
+    for (size_type i = 0; i < n; ++i) {
+      alloc_traits::construct(m_alloc, m_end, *first);
+      ++m_end;
+      ++first;
+    }
+  }
+}
+
+// construct_at(p, i) constructs element i at p into an empty buffer. The
+// buffer is released if construction throws, leaving the vector empty.
+//
+// In parallel, each piece records its range once it is fully built, and a
+// piece that throws destroys its own partial prefix. After the join, the
+// recorded ranges are exactly the live elements, so they are destroyed and
+// the first exception is rethrown. Pieces that start after a failure skip
+// their work.
+template <class T, class Alloc>
+template <class ExecutionPolicy, class ConstructAt>
+void vector<T, Alloc>::parallel_construct(
+  ExecutionPolicy &policy, size_type n, ConstructAt construct_at
+) {
+  if constexpr (parallel_execution_policy<ExecutionPolicy>) {
+    thread_pool &pool = policy.pool();
+    std::size_t count = static_cast<std::size_t>(n);
+    std::size_t grain = detail::parallel_grain(pool, count);
+
+    if constexpr (std::is_nothrow_invocable_v<ConstructAt &, pointer, size_type>) {
+      detail::parallel_for(
+        pool, count, grain,
+        [this, &construct_at](std::size_t b, std::size_t e) {
+          for (std::size_t i = b; i < e; ++i) {
+            construct_at(m_begin + i, static_cast<size_type>(i));
+          }
+        }
+      );
+    } else {
+      // parallel_split never makes a piece shorter than grain / 2, so the
+      // record never has to grow while pieces are running.
+      std::vector<std::pair<std::size_t, std::size_t>> built;
+      built.reserve(2 * (count / grain) + 2);
+      std::mutex built_mutex;
+      std::atomic<bool> failed{false};
+
+      try {
+        detail::parallel_for(pool, count, grain, [&](std::size_t b, std::size_t e) {
+          if (failed.load(std::memory_order_relaxed)) {
+            return;
+          }
+          std::size_t i = b;
+          try {
+            for (; i < e; ++i) {
+              construct_at(m_begin + i, static_cast<size_type>(i));
+            }
+          } catch (...) {
+            failed.store(true, std::memory_order_relaxed);
+            this->destroy_range(m_begin + b, m_begin + i);
+            throw;
+          }
+          std::lock_guard<std::mutex> lock(built_mutex);
+          built.emplace_back(b, e);
+        });
+      } catch (...) {
+        for (auto [b, e] : built) {
+          this->destroy_range(m_begin + b, m_begin + e);
+        }
+        this->deallocate();
+        throw;
+      }
+    }
+    m_end = m_begin + n;
+  } else {
+    try {
+      for (size_type i = 0; i < n; ++i) {
+        construct_at(m_end, i);
+        ++m_end;
+      }
+    } catch (...) {
+      this->clear();
+      this->deallocate();
+      throw;
+    }
   }
 }
 
+template <class T, class Alloc>
+void vector<T, Alloc>::destroy_range(pointer first, pointer last) noexcept {
+  while (last != first) {
+    alloc_traits::destroy(m_alloc, std::to_address(--last));
+  }
+}
+
+// Takes over other's buffer, which was allocated with an equal allocator.
+template <class T, class Alloc>
+void vector<T, Alloc>::adopt(vector &other) noexcept {
+  this->clear();
+  this->deallocate();
+  m_begin = other.m_begin;
+  m_end = other.m_end;
+  m_cap = other.m_cap;
+  other.m_begin = other.m_end = other.m_cap = nullptr;
+}
+
 template <class T, class Alloc>
 void vector<T, Alloc>::destruct(pointer new_last) {
   pointer new_end = m_end;
@@ -1219,13 +1595,13 @@ template <class T, class Alloc>
 void vector<T, Alloc>::move_to_insert(
   pointer from_s, pointer from_e, pointer to
 ) {
-  pointer from_mid = from_s + (m_end - to);
+  const difference_type n = m_end - to;
   pointer new_end = m_end;
-  for (; from_mid < from_e; ++from_mid, ++new_end) {
-    alloc_traits::construct(m_alloc, new_end, std::move(*from_mid));
+  for (pointer i = from_s + n; i < from_e; ++i, ++new_end) {
+    alloc_traits::construct(m_alloc, new_end, std::move(*i));
   }
 
-  std::move_backward(from_s, from_mid, m_end);
+  std::move_backward(from_s, from_s + n, m_end);
 
   m_end = new_end;
 }
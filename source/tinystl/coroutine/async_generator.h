@@ -0,0 +1,105 @@
+#pragma once
+
+#include <coroutine>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "tinystl/coroutine/generator.h"
+#include "tinystl/coroutine/task.h"
+
+namespace tinystl {
+
+// A generator whose body may co_await between elements, for example on a
+// task or on schedule(pool). The consumer is itself a coroutine and pulls
+// one element at a time:
+//
+//   while (T *item = co_await gen.next()) {
+//     ...
+//   }
+//
+// Control passes directly between the two, so the body runs on whichever
+// thread resumed it and nothing is queued in between. The pointer
+// stays valid until the next call to next().
+template <class T>
+class async_generator {
+public:
+  using value_type = std::remove_cvref_t<T>;
+
+  class promise_type : public detail::yield_state<value_type> {
+    using base = detail::yield_state<value_type>;
+
+  public:
+    async_generator get_return_object() noexcept {
+      return async_generator(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    detail::handoff_awaiter final_suspend() noexcept { return {}; }
+    void return_void() noexcept {}
+
+    using base::yield_value;
+
+    detail::handoff_awaiter yield_value(value_type &&value) noexcept {
+      this->store(std::addressof(value));
+      return {};
+    }
+
+    auto yield_value(const value_type &value)
+      requires std::copy_constructible<value_type>
+    {
+      this->store(nullptr);
+      return typename base::template copy_awaiter<detail::handoff_awaiter>{{}, value, this};
+    }
+
+    detail::handoff &handoff() noexcept { return m_handoff; }
+
+  private:
+    detail::handoff m_handoff;
+  };
+
+  async_generator(async_generator &&other) noexcept : m_coro(std::exchange(other.m_coro, nullptr)) {}
+  async_generator &operator=(async_generator other) noexcept {
+    std::swap(m_coro, other.m_coro);
+    return *this;
+  }
+
+  ~async_generator() {
+    if (m_coro) {
+      m_coro.destroy();
+    }
+  }
+
+  // Resumes the body until it yields or finishes. The awaited result is the
+  // element, or nullptr once the body has returned; an exception from the
+  // body is rethrown here.
+  [[nodiscard]] auto next() noexcept {
+    struct awaiter {
+      std::coroutine_handle<promise_type> coro;
+
+      bool await_ready() const noexcept { return coro.done(); }
+
+      bool await_suspend(std::coroutine_handle<> consumer) const {
+        return coro.promise().handoff().start(consumer, coro);
+      }
+
+      value_type *await_resume() const {
+        coro.promise().rethrow_if_failed();
+        return coro.done() ? nullptr : coro.promise().value();
+      }
+    };
+    return awaiter{m_coro};
+  }
+
+  // How many more elements the body said would follow; see generator::hint.
+  std::optional<std::size_t> hint() const noexcept { return m_coro.promise().hint(); }
+
+private:
+  explicit async_generator(std::coroutine_handle<promise_type> coro) noexcept : m_coro(coro) {}
+
+  std::coroutine_handle<promise_type> m_coro;
+};
+
+} // namespace tinystl
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <algorithm>
+#include <coroutine>
+#include <cstddef>
+#include <limits>
+#include <mutex>
+#include <utility>
+
+#include "tinystl/container/vector.h"
+#include "tinystl/coroutine/async_generator.h"
+#include "tinystl/coroutine/task.h"
+
+namespace tinystl {
+
+// Streams elements from a producing coroutine into a container such as a
+// vector or deque. Elements are staged privately and appended batch at a
+// time, so the container's lock is taken once per batch, and when the
+// producer has given a size hint the container reserves for the rest of the
+// stream up front instead of growing geometrically.
+//
+// A consumer on another thread may take() what has arrived so far. Once the
+// container holds capacity elements, the producer suspends at its next full
+// batch until take() makes room, which bounds memory to roughly
+// capacity + batch elements. The producer then resumes inside take(), on
+// the consumer's thread, and runs until it next suspends. While a producer
+// is active the container must only be accessed through take().
+template <class Container>
+class batching_sink {
+public:
+  using value_type = typename Container::value_type;
+  using size_type = std::size_t;
+
+  explicit batching_sink(
+    Container &out, size_type batch = 256,
+    size_type capacity = std::numeric_limits<size_type>::max()
+  )
+    : m_out(out), m_batch(std::max<size_type>(batch, 1)), m_capacity(capacity) {
+    m_staged.reserve(m_batch);
+  }
+
+  batching_sink(const batching_sink &) = delete;
+  batching_sink &operator=(const batching_sink &) = delete;
+
+  // Stages value. The result must be awaited: it completes at once unless
+  // this push filled a batch and the container is at capacity.
+  [[nodiscard]] auto push(value_type value) {
+    struct awaiter {
+      batching_sink *sink;
+      bool full;
+
+      bool await_ready() const noexcept { return !full; }
+      bool await_suspend(std::coroutine_handle<> h) { return sink->flush_or_wait(h); }
+      void await_resume() const noexcept {}
+    };
+    m_staged.push_back(std::move(value));
+    return awaiter{this, m_staged.size() >= m_batch};
+  }
+
+  // How many more elements the producer expects to push.
+  void hint(size_type remaining) noexcept { m_hint = remaining; }
+
+  // Appends the staged elements regardless of capacity.
+  void flush() {
+    std::lock_guard lock(m_mutex);
+    this->append_locked();
+  }
+
+  // Flushes and marks the stream finished.
+  void close() {
+    std::lock_guard lock(m_mutex);
+    this->append_locked();
+    m_closed = true;
+  }
+
+  // Pushes every element of gen, forwarding its size hints, then closes the
+  // sink. Returns the number of elements pushed.
+  template <class U>
+  task<size_type> drain(async_generator<U> &gen) {
+    size_type count = 0;
+    while (auto *item = co_await gen.next()) {
+      m_hint = gen.hint().value_or(0);
+      co_await this->push(std::move(*item));
+      ++count;
+    }
+    this->close();
+    co_return count;
+  }
+
+  // Moves out everything appended so far and lets a waiting producer
+  // continue. A consumer that sees closed() before a take() has received
+  // the whole stream once that take() returns.
+  Container take() {
+    std::coroutine_handle<> waiting;
+    Container taken = [&] {
+      std::lock_guard lock(m_mutex);
+      waiting = std::exchange(m_waiting, nullptr);
+      Container out(std::move(m_out));
+      m_out.clear();
+      return out;
+    }();
+    if (waiting) {
+      waiting.resume();
+    }
+    return taken;
+  }
+
+  bool closed() const {
+    std::lock_guard lock(m_mutex);
+    return m_closed;
+  }
+
+private:
+  bool flush_or_wait(std::coroutine_handle<> h) {
+    std::lock_guard lock(m_mutex);
+    this->append_locked();
+    if (m_out.size() < m_capacity) {
+      return false;
+    }
+    m_waiting = h;
+    return true;
+  }
+
+  void append_locked() {
+    if constexpr (requires { m_out.reserve(size_type()); }) {
+      const size_type need = m_out.size() + m_staged.size();
+      if (m_hint > 0 && m_out.capacity() < need) {
+        const size_type room = m_capacity > need ? m_capacity - need : 0;
+        m_out.reserve(need + std::min(m_hint, room));
+      }
+    }
+    for (value_type &value : m_staged) {
+      m_out.push_back(std::move(value));
+    }
+    m_staged.clear();
+  }
+
+  Container &m_out;
+  size_type m_batch;
+  size_type m_capacity;
+  size_type m_hint = 0;
+  vector<value_type> m_staged;
+  mutable std::mutex m_mutex;
+  std::coroutine_handle<> m_waiting;
+  bool m_closed = false;
+};
+
+} // namespace tinystl
@@ -0,0 +1,184 @@
+#pragma once
+
+// https://en.cppreference.com/w/cpp/coroutine/generator.html
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace tinystl {
+
+// Yielded from a generator body to tell the consumer roughly how many more
+// elements will follow, so that it can reserve ahead. Yielding a hint does
+// not suspend the body.
+struct size_hint {
+  std::size_t count;
+};
+
+namespace detail {
+
+// The part of a generator promise that holds the current element and the
+// size hint; shared by generator and async_generator.
+template <class T>
+class yield_state {
+public:
+  // Lvalues are yielded through a copy kept in the awaiter, which lives in
+  // the coroutine frame until the body resumes.
+  template <class Suspend>
+  struct copy_awaiter : Suspend {
+    T copy;
+    yield_state *state;
+
+    template <class Promise>
+    auto await_suspend(std::coroutine_handle<Promise> h) noexcept {
+      state->m_value = std::addressof(copy);
+      return Suspend::await_suspend(h);
+    }
+  };
+
+  std::suspend_never yield_value(size_hint hint) noexcept {
+    m_hint = hint.count;
+    return {};
+  }
+
+  void unhandled_exception() noexcept { m_exception = std::current_exception(); }
+
+  T *value() const noexcept { return m_value; }
+
+  std::optional<std::size_t> hint() const noexcept { return m_hint; }
+
+  void rethrow_if_failed() {
+    if (m_exception) {
+      std::rethrow_exception(std::exchange(m_exception, nullptr));
+    }
+  }
+
+protected:
+  void store(T *value) noexcept {
+    m_value = value;
+    if (m_hint && *m_hint > 0) {
+      --*m_hint;
+    }
+  }
+
+private:
+  T *m_value = nullptr;
+  std::optional<std::size_t> m_hint;
+  std::exception_ptr m_exception;
+};
+
+} // namespace detail
+
+// A lazily evaluated sequence produced by a coroutine body with co_yield.
+// The body runs only while the consumer advances the iterator, one element
+// at a time, so nothing is buffered between the two. A generator is an input
+// range and can be traversed once; an exception thrown by the body reaches
+// the consumer from begin() or operator++.
+//
+//   tinystl::generator<int> iota(int n) {
+//     co_yield tinystl::size_hint{std::size_t(n)};
+//     for (int i = 0; i < n; ++i) {
+//       co_yield i;
+//     }
+//   }
+template <class T>
+class generator {
+public:
+  using value_type = std::remove_cvref_t<T>;
+
+  class promise_type : public detail::yield_state<value_type> {
+    using base = detail::yield_state<value_type>;
+
+  public:
+    generator get_return_object() noexcept {
+      return generator(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    std::suspend_always final_suspend() noexcept { return {}; }
+    void return_void() noexcept {}
+
+    using base::yield_value;
+
+    std::suspend_always yield_value(value_type &&value) noexcept {
+      this->store(std::addressof(value));
+      return {};
+    }
+
+    auto yield_value(const value_type &value)
+      requires std::copy_constructible<value_type>
+    {
+      this->store(nullptr);
+      return typename base::template copy_awaiter<std::suspend_always>{{}, value, this};
+    }
+
+    // Generators only yield; awaiting belongs in async_generator.
+    template <class U>
+    std::suspend_never await_transform(U &&) = delete;
+  };
+
+  class iterator {
+  public:
+    using value_type = generator::value_type;
+    using difference_type = std::ptrdiff_t;
+
+    iterator() noexcept = default;
+
+    value_type &operator*() const noexcept { return *m_coro.promise().value(); }
+    value_type *operator->() const noexcept { return m_coro.promise().value(); }
+
+    iterator &operator++() {
+      m_coro.resume();
+      m_coro.promise().rethrow_if_failed();
+      return *this;
+    }
+    void operator++(int) { ++*this; }
+
+    friend bool operator==(const iterator &it, std::default_sentinel_t) noexcept {
+      return it.m_coro.done();
+    }
+
+  private:
+    friend class generator;
+
+    explicit iterator(std::coroutine_handle<promise_type> coro) noexcept : m_coro(coro) {}
+
+    std::coroutine_handle<promise_type> m_coro;
+  };
+
+  generator(generator &&other) noexcept : m_coro(std::exchange(other.m_coro, nullptr)) {}
+  generator &operator=(generator other) noexcept {
+    std::swap(m_coro, other.m_coro);
+    return *this;
+  }
+
+  ~generator() {
+    if (m_coro) {
+      m_coro.destroy();
+    }
+  }
+
+  // Runs the body up to its first element.
+  iterator begin() {
+    m_coro.resume();
+    m_coro.promise().rethrow_if_failed();
+    return iterator(m_coro);
+  }
+  std::default_sentinel_t end() const noexcept { return {}; }
+
+  // How many more elements the body said would follow, counting down as
+  // they are yielded; empty if it gave no hint.
+  std::optional<std::size_t> hint() const noexcept { return m_coro.promise().hint(); }
+
+private:
+  explicit generator(std::coroutine_handle<promise_type> coro) noexcept : m_coro(coro) {}
+
+  std::coroutine_handle<promise_type> m_coro;
+};
+
+} // namespace tinystl
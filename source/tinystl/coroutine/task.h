@@ -0,0 +1,282 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "tinystl/execution/thread_pool.h"
+
+namespace tinystl {
+
+template <class T = void>
+class task;
+
+namespace detail {
+
+// Hands control from an awaited coroutine back to its awaiter. When the
+// awaited side reaches its suspend point on the same stack that resumed it,
+// the awaiter simply continues once resume() returns; only when it got there
+// from another thread is the awaiter resumed from that suspend point. That
+// keeps long synchronous chains from growing the stack even where symmetric
+// transfer is not compiled into a tail call (unoptimized and sanitized
+// builds).
+class handoff {
+public:
+  // Called from the awaiter's await_suspend; true if it must stay suspended.
+  bool start(std::coroutine_handle<> awaiting, std::coroutine_handle<> awaited) {
+    m_awaiting = awaiting;
+    m_reached.store(false, std::memory_order_relaxed);
+    awaited.resume();
+    return !m_reached.exchange(true, std::memory_order_acq_rel);
+  }
+
+  // Called when the awaited side suspends to hand control back.
+  std::coroutine_handle<> finish() noexcept {
+    if (m_reached.exchange(true, std::memory_order_acq_rel)) {
+      return m_awaiting;
+    }
+    return std::noop_coroutine();
+  }
+
+private:
+  std::coroutine_handle<> m_awaiting;
+  std::atomic<bool> m_reached{false};
+};
+
+// The suspend point at which a task finishes or a generator yields.
+struct handoff_awaiter {
+  bool await_ready() const noexcept { return false; }
+
+  template <class Promise>
+  std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> h) const noexcept {
+    return h.promise().handoff().finish();
+  }
+
+  void await_resume() const noexcept {}
+};
+
+class task_promise_base {
+public:
+  std::suspend_always initial_suspend() noexcept { return {}; }
+  handoff_awaiter final_suspend() noexcept { return {}; }
+
+  void unhandled_exception() noexcept { m_exception = std::current_exception(); }
+
+  detail::handoff &handoff() noexcept { return m_handoff; }
+
+protected:
+  void rethrow_if_failed() {
+    if (m_exception) {
+      std::rethrow_exception(m_exception);
+    }
+  }
+
+private:
+  detail::handoff m_handoff;
+  std::exception_ptr m_exception;
+};
+
+template <class T>
+class task_promise : public task_promise_base {
+public:
+  task<T> get_return_object() noexcept;
+
+  template <class U = T>
+  void return_value(U &&value) {
+    m_value.emplace(std::forward<U>(value));
+  }
+
+  T result() {
+    this->rethrow_if_failed();
+    return std::move(*m_value);
+  }
+
+private:
+  std::optional<T> m_value;
+};
+
+template <>
+class task_promise<void> : public task_promise_base {
+public:
+  task<void> get_return_object() noexcept;
+
+  void return_void() noexcept {}
+
+  void result() { this->rethrow_if_failed(); }
+};
+
+} // namespace detail
+
+// A coroutine that produces one value. It starts only when awaited, and the
+// awaiter continues from wherever the task finishes: on the same thread if
+// it never suspended, otherwise on the thread that completed it. Exceptions
+// propagate to the awaiter. Use sync_wait to run a task from ordinary code.
+template <class T>
+class [[nodiscard]] task {
+public:
+  using promise_type = detail::task_promise<T>;
+
+  task(task &&other) noexcept : m_coro(std::exchange(other.m_coro, nullptr)) {}
+  task &operator=(task other) noexcept {
+    std::swap(m_coro, other.m_coro);
+    return *this;
+  }
+
+  ~task() {
+    if (m_coro) {
+      m_coro.destroy();
+    }
+  }
+
+  auto operator co_await() const noexcept {
+    struct awaiter {
+      std::coroutine_handle<promise_type> coro;
+
+      bool await_ready() const noexcept { return false; }
+
+      bool await_suspend(std::coroutine_handle<> awaiting) const {
+        return coro.promise().handoff().start(awaiting, coro);
+      }
+
+      T await_resume() const { return coro.promise().result(); }
+    };
+    return awaiter{m_coro};
+  }
+
+private:
+  friend promise_type;
+
+  explicit task(std::coroutine_handle<promise_type> coro) noexcept : m_coro(coro) {}
+
+  std::coroutine_handle<promise_type> m_coro;
+};
+
+namespace detail {
+
+template <class T>
+task<T> task_promise<T>::get_return_object() noexcept {
+  return task<T>(std::coroutine_handle<task_promise>::from_promise(*this));
+}
+
+inline task<void> task_promise<void>::get_return_object() noexcept {
+  return task<void>(std::coroutine_handle<task_promise>::from_promise(*this));
+}
+
+// The outermost coroutine of sync_wait. It signals the blocked caller from
+// its final suspend point; the signal is raised under the lock so the
+// caller cannot destroy the frame before the notifying thread is done.
+class sync_wait_task {
+public:
+  struct promise_type {
+    std::mutex *mutex = nullptr;
+    std::condition_variable *ready = nullptr;
+    bool *done = nullptr;
+
+    sync_wait_task get_return_object() noexcept {
+      return sync_wait_task(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+
+    std::suspend_always initial_suspend() noexcept { return {}; }
+
+    auto final_suspend() noexcept {
+      struct notify {
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<promise_type> h) const noexcept {
+          promise_type &p = h.promise();
+          std::lock_guard lock(*p.mutex);
+          *p.done = true;
+          p.ready->notify_one();
+        }
+        void await_resume() const noexcept {}
+      };
+      return notify{};
+    }
+
+    void return_void() noexcept {}
+
+    // The body catches everything itself.
+    void unhandled_exception() noexcept { std::terminate(); }
+  };
+
+  sync_wait_task(sync_wait_task &&other) noexcept : m_coro(std::exchange(other.m_coro, nullptr)) {}
+  sync_wait_task &operator=(sync_wait_task &&) = delete;
+
+  ~sync_wait_task() {
+    if (m_coro) {
+      m_coro.destroy();
+    }
+  }
+
+  void run() {
+    std::mutex mutex;
+    std::condition_variable ready;
+    bool done = false;
+    m_coro.promise().mutex = &mutex;
+    m_coro.promise().ready = &ready;
+    m_coro.promise().done = &done;
+    m_coro.resume();
+    std::unique_lock lock(mutex);
+    ready.wait(lock, [&] { return done; });
+  }
+
+private:
+  explicit sync_wait_task(std::coroutine_handle<promise_type> coro) noexcept : m_coro(coro) {}
+
+  std::coroutine_handle<promise_type> m_coro;
+};
+
+template <class T>
+sync_wait_task sync_wait_body(task<T> &t, std::optional<T> &result, std::exception_ptr &error) {
+  try {
+    result.emplace(co_await t);
+  } catch (...) {
+    error = std::current_exception();
+  }
+}
+
+inline sync_wait_task sync_wait_body(task<void> &t, std::optional<bool> &result, std::exception_ptr &error) {
+  try {
+    co_await t;
+    result.emplace(true);
+  } catch (...) {
+    error = std::current_exception();
+  }
+}
+
+} // namespace detail
+
+// Runs t to completion and returns its result, blocking the calling thread
+// while t waits on other threads (for example after co_await schedule(pool)).
+template <class T>
+T sync_wait(task<T> t) {
+  using result_type = std::conditional_t<std::is_void_v<T>, bool, T>;
+  std::optional<result_type> result;
+  std::exception_ptr error;
+  detail::sync_wait_body(t, result, error).run();
+  if (error) {
+    std::rethrow_exception(error);
+  }
+  if constexpr (!std::is_void_v<T>) {
+    return std::move(*result);
+  }
+}
+
+// Awaiting the result moves the rest of the coroutine onto one of pool's
+// workers.
+inline auto schedule(thread_pool &pool) noexcept {
+  struct awaiter {
+    thread_pool &pool;
+
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> h) const { pool.submit([h] { h.resume(); }); }
+    void await_resume() const noexcept {}
+  };
+  return awaiter{pool};
+}
+
+} // namespace tinystl
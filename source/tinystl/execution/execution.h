@@ -0,0 +1,90 @@
+#pragma once
+
+// https://en.cppreference.com/w/cpp/algorithm/execution_policy_tag_t.html
+
+#include <type_traits>
+
+#include "tinystl/execution/thread_pool.h"
+
+namespace tinystl {
+
+namespace detail {
+
+// Shared by the parallel policies: the pool to split work across, the
+// global one unless another is chosen with on().
+template <class Policy>
+class pool_policy {
+public:
+  constexpr pool_policy() noexcept = default;
+
+  Policy on(thread_pool &pool) const noexcept {
+    Policy policy = static_cast<const Policy &>(*this);
+    policy.m_pool = &pool;
+    return policy;
+  }
+
+  // Splits reductions and scans at fixed positions and combines the partial
+  // results in a fixed order, so floating-point results come out the same
+  // on every run whatever the size of the pool.
+  Policy deterministic() const noexcept {
+    Policy policy = static_cast<const Policy &>(*this);
+    policy.m_deterministic = true;
+    return policy;
+  }
+
+  thread_pool &pool() const {
+    return m_pool ? *m_pool : thread_pool::global();
+  }
+
+  bool is_deterministic() const noexcept { return m_deterministic; }
+
+private:
+  thread_pool *m_pool = nullptr;
+  bool m_deterministic = false;
+};
+
+} // namespace detail
+
+namespace execution {
+
+class sequenced_policy {};
+
+class parallel_policy : public detail::pool_policy<parallel_policy> {};
+
+// Like parallel_policy, and additionally lets each thread's share of the
+// work be vectorized, so element accesses must not synchronize.
+class parallel_unsequenced_policy
+  : public detail::pool_policy<parallel_unsequenced_policy> {};
+
+inline constexpr sequenced_policy seq{};
+inline constexpr parallel_policy par{};
+inline constexpr parallel_unsequenced_policy par_unseq{};
+
+} // namespace execution
+
+template <class T>
+struct is_execution_policy : std::false_type {};
+
+template <>
+struct is_execution_policy<execution::sequenced_policy> : std::true_type {};
+
+template <>
+struct is_execution_policy<execution::parallel_policy> : std::true_type {};
+
+template <>
+struct is_execution_policy<execution::parallel_unsequenced_policy>
+  : std::true_type {};
+
+template <class T>
+inline constexpr bool is_execution_policy_v = is_execution_policy<T>::value;
+
+template <class T>
+concept execution_policy = is_execution_policy_v<std::remove_cvref_t<T>>;
+
+// Policies that may run on more than one thread.
+template <class T>
+concept parallel_execution_policy =
+  execution_policy<T> &&
+  !std::is_same_v<std::remove_cvref_t<T>, execution::sequenced_policy>;
+
+} // namespace tinystl
@@ -0,0 +1,492 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "tinystl/concurrent/bounded_queue.h"
+
+namespace tinystl {
+
+namespace detail {
+
+// A type-erased unit of work, owned by whichever queue currently holds it.
+class pool_task {
+public:
+  virtual ~pool_task() = default;
+  virtual void run() = 0;
+};
+
+template <class Func>
+class pool_task_impl final : public pool_task {
+public:
+  template <class F>
+  explicit pool_task_impl(F &&func) : m_func(std::forward<F>(func)) {}
+
+  void run() override { m_func(); }
+
+private:
+  Func m_func;
+};
+
+// Chase-Lev work-stealing deque (Le, Pop, Cohen, Zappa Nardelli, PPoPP 2013).
+// The owning worker pushes and pops at the bottom without locking; other
+// workers steal from the top with a single CAS. A full ring is replaced by
+// one twice the size, and the old ring stays alive until the deque is
+// destroyed because a thief may still be reading from it.
+template <class T>
+  requires std::is_pointer_v<T>
+class work_stealing_deque {
+public:
+  explicit work_stealing_deque(std::size_t capacity = 256);
+
+  work_stealing_deque(const work_stealing_deque &) = delete;
+  work_stealing_deque &operator=(const work_stealing_deque &) = delete;
+
+  // Owner only.
+  void push(T item);
+  T pop() noexcept;
+
+  // Any thread. Returns nullptr when empty or when another thread won the
+  // race for the top element.
+  T steal() noexcept;
+
+  bool empty() const noexcept;
+
+private:
+  struct ring {
+    explicit ring(std::int64_t capacity)
+      : mask(capacity - 1), slots(new std::atomic<T>[capacity]) {}
+
+    T get(std::int64_t i) const noexcept {
+      return slots[i & mask].load(std::memory_order_relaxed);
+    }
+    void put(std::int64_t i, T item) noexcept {
+      slots[i & mask].store(item, std::memory_order_relaxed);
+    }
+
+    std::int64_t mask;
+    std::unique_ptr<std::atomic<T>[]> slots;
+  };
+
+  ring *grow(ring *old, std::int64_t top, std::int64_t bottom);
+
+private:
+  alignas(64) std::atomic<std::int64_t> m_top{0};
+  alignas(64) std::atomic<std::int64_t> m_bottom{0};
+  std::atomic<ring *> m_ring;
+  std::vector<std::unique_ptr<ring>> m_rings;
+};
+
+} // namespace detail
+
+// A fixed set of worker threads, each with its own work-stealing deque.
+// Tasks submitted from a worker go to that worker's deque and run LIFO, so a
+// recursive split keeps working on the freshest, cache-warm half while idle
+// workers steal the oldest, largest pieces. Tasks from other threads enter
+// through a shared lock-free queue, which spills into a locked one only when
+// it is full. Parallel algorithms submit work through a
+// task_group rather than directly.
+class thread_pool {
+public:
+  explicit thread_pool(
+    std::size_t threads = std::max(1u, std::thread::hardware_concurrency())
+  );
+  ~thread_pool();
+
+  thread_pool(const thread_pool &) = delete;
+  thread_pool &operator=(const thread_pool &) = delete;
+
+  std::size_t size() const noexcept { return m_workers.size(); }
+
+  template <class Func>
+  void submit(Func &&func);
+
+  // Runs one queued task on the calling thread. A thread waiting for its own
+  // tasks calls this so that nested parallelism cannot deadlock the pool.
+  bool try_run_one();
+
+  // The index of the calling thread among this pool's workers, or size()
+  // when it is not one of them.
+  std::size_t worker_index() const noexcept;
+
+  // The pool used when an algorithm is not given one explicitly.
+  static thread_pool &global();
+
+private:
+  struct worker {
+    detail::work_stealing_deque<detail::pool_task *> tasks;
+    std::thread thread;
+  };
+
+  struct worker_context {
+    const thread_pool *pool = nullptr;
+    std::size_t index = 0;
+    std::uint32_t seed = 0;
+  };
+
+  static worker_context &this_worker() noexcept;
+
+  void enqueue(detail::pool_task *task);
+  detail::pool_task *find_task(std::size_t self);
+  detail::pool_task *steal(std::size_t self);
+  void wake_one();
+  void worker_loop(std::size_t index);
+
+private:
+  std::vector<std::unique_ptr<worker>> m_workers;
+
+  std::mutex m_mutex;
+  std::condition_variable m_wake;
+  mpmc_queue<detail::pool_task *> m_injected{1024};
+  std::deque<detail::pool_task *> m_overflow;
+  std::atomic<std::size_t> m_overflow_size{0};
+
+  // Bumped after every enqueue; a worker only sleeps while it is unchanged.
+  std::atomic<std::uint64_t> m_epoch{0};
+  std::atomic<std::size_t> m_sleeping{0};
+  std::atomic<bool> m_stop{false};
+};
+
+// Fork-join scope over a thread_pool: run() forks, wait() joins and rethrows
+// the first exception any task threw.
+class task_group {
+public:
+  explicit task_group(thread_pool &pool = thread_pool::global()) noexcept
+    : m_pool(pool) {}
+  ~task_group();
+
+  task_group(const task_group &) = delete;
+  task_group &operator=(const task_group &) = delete;
+
+  thread_pool &pool() const noexcept { return m_pool; }
+
+  template <class Func>
+  void run(Func &&func);
+
+  void wait();
+
+private:
+  thread_pool &m_pool;
+  std::atomic<std::size_t> m_pending{0};
+  std::mutex m_error_mutex;
+  std::exception_ptr m_error;
+};
+
+/* -------------------------------------------------------------------------- */
+/*                             work_stealing_deque                            */
+/* -------------------------------------------------------------------------- */
+namespace detail {
+
+template <class T>
+  requires std::is_pointer_v<T>
+work_stealing_deque<T>::work_stealing_deque(std::size_t capacity) {
+  m_rings.push_back(std::make_unique<ring>(
+    static_cast<std::int64_t>(std::bit_ceil(std::max<std::size_t>(capacity, 2)))
+  ));
+  m_ring.store(m_rings.back().get(), std::memory_order_relaxed);
+}
+
+template <class T>
+  requires std::is_pointer_v<T>
+void work_stealing_deque<T>::push(T item) {
+  std::int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+  std::int64_t top = m_top.load(std::memory_order_acquire);
+  ring *r = m_ring.load(std::memory_order_relaxed);
+  if (bottom - top > r->mask) {
+    r = this->grow(r, top, bottom);
+  }
+  r->put(bottom, item);
+  m_bottom.store(bottom + 1, std::memory_order_release);
+}
+
+template <class T>
+  requires std::is_pointer_v<T>
+T work_stealing_deque<T>::pop() noexcept {
+  std::int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+  ring *r = m_ring.load(std::memory_order_relaxed);
+  // Claiming the bottom slot must be ordered before reading top, or a thief
+  // and the owner could both take the last element.
+  m_bottom.store(bottom, std::memory_order_seq_cst);
+  std::int64_t top = m_top.load(std::memory_order_seq_cst);
+
+  if (top > bottom) {
+    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  T item = r->get(bottom);
+  if (top == bottom) {
+    // Last element: race the thieves for it through top.
+    if (!m_top.compare_exchange_strong(
+          top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed
+        )) {
+      item = nullptr;
+    }
+    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+  }
+  return item;
+}
+
+template <class T>
+  requires std::is_pointer_v<T>
+T work_stealing_deque<T>::steal() noexcept {
+  std::int64_t top = m_top.load(std::memory_order_seq_cst);
+  std::int64_t bottom = m_bottom.load(std::memory_order_seq_cst);
+  if (top >= bottom) {
+    return nullptr;
+  }
+
+  ring *r = m_ring.load(std::memory_order_acquire);
+  T item = r->get(top);
+  if (!m_top.compare_exchange_strong(
+        top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed
+      )) {
+    return nullptr;
+  }
+  return item;
+}
+
+template <class T>
+  requires std::is_pointer_v<T>
+bool work_stealing_deque<T>::empty() const noexcept {
+  return m_top.load(std::memory_order_acquire) >=
+         m_bottom.load(std::memory_order_acquire);
+}
+
+template <class T>
+  requires std::is_pointer_v<T>
+auto work_stealing_deque<T>::grow(ring *old, std::int64_t top, std::int64_t bottom)
+  -> ring * {
+  auto bigger = std::make_unique<ring>(2 * (old->mask + 1));
+  for (std::int64_t i = top; i < bottom; ++i) {
+    bigger->put(i, old->get(i));
+  }
+  ring *r = bigger.get();
+  m_rings.push_back(std::move(bigger));
+  m_ring.store(r, std::memory_order_release);
+  return r;
+}
+
+} // namespace detail
+
+/* -------------------------------------------------------------------------- */
+/*                                 thread_pool                                */
+/* -------------------------------------------------------------------------- */
+inline thread_pool::thread_pool(std::size_t threads) {
+  // Every deque exists before any worker starts stealing from it.
+  m_workers.reserve(threads);
+  for (std::size_t i = 0; i < threads; ++i) {
+    m_workers.push_back(std::make_unique<worker>());
+  }
+  for (std::size_t i = 0; i < threads; ++i) {
+    m_workers[i]->thread = std::thread([this, i] { this->worker_loop(i); });
+  }
+}
+
+inline thread_pool::~thread_pool() {
+  m_stop.store(true, std::memory_order_seq_cst);
+  m_epoch.fetch_add(1, std::memory_order_seq_cst);
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+  }
+  m_wake.notify_all();
+  for (auto &w : m_workers) {
+    w->thread.join();
+  }
+}
+
+template <class Func>
+void thread_pool::submit(Func &&func) {
+  this->enqueue(new detail::pool_task_impl<std::decay_t<Func>>(std::forward<Func>(func)));
+}
+
+inline bool thread_pool::try_run_one() {
+  detail::pool_task *task = this->find_task(this->worker_index());
+  if (task == nullptr) {
+    return false;
+  }
+  std::unique_ptr<detail::pool_task> owner(task);
+  owner->run();
+  return true;
+}
+
+inline std::size_t thread_pool::worker_index() const noexcept {
+  const worker_context &ctx = this_worker();
+  return ctx.pool == this ? ctx.index : this->size();
+}
+
+inline thread_pool &thread_pool::global() {
+  static thread_pool pool;
+  return pool;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                           private member functions                         */
+/* -------------------------------------------------------------------------- */
+inline thread_pool::worker_context &thread_pool::this_worker() noexcept {
+  static thread_local worker_context ctx;
+  return ctx;
+}
+
+inline void thread_pool::enqueue(detail::pool_task *task) {
+  std::size_t self = this->worker_index();
+  if (self < this->size()) {
+    m_workers[self]->tasks.push(task);
+  } else if (!m_injected.try_push(task)) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_overflow.push_back(task);
+    m_overflow_size.fetch_add(1, std::memory_order_relaxed);
+  }
+  this->wake_one();
+}
+
+inline detail::pool_task *thread_pool::find_task(std::size_t self) {
+  if (self < this->size()) {
+    if (detail::pool_task *task = m_workers[self]->tasks.pop()) {
+      return task;
+    }
+  }
+
+  if (detail::pool_task *task = nullptr; m_injected.try_pop(task)) {
+    return task;
+  }
+
+  if (m_overflow_size.load(std::memory_order_relaxed) != 0) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_overflow.empty()) {
+      detail::pool_task *task = m_overflow.front();
+      m_overflow.pop_front();
+      m_overflow_size.fetch_sub(1, std::memory_order_relaxed);
+      return task;
+    }
+  }
+
+  return this->steal(self);
+}
+
+// Tries every other worker once, starting from a random victim so thieves
+// spread out instead of all hitting worker 0.
+inline detail::pool_task *thread_pool::steal(std::size_t self) {
+  const std::size_t n = this->size();
+  worker_context &ctx = this_worker();
+  ctx.seed = ctx.seed * 1664525u + 1013904223u;
+  std::size_t start = ctx.seed % n;
+  for (std::size_t k = 0; k < n; ++k) {
+    std::size_t victim = (start + k) % n;
+    if (victim == self) {
+      continue;
+    }
+    if (detail::pool_task *task = m_workers[victim]->tasks.steal()) {
+      return task;
+    }
+  }
+  return nullptr;
+}
+
+// A sleeper announces itself in m_sleeping before its last look for work,
+// and the epoch is bumped after every enqueue, so either the sleeper sees
+// the new task or the enqueuer sees the sleeper and wakes it.
+inline void thread_pool::wake_one() {
+  m_epoch.fetch_add(1, std::memory_order_seq_cst);
+  if (m_sleeping.load(std::memory_order_seq_cst) != 0) {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+    }
+    m_wake.notify_one();
+  }
+}
+
+inline void thread_pool::worker_loop(std::size_t index) {
+  worker_context &ctx = this_worker();
+  ctx.pool = this;
+  ctx.index = index;
+  ctx.seed = static_cast<std::uint32_t>(index * 2654435761u + 1);
+
+  constexpr int spins = 64;
+  for (;;) {
+    detail::pool_task *task = nullptr;
+    for (int spin = 0; spin < spins && task == nullptr; ++spin) {
+      task = this->find_task(index);
+      if (task == nullptr) {
+        std::this_thread::yield();
+      }
+    }
+
+    if (task == nullptr) {
+      m_sleeping.fetch_add(1, std::memory_order_seq_cst);
+      std::uint64_t epoch = m_epoch.load(std::memory_order_seq_cst);
+      task = this->find_task(index);
+      if (task == nullptr) {
+        if (m_stop.load(std::memory_order_seq_cst)) {
+          m_sleeping.fetch_sub(1, std::memory_order_relaxed);
+          return;
+        }
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_wake.wait(lock, [&] {
+          return m_epoch.load(std::memory_order_seq_cst) != epoch;
+        });
+      }
+      m_sleeping.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    if (task != nullptr) {
+      std::unique_ptr<detail::pool_task> owner(task);
+      owner->run();
+    }
+  }
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                 task_group                                 */
+/* -------------------------------------------------------------------------- */
+inline task_group::~task_group() {
+  // Tasks reference the group, so it cannot go away before they finish.
+  while (m_pending.load(std::memory_order_acquire) != 0) {
+    if (!m_pool.try_run_one()) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+template <class Func>
+void task_group::run(Func &&func) {
+  m_pending.fetch_add(1, std::memory_order_relaxed);
+  m_pool.submit([this, f = std::forward<Func>(func)]() mutable {
+    try {
+      f();
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(m_error_mutex);
+      if (!m_error) {
+        m_error = std::current_exception();
+      }
+    }
+    m_pending.fetch_sub(1, std::memory_order_release);
+  });
+}
+
+inline void task_group::wait() {
+  while (m_pending.load(std::memory_order_acquire) != 0) {
+    if (!m_pool.try_run_one()) {
+      std::this_thread::yield();
+    }
+  }
+
+  if (m_error) {
+    std::exception_ptr error = std::exchange(m_error, nullptr);
+    std::rethrow_exception(error);
+  }
+}
+
+} // namespace tinystl
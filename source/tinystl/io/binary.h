@@ -0,0 +1,302 @@
+#pragma once
+
+// A file format for arrays of trivially copyable elements: a fixed header
+// followed by the raw bytes of the elements, laid out so that the file can
+// be used in place. save() writes one; mapped_view maps it read-only and
+// reads the elements where they lie; load() copies them into a vector with
+// one allocation and one memcpy.
+//
+// The payload is the in-memory representation, so a file can only be read
+// by a build with the same element size, alignment and byte order; the
+// header records those and every reader checks them. POSIX only.
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "tinystl/container/slow_path.h"
+#include "tinystl/container/vector.h"
+
+namespace tinystl::io {
+
+// The file is not one the reader can use: a different magic, version,
+// element layout or byte order, or fewer bytes than the header declares.
+class format_error : public std::runtime_error {
+public:
+  using std::runtime_error::runtime_error;
+};
+
+struct binary_header {
+  static constexpr char expected_magic[8] = {'T', 'S', 'T', 'L',
+                                             'V', 'E', 'C', '\0'};
+  static constexpr std::uint32_t current_version = 1;
+  static constexpr std::uint32_t byte_order_mark = 0x01020304;
+
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t byte_order;
+  std::uint64_t element_size;
+  std::uint64_t element_align;
+  std::uint64_t count;
+  // Offset of the first element from the start of the file, aligned for
+  // the element type and to at least 64 bytes.
+  std::uint64_t payload_offset;
+};
+
+static_assert(sizeof(binary_header) == 48);
+
+namespace detail {
+
+template <class T>
+inline constexpr std::uint64_t payload_offset =
+  std::max<std::uint64_t>(64, alignof(T));
+
+template <class T>
+binary_header make_header(std::size_t count) noexcept {
+  binary_header h{};
+  std::memcpy(h.magic, binary_header::expected_magic, sizeof h.magic);
+  h.version = binary_header::current_version;
+  h.byte_order = binary_header::byte_order_mark;
+  h.element_size = sizeof(T);
+  h.element_align = alignof(T);
+  h.count = count;
+  h.payload_offset = payload_offset<T>;
+  return h;
+}
+
+[[noreturn]] TINYSTL_COLD inline void
+throw_errno(const char *what, const std::string &path) {
+  throw std::system_error(errno, std::generic_category(), what + (": " + path));
+}
+
+[[noreturn]] TINYSTL_COLD inline void
+throw_format(const char *what, const std::string &path) {
+  throw format_error(path + ": " + what);
+}
+
+// Checks a header read from a file of file_size bytes against T.
+template <class T>
+void check_header(
+  const binary_header &h, std::uint64_t file_size, const std::string &path
+) {
+  if (std::memcmp(h.magic, binary_header::expected_magic, sizeof h.magic)) {
+    throw_format("not a tinystl binary array", path);
+  }
+  if (h.version != binary_header::current_version) {
+    throw_format("unsupported format version", path);
+  }
+  if (h.byte_order != binary_header::byte_order_mark) {
+    throw_format("written with a different byte order", path);
+  }
+  if (h.element_size != sizeof(T) || h.element_align != alignof(T)) {
+    throw_format("element size or alignment does not match", path);
+  }
+  if (h.payload_offset < sizeof(binary_header) ||
+      h.payload_offset % alignof(T) != 0 || h.payload_offset > file_size ||
+      h.count > (file_size - h.payload_offset) / sizeof(T)) {
+    throw_format("truncated or corrupt payload", path);
+  }
+}
+
+class file_descriptor {
+public:
+  file_descriptor(const std::string &path, int flags, mode_t mode = 0)
+    : m_fd(::open(path.c_str(), flags | O_CLOEXEC, mode)) {
+    if (m_fd < 0) {
+      throw_errno("open", path);
+    }
+  }
+  file_descriptor(const file_descriptor &) = delete;
+  file_descriptor &operator=(const file_descriptor &) = delete;
+  ~file_descriptor() {
+    if (m_fd >= 0) {
+      ::close(m_fd);
+    }
+  }
+
+  int get() const noexcept { return m_fd; }
+
+  // Closes now, so that a failure to flush is reported.
+  void close(const std::string &path) {
+    int fd = std::exchange(m_fd, -1);
+    if (::close(fd) != 0) {
+      throw_errno("close", path);
+    }
+  }
+
+private:
+  int m_fd;
+};
+
+inline void write_all(
+  int fd, const void *data, std::size_t n, const std::string &path
+) {
+  const char *p = static_cast<const char *>(data);
+  while (n > 0) {
+    ssize_t written = ::write(fd, p, n);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      throw_errno("write", path);
+    }
+    p += written;
+    n -= static_cast<std::size_t>(written);
+  }
+}
+
+} // namespace detail
+
+// Writes elements to path, replacing any existing file.
+template <class T>
+  requires std::is_trivially_copyable_v<T>
+void save(const std::string &path, std::span<const T> elements) {
+  static constexpr char padding[detail::payload_offset<T>] = {};
+  const binary_header h = detail::make_header<T>(elements.size());
+
+  detail::file_descriptor fd(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  detail::write_all(fd.get(), &h, sizeof h, path);
+  detail::write_all(
+    fd.get(), padding, detail::payload_offset<T> - sizeof h, path
+  );
+  detail::write_all(fd.get(), elements.data(), elements.size_bytes(), path);
+  fd.close(path);
+}
+
+template <class T, class Alloc>
+  requires std::is_trivially_copyable_v<T>
+void save(const std::string &path, const vector<T, Alloc> &v) {
+  io::save(path, std::span<const T>(std::to_address(v.data()), v.size()));
+}
+
+// The elements of a saved file, mapped read-only and never copied: the
+// const interface of vector over memory owned by the mapping. Pages are
+// read in on first access, so opening costs the same for any file size.
+template <class T>
+  requires std::is_trivially_copyable_v<T>
+class mapped_view {
+public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using const_reference = const T &;
+  using reference = const_reference;
+  using const_pointer = const T *;
+  using pointer = const_pointer;
+  using const_iterator = const T *;
+  using iterator = const_iterator;
+
+  mapped_view() noexcept = default;
+  explicit mapped_view(const std::string &path);
+  mapped_view(const mapped_view &) = delete;
+  mapped_view(mapped_view &&other) noexcept { this->swap(other); }
+  mapped_view &operator=(const mapped_view &) = delete;
+  mapped_view &operator=(mapped_view &&other) noexcept {
+    mapped_view(std::move(other)).swap(*this);
+    return *this;
+  }
+  ~mapped_view() {
+    if (m_map != nullptr) {
+      ::munmap(m_map, m_map_size);
+    }
+  }
+
+  // element access
+  const_reference at(size_type pos) const {
+    if (pos >= m_size) {
+      tinystl::detail::throw_out_of_range("mapped_view");
+    }
+    return m_data[pos];
+  }
+  const_reference operator[](size_type pos) const noexcept {
+    return m_data[pos];
+  }
+  const_reference front() const noexcept { return m_data[0]; }
+  const_reference back() const noexcept { return m_data[m_size - 1]; }
+  const_pointer data() const noexcept { return m_data; }
+
+  // iterators
+  const_iterator begin() const noexcept { return m_data; }
+  const_iterator cbegin() const noexcept { return m_data; }
+  const_iterator end() const noexcept { return m_data + m_size; }
+  const_iterator cend() const noexcept { return m_data + m_size; }
+
+  // capacity
+  bool empty() const noexcept { return m_size == 0; }
+  size_type size() const noexcept { return m_size; }
+
+  operator std::span<const T>() const noexcept { return {m_data, m_size}; }
+
+  void swap(mapped_view &other) noexcept {
+    std::swap(m_map, other.m_map);
+    std::swap(m_map_size, other.m_map_size);
+    std::swap(m_data, other.m_data);
+    std::swap(m_size, other.m_size);
+  }
+
+private:
+  void *m_map = nullptr;
+  std::size_t m_map_size = 0;
+  const T *m_data = nullptr;
+  size_type m_size = 0;
+};
+
+template <class T>
+  requires std::is_trivially_copyable_v<T>
+mapped_view<T>::mapped_view(const std::string &path) {
+  detail::file_descriptor fd(path, O_RDONLY);
+  struct stat st;
+  if (::fstat(fd.get(), &st) != 0) {
+    detail::throw_errno("fstat", path);
+  }
+  const auto file_size = static_cast<std::uint64_t>(st.st_size);
+  if (file_size < sizeof(binary_header)) {
+    detail::throw_format("too short for a header", path);
+  }
+
+  void *map = ::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd.get(), 0);
+  if (map == MAP_FAILED) {
+    detail::throw_errno("mmap", path);
+  }
+  m_map = map;
+  m_map_size = file_size;
+
+  binary_header h;
+  std::memcpy(&h, map, sizeof h);
+  try {
+    detail::check_header<T>(h, file_size, path);
+  } catch (...) {
+    ::munmap(m_map, m_map_size);
+    m_map = nullptr;
+    throw;
+  }
+  m_data = reinterpret_cast<const T *>(
+    static_cast<const char *>(map) + h.payload_offset
+  );
+  m_size = h.count;
+}
+
+// Reads a saved file into a vector that uses alloc: one allocation, and the
+// elements copied in one block straight from the page cache.
+template <class T, class Alloc = std::allocator<T>>
+  requires std::is_trivially_copyable_v<T>
+vector<T, Alloc> load(const std::string &path, const Alloc &alloc = Alloc()) {
+  mapped_view<T> view(path);
+  return vector<T, Alloc>(view.begin(), view.end(), alloc);
+}
+
+} // namespace tinystl::io
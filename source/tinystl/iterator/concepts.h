@@ -0,0 +1,19 @@
+#pragma once
+
+#include <concepts>
+#include <iterator>
+
+namespace tinystl::detail {
+
+// An iterator that can be walked more than once, so a range can be
+// measured before it is copied. Checks the classic iterator category as
+// well: before P2520, std::move_iterator only models input_iterator even
+// over a forward range.
+template <class Iter>
+concept multipass_iterator =
+  std::forward_iterator<Iter> ||
+  std::derived_from<
+    typename std::iterator_traits<Iter>::iterator_category,
+    std::forward_iterator_tag>;
+
+} // namespace tinystl::detail
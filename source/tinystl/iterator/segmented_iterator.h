@@ -17,4 +17,34 @@ static Iter compose(segment_iterator, local_iterator);
 };
 */
 
+template <class Iter>
+concept segmented_iterator =
+  requires { typename segmented_iterator_traits<Iter>::segment_iterator; };
+
+// Calls func(local_first, local_last) once for every contiguous run of
+// [first, last), so the loop inside func can run over plain local iterators.
+// A non-segmented range is a single run.
+template <class Iter, class Func>
+constexpr Func for_each_segment(Iter first, Iter last, Func func) {
+  if constexpr (segmented_iterator<Iter>) {
+    using traits = segmented_iterator_traits<Iter>;
+
+    auto sfirst = traits::segment(first);
+    auto slast = traits::segment(last);
+    if (sfirst == slast) {
+      func(traits::local(first), traits::local(last));
+      return func;
+    }
+
+    func(traits::local(first), traits::end(sfirst));
+    for (++sfirst; sfirst != slast; ++sfirst) {
+      func(traits::begin(sfirst), traits::end(sfirst));
+    }
+    func(traits::begin(slast), traits::local(last));
+  } else {
+    func(first, last);
+  }
+  return func;
+}
+
 } // namespace tinystl
@@ -0,0 +1,300 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "tinystl/concurrent/cache_line.h"
+
+namespace tinystl {
+
+namespace detail {
+
+// One deferred reclamation: a small callable stored in place and run once.
+class retired_object {
+public:
+  static constexpr std::size_t storage_size = 4 * sizeof(void *);
+
+  template <class F>
+  static constexpr bool fits = sizeof(F) <= storage_size && alignof(F) <= alignof(void *);
+
+  template <class F>
+  void emplace(F &&reclaim) {
+    using fn = std::decay_t<F>;
+    ::new (static_cast<void *>(m_storage)) fn(std::forward<F>(reclaim));
+    m_run = [](void *storage) noexcept {
+      fn &f = *std::launder(static_cast<fn *>(storage));
+      f();
+      f.~fn();
+    };
+  }
+
+  void run() noexcept { m_run(m_storage); }
+
+private:
+  void (*m_run)(void *) noexcept;
+  alignas(void *) unsigned char m_storage[storage_size];
+};
+
+// Objects retired by one guard slot, sealed with the epoch they were retired
+// in and reclaimed together once that epoch has expired.
+struct retire_bag {
+  static constexpr std::size_t capacity = 64;
+
+  std::uint64_t epoch = 0;
+  std::size_t count = 0;
+  retire_bag *next = nullptr;
+  retired_object objects[capacity];
+};
+
+// Spreads threads over the guard slots so that each usually finds its own
+// slot free on the first try.
+inline std::size_t epoch_thread_hint() noexcept {
+  static std::atomic<std::size_t> next{0};
+  thread_local std::size_t hint = next.fetch_add(1, std::memory_order_relaxed);
+  return hint;
+}
+
+} // namespace detail
+
+// Epoch-based reclamation for lock-free data structures. A reader pins the
+// domain for as long as it holds pointers into shared storage; a writer that
+// unlinks a node or replaces a buffer retires the old storage through its
+// own guard instead of freeing it. Retired objects are collected in bags of
+// 64 and a bag is reclaimed, all at once, when the global epoch has moved two
+// steps past the one it was sealed in: by then every guard that could have
+// seen its objects has been released.
+//
+// The epoch only advances while every pinned guard has observed the current
+// one, so a guard held for a long time holds up all reclamation; pin around
+// an operation, not around a thread's lifetime. Objects left in a bag that
+// never fills are reclaimed by flush() or, at the latest, by the domain's
+// destructor, which requires that no guards are alive.
+//
+//   epoch_domain domain;
+//   {
+//     auto guard = domain.pin();
+//     node *old = head.exchange(fresh);
+//     guard.retire(old);
+//   }
+class epoch_domain {
+  struct alignas(detail::cache_line_size) slot {
+    // 0 while free, otherwise the pinned epoch shifted left with bit 0 set.
+    std::atomic<std::uint64_t> state{0};
+    detail::retire_bag *bag = nullptr;
+  };
+
+public:
+  class guard {
+  public:
+    guard(guard &&other) noexcept
+      : m_domain(other.m_domain), m_slot(std::exchange(other.m_slot, nullptr)) {}
+    guard &operator=(guard &&) = delete;
+
+    ~guard() {
+      if (m_slot != nullptr) {
+        m_slot->state.store(0, std::memory_order_release);
+      }
+    }
+
+    // Runs `reclaim()` once no guard can still see what it frees. The
+    // callable must fit in four pointers and should not throw.
+    template <class F>
+    void defer(F &&reclaim);
+
+    // Deletes `p` with delete.
+    template <class U>
+    void retire(U *p) {
+      this->defer([p] { delete p; });
+    }
+
+    // Destroys `n` elements at `p` and gives the storage back to `alloc`.
+    template <class Alloc>
+    void retire(typename std::allocator_traits<Alloc>::pointer p, std::size_t n, const Alloc &alloc) {
+      this->defer([a = Alloc(alloc), p, n]() mutable {
+        for (std::size_t i = 0; i < n; ++i) {
+          std::allocator_traits<Alloc>::destroy(a, std::to_address(p + i));
+        }
+        std::allocator_traits<Alloc>::deallocate(a, p, n);
+      });
+    }
+
+    // Seals the objects retired through this slot so far and tries to
+    // reclaim expired bags. Returns how many objects were reclaimed.
+    std::size_t flush() {
+      if (m_slot->bag != nullptr) {
+        m_domain->seal(*m_slot);
+      }
+      return m_domain->collect();
+    }
+
+    epoch_domain &domain() const noexcept { return *m_domain; }
+
+  private:
+    friend class epoch_domain;
+
+    guard(epoch_domain &domain, slot &s) noexcept : m_domain(&domain), m_slot(&s) {}
+
+    epoch_domain *m_domain;
+    slot *m_slot;
+  };
+
+  // Slots bound how many guards can be alive at once; pin() waits for a free
+  // one beyond that.
+  explicit epoch_domain(std::size_t slot_count = default_slot_count())
+    : m_slot_mask(std::bit_ceil(slot_count > 0 ? slot_count : 1) - 1),
+      m_slots(std::make_unique<slot[]>(m_slot_mask + 1)) {}
+
+  epoch_domain(const epoch_domain &) = delete;
+  epoch_domain &operator=(const epoch_domain &) = delete;
+
+  ~epoch_domain() {
+    for (std::size_t i = 0; i <= m_slot_mask; ++i) {
+      if (m_slots[i].bag != nullptr) {
+        reclaim(m_slots[i].bag);
+      }
+    }
+    detail::retire_bag *bag = m_sealed.load(std::memory_order_acquire);
+    while (bag != nullptr) {
+      detail::retire_bag *next = bag->next;
+      reclaim(bag);
+      bag = next;
+    }
+  }
+
+  static std::size_t default_slot_count() noexcept {
+    return std::bit_ceil(std::max<std::size_t>(16, 2 * std::size_t(std::thread::hardware_concurrency())));
+  }
+
+  // Pins the current epoch until the guard is destroyed.
+  [[nodiscard]] guard pin() {
+    std::size_t start = detail::epoch_thread_hint();
+    for (;;) {
+      for (std::size_t i = 0; i <= m_slot_mask; ++i) {
+        slot &s = m_slots[(start + i) & m_slot_mask];
+        std::uint64_t expected = 0;
+        if (s.state.load(std::memory_order_relaxed) != 0) {
+          continue;
+        }
+        std::uint64_t pinned = (m_epoch.load(std::memory_order_relaxed) << 1) | 1;
+        if (s.state.compare_exchange_strong(
+              expected, pinned, std::memory_order_acquire, std::memory_order_relaxed
+            )) {
+          // Orders the announcement before every load of shared pointers.
+          std::atomic_thread_fence(std::memory_order_seq_cst);
+          return guard(*this, s);
+        }
+      }
+      std::this_thread::yield();
+    }
+  }
+
+  // Advances the epoch if every pinned guard has caught up with it and
+  // reclaims the bags that have expired. Returns how many objects were
+  // reclaimed.
+  std::size_t collect() {
+    this->try_advance();
+    std::uint64_t epoch = m_epoch.load(std::memory_order_acquire);
+
+    detail::retire_bag *bag = m_sealed.exchange(nullptr, std::memory_order_acquire);
+    detail::retire_bag *kept = nullptr;
+    detail::retire_bag *kept_tail = nullptr;
+    std::size_t reclaimed = 0;
+    while (bag != nullptr) {
+      detail::retire_bag *next = bag->next;
+      if (epoch - bag->epoch >= 2) {
+        reclaimed += reclaim(bag);
+      } else {
+        bag->next = kept;
+        kept = bag;
+        if (kept_tail == nullptr) {
+          kept_tail = bag;
+        }
+      }
+      bag = next;
+    }
+
+    if (kept != nullptr) {
+      kept_tail->next = m_sealed.load(std::memory_order_relaxed);
+      while (!m_sealed.compare_exchange_weak(
+        kept_tail->next, kept, std::memory_order_release, std::memory_order_relaxed
+      )) {
+      }
+    }
+    return reclaimed;
+  }
+
+  std::uint64_t epoch() const noexcept { return m_epoch.load(std::memory_order_relaxed); }
+
+private:
+  bool try_advance() noexcept {
+    std::uint64_t epoch = m_epoch.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    for (std::size_t i = 0; i <= m_slot_mask; ++i) {
+      // Acquire pairs with the release that unpinned the slot, so whatever
+      // its last guard read happens before the storage is reclaimed.
+      std::uint64_t state = m_slots[i].state.load(std::memory_order_acquire);
+      if (state != 0 && (state >> 1) != epoch) {
+        return false;
+      }
+    }
+    return m_epoch.compare_exchange_strong(
+      epoch, epoch + 1, std::memory_order_release, std::memory_order_relaxed
+    );
+  }
+
+  // Moves the slot's bag to the shared list, tagged with the current epoch.
+  // Every object in it was unlinked before this point, so none can be
+  // reached by a guard that pins a later epoch.
+  void seal(slot &s) noexcept {
+    detail::retire_bag *bag = std::exchange(s.bag, nullptr);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    bag->epoch = m_epoch.load(std::memory_order_relaxed);
+    bag->next = m_sealed.load(std::memory_order_relaxed);
+    while (!m_sealed.compare_exchange_weak(
+      bag->next, bag, std::memory_order_release, std::memory_order_relaxed
+    )) {
+    }
+  }
+
+  static std::size_t reclaim(detail::retire_bag *bag) noexcept {
+    std::size_t count = bag->count;
+    for (std::size_t i = 0; i < count; ++i) {
+      bag->objects[i].run();
+    }
+    delete bag;
+    return count;
+  }
+
+private:
+  std::size_t m_slot_mask;
+  std::unique_ptr<slot[]> m_slots;
+  alignas(detail::cache_line_size) std::atomic<std::uint64_t> m_epoch{0};
+  alignas(detail::cache_line_size) std::atomic<detail::retire_bag *> m_sealed{nullptr};
+};
+
+template <class F>
+void epoch_domain::guard::defer(F &&reclaim) {
+  static_assert(
+    detail::retired_object::fits<std::decay_t<F>>,
+    "deferred reclamations must fit in four pointers"
+  );
+  if (m_slot->bag == nullptr) {
+    m_slot->bag = new detail::retire_bag;
+  }
+  detail::retire_bag &bag = *m_slot->bag;
+  bag.objects[bag.count].emplace(std::forward<F>(reclaim));
+  if (++bag.count == detail::retire_bag::capacity) {
+    m_domain->seal(*m_slot);
+    m_domain->collect();
+  }
+}
+
+} // namespace tinystl
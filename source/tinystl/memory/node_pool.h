@@ -0,0 +1,167 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace tinystl {
+
+// Segregated free-list pool for small, fixed-size blocks (list nodes, tree
+// nodes, ...). Requests are rounded up to a multiple of block_alignment and
+// served from a per-size free list; empty lists are refilled by carving a
+// whole chunk at once, so steady-state allocate/deallocate is a pointer pop
+// or push. Memory is returned to the system only by release() or the
+// destructor. Not thread-safe: share a pool between threads only with
+// external synchronization.
+class node_pool {
+public:
+  static constexpr std::size_t block_alignment = alignof(std::max_align_t);
+  static constexpr std::size_t max_block_size = 512;
+
+  explicit node_pool(std::size_t blocks_per_chunk = 256) noexcept
+    : m_blocks_per_chunk(blocks_per_chunk > 0 ? blocks_per_chunk : 1) {}
+
+  node_pool(const node_pool &) = delete;
+  node_pool &operator=(const node_pool &) = delete;
+
+  ~node_pool() { this->release(); }
+
+  void *allocate(std::size_t bytes, std::size_t align) {
+    if (bytes > max_block_size || align > block_alignment) {
+      return ::operator new(bytes, std::align_val_t(align));
+    }
+
+    std::size_t cls = size_class(bytes);
+    free_block *head = m_free[cls];
+    if (head == nullptr) {
+      head = this->refill(cls);
+    }
+    m_free[cls] = head->next;
+    return head;
+  }
+
+  void deallocate(void *p, std::size_t bytes, std::size_t align) noexcept {
+    if (bytes > max_block_size || align > block_alignment) {
+      ::operator delete(p, std::align_val_t(align));
+      return;
+    }
+
+    std::size_t cls = size_class(bytes);
+    free_block *block = static_cast<free_block *>(p);
+    block->next = m_free[cls];
+    m_free[cls] = block;
+  }
+
+  // Give every chunk back to the system. All blocks handed out by this pool
+  // become invalid.
+  void release() noexcept {
+    while (m_chunks != nullptr) {
+      chunk_header *next = m_chunks->next;
+      ::operator delete(m_chunks, std::align_val_t(block_alignment));
+      m_chunks = next;
+    }
+    for (free_block *&head : m_free) {
+      head = nullptr;
+    }
+  }
+
+  std::size_t blocks_per_chunk() const noexcept { return m_blocks_per_chunk; }
+
+private:
+  struct free_block {
+    free_block *next;
+  };
+
+  struct alignas(block_alignment) chunk_header {
+    chunk_header *next;
+  };
+
+  static constexpr std::size_t class_count = max_block_size / block_alignment;
+
+  static std::size_t size_class(std::size_t bytes) noexcept {
+    return bytes == 0 ? 0 : (bytes - 1) / block_alignment;
+  }
+
+  free_block *refill(std::size_t cls) {
+    std::size_t block_size = (cls + 1) * block_alignment;
+    void *raw = ::operator new(
+      sizeof(chunk_header) + block_size * m_blocks_per_chunk,
+      std::align_val_t(block_alignment)
+    );
+
+    chunk_header *chunk = static_cast<chunk_header *>(raw);
+    chunk->next = m_chunks;
+    m_chunks = chunk;
+
+    // thread the new blocks onto the free list, lowest address first
+    std::byte *first = reinterpret_cast<std::byte *>(chunk + 1);
+    free_block *head = nullptr;
+    for (std::size_t i = m_blocks_per_chunk; i > 0; --i) {
+      free_block *block =
+        reinterpret_cast<free_block *>(first + (i - 1) * block_size);
+      block->next = head;
+      head = block;
+    }
+    return head;
+  }
+
+private:
+  std::size_t m_blocks_per_chunk;
+  chunk_header *m_chunks = nullptr;
+  free_block *m_free[class_count] = {};
+};
+
+// Allocator adaptor over a node_pool. Single-object requests (the node
+// containers' only kind) are served by the pool, anything larger goes to the
+// global heap. Rebound copies share the pool, so
+//   node_pool pool;
+//   tinystl::list<int, pool_allocator<int>> l{pool_allocator<int>(pool)};
+// allocates its nodes from `pool`.
+template <class T>
+class pool_allocator {
+  template <class>
+  friend class pool_allocator;
+
+public:
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+  using is_always_equal = std::false_type;
+
+  explicit pool_allocator(node_pool &pool) noexcept : m_pool(&pool) {}
+  template <class U>
+  pool_allocator(const pool_allocator<U> &other) noexcept
+    : m_pool(other.m_pool) {}
+
+  T *allocate(std::size_t n) {
+    if (n == 1) {
+      return static_cast<T *>(m_pool->allocate(sizeof(T), alignof(T)));
+    }
+    return static_cast<T *>(
+      ::operator new(n * sizeof(T), std::align_val_t(alignof(T)))
+    );
+  }
+
+  void deallocate(T *p, std::size_t n) noexcept {
+    if (n == 1) {
+      m_pool->deallocate(p, sizeof(T), alignof(T));
+    } else {
+      ::operator delete(p, std::align_val_t(alignof(T)));
+    }
+  }
+
+  node_pool &pool() const noexcept { return *m_pool; }
+
+  template <class U>
+  friend bool
+  operator==(const pool_allocator &lhs, const pool_allocator<U> &rhs) {
+    return &lhs.pool() == &rhs.pool();
+  }
+
+private:
+  node_pool *m_pool;
+};
+
+} // namespace tinystl
@@ -0,0 +1,194 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <tinystl/algorithm/numeric.h>
+#include <tinystl/container/segmented_vector.h>
+
+namespace {
+
+std::vector<double> random_doubles(std::size_t n) {
+  std::mt19937_64 rng(42);
+  std::uniform_real_distribution<double> dist(-1e6, 1e6);
+  std::vector<double> v(n);
+  for (double &x : v) {
+    x = dist(rng);
+  }
+  return v;
+}
+
+} // namespace
+
+TEST_CASE("Floating-point sum kernels agree bit for bit", "[numeric][simd]") {
+  std::vector<double> d = random_doubles(10007);
+  std::vector<float> f(d.begin(), d.end());
+
+  for (std::size_t n : {std::size_t(0), std::size_t(1), std::size_t(15), std::size_t(17), std::size_t(33), d.size()}) {
+    double expected = tinystl::detail::scalar_sum(d.data(), n);
+    float expected_f = tinystl::detail::scalar_sum(f.data(), n);
+    REQUIRE(tinystl::detail::simd_sum(d.data(), n) == expected);
+    REQUIRE(tinystl::detail::simd_sum(f.data(), n) == expected_f);
+#if defined(TINYSTL_SIMD_X86)
+    REQUIRE(tinystl::detail::sse2_sum(d.data(), n) == expected);
+    REQUIRE(tinystl::detail::sse2_sum(f.data(), n) == expected_f);
+    if (tinystl::detail::active_simd_isa() == tinystl::detail::simd_isa::avx2) {
+      REQUIRE(tinystl::detail::avx2_sum(d.data(), n) == expected);
+      REQUIRE(tinystl::detail::avx2_sum(f.data(), n) == expected_f);
+    }
+#endif
+    double dot = std::inner_product(d.begin(), d.begin() + n, d.begin(), 0.0);
+    REQUIRE(std::abs(tinystl::detail::simd_dot(d.data(), d.data(), n) - dot) <= 1e-9 * dot);
+  }
+}
+
+TEST_CASE("Reduce and transform_reduce", "[numeric]") {
+  tinystl::thread_pool pool(4);
+  auto par = tinystl::execution::par.on(pool);
+
+  SECTION("floating-point sums stay close to a careful sum") {
+    std::vector<double> v = random_doubles(100000);
+    double exact = 0;
+    for (double x : v) {
+      exact += x;
+    }
+    REQUIRE(std::abs(tinystl::reduce(v.begin(), v.end()) - exact) < 1e-3);
+    REQUIRE(std::abs(tinystl::reduce(par, v.begin(), v.end(), 1.0) - (exact + 1.0)) < 1e-3);
+    REQUIRE(std::abs(tinystl::transform_reduce(v.begin(), v.end(), v.begin(), 0.0) - std::inner_product(v.begin(), v.end(), v.begin(), 0.0)) < 1e3);
+  }
+
+  SECTION("integer and custom operations") {
+    std::vector<std::int64_t> v(300000);
+    std::iota(v.begin(), v.end(), 1);
+    const std::int64_t n = static_cast<std::int64_t>(v.size());
+    REQUIRE(tinystl::transform_reduce(par, v.begin(), v.end(), std::int64_t(0), std::plus<>(), [](std::int64_t x) { return 2 * x; }) == n * (n + 1));
+    REQUIRE(tinystl::transform_reduce(par, v.begin(), v.end(), v.begin(), std::int64_t(5)) == n * (n + 1) * (2 * n + 1) / 6 + 5);
+    auto max = [](std::int64_t a, std::int64_t b) { return a < b ? b : a; };
+    REQUIRE(tinystl::transform_reduce(par, v.begin(), v.end(), v.begin(), std::int64_t(0), max, std::minus<>()) == 0);
+    REQUIRE(tinystl::transform_reduce(v.begin(), v.end(), std::int64_t(0), std::plus<>(), [](std::int64_t x) { return x % 2; }) == n / 2);
+  }
+
+  SECTION("forward iterators run sequentially") {
+    std::list<int> l{1, 2, 3, 4};
+    REQUIRE(tinystl::transform_reduce(par, l.begin(), l.end(), 0, std::plus<>(), [](int x) { return x * x; }) == 30);
+    REQUIRE(tinystl::transform_reduce(par, l.begin(), l.end(), l.begin(), 0) == 30);
+  }
+
+  SECTION("deterministic reductions do not depend on the pool") {
+    std::vector<double> v = random_doubles(200003);
+    tinystl::thread_pool one(1);
+    tinystl::thread_pool three(3);
+    double a = tinystl::reduce(tinystl::execution::par.on(one).deterministic(), v.begin(), v.end());
+    double b = tinystl::reduce(tinystl::execution::par.deterministic().on(three), v.begin(), v.end());
+    double c = tinystl::reduce(par.deterministic(), v.begin(), v.end());
+    REQUIRE(a == b);
+    REQUIRE(a == c);
+
+    auto square = [](double x) { return x * x; };
+    REQUIRE(
+      tinystl::transform_reduce(tinystl::execution::par.on(one).deterministic(), v.begin(), v.end(), 0.0, std::plus<>(), square) ==
+      tinystl::transform_reduce(par.deterministic(), v.begin(), v.end(), 0.0, std::plus<>(), square)
+    );
+  }
+
+  SECTION("constant evaluation") {
+    constexpr int sum = [] {
+      int a[] = {1, 2, 3, 4};
+      return tinystl::reduce(a, a + 4) + tinystl::transform_reduce(a, a + 4, a, 0);
+    }();
+    STATIC_REQUIRE(sum == 40);
+  }
+}
+
+TEST_CASE("Inclusive and exclusive scans", "[numeric]") {
+  tinystl::thread_pool pool(4);
+  auto par = tinystl::execution::par.on(pool);
+
+  std::vector<std::int64_t> v(100003);
+  std::iota(v.begin(), v.end(), -50000);
+  std::vector<std::int64_t> inclusive(v.size());
+  std::vector<std::int64_t> exclusive(v.size());
+  std::inclusive_scan(v.begin(), v.end(), inclusive.begin());
+  std::exclusive_scan(v.begin(), v.end(), exclusive.begin(), std::int64_t(7));
+
+  SECTION("sequential") {
+    std::vector<std::int64_t> out(v.size());
+    REQUIRE(tinystl::inclusive_scan(v.begin(), v.end(), out.begin()) == out.end());
+    REQUIRE(out == inclusive);
+    tinystl::exclusive_scan(v.begin(), v.end(), out.begin(), std::int64_t(7));
+    REQUIRE(out == exclusive);
+    tinystl::inclusive_scan(v.begin(), v.end(), out.begin(), std::plus<>(), std::int64_t(0));
+    REQUIRE(out == inclusive);
+  }
+
+  SECTION("parallel, including in place") {
+    std::vector<std::int64_t> out(v.size());
+    REQUIRE(tinystl::inclusive_scan(par, v.begin(), v.end(), out.begin()) == out.end());
+    REQUIRE(out == inclusive);
+    REQUIRE(tinystl::exclusive_scan(par, v.begin(), v.end(), out.begin(), std::int64_t(7)) == out.end());
+    REQUIRE(out == exclusive);
+    tinystl::inclusive_scan(par.deterministic(), v.begin(), v.end(), out.begin(), std::plus<>(), std::int64_t(0));
+    REQUIRE(out == inclusive);
+
+    std::vector<std::int64_t> in_place = v;
+    tinystl::inclusive_scan(par, in_place.begin(), in_place.end(), in_place.begin());
+    REQUIRE(in_place == inclusive);
+  }
+
+  SECTION("non-commutative operations keep their order") {
+    std::vector<std::string> words(20000, "ab");
+    std::vector<std::string> out(words.size());
+    tinystl::exclusive_scan(par.deterministic(), words.begin(), words.end(), out.begin(), std::string(">"));
+    REQUIRE(out[0] == ">");
+    REQUIRE(out[3] == ">ababab");
+    REQUIRE(out.back().size() == 1 + 2 * (words.size() - 1));
+  }
+
+  SECTION("empty ranges") {
+    std::vector<std::int64_t> empty;
+    REQUIRE(tinystl::inclusive_scan(par, empty.begin(), empty.end(), empty.begin()) == empty.begin());
+    REQUIRE(tinystl::exclusive_scan(par.deterministic(), empty.begin(), empty.end(), empty.begin(), 0) == empty.begin());
+    REQUIRE(tinystl::inclusive_scan(empty.begin(), empty.end(), empty.begin()) == empty.begin());
+  }
+}
+
+TEST_CASE("Numeric algorithms over segmented ranges", "[numeric][segmented]") {
+  tinystl::thread_pool pool(3);
+  auto par = tinystl::execution::par.on(pool);
+
+  std::vector<double> source = random_doubles(50000);
+  tinystl::segmented_vector<double> seg;
+  for (double x : source) {
+    seg.push_back(x);
+  }
+
+  // Each segment is summed on its own, so compare against the same per-run
+  // kernel calls.
+  double by_runs = 0;
+  tinystl::for_each_segment(seg.begin(), seg.end(), [&](const double *b, const double *e) {
+    by_runs += tinystl::detail::simd_sum(b, static_cast<std::size_t>(e - b));
+  });
+  REQUIRE(tinystl::reduce(seg.begin(), seg.end()) == by_runs);
+  REQUIRE(std::abs(tinystl::reduce(par, seg.begin(), seg.end()) - by_runs) < 1e-3);
+  REQUIRE(std::abs(tinystl::transform_reduce(seg.begin(), seg.end(), source.begin(), 0.0) - std::inner_product(source.begin(), source.end(), source.begin(), 0.0)) < 1e3);
+
+  std::vector<std::int64_t> ints(50000);
+  std::iota(ints.begin(), ints.end(), 0);
+  tinystl::segmented_vector<std::int64_t> iseg;
+  for (std::int64_t x : ints) {
+    iseg.push_back(x);
+  }
+  std::vector<std::int64_t> expected(ints.size());
+  std::inclusive_scan(ints.begin(), ints.end(), expected.begin());
+  std::vector<std::int64_t> out(ints.size());
+  tinystl::inclusive_scan(iseg.begin(), iseg.end(), out.begin());
+  REQUIRE(out == expected);
+  tinystl::inclusive_scan(par.deterministic(), iseg.begin(), iseg.end(), iseg.begin());
+  REQUIRE(std::equal(iseg.begin(), iseg.end(), expected.begin(), expected.end()));
+}
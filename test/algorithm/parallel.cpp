@@ -0,0 +1,109 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <tinystl/algorithm/algorithm.h>
+
+TEST_CASE("Parallel for_each", "[parallel][for_each]") {
+  tinystl::thread_pool pool(4);
+
+  SECTION("visits every element exactly once") {
+    std::vector<std::atomic<int>> hits(100000);
+    tinystl::for_each(tinystl::execution::par.on(pool), hits.begin(), hits.end(), [](std::atomic<int> &h) { ++h; });
+    REQUIRE(std::all_of(hits.begin(), hits.end(), [](const std::atomic<int> &h) { return h == 1; }));
+  }
+
+  SECTION("forward iterators run sequentially") {
+    std::list<int> l(1000, 1);
+    tinystl::for_each(tinystl::execution::par.on(pool), l.begin(), l.end(), [](int &x) { x *= 3; });
+    REQUIRE(std::accumulate(l.begin(), l.end(), 0) == 3000);
+  }
+
+  SECTION("exceptions reach the caller") {
+    std::vector<int> v(100000);
+    auto throwing = [](int &x) {
+      if (x == 0) {
+        throw std::runtime_error("element");
+      }
+    };
+    REQUIRE_THROWS_AS(
+      tinystl::for_each(tinystl::execution::par.on(pool), v.begin(), v.end(), throwing),
+      std::runtime_error
+    );
+  }
+
+  SECTION("sequential overload") {
+    std::vector<int> v{1, 2, 3};
+    int sum = 0;
+    tinystl::for_each(v.begin(), v.end(), [&sum](int x) { sum += x; });
+    REQUIRE(sum == 6);
+  }
+}
+
+TEST_CASE("Parallel transform, fill and copy", "[parallel]") {
+  tinystl::thread_pool pool(3);
+  const std::size_t n = 200003;
+  std::vector<std::int64_t> src(n);
+  std::iota(src.begin(), src.end(), 0);
+
+  SECTION("unary transform") {
+    std::vector<std::int64_t> dst(n);
+    auto end = tinystl::transform(tinystl::execution::par_unseq.on(pool), src.begin(), src.end(), dst.begin(), [](std::int64_t x) { return x * x; });
+    REQUIRE(end == dst.end());
+    for (std::size_t i = 0; i < n; i += 997) {
+      REQUIRE(dst[i] == std::int64_t(i) * std::int64_t(i));
+    }
+  }
+
+  SECTION("binary transform") {
+    std::vector<std::int64_t> dst(n);
+    tinystl::transform(tinystl::execution::par.on(pool), src.begin(), src.end(), src.begin(), dst.begin(), std::plus<>());
+    REQUIRE(dst.back() == 2 * std::int64_t(n - 1));
+    REQUIRE(std::equal(dst.begin(), dst.end(), src.begin(), [](auto d, auto s) { return d == 2 * s; }));
+  }
+
+  SECTION("fill") {
+    std::vector<std::string> v(50000);
+    tinystl::fill(tinystl::execution::par.on(pool), v.begin(), v.end(), std::string("x"));
+    REQUIRE(std::count(v.begin(), v.end(), "x") == 50000);
+  }
+
+  SECTION("copy") {
+    std::vector<std::int64_t> dst(n);
+    auto end = tinystl::copy(tinystl::execution::par.on(pool), src.begin(), src.end(), dst.begin());
+    REQUIRE(end == dst.end());
+    REQUIRE(dst == src);
+  }
+}
+
+TEST_CASE("Parallel reduce", "[parallel][reduce]") {
+  tinystl::thread_pool pool(4);
+
+  SECTION("sum") {
+    std::vector<std::int64_t> v(1000001);
+    std::iota(v.begin(), v.end(), 0);
+    REQUIRE(tinystl::reduce(tinystl::execution::par.on(pool), v.begin(), v.end()) == std::int64_t(1000000) * 1000001 / 2);
+    REQUIRE(tinystl::reduce(tinystl::execution::par.on(pool), v.begin(), v.end(), std::int64_t(10)) == std::int64_t(1000000) * 1000001 / 2 + 10);
+  }
+
+  SECTION("custom operation and type") {
+    std::vector<int> v(100000);
+    std::iota(v.begin(), v.end(), -50000);
+    auto max = [](int a, int b) { return std::max(a, b); };
+    REQUIRE(tinystl::reduce(tinystl::execution::par.on(pool), v.begin(), v.end(), -1000000, max) == 49999);
+  }
+
+  SECTION("small and empty ranges") {
+    std::vector<int> v{1, 2, 3};
+    REQUIRE(tinystl::reduce(tinystl::execution::par.on(pool), v.begin(), v.end()) == 6);
+    REQUIRE(tinystl::reduce(tinystl::execution::par.on(pool), v.begin(), v.begin(), 5) == 5);
+    REQUIRE(tinystl::reduce(v.begin(), v.end()) == 6);
+  }
+}
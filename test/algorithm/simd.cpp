@@ -0,0 +1,169 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <compare>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <tinystl/algorithm/algorithm.h>
+#include <tinystl/container/array.h>
+#include <tinystl/container/inplace_vector.h>
+#include <tinystl/container/vector.h>
+
+namespace {
+enum class color : std::uint16_t { red, green, blue };
+
+template <class T>
+std::vector<T> sawtooth(std::size_t n, std::size_t period) {
+  std::vector<T> values(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    values[i] = static_cast<T>(i % period);
+  }
+  return values;
+}
+
+// Checks every kernel family of one element type against the standard
+// algorithms, over lengths that straddle the vector widths.
+template <class T>
+void check_against_std() {
+  for (std::size_t n : {0u, 1u, 7u, 15u, 16u, 17u, 31u, 32u, 33u, 64u, 100u, 1000u}) {
+    auto values = sawtooth<T>(n, 37);
+    for (T needle : {T(0), T(5), T(36), T(99)}) {
+      REQUIRE(tinystl::find(values.begin(), values.end(), needle) ==
+              std::find(values.begin(), values.end(), needle));
+      REQUIRE(tinystl::count(values.begin(), values.end(), needle) ==
+              std::count(values.begin(), values.end(), needle));
+
+      auto removed = values;
+      auto expected = values;
+      auto end = tinystl::remove(removed.begin(), removed.end(), needle);
+      auto expected_end = std::remove(expected.begin(), expected.end(), needle);
+      REQUIRE(end - removed.begin() == expected_end - expected.begin());
+      REQUIRE(std::equal(removed.begin(), end, expected.begin()));
+    }
+
+    for (std::size_t at : {std::size_t(0), n / 2, n - 1}) {
+      if (at >= n) {
+        continue;
+      }
+      auto other = values;
+      other[at] = T(90);
+      REQUIRE(tinystl::mismatch(values.begin(), values.end(), other.begin()).first - values.begin() == std::ptrdiff_t(at));
+      REQUIRE(!tinystl::equal(values.begin(), values.end(), other.begin(), other.end()));
+      REQUIRE(tinystl::lexicographical_compare(values.begin(), values.end(), other.begin(), other.end()));
+      REQUIRE(tinystl::lexicographical_compare_three_way(other.begin(), other.end(), values.begin(), values.end()) ==
+              std::lexicographical_compare_three_way(other.begin(), other.end(), values.begin(), values.end()));
+    }
+    REQUIRE(tinystl::equal(values.begin(), values.end(), values.begin(), values.end()));
+  }
+}
+} // namespace
+
+TEST_CASE("SIMD algorithms match the standard ones", "[simd]") {
+  SECTION("8-bit") { check_against_std<std::uint8_t>(); }
+  SECTION("signed 8-bit") { check_against_std<signed char>(); }
+  SECTION("16-bit") { check_against_std<std::int16_t>(); }
+  SECTION("32-bit") { check_against_std<std::uint32_t>(); }
+  SECTION("64-bit") { check_against_std<std::int64_t>(); }
+  SECTION("enum") { check_against_std<color>(); }
+}
+
+TEST_CASE("SIMD kernels for every instruction set", "[simd]") {
+  // The dispatcher only reaches the widest set the CPU has; call the others
+  // directly so each stays covered.
+  auto values = sawtooth<std::uint32_t>(1000, 251);
+  auto bytes = reinterpret_cast<const unsigned char *>(values.data());
+  const std::size_t n = values.size();
+  auto expected_count = static_cast<std::size_t>(std::count(values.begin(), values.end(), 250u));
+
+  REQUIRE(tinystl::detail::scalar_find<4>(bytes, n, 250) == 250);
+  REQUIRE(tinystl::detail::scalar_count<4>(bytes, n, 250) == expected_count);
+#if defined(TINYSTL_SIMD_X86)
+  REQUIRE(tinystl::detail::sse2_find<4>(bytes, n, 250) == 250);
+  REQUIRE(tinystl::detail::sse2_count<4>(bytes, n, 250) == expected_count);
+  REQUIRE(tinystl::detail::sse2_count<8>(bytes, n / 2, 250) == tinystl::detail::scalar_count<8>(bytes, n / 2, 250));
+  if (tinystl::detail::active_simd_isa() == tinystl::detail::simd_isa::avx2) {
+    REQUIRE(tinystl::detail::avx2_find<4>(bytes, n, 250) == 250);
+    REQUIRE(tinystl::detail::avx2_count<4>(bytes, n, 250) == expected_count);
+  }
+#endif
+
+  SECTION("byte counts past the accumulator flush") {
+    std::vector<std::uint8_t> ones(100000, 1);
+    ones[12345] = 2;
+    REQUIRE(tinystl::count(ones.begin(), ones.end(), std::uint8_t(1)) == 99999);
+#if defined(TINYSTL_SIMD_X86)
+    REQUIRE(tinystl::detail::sse2_count<1>(ones.data(), ones.size(), 1) == 99999);
+    REQUIRE(tinystl::detail::sse2_count<2>(ones.data(), ones.size() / 2, 0x0101) == 49999);
+#endif
+  }
+
+  SECTION("64-bit lanes need both halves to match") {
+    std::vector<std::uint64_t> v(64, 0x1111111122222222ull);
+    v[40] = 0x2222222211111111ull;
+    v[50] = 0x1111111100000000ull;
+    std::uint64_t needle = 0x2222222211111111ull;
+    REQUIRE(tinystl::find(v.begin(), v.end(), needle) - v.begin() == 40);
+    REQUIRE(tinystl::count(v.begin(), v.end(), 0x1111111122222222ull) == 62);
+  }
+}
+
+TEST_CASE("SIMD fallbacks", "[simd]") {
+  SECTION("mismatched value type uses the scalar path") {
+    std::vector<std::uint8_t> v{1, 2, 255};
+    REQUIRE(tinystl::find(v.begin(), v.end(), -1) == v.end());
+    REQUIRE(tinystl::count(v.begin(), v.end(), 255) == 1);
+  }
+
+  SECTION("non-contiguous and non-scalar ranges") {
+    std::list<int> l{3, 1, 3, 2};
+    REQUIRE(tinystl::count(l.begin(), l.end(), 3) == 2);
+    std::vector<std::string> s{"a", "b", "a"};
+    REQUIRE(tinystl::remove(s.begin(), s.end(), std::string("a")) == s.begin() + 1);
+    REQUIRE(s[0] == "b");
+  }
+
+  SECTION("floating point keeps its own equality") {
+    std::vector<double> d{1.0, -0.0, 2.0};
+    REQUIRE(tinystl::find(d.begin(), d.end(), 0.0) == d.begin() + 1);
+  }
+
+  SECTION("custom predicate") {
+    std::vector<int> a{1, 2, 3}, b{-1, -2, -3};
+    auto abs_equal = [](int x, int y) { return x == -y; };
+    REQUIRE(tinystl::equal(a.begin(), a.end(), b.begin(), abs_equal));
+  }
+
+  SECTION("remove_if compacts in order") {
+    std::vector<int> v = sawtooth<int>(1000, 10);
+    auto expected = v;
+    auto odd = [](int x) { return x % 2 != 0; };
+    auto end = tinystl::remove_if(v.begin(), v.end(), odd);
+    auto expected_end = std::remove_if(expected.begin(), expected.end(), odd);
+    REQUIRE(std::equal(v.begin(), end, expected.begin(), expected_end));
+  }
+}
+
+TEST_CASE("Containers use the SIMD algorithms", "[simd]") {
+  tinystl::vector<int> a{1, 2, 3, 4, 5};
+  tinystl::vector<int> b{1, 2, 3, 4, 6};
+  REQUIRE(a != b);
+  REQUIRE((a <=> b) == std::strong_ordering::less);
+  REQUIRE(tinystl::erase(a, 3) == 1);
+  REQUIRE(tinystl::erase_if(b, [](int x) { return x > 3; }) == 2);
+  REQUIRE(a == tinystl::vector<int>{1, 2, 4, 5});
+
+  tinystl::array<char, 4> x{'a', 'b', 'c', 'd'};
+  tinystl::array<char, 4> y{'a', 'b', 'd', 'a'};
+  REQUIRE(x < y);
+
+  REQUIRE(x == x);
+
+  tinystl::inplace_vector<std::uint16_t, 40> iv(40, 7);
+  iv[30] = 8;
+  REQUIRE(tinystl::erase(iv, std::uint16_t(7)) == 39);
+  REQUIRE(iv.size() == 1);
+}
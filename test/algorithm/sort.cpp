@@ -0,0 +1,252 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <tinystl/algorithm/sort.h>
+#include <tinystl/container/vector.h>
+
+namespace {
+template <class T>
+std::vector<T> random_values(std::size_t n, std::uint32_t seed, T lo, T hi) {
+  std::mt19937_64 rng(seed);
+  std::vector<T> values(n);
+  for (T &v : values) {
+    if constexpr (std::is_floating_point_v<T>) {
+      v = std::uniform_real_distribution<T>(lo, hi)(rng);
+    } else {
+      v = static_cast<T>(std::uniform_int_distribution<long long>(lo, hi)(rng));
+    }
+  }
+  return values;
+}
+
+// Orders by key only, so the payload tells apart equal keys.
+struct keyed {
+  int key;
+  int order;
+};
+
+struct by_key {
+  bool operator()(const keyed &a, const keyed &b) const { return a.key < b.key; }
+};
+
+std::vector<keyed> keyed_values(std::size_t n, int keys) {
+  std::mt19937 rng(7);
+  std::vector<keyed> values(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    values[i] = {static_cast<int>(rng() % keys), static_cast<int>(i)};
+  }
+  return values;
+}
+
+bool stably_sorted(const std::vector<keyed> &values) {
+  return std::is_sorted(values.begin(), values.end(), [](auto &a, auto &b) {
+    return a.key < b.key || (a.key == b.key && a.order < b.order);
+  });
+}
+} // namespace
+
+TEST_CASE("Sort small and patterned inputs", "[sort]") {
+  SECTION("empty and single element") {
+    std::vector<int> v;
+    tinystl::sort(v.begin(), v.end());
+    REQUIRE(v.empty());
+    v.push_back(1);
+    tinystl::sort(v.begin(), v.end());
+    REQUIRE(v == std::vector<int>{1});
+  }
+
+  SECTION("every size below the pdqsort thresholds") {
+    for (std::size_t n = 0; n < 300; ++n) {
+      auto v = random_values<int>(n, n, -50, 50);
+      auto expected = v;
+      std::sort(expected.begin(), expected.end());
+      tinystl::sort(v.begin(), v.end());
+      REQUIRE(v == expected);
+    }
+  }
+
+  SECTION("sorted, reversed, organ pipe and all equal") {
+    const int n = 5000;
+    std::vector<std::vector<int>> inputs(4, std::vector<int>(n));
+    for (int i = 0; i < n; ++i) {
+      inputs[0][i] = i;
+      inputs[1][i] = n - i;
+      inputs[2][i] = i < n / 2 ? i : n - i;
+      inputs[3][i] = 42;
+    }
+    for (auto &v : inputs) {
+      tinystl::sort(v.begin(), v.end(), std::greater<>());
+      REQUIRE(std::is_sorted(v.begin(), v.end(), std::greater<>()));
+    }
+  }
+
+  SECTION("adversarial input falls back without breaking") {
+    // Sawtooth of few values; every partition is lopsided.
+    std::vector<int> v(20000);
+    for (std::size_t i = 0; i < v.size(); ++i) {
+      v[i] = static_cast<int>(i % 3 == 0 ? i : 7);
+    }
+    tinystl::sort(v.begin(), v.end(), [](int a, int b) { return a < b; });
+    REQUIRE(std::is_sorted(v.begin(), v.end()));
+  }
+}
+
+TEST_CASE("Sort custom types and iterators", "[sort]") {
+  SECTION("strings") {
+    std::vector<std::string> v;
+    for (int i = 0; i < 1000; ++i) {
+      v.push_back(std::to_string((i * 7919) % 1000));
+    }
+    auto expected = v;
+    std::sort(expected.begin(), expected.end());
+    tinystl::sort(v.begin(), v.end());
+    REQUIRE(v == expected);
+  }
+
+  SECTION("non-contiguous random access iterators") {
+    auto values = random_values<int>(5000, 3, 0, 1000);
+    std::deque<int> d(values.begin(), values.end());
+    tinystl::sort(d.begin(), d.end());
+    REQUIRE(std::is_sorted(d.begin(), d.end()));
+  }
+
+  SECTION("tinystl vector") {
+    auto values = random_values<int>(4096, 5, -1000, 1000);
+    tinystl::vector<int> v(values.begin(), values.end());
+    tinystl::sort(v.begin(), v.end());
+    std::sort(values.begin(), values.end());
+    REQUIRE(std::equal(v.begin(), v.end(), values.begin(), values.end()));
+  }
+}
+
+TEST_CASE("Sort arithmetic keys through the radix path", "[sort][radix]") {
+  SECTION("signed integers including extremes") {
+    auto v = random_values<std::int64_t>(10000, 11, -1000000, 1000000);
+    v[0] = std::numeric_limits<std::int64_t>::min();
+    v[1] = std::numeric_limits<std::int64_t>::max();
+    auto expected = v;
+    std::sort(expected.begin(), expected.end());
+    tinystl::sort(v.begin(), v.end());
+    REQUIRE(v == expected);
+  }
+
+  SECTION("narrow unsigned range skips constant digits") {
+    auto v = random_values<std::uint32_t>(10000, 13, 0, 200);
+    auto expected = v;
+    std::sort(expected.begin(), expected.end());
+    tinystl::sort(v.begin(), v.end(), std::less<std::uint32_t>());
+    REQUIRE(v == expected);
+  }
+
+  SECTION("8 and 16 bit keys") {
+    auto bytes = random_values<std::int8_t>(5000, 17, -128, 127);
+    auto shorts = random_values<std::uint16_t>(5000, 19, 0, 65535);
+    tinystl::sort(bytes.begin(), bytes.end());
+    tinystl::sort(shorts.begin(), shorts.end());
+    REQUIRE(std::is_sorted(bytes.begin(), bytes.end()));
+    REQUIRE(std::is_sorted(shorts.begin(), shorts.end()));
+  }
+
+  SECTION("floating point with signed zeros and infinities") {
+    auto v = random_values<double>(10000, 23, -1e6, 1e6);
+    v[0] = -0.0;
+    v[1] = 0.0;
+    v[2] = std::numeric_limits<double>::infinity();
+    v[3] = -std::numeric_limits<double>::infinity();
+    v[4] = std::numeric_limits<double>::denorm_min();
+    auto expected = v;
+    std::sort(expected.begin(), expected.end());
+    tinystl::sort(v.begin(), v.end());
+    REQUIRE(v == expected);
+  }
+
+  SECTION("stable_sort keeps signed zeros in input order") {
+    std::vector<float> v(4096, 1.0f);
+    v[10] = -0.0f;
+    v[20] = 0.0f;
+    v[30] = -0.0f;
+    tinystl::stable_sort(v.begin(), v.end());
+    REQUIRE(std::signbit(v[0]));
+    REQUIRE(!std::signbit(v[1]));
+    REQUIRE(std::signbit(v[2]));
+  }
+}
+
+TEST_CASE("Stable sort", "[stable_sort]") {
+  SECTION("equal keys keep their order") {
+    auto v = keyed_values(20000, 50);
+    tinystl::stable_sort(v.begin(), v.end(), by_key());
+    REQUIRE(stably_sorted(v));
+  }
+
+  SECTION("parallel stable sort") {
+    auto v = keyed_values(200000, 1000);
+    tinystl::stable_sort(tinystl::execution::par, v.begin(), v.end(), by_key());
+    REQUIRE(stably_sorted(v));
+  }
+
+  SECTION("sequenced policy") {
+    auto v = keyed_values(1000, 10);
+    tinystl::stable_sort(tinystl::execution::seq, v.begin(), v.end(), by_key());
+    REQUIRE(stably_sorted(v));
+  }
+}
+
+TEST_CASE("Parallel sort", "[sort][parallel]") {
+  SECTION("large random input on the global pool") {
+    auto v = random_values<int>(300000, 29, 0, 1 << 30);
+    auto expected = v;
+    std::sort(expected.begin(), expected.end());
+    tinystl::sort(tinystl::execution::par, v.begin(), v.end(), std::greater<>());
+    REQUIRE(std::equal(v.rbegin(), v.rend(), expected.begin()));
+  }
+
+  SECTION("explicit pool and few unique keys") {
+    tinystl::thread_pool pool(4);
+    auto v = random_values<int>(300000, 31, 0, 8);
+    tinystl::sort(
+      tinystl::execution::par.on(pool), v.begin(), v.end(),
+      [](int a, int b) { return a < b; }
+    );
+    REQUIRE(std::is_sorted(v.begin(), v.end()));
+  }
+
+  SECTION("strings") {
+    tinystl::thread_pool pool(3);
+    std::vector<std::string> v;
+    for (int i = 0; i < 100000; ++i) {
+      v.push_back(std::to_string((i * 7919LL) % 100003));
+    }
+    auto expected = v;
+    std::sort(expected.begin(), expected.end());
+    tinystl::sort(tinystl::execution::par.on(pool), v.begin(), v.end());
+    REQUIRE(v == expected);
+  }
+
+  SECTION("comparator exceptions reach the caller") {
+    tinystl::thread_pool pool(2);
+    auto v = random_values<int>(100000, 37, 0, 1000);
+    std::atomic<int> calls{0};
+    auto throwing = [&calls](int a, int b) {
+      if (++calls > 500000) {
+        throw std::runtime_error("comparator");
+      }
+      return a < b;
+    };
+    REQUIRE_THROWS_AS(
+      tinystl::sort(tinystl::execution::par.on(pool), v.begin(), v.end(), throwing),
+      std::runtime_error
+    );
+  }
+}
@@ -0,0 +1,200 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <tinystl/concurrent/bounded_queue.h>
+
+namespace {
+
+struct tracked {
+  static inline int live = 0;
+
+  int value;
+
+  explicit tracked(int v) : value(v) { ++live; }
+  tracked(tracked &&other) noexcept : value(other.value) { ++live; }
+  tracked &operator=(tracked &&) noexcept = default;
+  ~tracked() { --live; }
+};
+
+struct throws_on_negative {
+  int value;
+
+  explicit throws_on_negative(int v) : value(v) {
+    if (v < 0) {
+      throw std::invalid_argument("negative");
+    }
+  }
+  throws_on_negative(throws_on_negative &&) noexcept = default;
+  throws_on_negative &operator=(throws_on_negative &&) noexcept = default;
+};
+
+template <class T>
+struct counting_allocator {
+  using value_type = T;
+
+  std::shared_ptr<std::size_t> bytes;
+
+  counting_allocator() : bytes(std::make_shared<std::size_t>(0)) {}
+  template <class U>
+  counting_allocator(const counting_allocator<U> &other) noexcept : bytes(other.bytes) {}
+
+  T *allocate(std::size_t n) {
+    *bytes += n * sizeof(T);
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *p, std::size_t n) noexcept {
+    *bytes -= n * sizeof(T);
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  template <class U>
+  bool operator==(const counting_allocator<U> &other) const noexcept {
+    return bytes == other.bytes;
+  }
+};
+
+// Each producer pushes the values [id * per, (id + 1) * per); consumers check
+// that no value is lost or seen twice, and that values from one producer
+// arrive in the order they were pushed.
+template <class Queue>
+void stress(std::size_t producers, std::size_t consumers, std::size_t per) {
+  Queue queue(64);
+  const std::size_t total = producers * per;
+  std::vector<std::atomic<int>> seen(total);
+  std::atomic<std::size_t> popped{0};
+  std::atomic<bool> ordered{true};
+
+  std::vector<std::thread> threads;
+  for (std::size_t id = 0; id < producers; ++id) {
+    threads.emplace_back([&, id] {
+      for (std::size_t i = 0; i < per; ++i) {
+        queue.push(id * per + i);
+      }
+    });
+  }
+  for (std::size_t c = 0; c < consumers; ++c) {
+    threads.emplace_back([&] {
+      std::vector<std::size_t> last(producers, 0);
+      std::vector<bool> any(producers, false);
+      while (popped.load() < total) {
+        std::size_t value;
+        if (!queue.try_pop(value)) {
+          std::this_thread::yield();
+          continue;
+        }
+        ++popped;
+        ++seen[value];
+        std::size_t id = value / per;
+        if (any[id] && value <= last[id]) {
+          ordered = false;
+        }
+        any[id] = true;
+        last[id] = value;
+      }
+    });
+  }
+  for (auto &t : threads) {
+    t.join();
+  }
+
+  REQUIRE(popped == total);
+  REQUIRE(ordered);
+  bool exactly_once = true;
+  for (auto &s : seen) {
+    exactly_once = exactly_once && s.load() == 1;
+  }
+  REQUIRE(exactly_once);
+  REQUIRE(queue.empty());
+}
+
+} // namespace
+
+TEST_CASE("Bounded queue", "[bounded_queue]") {
+  SECTION("capacity rounds up to a power of two") {
+    REQUIRE(tinystl::mpmc_queue<int>(0).capacity() == 2);
+    REQUIRE(tinystl::mpmc_queue<int>(5).capacity() == 8);
+    REQUIRE(tinystl::spsc_queue<int>(16).capacity() == 16);
+  }
+
+  SECTION("is FIFO and reports full and empty") {
+    tinystl::mpmc_queue<int> queue(4);
+    REQUIRE(queue.empty());
+    REQUIRE_FALSE(queue.try_pop().has_value());
+
+    for (int round = 0; round < 3; ++round) {
+      for (int i = 0; i < 4; ++i) {
+        REQUIRE(queue.try_push(round * 10 + i));
+      }
+      REQUIRE_FALSE(queue.try_push(99));
+      REQUIRE(queue.size() == 4);
+
+      for (int i = 0; i < 4; ++i) {
+        REQUIRE(queue.pop() == round * 10 + i);
+      }
+      REQUIRE(queue.empty());
+    }
+  }
+
+  SECTION("moves non-trivial values") {
+    tinystl::mpsc_queue<std::unique_ptr<std::string>> queue(2);
+    REQUIRE(queue.try_emplace(std::make_unique<std::string>("tiny")));
+    queue.push(std::make_unique<std::string>("stl"));
+
+    std::unique_ptr<std::string> out;
+    REQUIRE(queue.try_pop(out));
+    REQUIRE(*out == "tiny");
+    REQUIRE(*queue.pop() == "stl");
+  }
+
+  SECTION("destroys what is left in the queue") {
+    {
+      tinystl::spsc_queue<tracked> queue(8);
+      for (int i = 0; i < 5; ++i) {
+        queue.emplace(i);
+      }
+      queue.pop();
+      REQUIRE(tracked::live == 4);
+    }
+    REQUIRE(tracked::live == 0);
+  }
+
+  SECTION("a throwing constructor leaves the queue untouched") {
+    tinystl::mpmc_queue<throws_on_negative> queue(2);
+    REQUIRE_THROWS_AS(queue.try_emplace(-1), std::invalid_argument);
+    REQUIRE(queue.empty());
+    REQUIRE(queue.try_emplace(1));
+    REQUIRE(queue.try_emplace(2));
+    REQUIRE(queue.pop().value == 1);
+    REQUIRE(queue.pop().value == 2);
+  }
+
+  SECTION("allocates its slots through the allocator") {
+    counting_allocator<int> alloc;
+    {
+      tinystl::mpmc_queue<int, counting_allocator<int>> queue(16, alloc);
+      REQUIRE(*alloc.bytes >= 16 * sizeof(int));
+      queue.push(1);
+    }
+    REQUIRE(*alloc.bytes == 0);
+  }
+}
+
+TEST_CASE("Bounded queue under contention", "[bounded_queue][concurrent]") {
+  SECTION("spsc") {
+    stress<tinystl::spsc_queue<std::size_t>>(1, 1, 100000);
+  }
+
+  SECTION("mpsc") {
+    stress<tinystl::mpsc_queue<std::size_t>>(4, 1, 20000);
+  }
+
+  SECTION("mpmc") {
+    stress<tinystl::mpmc_queue<std::size_t>>(4, 4, 20000);
+  }
+}
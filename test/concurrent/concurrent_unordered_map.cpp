@@ -0,0 +1,197 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <tinystl/concurrent/concurrent_unordered_map.h>
+
+namespace {
+
+struct tracked {
+  static inline std::atomic<int> live{0};
+
+  std::string text;
+
+  tracked(std::string t) : text(std::move(t)) { ++live; }
+  tracked(const tracked &other) : text(other.text) { ++live; }
+  tracked(tracked &&other) noexcept : text(std::move(other.text)) { ++live; }
+  tracked &operator=(const tracked &) = default;
+  ~tracked() { --live; }
+};
+
+// Written as one unit; a torn read would break the relation between the
+// two halves.
+struct pair_value {
+  std::uint64_t value;
+  std::uint64_t check;
+};
+
+} // namespace
+
+TEST_CASE("Concurrent unordered map basics", "[concurrent_unordered_map]") {
+  SECTION("insert, find, assign and erase") {
+    tinystl::concurrent_unordered_map<int, int> map(4);
+    STATIC_REQUIRE(decltype(map)::lock_free_reads);
+    REQUIRE(map.shard_count() == 4);
+    REQUIRE(map.empty());
+    REQUIRE_FALSE(map.find(1).has_value());
+
+    REQUIRE(map.insert(1, 10));
+    REQUIRE_FALSE(map.insert(1, 11));
+    REQUIRE(map.find(1) == 10);
+
+    REQUIRE_FALSE(map.insert_or_assign(1, 12));
+    REQUIRE(map.find(1) == 12);
+    REQUIRE(map.insert_or_assign(2, 20));
+    REQUIRE(map.size() == 2);
+
+    REQUIRE(map.erase(1));
+    REQUIRE_FALSE(map.erase(1));
+    REQUIRE_FALSE(map.contains(1));
+    REQUIRE(map.contains(2));
+    REQUIRE(map.size() == 1);
+
+    map.clear();
+    REQUIRE(map.empty());
+    REQUIRE_FALSE(map.contains(2));
+  }
+
+  SECTION("grows and reuses erased slots") {
+    tinystl::concurrent_unordered_map<std::uint64_t, std::uint64_t> map(2);
+    for (std::uint64_t round = 0; round < 3; ++round) {
+      bool all_new = true;
+      for (std::uint64_t i = 0; i < 20000; ++i) {
+        all_new = map.insert(i, i + round) && all_new;
+      }
+      REQUIRE(all_new);
+      REQUIRE(map.size() == 20000);
+      bool all_found = true;
+      for (std::uint64_t i = 0; i < 20000; ++i) {
+        all_found = all_found && map.find(i) == i + round;
+      }
+      REQUIRE(all_found);
+      for (std::uint64_t i = 0; i < 20000; ++i) {
+        map.erase(i);
+      }
+      REQUIRE(map.empty());
+    }
+  }
+
+  SECTION("batched insert") {
+    tinystl::concurrent_unordered_map<int, int> map;
+    std::vector<std::pair<int, int>> items;
+    for (int i = 0; i < 1000; ++i) {
+      items.emplace_back(i % 600, i);
+    }
+    map.reserve(600);
+    REQUIRE(map.insert(items.begin(), items.end()) == 600);
+    REQUIRE(map.size() == 600);
+    REQUIRE(map.find(5) == 5);
+    REQUIRE(map.find(599) == 599);
+  }
+
+  SECTION("other types are read under a lock") {
+    {
+      tinystl::concurrent_unordered_map<std::string, tracked> map(2);
+      STATIC_REQUIRE_FALSE(decltype(map)::lock_free_reads);
+      for (int i = 0; i < 500; ++i) {
+        map.insert(std::to_string(i), tracked(std::string(40, 'a' + i % 26)));
+      }
+      REQUIRE(map.size() == 500);
+      REQUIRE(map.find("42")->text == std::string(40, 'a' + 42 % 26));
+      REQUIRE(map.erase("42"));
+      REQUIRE_FALSE(map.find("42").has_value());
+      REQUIRE(map.insert_or_assign("7", tracked("seven")) == false);
+      REQUIRE(map.find("7")->text == "seven");
+      REQUIRE(tracked::live == 499);
+    }
+    REQUIRE(tracked::live == 0);
+  }
+}
+
+TEST_CASE("Concurrent unordered map under contention", "[concurrent_unordered_map][concurrent]") {
+  SECTION("optimistic readers never see a torn value") {
+    tinystl::concurrent_unordered_map<std::uint64_t, pair_value> map(4);
+    constexpr std::uint64_t keys = 2000;
+    std::atomic<bool> done{false};
+    std::atomic<bool> consistent{true};
+
+    std::vector<std::thread> threads;
+    for (int w = 0; w < 2; ++w) {
+      threads.emplace_back([&, w] {
+        for (std::uint64_t round = 0; round < 10; ++round) {
+          for (std::uint64_t k = w; k < keys; k += 2) {
+            std::uint64_t v = k * 1000 + round;
+            map.insert_or_assign(k, pair_value{v, ~v});
+          }
+          for (std::uint64_t k = w; k < keys; k += 8) {
+            map.erase(k);
+          }
+        }
+      });
+    }
+    for (int r = 0; r < 2; ++r) {
+      threads.emplace_back([&] {
+        while (!done.load()) {
+          for (std::uint64_t k = 0; k < keys; ++k) {
+            if (auto found = map.find(k)) {
+              if (found->check != ~found->value || found->value / 1000 != k) {
+                consistent = false;
+              }
+            }
+          }
+        }
+      });
+    }
+    threads[0].join();
+    threads[1].join();
+    done = true;
+    threads[2].join();
+    threads[3].join();
+
+    REQUIRE(consistent);
+    bool final_state = true;
+    for (std::uint64_t k = 0; k < keys; ++k) {
+      auto found = map.find(k);
+      bool erased = k % 8 < 2;
+      final_state = final_state && found.has_value() != erased;
+      final_state = final_state && (erased || found->value == k * 1000 + 9);
+    }
+    REQUIRE(final_state);
+    REQUIRE(map.size() == keys - keys / 4);
+  }
+
+  SECTION("locked readers and batched writers") {
+    tinystl::concurrent_unordered_map<std::string, std::string> map(8);
+    std::vector<std::thread> threads;
+    for (int w = 0; w < 3; ++w) {
+      threads.emplace_back([&, w] {
+        std::vector<std::pair<std::string, std::string>> batch;
+        for (int i = 0; i < 3000; ++i) {
+          batch.emplace_back(std::to_string(w * 3000 + i), std::to_string(i));
+          if (batch.size() == 100) {
+            map.insert(batch.begin(), batch.end());
+            batch.clear();
+          }
+        }
+      });
+    }
+    std::atomic<int> hits{0};
+    threads.emplace_back([&] {
+      for (int i = 0; i < 9000; ++i) {
+        if (auto found = map.find(std::to_string(i))) {
+          hits += *found == std::to_string(i % 3000);
+        }
+      }
+    });
+    for (auto &t : threads) {
+      t.join();
+    }
+    REQUIRE(map.size() == 9000);
+    REQUIRE(map.find("8999") == std::string("2999"));
+  }
+}
@@ -0,0 +1,221 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <tinystl/concurrent/concurrent_vector.h>
+
+namespace {
+
+struct tracked {
+  static inline std::atomic<int> live{0};
+
+  int value = 0;
+
+  tracked() noexcept { ++live; }
+  explicit tracked(int v) : value(v) {
+    if (v < 0) {
+      throw std::invalid_argument("negative");
+    }
+    ++live;
+  }
+  tracked(const tracked &other) noexcept : value(other.value) { ++live; }
+  tracked(tracked &&other) noexcept : value(other.value) { ++live; }
+  ~tracked() { --live; }
+};
+
+} // namespace
+
+TEST_CASE("Concurrent vector basics", "[concurrent_vector]") {
+  SECTION("starts empty with its first chunk in place") {
+    tinystl::concurrent_vector<int> vec;
+    REQUIRE(vec.empty());
+    REQUIRE(vec.begin() == vec.end());
+    REQUIRE(vec.capacity() > 0);
+  }
+
+  SECTION("push_back returns the new element and elements never move") {
+    tinystl::concurrent_vector<int> vec;
+    std::vector<int *> addresses;
+    bool returned_new_element = true;
+    for (int i = 0; i < 10000; ++i) {
+      auto it = vec.push_back(i);
+      returned_new_element = returned_new_element && *it == i && it - vec.begin() == i;
+      addresses.push_back(&*it);
+    }
+    REQUIRE(returned_new_element);
+    REQUIRE(vec.size() == 10000);
+    bool stable = true;
+    for (int i = 0; i < 10000; ++i) {
+      stable = stable && &vec[i] == addresses[i];
+    }
+    REQUIRE(stable);
+    REQUIRE(vec.front() == 0);
+    REQUIRE(vec.back() == 9999);
+    REQUIRE_THROWS_AS(vec.at(10000), std::out_of_range);
+  }
+
+  SECTION("grow_by appends contiguous index ranges") {
+    tinystl::concurrent_vector<int> vec{1, 2, 3};
+    auto it = vec.grow_by(5000, 7);
+    REQUIRE(it - vec.begin() == 3);
+    REQUIRE(vec.size() == 5003);
+    REQUIRE(std::all_of(it, vec.end(), [](int x) { return x == 7; }));
+
+    std::vector<int> source(3000);
+    std::iota(source.begin(), source.end(), 0);
+    it = vec.grow_by(source.begin(), source.end());
+    REQUIRE(std::equal(it, vec.end(), source.begin(), source.end()));
+
+    it = vec.grow_by(10);
+    REQUIRE(std::count(it, vec.end(), 0) == 10);
+    REQUIRE(vec.size() == 8013);
+  }
+
+  SECTION("end on an exact chunk boundary") {
+    tinystl::concurrent_vector<int> vec;
+    std::size_t first_chunk = vec.capacity();
+    vec.grow_by(first_chunk, 1);
+    REQUIRE(vec.end() - vec.begin() == static_cast<std::ptrdiff_t>(first_chunk));
+    REQUIRE(std::count(vec.begin(), vec.end(), 1) == static_cast<std::ptrdiff_t>(first_chunk));
+    REQUIRE(vec.capacity() > first_chunk);
+  }
+
+  SECTION("segments cover the published elements") {
+    tinystl::concurrent_vector<int> vec;
+    vec.grow_by(20000, 1);
+    std::size_t runs = 0;
+    std::size_t total = 0;
+    tinystl::for_each_segment(vec.begin(), vec.end(), [&](int *first, int *last) {
+      ++runs;
+      total += static_cast<std::size_t>(last - first);
+    });
+    REQUIRE(runs > 1);
+    REQUIRE(total == 20000);
+  }
+
+  SECTION("copy, move, clear and reserve") {
+    tinystl::concurrent_vector<std::string> vec{"a", "b", "c"};
+    tinystl::concurrent_vector<std::string> copy(vec);
+    REQUIRE(std::equal(copy.begin(), copy.end(), vec.begin(), vec.end()));
+
+    tinystl::concurrent_vector<std::string> moved(std::move(copy));
+    REQUIRE(moved.size() == 3);
+    REQUIRE(moved[2] == "c");
+
+    moved.clear();
+    REQUIRE(moved.empty());
+    moved.push_back("d");
+    REQUIRE(moved[0] == "d");
+
+    moved.reserve(100000);
+    REQUIRE(moved.capacity() >= 100000);
+  }
+
+  SECTION("a throwing constructor leaves the vector untouched") {
+    {
+      tinystl::concurrent_vector<tracked> vec;
+      vec.emplace_back(1);
+      REQUIRE_THROWS_AS(vec.emplace_back(-1), std::invalid_argument);
+      REQUIRE(vec.size() == 1);
+      vec.emplace_back(2);
+      REQUIRE(vec[1].value == 2);
+      vec.grow_by(100);
+      REQUIRE(tracked::live == 102);
+    }
+    REQUIRE(tracked::live == 0);
+  }
+}
+
+TEST_CASE("Concurrent vector under contention", "[concurrent_vector][concurrent]") {
+  constexpr std::size_t threads = 4;
+  constexpr std::size_t per_thread = 20000;
+
+  tinystl::concurrent_vector<std::size_t> vec;
+  std::atomic<bool> reader_ok{true};
+  std::atomic<bool> done{false};
+
+  // The reader only looks below the size it observed, where every element
+  // must already be fully built.
+  std::thread reader([&] {
+    while (!done.load()) {
+      std::size_t n = vec.size();
+      for (std::size_t i = n > 64 ? n - 64 : 0; i < n; ++i) {
+        if (vec[i] == 0) {
+          reader_ok = false;
+        }
+      }
+      std::size_t counted = 0;
+      for (auto it = vec.begin(), last = vec.end(); it != last; ++it) {
+        ++counted;
+      }
+      if (counted < n) {
+        reader_ok = false;
+      }
+    }
+  });
+
+  std::vector<std::thread> writers;
+  for (std::size_t t = 0; t < threads; ++t) {
+    writers.emplace_back([&, t] {
+      for (std::size_t i = 0; i < per_thread; ++i) {
+        std::size_t value = t * per_thread + i + 1;
+        if (i % 7 == 0) {
+          vec.grow_by(&value, &value + 1);
+        } else {
+          vec.push_back(value);
+        }
+      }
+    });
+  }
+  for (auto &w : writers) {
+    w.join();
+  }
+  done = true;
+  reader.join();
+
+  REQUIRE(reader_ok);
+  REQUIRE(vec.size() == threads * per_thread);
+  std::vector<std::size_t> values(vec.begin(), vec.end());
+  std::sort(values.begin(), values.end());
+  std::vector<std::size_t> expected(threads * per_thread);
+  std::iota(expected.begin(), expected.end(), 1);
+  REQUIRE(values == expected);
+}
+
+TEST_CASE("Concurrent vector with chunks smaller than a bitmap word", "[concurrent_vector][concurrent]") {
+  struct record {
+    std::size_t id;
+    char payload[2040];
+  };
+
+  tinystl::concurrent_vector<record> vec;
+  REQUIRE(vec.capacity() == 2);
+
+  std::vector<std::thread> writers;
+  for (std::size_t t = 0; t < 3; ++t) {
+    writers.emplace_back([&vec, t] {
+      for (std::size_t i = 0; i < 500; ++i) {
+        vec.push_back(record{t * 500 + i, {}});
+      }
+    });
+  }
+  for (auto &w : writers) {
+    w.join();
+  }
+
+  REQUIRE(vec.size() == 1500);
+  std::vector<std::size_t> ids;
+  for (const record &r : vec) {
+    ids.push_back(r.id);
+  }
+  std::sort(ids.begin(), ids.end());
+  std::vector<std::size_t> expected(1500);
+  std::iota(expected.begin(), expected.end(), 0);
+  REQUIRE(ids == expected);
+}
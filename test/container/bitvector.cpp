@@ -0,0 +1,185 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include <tinystl/container/bitvector.h>
+
+namespace {
+std::vector<bool> pattern(std::size_t n, std::size_t stride) {
+  std::vector<bool> bits(n);
+  for (std::size_t i = 0; i < n; i += stride) {
+    bits[i] = true;
+  }
+  return bits;
+}
+
+template <class Bits>
+bool same(const Bits &b, const std::vector<bool> &s) {
+  return b.size() == s.size() && std::equal(b.begin(), b.end(), s.begin());
+}
+} // namespace
+
+TEST_CASE("Bitvector constructors", "[bitvector][ctor]") {
+  SECTION("default constructor") {
+    tinystl::bitvector<> b;
+    REQUIRE(b.empty());
+    REQUIRE(b.count() == 0);
+    REQUIRE(b.find_first() == tinystl::bitvector<>::npos);
+  }
+
+  SECTION("size and value constructors") {
+    tinystl::bitvector<> zeros(100);
+    tinystl::bitvector<> ones(100, true);
+    REQUIRE(zeros.size() == 100);
+    REQUIRE(zeros.none());
+    REQUIRE(ones.count() == 100);
+    REQUIRE(ones.all());
+    REQUIRE(ones.words().size() == 2);
+    REQUIRE(ones.words()[1] == (tinystl::bit_word(1) << 36) - 1);
+  }
+
+  SECTION("range and initializer list constructors") {
+    auto source = pattern(130, 3);
+    tinystl::bitvector<> a(source.begin(), source.end());
+    REQUIRE(same(a, source));
+    tinystl::bitvector<> b = {true, false, true};
+    REQUIRE(b.size() == 3);
+    REQUIRE(b[0]);
+    REQUIRE(!b[1]);
+    REQUIRE(b.count() == 2);
+  }
+}
+
+TEST_CASE("Bitvector element access and modifiers", "[bitvector][modifiers]") {
+  tinystl::bitvector<> b;
+  std::vector<bool> s;
+
+  SECTION("push_back and pop_back across word boundaries") {
+    for (std::size_t i = 0; i < 200; ++i) {
+      b.push_back(i % 5 == 0);
+      s.push_back(i % 5 == 0);
+    }
+    REQUIRE(same(b, s));
+    for (int i = 0; i < 72; ++i) {
+      b.pop_back();
+      s.pop_back();
+    }
+    REQUIRE(same(b, s));
+    REQUIRE(b.words().size() == 2);
+    REQUIRE(b.count() == static_cast<std::size_t>(std::count(s.begin(), s.end(), true)));
+  }
+
+  SECTION("proxy references") {
+    b.resize(70);
+    b[3] = true;
+    b[69] = b[3];
+    REQUIRE(b.test(69));
+    b[3].flip();
+    REQUIRE(!b[3]);
+    REQUIRE(~b[3]);
+    swap(b[3], b[69]);
+    REQUIRE(b[3]);
+    REQUIRE(!b[69]);
+    REQUIRE_THROWS_AS(b.at(70), std::out_of_range);
+    REQUIRE_THROWS_AS(b.set(70), std::out_of_range);
+  }
+
+  SECTION("set, reset and flip") {
+    b.resize(100);
+    b.set(1).set(64).set(99);
+    REQUIRE(b.count() == 3);
+    b.reset(64);
+    REQUIRE(b.count() == 2);
+    b.flip();
+    REQUIRE(b.count() == 98);
+    b.flip(0);
+    REQUIRE(b.count() == 97);
+    b.set();
+    REQUIRE(b.all());
+    b.reset();
+    REQUIRE(b.none());
+  }
+
+  SECTION("resize keeps padding bits clear") {
+    b.resize(10, true);
+    b.resize(5);
+    b.resize(80, false);
+    REQUIRE(b.count() == 5);
+    b.resize(130, true);
+    REQUIRE(b.count() == 55);
+    REQUIRE(b.find_next(4) == 80);
+  }
+
+  SECTION("iterators") {
+    auto source = pattern(150, 7);
+    tinystl::bitvector<> a(source.begin(), source.end());
+    REQUIRE(a.end() - a.begin() == 150);
+    REQUIRE(std::count(a.begin(), a.end(), true) == 22);
+    REQUIRE(*(a.begin() + 140));
+    REQUIRE(*(a.end() - 10));
+    REQUIRE(std::equal(a.rbegin(), a.rend(), source.rbegin()));
+    auto it = a.begin() + 100;
+    it -= 93;
+    REQUIRE(*it);
+    REQUIRE(it - a.begin() == 7);
+    *it = false;
+    REQUIRE(!a[7]);
+  }
+}
+
+TEST_CASE("Bitvector bit operations", "[bitvector][operations]") {
+  const std::size_t n = 1000;
+  auto threes = pattern(n, 3);
+  auto fives = pattern(n, 5);
+  tinystl::bitvector<> a(threes.begin(), threes.end());
+  tinystl::bitvector<> b(fives.begin(), fives.end());
+
+  auto expect = [&](auto op) {
+    std::vector<bool> out(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      out[i] = op(threes[i], fives[i]);
+    }
+    return out;
+  };
+
+  SECTION("count and find") {
+    REQUIRE(a.count() == 334);
+    REQUIRE(a.find_first() == 0);
+    REQUIRE(a.find_next(0) == 3);
+    REQUIRE(a.find_next(62) == 63);
+    REQUIRE(a.find_next(999) == tinystl::bitvector<>::npos);
+
+    std::size_t visited = 0;
+    for (auto i = b.find_first(); i != tinystl::bitvector<>::npos;
+         i = b.find_next(i)) {
+      REQUIRE(i % 5 == 0);
+      ++visited;
+    }
+    REQUIRE(visited == 200);
+
+    tinystl::bitvector<> sparse(500);
+    sparse.set(321);
+    REQUIRE(sparse.find_first() == 321);
+    REQUIRE(sparse.find_next(321) == tinystl::bitvector<>::npos);
+  }
+
+  SECTION("bulk and, or, xor, and_not, not") {
+    REQUIRE(same(a & b, expect([](bool x, bool y) { return x && y; })));
+    REQUIRE(same(a | b, expect([](bool x, bool y) { return x || y; })));
+    REQUIRE(same(a ^ b, expect([](bool x, bool y) { return x != y; })));
+    tinystl::bitvector<> c = a;
+    c.and_not(b);
+    REQUIRE(same(c, expect([](bool x, bool y) { return x && !y; })));
+    REQUIRE((~a).count() == n - a.count());
+    REQUIRE((a & b).count() == 67);
+  }
+
+  SECTION("equality") {
+    tinystl::bitvector<> c(threes.begin(), threes.end());
+    REQUIRE(a == c);
+    c.flip(999);
+    REQUIRE(a != c);
+  }
+}
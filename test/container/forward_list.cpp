@@ -0,0 +1,164 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <forward_list>
+#include <string>
+#include <vector>
+
+#include <tinystl/container/forward_list.h>
+#include <tinystl/memory/node_pool.h>
+
+template <class List, class StdList>
+static bool same(const List &l, const StdList &s) {
+  return std::equal(l.begin(), l.end(), s.begin(), s.end());
+}
+
+TEST_CASE("Forward list constructors", "[forward_list][ctor]") {
+  SECTION("default constructor") {
+    tinystl::forward_list<int> l;
+    REQUIRE(l.empty());
+    REQUIRE(l.begin() == l.end());
+  }
+
+  SECTION("size, value, range and initializer list constructors") {
+    tinystl::forward_list<int> a(3);
+    tinystl::forward_list<int> b(2, 9);
+    std::vector<int> source = {1, 2, 3};
+    tinystl::forward_list<int> c(source.begin(), source.end());
+    tinystl::forward_list<int> d = {1, 2, 3};
+    REQUIRE(same(a, std::forward_list<int>(3)));
+    REQUIRE(same(b, std::forward_list<int>(2, 9)));
+    REQUIRE(same(c, source));
+    REQUIRE(c == d);
+  }
+
+  SECTION("copy and move") {
+    tinystl::forward_list<std::string> a = {"a", "b"};
+    tinystl::forward_list<std::string> b(a);
+    REQUIRE(a == b);
+    tinystl::forward_list<std::string> c(std::move(a));
+    REQUIRE(a.empty());
+    REQUIRE(c == b);
+
+    tinystl::forward_list<std::string> d = {"x", "y", "z"};
+    d = b;
+    REQUIRE(d == b);
+    d = std::move(c);
+    REQUIRE(d == b);
+  }
+}
+
+TEST_CASE("Forward list modifiers", "[forward_list][modifiers]") {
+  tinystl::forward_list<int> l;
+  std::forward_list<int> s;
+
+  SECTION("push_front and pop_front") {
+    for (int i = 0; i < 5; ++i) {
+      l.push_front(i);
+      s.push_front(i);
+    }
+    REQUIRE(same(l, s));
+    l.pop_front();
+    s.pop_front();
+    REQUIRE(same(l, s));
+    REQUIRE(l.front() == 3);
+  }
+
+  SECTION("insert_after and erase_after") {
+    l = {1, 2, 3};
+    s = {1, 2, 3};
+    auto it = l.insert_after(l.begin(), 10);
+    s.insert_after(s.begin(), 10);
+    REQUIRE(*it == 10);
+    it = l.insert_after(l.before_begin(), 2, 7);
+    s.insert_after(s.before_begin(), 2, 7);
+    REQUIRE(*it == 7);
+    l.insert_after(l.begin(), {5, 6});
+    s.insert_after(s.begin(), {5, 6});
+    REQUIRE(same(l, s));
+
+    l.erase_after(l.before_begin());
+    s.erase_after(s.before_begin());
+    l.erase_after(l.begin(), std::next(l.begin(), 3));
+    s.erase_after(s.begin(), std::next(s.begin(), 3));
+    REQUIRE(same(l, s));
+  }
+
+  SECTION("resize and assign") {
+    l.resize(3, 1);
+    s.resize(3, 1);
+    REQUIRE(same(l, s));
+    l.resize(5);
+    s.resize(5);
+    REQUIRE(same(l, s));
+    l.resize(1);
+    s.resize(1);
+    REQUIRE(same(l, s));
+
+    l.assign(3, 4);
+    s.assign(3, 4);
+    REQUIRE(same(l, s));
+    l.assign({9, 8, 7, 6});
+    s.assign({9, 8, 7, 6});
+    REQUIRE(same(l, s));
+  }
+}
+
+TEST_CASE("Forward list operations", "[forward_list][operations]") {
+  SECTION("splice_after") {
+    tinystl::forward_list<int> a = {1, 2, 3};
+    tinystl::forward_list<int> b = {10, 20, 30};
+    a.splice_after(a.begin(), b, b.begin());
+    REQUIRE(a == tinystl::forward_list<int>{1, 20, 2, 3});
+    REQUIRE(b == tinystl::forward_list<int>{10, 30});
+
+    a.splice_after(a.before_begin(), b);
+    REQUIRE(b.empty());
+    REQUIRE(a == tinystl::forward_list<int>{10, 30, 1, 20, 2, 3});
+
+    tinystl::forward_list<int> c;
+    c.splice_after(c.before_begin(), a, a.begin(), std::next(a.begin(), 3));
+    REQUIRE(c == tinystl::forward_list<int>{30, 1});
+    REQUIRE(a == tinystl::forward_list<int>{10, 20, 2, 3});
+  }
+
+  SECTION("remove, unique and reverse") {
+    tinystl::forward_list<int> l = {1, 1, 2, 2, 2, 3, 1};
+    REQUIRE(l.unique() == 3);
+    REQUIRE(l == tinystl::forward_list<int>{1, 2, 3, 1});
+    REQUIRE(l.remove(1) == 2);
+    REQUIRE(l == tinystl::forward_list<int>{2, 3});
+    l.remove(l.front());
+    REQUIRE(l == tinystl::forward_list<int>{3});
+
+    l = {1, 2, 3};
+    l.reverse();
+    REQUIRE(l == tinystl::forward_list<int>{3, 2, 1});
+    REQUIRE(tinystl::erase(l, 2) == 1);
+  }
+
+  SECTION("sort and merge") {
+    tinystl::forward_list<int> a = {5, 1, 4, 2, 3};
+    a.sort();
+    REQUIRE(a == tinystl::forward_list<int>{1, 2, 3, 4, 5});
+    a.sort([](int x, int y) { return x > y; });
+    REQUIRE(a == tinystl::forward_list<int>{5, 4, 3, 2, 1});
+
+    tinystl::forward_list<int> b = {1, 3, 5};
+    tinystl::forward_list<int> c = {2, 3, 6};
+    b.merge(c);
+    REQUIRE(c.empty());
+    REQUIRE(b == tinystl::forward_list<int>{1, 2, 3, 3, 5, 6});
+  }
+
+  SECTION("pool allocator") {
+    tinystl::node_pool pool;
+    using alloc = tinystl::pool_allocator<int>;
+    tinystl::forward_list<int, alloc> l{alloc(pool)};
+    for (int i = 0; i < 100; ++i) {
+      l.push_front(i);
+    }
+    REQUIRE(l.front() == 99);
+    l.clear();
+    REQUIRE(l.empty());
+  }
+}
@@ -0,0 +1,210 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <tinystl/container/inplace_vector.h>
+
+namespace {
+
+// Built entirely at compile time.
+constexpr tinystl::inplace_vector<int, 8> squares() {
+  tinystl::inplace_vector<int, 8> v;
+  for (int i = 0; i < 6; ++i) {
+    v.push_back(i * i);
+  }
+  v.erase(v.begin());
+  v.insert(v.begin() + 1, 2);
+  v.pop_back();
+  return v;
+}
+
+constexpr auto table = squares();
+static_assert(table.size() == 5);
+static_assert(table[0] == 1 && table[1] == 2 && table[4] == 16);
+static_assert(table == tinystl::inplace_vector<int, 8>{1, 2, 4, 9, 16});
+
+constexpr bool try_push_back_when_full() {
+  tinystl::inplace_vector<int, 2> v = {1, 2};
+  return v.try_push_back(3) == nullptr && v.size() == 2;
+}
+static_assert(try_push_back_when_full());
+
+struct header {
+  std::uint16_t kind;
+  std::uint16_t length;
+};
+
+static_assert(std::is_trivially_copyable_v<tinystl::inplace_vector<int, 4>>);
+static_assert(std::is_trivially_copyable_v<tinystl::inplace_vector<header, 4>>);
+static_assert(!std::is_trivially_copyable_v<tinystl::inplace_vector<std::string, 4>>);
+static_assert(std::is_trivially_destructible_v<tinystl::inplace_vector<header, 4>>);
+static_assert(sizeof(tinystl::inplace_vector<char, 16>) == 17);
+
+struct counted {
+  static inline int alive = 0;
+  int value;
+  explicit counted(int v) : value(v) {
+    if (v < 0) {
+      throw std::runtime_error("negative");
+    }
+    ++alive;
+  }
+  counted(const counted &other) : value(other.value) { ++alive; }
+  counted &operator=(const counted &) = default;
+  ~counted() { --alive; }
+};
+
+} // namespace
+
+TEST_CASE("Inplace vector constructors", "[inplace_vector][ctor]") {
+  SECTION("default constructor") {
+    tinystl::inplace_vector<int, 4> v;
+    REQUIRE(v.empty());
+    REQUIRE(v.capacity() == 4);
+    REQUIRE(v.max_size() == 4);
+  }
+
+  SECTION("size, value, range and initializer list constructors") {
+    tinystl::inplace_vector<int, 8> a(3);
+    tinystl::inplace_vector<int, 8> b(2, 5);
+    std::vector<int> source = {1, 2, 3};
+    tinystl::inplace_vector<int, 8> c(source.begin(), source.end());
+    tinystl::inplace_vector<int, 8> d = {1, 2, 3};
+    REQUIRE(a == tinystl::inplace_vector<int, 8>{0, 0, 0});
+    REQUIRE(b == tinystl::inplace_vector<int, 8>{5, 5});
+    REQUIRE(c == d);
+  }
+
+  SECTION("over capacity throws bad_alloc") {
+    using small = tinystl::inplace_vector<int, 2>;
+    REQUIRE_THROWS_AS(small(3), std::bad_alloc);
+    REQUIRE_THROWS_AS(small({1, 2, 3}), std::bad_alloc);
+  }
+
+  SECTION("copy and move of non-trivial elements") {
+    tinystl::inplace_vector<std::string, 4> a = {"a", "b", "c"};
+    tinystl::inplace_vector<std::string, 4> b(a);
+    REQUIRE(a == b);
+    tinystl::inplace_vector<std::string, 4> c(std::move(a));
+    REQUIRE(c == b);
+
+    tinystl::inplace_vector<std::string, 4> d = {"x"};
+    d = b;
+    REQUIRE(d == b);
+    d = {"p", "q", "r", "s"};
+    REQUIRE(d.size() == 4);
+    d = std::move(c);
+    REQUIRE(d == b);
+  }
+
+  SECTION("trivially copyable vectors copy bytewise") {
+    tinystl::inplace_vector<header, 4> a = {{1, 10}, {2, 20}};
+    tinystl::inplace_vector<header, 4> b;
+    std::memcpy(&b, &a, sizeof(a));
+    REQUIRE(b.size() == 2);
+    REQUIRE(b[1].length == 20);
+  }
+}
+
+TEST_CASE("Inplace vector modifiers", "[inplace_vector][modifiers]") {
+  tinystl::inplace_vector<int, 6> v;
+
+  SECTION("push_back variants") {
+    REQUIRE(v.push_back(1) == 1);
+    REQUIRE(*v.try_push_back(2) == 2);
+    REQUIRE(v.unchecked_push_back(3) == 3);
+    v.emplace_back(4);
+    REQUIRE(v.try_emplace_back(5) != nullptr);
+    REQUIRE(v.size() == 5);
+    v.push_back(6);
+    REQUIRE(v.try_push_back(7) == nullptr);
+    REQUIRE_THROWS_AS(v.push_back(7), std::bad_alloc);
+    REQUIRE(v.back() == 6);
+    REQUIRE(v.size() == 6);
+  }
+
+  SECTION("insert and erase") {
+    v = {1, 2, 3};
+    auto it = v.insert(v.begin() + 1, 10);
+    REQUIRE(*it == 10);
+    REQUIRE(v == tinystl::inplace_vector<int, 6>{1, 10, 2, 3});
+    it = v.insert(v.end(), 2, 7);
+    REQUIRE(it == v.begin() + 4);
+    REQUIRE(v == tinystl::inplace_vector<int, 6>{1, 10, 2, 3, 7, 7});
+    REQUIRE_THROWS_AS(v.insert(v.begin(), 0), std::bad_alloc);
+    REQUIRE(v.size() == 6);
+
+    it = v.erase(v.begin() + 1);
+    REQUIRE(*it == 2);
+    v.erase(v.begin() + 2, v.end());
+    REQUIRE(v == tinystl::inplace_vector<int, 6>{1, 2});
+    v.insert(v.begin(), {8, 9});
+    REQUIRE(v == tinystl::inplace_vector<int, 6>{8, 9, 1, 2});
+    v.insert(v.begin(), v[3]);
+    REQUIRE(v.front() == 2);
+  }
+
+  SECTION("resize, assign and swap") {
+    v.resize(3, 4);
+    REQUIRE(v == tinystl::inplace_vector<int, 6>{4, 4, 4});
+    v.resize(1);
+    REQUIRE(v.size() == 1);
+    REQUIRE_THROWS_AS(v.resize(7), std::bad_alloc);
+    REQUIRE_THROWS_AS(v.reserve(7), std::bad_alloc);
+
+    v.assign(5, 1);
+    REQUIRE(v == tinystl::inplace_vector<int, 6>{1, 1, 1, 1, 1});
+    v.assign({3, 2});
+    REQUIRE(v == tinystl::inplace_vector<int, 6>{3, 2});
+
+    tinystl::inplace_vector<int, 6> w = {9, 8, 7, 6};
+    v.swap(w);
+    REQUIRE(v == tinystl::inplace_vector<int, 6>{9, 8, 7, 6});
+    REQUIRE(w == tinystl::inplace_vector<int, 6>{3, 2});
+    REQUIRE(tinystl::erase(v, 8) == 1);
+    REQUIRE(tinystl::erase_if(v, [](int x) { return x > 6; }) == 2);
+    REQUIRE(v == tinystl::inplace_vector<int, 6>{6});
+  }
+
+  SECTION("at") {
+    v = {1, 2};
+    REQUIRE(v.at(1) == 2);
+    REQUIRE_THROWS_AS(v.at(2), std::out_of_range);
+    const auto &cv = v;
+    REQUIRE(cv.at(0) == 1);
+  }
+}
+
+TEST_CASE("Inplace vector element lifetimes", "[inplace_vector][lifetime]") {
+  counted::alive = 0;
+  {
+    tinystl::inplace_vector<counted, 4> v;
+    v.emplace_back(1);
+    v.emplace_back(2);
+    REQUIRE(counted::alive == 2);
+
+    std::vector<int> source = {3, -1};
+    REQUIRE_THROWS_AS(
+      v.insert(v.begin(), source.begin(), source.end()), std::runtime_error
+    );
+    REQUIRE(v.size() == 2);
+    REQUIRE(v.front().value == 1);
+    REQUIRE(counted::alive == 2);
+
+    tinystl::inplace_vector<counted, 4> w(v);
+    REQUIRE(counted::alive == 4);
+    w.pop_back();
+    REQUIRE(counted::alive == 3);
+    v.swap(w);
+    REQUIRE(v.size() == 1);
+    REQUIRE(w.size() == 2);
+    REQUIRE(counted::alive == 3);
+  }
+  REQUIRE(counted::alive == 0);
+}
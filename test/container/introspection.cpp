@@ -0,0 +1,166 @@
+#if !defined(TINYSTL_ENABLE_INTROSPECTION)
+#define TINYSTL_ENABLE_INTROSPECTION
+#endif
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include <tinystl/container/introspection.h>
+#include <tinystl/container/split_buffer.h>
+#include <tinystl/container/vector.h>
+
+namespace {
+
+using tinystl::introspection::container_stats;
+
+// The stats of the one live container carrying this tag.
+container_stats stats_for(const std::string &tag) {
+  container_stats found;
+  for (const container_stats &s : tinystl::introspection::snapshot()) {
+    if (s.tag == tag) {
+      REQUIRE(found.containers == 0);
+      found = s;
+    }
+  }
+  REQUIRE(found.containers == 1);
+  return found;
+}
+
+std::size_t live_containers() {
+  return tinystl::introspection::snapshot().size();
+}
+
+} // namespace
+
+TEST_CASE("Introspection counts vector growth", "[introspection]") {
+  static_assert(tinystl::introspection::enabled);
+  const std::size_t before = live_containers();
+
+  SECTION("registration follows lifetime") {
+    {
+      tinystl::vector<int> a;
+      tinystl::vector<int> b(a);
+      REQUIRE(live_containers() == before + 2);
+    }
+    REQUIRE(live_containers() == before);
+  }
+
+  SECTION("push_back reallocations, moved bytes and slack") {
+    tinystl::vector<int> v;
+    tinystl::introspection::set_tag(v, "push_back");
+    for (int i = 0; i < 100; ++i) {
+      v.push_back(i);
+    }
+
+    container_stats s = stats_for("push_back");
+    REQUIRE(s.size == 100);
+    REQUIRE(s.capacity == v.capacity());
+    REQUIRE(s.allocated_bytes == v.capacity() * sizeof(int));
+    REQUIRE(s.slack_bytes == (v.capacity() - 100) * sizeof(int));
+    REQUIRE(s.peak_capacity == v.capacity());
+    // 1, 2, 4, ..., 128: the first allocation moves nothing.
+    REQUIRE(s.reallocations == 7);
+    REQUIRE(s.bytes_moved == (1 + 2 + 4 + 8 + 16 + 32 + 64) * sizeof(int));
+  }
+
+  SECTION("reserve up front avoids reallocations") {
+    tinystl::vector<int> v;
+    tinystl::introspection::set_tag(v, "reserve");
+    v.reserve(100);
+    for (int i = 0; i < 100; ++i) {
+      v.push_back(i);
+    }
+
+    container_stats s = stats_for("reserve");
+    REQUIRE(s.reallocations == 0);
+    REQUIRE(s.bytes_moved == 0);
+    REQUIRE(s.slack_bytes == 0);
+  }
+
+  SECTION("peak capacity survives shrink_to_fit") {
+    tinystl::vector<std::string> v(64, "x");
+    tinystl::introspection::set_tag(v, "shrink");
+    v.resize(4);
+    v.shrink_to_fit();
+
+    container_stats s = stats_for("shrink");
+    REQUIRE(s.capacity == 4);
+    REQUIRE(s.peak_capacity == 64);
+    REQUIRE(s.reallocations == 1);
+    REQUIRE(s.bytes_moved == 4 * sizeof(std::string));
+  }
+
+  SECTION("a copy starts its own statistics") {
+    tinystl::vector<int> v;
+    for (int i = 0; i < 10; ++i) {
+      v.push_back(i);
+    }
+    tinystl::vector<int> copy(v);
+    tinystl::introspection::set_tag(copy, "copy");
+
+    container_stats s = stats_for("copy");
+    REQUIRE(s.size == 10);
+    REQUIRE(s.reallocations == 0);
+  }
+}
+
+TEST_CASE("Introspection counts split_buffer growth", "[introspection]") {
+  const std::size_t before = live_containers();
+  tinystl::split_buffer<int, std::allocator<int>> b;
+  tinystl::introspection::set_tag(b, "split_buffer");
+  for (int i = 0; i < 16; ++i) {
+    b.emplace_back(i);
+    b.emplace_front(i);
+  }
+
+  // The temporary buffers used for growth are not registered.
+  REQUIRE(live_containers() == before + 1);
+  container_stats s = stats_for("split_buffer");
+  REQUIRE(s.size == 32);
+  REQUIRE(s.capacity == b.capacity());
+  REQUIRE(s.reallocations > 0);
+  REQUIRE(s.bytes_moved > 0);
+}
+
+TEST_CASE("Introspection summaries group by type and tag", "[introspection]") {
+  tinystl::vector<int> a(10);
+  tinystl::vector<int> b(20);
+  tinystl::vector<double> c(30);
+  tinystl::introspection::set_tag(a, "cache");
+  tinystl::introspection::set_tag(b, "cache");
+  tinystl::introspection::set_tag(c, "index");
+
+  auto by_tag = tinystl::introspection::summary_by_tag();
+  auto cache = std::find_if(by_tag.begin(), by_tag.end(), [](auto &s) {
+    return s.tag == "cache";
+  });
+  REQUIRE(cache != by_tag.end());
+  REQUIRE(cache->containers == 2);
+  REQUIRE(cache->size == 30);
+  REQUIRE(cache->type.find("tinystl::vector<int") != std::string::npos);
+
+  auto by_type = tinystl::introspection::summary_by_type();
+  auto doubles = std::find_if(by_type.begin(), by_type.end(), [](auto &s) {
+    return s.type.find("tinystl::vector<double") != std::string::npos;
+  });
+  REQUIRE(doubles != by_type.end());
+  REQUIRE(doubles->containers == 1);
+  REQUIRE(doubles->allocated_bytes == 30 * sizeof(double));
+
+  std::FILE *out = std::tmpfile();
+  REQUIRE(out != nullptr);
+  tinystl::introspection::dump(out);
+  std::rewind(out);
+  std::string text;
+  char buf[256];
+  while (std::fgets(buf, sizeof buf, out) != nullptr) {
+    text += buf;
+  }
+  std::fclose(out);
+  REQUIRE(text.find("by type") != std::string::npos);
+  REQUIRE(text.find("cache") != std::string::npos);
+  REQUIRE(text.find("index") != std::string::npos);
+}
@@ -0,0 +1,118 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+
+#include <tinystl/container/intrusive_list.h>
+
+namespace {
+struct lru_tag {};
+struct all_tag {};
+
+struct entry : tinystl::intrusive_list_hook<lru_tag>,
+               tinystl::intrusive_list_hook<all_tag> {
+  explicit entry(int k) : key(k) {}
+  int key;
+};
+
+using lru_list = tinystl::intrusive_list<entry, lru_tag>;
+using all_list = tinystl::intrusive_list<entry, all_tag>;
+
+std::vector<int> keys(const lru_list &l) {
+  std::vector<int> out;
+  for (const entry &e : l) {
+    out.push_back(e.key);
+  }
+  return out;
+}
+} // namespace
+
+TEST_CASE("Intrusive list basics", "[intrusive_list][basic]") {
+  std::vector<entry> storage;
+  for (int i = 0; i < 5; ++i) {
+    storage.emplace_back(i);
+  }
+
+  lru_list l;
+  REQUIRE(l.empty());
+
+  SECTION("push, pop and iterate") {
+    for (entry &e : storage) {
+      l.push_back(e);
+    }
+    REQUIRE(l.size() == 5);
+    REQUIRE(keys(l) == std::vector<int>{0, 1, 2, 3, 4});
+    REQUIRE(storage[2].tinystl::intrusive_list_hook<lru_tag>::is_linked());
+
+    l.pop_front();
+    l.pop_back();
+    REQUIRE(keys(l) == std::vector<int>{1, 2, 3});
+    REQUIRE(!storage[0].tinystl::intrusive_list_hook<lru_tag>::is_linked());
+    REQUIRE(&l.front() == &storage[1]);
+    REQUIRE(&l.back() == &storage[3]);
+    l.clear();
+  }
+
+  SECTION("iterator_to and erase are O(1) lookups") {
+    for (entry &e : storage) {
+      l.push_front(e);
+    }
+    auto it = l.erase(l.iterator_to(storage[2]));
+    REQUIRE(it->key == 1);
+    REQUIRE(keys(l) == std::vector<int>{4, 3, 1, 0});
+    l.insert(l.begin(), storage[2]);
+    REQUIRE(keys(l) == std::vector<int>{2, 4, 3, 1, 0});
+    l.clear();
+  }
+
+  SECTION("move to front") {
+    for (entry &e : storage) {
+      l.push_back(e);
+    }
+    l.splice(l.begin(), l, l.iterator_to(storage[3]));
+    REQUIRE(keys(l) == std::vector<int>{3, 0, 1, 2, 4});
+    l.splice(l.begin(), l, l.iterator_to(storage[3]));
+    REQUIRE(keys(l) == std::vector<int>{3, 0, 1, 2, 4});
+    l.clear();
+  }
+
+  SECTION("splice between lists") {
+    lru_list other;
+    for (int i = 0; i < 3; ++i) {
+      l.push_back(storage[i]);
+    }
+    other.push_back(storage[3]);
+    other.push_back(storage[4]);
+
+    l.splice(std::next(l.begin()), other);
+    REQUIRE(other.empty());
+    REQUIRE(keys(l) == std::vector<int>{0, 3, 4, 1, 2});
+
+    other.splice(other.end(), l, std::next(l.begin()), std::prev(l.end()));
+    REQUIRE(keys(other) == std::vector<int>{3, 4, 1});
+    REQUIRE(l.size() == 2);
+    REQUIRE(other.size() == 3);
+
+    l.swap(other);
+    REQUIRE(keys(l) == std::vector<int>{3, 4, 1});
+    lru_list moved(std::move(l));
+    REQUIRE(l.empty());
+    REQUIRE(moved.size() == 3);
+    moved.clear();
+    other.clear();
+  }
+
+  SECTION("an element can be in several lists") {
+    all_list all;
+    for (entry &e : storage) {
+      all.push_back(e);
+      l.push_front(e);
+    }
+    REQUIRE(all.front().key == 0);
+    REQUIRE(l.front().key == 4);
+    l.erase(l.iterator_to(storage[0]));
+    REQUIRE(all.size() == 5);
+    REQUIRE(l.size() == 4);
+    all.clear();
+    l.clear();
+  }
+}
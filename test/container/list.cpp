@@ -0,0 +1,266 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <list>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <tinystl/container/list.h>
+#include <tinystl/memory/node_pool.h>
+
+template <class List, class StdList>
+static bool same(const List &l, const StdList &s) {
+  return l.size() == s.size() && std::equal(l.begin(), l.end(), s.begin());
+}
+
+TEST_CASE("List constructors", "[list][ctor]") {
+  SECTION("default constructor") {
+    tinystl::list<int> l;
+    REQUIRE(l.empty());
+    REQUIRE(l.size() == 0);
+    REQUIRE(l.begin() == l.end());
+  }
+
+  SECTION("size and value constructors") {
+    tinystl::list<int> a(4);
+    tinystl::list<int> b(3, 7);
+    REQUIRE(same(a, std::list<int>(4)));
+    REQUIRE(same(b, std::list<int>(3, 7)));
+  }
+
+  SECTION("range and initializer list constructors") {
+    std::vector<int> source = {5, 4, 3, 2, 1};
+    tinystl::list<int> a(source.begin(), source.end());
+    tinystl::list<int> b = {5, 4, 3, 2, 1};
+    REQUIRE(same(a, source));
+    REQUIRE(a == b);
+  }
+
+  SECTION("copy and move") {
+    tinystl::list<std::string> a = {"a", "b", "c"};
+    tinystl::list<std::string> b(a);
+    REQUIRE(a == b);
+
+    tinystl::list<std::string> c(std::move(a));
+    REQUIRE(a.empty());
+    REQUIRE(c == b);
+    c.push_back("d");
+    REQUIRE(c.back() == "d");
+
+    tinystl::list<std::string> d;
+    d = b;
+    REQUIRE(d == b);
+    d = std::move(c);
+    REQUIRE(d.size() == 4);
+    d = {"x"};
+    REQUIRE(d.front() == "x");
+  }
+}
+
+TEST_CASE("List modifiers", "[list][modifiers]") {
+  tinystl::list<int> l;
+  std::list<int> s;
+
+  SECTION("push and pop at both ends") {
+    for (int i = 0; i < 5; ++i) {
+      l.push_back(i);
+      s.push_back(i);
+      l.push_front(-i);
+      s.push_front(-i);
+    }
+    REQUIRE(same(l, s));
+    l.pop_back();
+    s.pop_back();
+    l.pop_front();
+    s.pop_front();
+    REQUIRE(same(l, s));
+    REQUIRE(l.front() == s.front());
+    REQUIRE(l.back() == s.back());
+  }
+
+  SECTION("insert and erase") {
+    l = {1, 2, 3};
+    s = {1, 2, 3};
+    auto it = l.insert(std::next(l.begin()), 10);
+    s.insert(std::next(s.begin()), 10);
+    REQUIRE(*it == 10);
+    l.insert(l.end(), 3, 9);
+    s.insert(s.end(), 3, 9);
+    std::vector<int> v = {7, 8};
+    l.insert(l.begin(), v.begin(), v.end());
+    s.insert(s.begin(), v.begin(), v.end());
+    REQUIRE(same(l, s));
+
+    it = l.erase(l.begin());
+    s.erase(s.begin());
+    REQUIRE(*it == 8);
+    l.erase(std::next(l.begin()), std::prev(l.end()));
+    s.erase(std::next(s.begin()), std::prev(s.end()));
+    REQUIRE(same(l, s));
+  }
+
+  SECTION("emplace, resize and assign") {
+    l.emplace_back(1);
+    l.emplace_front(0);
+    l.emplace(std::next(l.begin()), 5);
+    s = {0, 5, 1};
+    REQUIRE(same(l, s));
+
+    l.resize(6, 4);
+    s.resize(6, 4);
+    REQUIRE(same(l, s));
+    l.resize(2);
+    s.resize(2);
+    REQUIRE(same(l, s));
+
+    l.assign(4, 3);
+    s.assign(4, 3);
+    REQUIRE(same(l, s));
+    l.assign({1, 2});
+    s.assign({1, 2});
+    REQUIRE(same(l, s));
+  }
+
+  SECTION("swap") {
+    tinystl::list<int> a = {1, 2};
+    tinystl::list<int> b = {3};
+    auto a_first = a.begin();
+    a.swap(b);
+    REQUIRE(a.size() == 1);
+    REQUIRE(b.size() == 2);
+    REQUIRE(b.begin() == a_first);
+    REQUIRE(*std::prev(b.end()) == 2);
+  }
+}
+
+TEST_CASE("List operations", "[list][operations]") {
+  SECTION("splice whole list") {
+    tinystl::list<int> a = {1, 2, 3};
+    tinystl::list<int> b = {10, 20};
+    auto it = b.begin();
+    a.splice(std::next(a.begin()), b);
+    REQUIRE(b.empty());
+    REQUIRE(a == tinystl::list<int>{1, 10, 20, 2, 3});
+    REQUIRE(*it == 10); // iterators stay valid
+  }
+
+  SECTION("splice one element, move to front") {
+    tinystl::list<int> a = {1, 2, 3, 4};
+    a.splice(a.begin(), a, std::prev(a.end()));
+    REQUIRE(a == tinystl::list<int>{4, 1, 2, 3});
+    a.splice(a.begin(), a, a.begin());
+    REQUIRE(a == tinystl::list<int>{4, 1, 2, 3});
+  }
+
+  SECTION("splice range") {
+    tinystl::list<int> a = {1, 2, 3};
+    tinystl::list<int> b = {10, 20, 30, 40};
+    a.splice(a.end(), b, std::next(b.begin()), std::prev(b.end()));
+    REQUIRE(a == tinystl::list<int>{1, 2, 3, 20, 30});
+    REQUIRE(b == tinystl::list<int>{10, 40});
+    REQUIRE(a.size() == 5);
+    REQUIRE(b.size() == 2);
+  }
+
+  SECTION("remove, unique and reverse") {
+    tinystl::list<int> l = {1, 1, 2, 3, 3, 3, 1, 4};
+    std::list<int> s = {1, 1, 2, 3, 3, 3, 1, 4};
+    REQUIRE(l.unique() == 3);
+    s.unique();
+    REQUIRE(same(l, s));
+
+    REQUIRE(l.remove(1) == 2);
+    s.remove(1);
+    REQUIRE(same(l, s));
+
+    // the value may live inside the list itself
+    l.remove(l.front());
+    s.remove(s.front());
+    REQUIRE(same(l, s));
+
+    l = {1, 2, 3, 4};
+    l.reverse();
+    REQUIRE(l == tinystl::list<int>{4, 3, 2, 1});
+    REQUIRE(*l.rbegin() == 1);
+    REQUIRE(tinystl::erase_if(l, [](int x) { return x % 2 == 0; }) == 2);
+    REQUIRE(l == tinystl::list<int>{3, 1});
+  }
+
+  SECTION("sort is stable") {
+    using item = std::pair<int, int>;
+    tinystl::list<item> l;
+    std::list<item> s;
+    for (int i = 0; i < 200; ++i) {
+      l.emplace_back((i * 37) % 11, i);
+      s.emplace_back((i * 37) % 11, i);
+    }
+    auto by_key = [](const item &a, const item &b) { return a.first < b.first; };
+    l.sort(by_key);
+    s.sort(by_key);
+    REQUIRE(same(l, s));
+    REQUIRE(std::prev(l.end()) == --l.end());
+  }
+
+  SECTION("merge") {
+    tinystl::list<int> a = {1, 3, 5, 7};
+    tinystl::list<int> b = {0, 2, 3, 8, 9};
+    a.merge(b);
+    REQUIRE(b.empty());
+    REQUIRE(a == tinystl::list<int>{0, 1, 2, 3, 3, 5, 7, 8, 9});
+    REQUIRE(a.size() == 9);
+  }
+
+  SECTION("comparison") {
+    tinystl::list<int> a = {1, 2, 3};
+    tinystl::list<int> b = {1, 2, 4};
+    REQUIRE(a != b);
+    REQUIRE(a < b);
+    REQUIRE(b >= a);
+  }
+}
+
+namespace {
+struct throw_on_value {
+  int value;
+  explicit throw_on_value(int v) : value(v) {
+    if (v < 0) {
+      throw std::runtime_error("negative");
+    }
+  }
+};
+} // namespace
+
+TEST_CASE("List exception safety", "[list][exception]") {
+  tinystl::list<throw_on_value> l;
+  l.emplace_back(1);
+  std::vector<int> source = {2, 3, -1, 4};
+  REQUIRE_THROWS_AS(
+    l.insert(l.end(), source.begin(), source.end()), std::runtime_error
+  );
+  REQUIRE(l.size() == 1);
+  REQUIRE(l.front().value == 1);
+}
+
+TEST_CASE("List with pool_allocator", "[list][allocator]") {
+  tinystl::node_pool pool(64);
+  using alloc = tinystl::pool_allocator<int>;
+
+  tinystl::list<int, alloc> a{alloc(pool)};
+  for (int i = 0; i < 1000; ++i) {
+    a.push_back(i);
+  }
+  REQUIRE(a.size() == 1000);
+
+  // nodes freed by erase are reused by the next insertions
+  int *first_value = &a.front();
+  a.pop_front();
+  a.push_back(1000);
+  REQUIRE(&a.back() == first_value);
+
+  tinystl::list<int, alloc> b{alloc(pool)};
+  b.splice(b.end(), a, a.begin(), std::next(a.begin(), 10));
+  REQUIRE(b.size() == 10);
+  REQUIRE(a.size() == 990);
+  REQUIRE(b.front() == 1);
+  REQUIRE(&b.get_allocator().pool() == &pool);
+}
@@ -0,0 +1,203 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <tinystl/container/segmented_vector.h>
+
+namespace {
+// One element per 4 KiB page, so the first chunk holds a single element and
+// chunk boundaries fall at 1, 3, 7, 15, ...
+struct page {
+  char bytes[4096];
+  int id;
+};
+
+struct throws_at {
+  static inline int limit = -1;
+  int value;
+  throws_at(int v) : value(v) {
+    if (v == limit) {
+      throw std::runtime_error("limit");
+    }
+  }
+};
+} // namespace
+
+TEST_CASE("Segmented vector constructors", "[segmented_vector][ctor]") {
+  SECTION("default constructor") {
+    tinystl::segmented_vector<int> v;
+    REQUIRE(v.empty());
+    REQUIRE(v.capacity() == 0);
+    REQUIRE(v.begin() == v.end());
+  }
+
+  SECTION("size, value, range and initializer list constructors") {
+    tinystl::segmented_vector<int> a(5000);
+    tinystl::segmented_vector<int> b(3000, 7);
+    std::vector<int> source(2500);
+    std::iota(source.begin(), source.end(), 0);
+    tinystl::segmented_vector<int> c(source.begin(), source.end());
+    tinystl::segmented_vector<int> d = {1, 2, 3};
+
+    REQUIRE(a.size() == 5000);
+    REQUIRE(a[4999] == 0);
+    REQUIRE(b.size() == 3000);
+    REQUIRE(b.back() == 7);
+    REQUIRE(std::equal(c.begin(), c.end(), source.begin(), source.end()));
+    REQUIRE(d.size() == 3);
+    REQUIRE(d[2] == 3);
+  }
+
+  SECTION("copy and move") {
+    tinystl::segmented_vector<std::string> a;
+    for (int i = 0; i < 100; ++i) {
+      a.push_back(std::to_string(i));
+    }
+    tinystl::segmented_vector<std::string> b(a);
+    REQUIRE(a == b);
+
+    std::string *first = &a.front();
+    tinystl::segmented_vector<std::string> c(std::move(a));
+    REQUIRE(a.empty());
+    REQUIRE(&c.front() == first);
+
+    tinystl::segmented_vector<std::string> d = {"x"};
+    d = b;
+    REQUIRE(d == b);
+    d = std::move(c);
+    REQUIRE(d == b);
+    REQUIRE(&d.front() == first);
+  }
+
+  SECTION("a throwing element constructor leaves nothing behind") {
+    throws_at::limit = 2000;
+    std::vector<int> source(3000);
+    std::iota(source.begin(), source.end(), 0);
+    REQUIRE_THROWS_AS(
+      tinystl::segmented_vector<throws_at>(source.begin(), source.end()),
+      std::runtime_error
+    );
+    throws_at::limit = -1;
+  }
+}
+
+TEST_CASE("Segmented vector growth", "[segmented_vector][growth]") {
+  SECTION("elements never move") {
+    tinystl::segmented_vector<page> v;
+    v.emplace_back().id = 0;
+    page *first = &v[0];
+    std::vector<page *> addresses = {first};
+    for (int i = 1; i < 100; ++i) {
+      v.emplace_back().id = i;
+      addresses.push_back(&v.back());
+    }
+    REQUIRE(&v[0] == first);
+    for (int i = 0; i < 100; ++i) {
+      REQUIRE(&v[i] == addresses[i]);
+      REQUIRE(v[i].id == i);
+    }
+    // 1 + 2 + 4 + ... + 64 = 127 slots in 7 chunks
+    REQUIRE(v.chunk_count() == 7);
+    REQUIRE(v.capacity() == 127);
+  }
+
+  SECTION("reserve, pop_back, resize and shrink_to_fit") {
+    tinystl::segmented_vector<int> v;
+    v.reserve(10000);
+    std::size_t cap = v.capacity();
+    REQUIRE(cap >= 10000);
+    for (int i = 0; i < 10000; ++i) {
+      v.push_back(i);
+    }
+    REQUIRE(v.capacity() == cap);
+
+    v.pop_back();
+    REQUIRE(v.back() == 9998);
+    v.resize(10);
+    REQUIRE(v.size() == 10);
+    v.shrink_to_fit();
+    REQUIRE(v.chunk_count() == 1);
+    v.resize(2000, 5);
+    REQUIRE(v[1999] == 5);
+    REQUIRE(v[9] == 9);
+    REQUIRE_THROWS_AS(v.at(2000), std::out_of_range);
+
+    v.clear();
+    REQUIRE(v.empty());
+    REQUIRE(v.capacity() > 0);
+  }
+
+  SECTION("swap") {
+    tinystl::segmented_vector<int> a(3000, 1);
+    tinystl::segmented_vector<int> b = {2, 3};
+    int *p = &a[2999];
+    a.swap(b);
+    REQUIRE(a.size() == 2);
+    REQUIRE(b.size() == 3000);
+    REQUIRE(&b[2999] == p);
+    REQUIRE(a[1] == 3);
+  }
+}
+
+TEST_CASE("Segmented vector iterators", "[segmented_vector][iterator]") {
+  tinystl::segmented_vector<int> v;
+  for (int i = 0; i < 5000; ++i) {
+    v.push_back(i);
+  }
+
+  SECTION("random access crosses chunk boundaries") {
+    REQUIRE(v.end() - v.begin() == 5000);
+    auto it = v.begin() + 1023;
+    REQUIRE(*it == 1023);
+    ++it;
+    REQUIRE(*it == 1024);
+    --it;
+    REQUIRE(*it == 1023);
+    it += 3000;
+    REQUIRE(*it == 4023);
+    it -= 4000;
+    REQUIRE(*it == 23);
+    REQUIRE(v.begin()[3071] == 3071);
+    REQUIRE(*(v.end() - 1) == 4999);
+    REQUIRE(*v.rbegin() == 4999);
+    REQUIRE(v.begin() < v.end());
+
+    int expected = 0;
+    for (int x : v) {
+      REQUIRE(x == expected++);
+    }
+    REQUIRE(expected == 5000);
+  }
+
+  SECTION("end on an exact chunk boundary") {
+    tinystl::segmented_vector<int> w(1024 + 2048, 1);
+    REQUIRE(w.end() - w.begin() == 3072);
+    REQUIRE(std::distance(w.begin(), w.end()) == 3072);
+    auto last = w.end();
+    --last;
+    REQUIRE(last == w.begin() + 3071);
+  }
+
+  SECTION("segment traits walk whole chunks") {
+    using traits = tinystl::segmented_iterator_traits<
+      tinystl::segmented_vector<int>::iterator>;
+    auto it = v.begin() + 1500;
+    auto seg = traits::segment(it);
+    REQUIRE(seg.index() == 1);
+    REQUIRE(traits::end(seg) - traits::begin(seg) == 2048);
+    REQUIRE(traits::compose(seg, traits::local(it)) == it);
+    REQUIRE(traits::compose(seg, traits::end(seg)) == v.begin() + 3072);
+
+    std::vector<std::ptrdiff_t> runs;
+    long long sum = 0;
+    tinystl::for_each_segment(v.begin() + 10, v.end() - 10, [&](int *first, int *last) {
+      runs.push_back(last - first);
+      sum = std::accumulate(first, last, sum);
+    });
+    REQUIRE(runs == std::vector<std::ptrdiff_t>{1014, 2048, 1918});
+    REQUIRE(sum == 4989LL * 4990 / 2 - 45);
+  }
+}
@@ -0,0 +1,175 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+#include <tinystl/container/soa_vector.h>
+
+TEST_CASE("soa_vector constructors", "[soa_vector][ctor]") {
+  SECTION("default constructor") {
+    tinystl::soa_vector<int, double> soa;
+    REQUIRE(soa.empty());
+    REQUIRE(soa.size() == 0);
+  }
+
+  SECTION("size constructor") {
+    tinystl::soa_vector<int, double> soa(4);
+    REQUIRE(soa.size() == 4);
+    for (std::size_t i = 0; i < soa.size(); ++i) {
+      REQUIRE(std::get<0>(soa[i]) == 0);
+      REQUIRE(std::get<1>(soa[i]) == 0.0);
+    }
+  }
+
+  SECTION("size and value constructor") {
+    tinystl::soa_vector<int, std::string> soa(3, 7, "x");
+    REQUIRE(soa.size() == 3);
+    for (std::size_t i = 0; i < soa.size(); ++i) {
+      REQUIRE(std::get<0>(soa[i]) == 7);
+      REQUIRE(std::get<1>(soa[i]) == "x");
+    }
+  }
+
+  SECTION("initializer list constructor") {
+    tinystl::soa_vector<int, char> soa = {{1, 'a'}, {2, 'b'}, {3, 'c'}};
+    REQUIRE(soa.size() == 3);
+    REQUIRE(soa.front() == std::tuple<int, char>(1, 'a'));
+    REQUIRE(soa.back() == std::tuple<int, char>(3, 'c'));
+  }
+}
+
+TEST_CASE("soa_vector element access", "[soa_vector][access]") {
+  tinystl::soa_vector<int, double> soa = {{1, 1.5}, {2, 2.5}, {3, 3.5}};
+
+  SECTION("proxy reference writes through to the columns") {
+    auto [i, d] = soa[1];
+    i = 20;
+    d = 20.5;
+    REQUIRE(soa.column<0>()[1] == 20);
+    REQUIRE(soa.column<1>()[1] == 20.5);
+
+    soa[2] = std::tuple<int, double>(30, 30.5);
+    REQUIRE(std::get<0>(soa[2]) == 30);
+    REQUIRE(std::get<1>(soa[2]) == 30.5);
+  }
+
+  SECTION("at throws on out-of-range") {
+    REQUIRE_THROWS_AS((void)soa.at(3), std::out_of_range);
+  }
+
+  SECTION("columns are contiguous spans") {
+    auto ints = soa.column<0>();
+    REQUIRE(ints.size() == 3);
+    REQUIRE(ints.data() == soa.data<0>());
+    REQUIRE(std::accumulate(ints.begin(), ints.end(), 0) == 6);
+
+    const auto &csoa = soa;
+    auto doubles = csoa.column<1>();
+    REQUIRE(std::accumulate(doubles.begin(), doubles.end(), 0.0) == 7.5);
+  }
+}
+
+TEST_CASE("soa_vector iterators", "[soa_vector][iterator]") {
+  tinystl::soa_vector<int, int> soa = {{1, 10}, {2, 20}, {3, 30}};
+
+  SECTION("forward iteration") {
+    int expected = 1;
+    for (auto [a, b] : soa) {
+      REQUIRE(a == expected);
+      REQUIRE(b == expected * 10);
+      ++expected;
+    }
+    REQUIRE(soa.end() - soa.begin() == 3);
+  }
+
+  SECTION("reverse iteration") {
+    auto rit = soa.rbegin();
+    REQUIRE(std::get<0>(*rit) == 3);
+    ++rit;
+    REQUIRE(std::get<1>(*rit) == 20);
+  }
+
+  SECTION("const iteration") {
+    const auto &csoa = soa;
+    int sum = 0;
+    for (auto it = csoa.cbegin(); it != csoa.cend(); ++it) {
+      sum += std::get<1>(*it);
+    }
+    REQUIRE(sum == 60);
+  }
+}
+
+TEST_CASE("soa_vector modifiers", "[soa_vector][modifiers]") {
+  tinystl::soa_vector<int, std::string> soa;
+
+  SECTION("push_back, emplace_back and pop_back") {
+    soa.push_back({1, "one"});
+    soa.emplace_back(2, "two");
+    REQUIRE(soa.size() == 2);
+    REQUIRE(std::get<1>(soa.back()) == "two");
+
+    soa.pop_back();
+    REQUIRE(soa.size() == 1);
+    REQUIRE(std::get<1>(soa.back()) == "one");
+  }
+
+  SECTION("reserve keeps the columns in lockstep") {
+    soa.reserve(16);
+    REQUIRE(soa.capacity() >= 16);
+    for (int i = 0; i < 100; ++i) {
+      soa.emplace_back(i, std::to_string(i));
+    }
+    REQUIRE(soa.size() == 100);
+    REQUIRE(soa.column<0>().size() == soa.column<1>().size());
+    REQUIRE(std::get<1>(soa[42]) == "42");
+  }
+
+  SECTION("erase") {
+    for (int i = 0; i < 5; ++i) {
+      soa.emplace_back(i, std::to_string(i));
+    }
+    auto it = soa.erase(soa.begin() + 1);
+    REQUIRE(std::get<0>(*it) == 2);
+    it = soa.erase(soa.begin() + 2, soa.end());
+    REQUIRE(it == soa.end());
+    REQUIRE(soa.size() == 2);
+    REQUIRE(std::get<1>(soa[1]) == "2");
+  }
+
+  SECTION("resize and clear") {
+    soa.resize(3);
+    REQUIRE(soa.size() == 3);
+    REQUIRE(std::get<1>(soa[2]).empty());
+    soa.clear();
+    REQUIRE(soa.empty());
+  }
+
+  SECTION("swap") {
+    tinystl::soa_vector<int, std::string> other = {{9, "nine"}};
+    soa.emplace_back(1, "one");
+    soa.emplace_back(2, "two");
+    soa.swap(other);
+    REQUIRE(soa.size() == 1);
+    REQUIRE(other.size() == 2);
+    REQUIRE(std::get<1>(soa[0]) == "nine");
+  }
+}
+
+namespace {
+struct throws_on_copy {
+  throws_on_copy() = default;
+  throws_on_copy(throws_on_copy &&) = default;
+  throws_on_copy(const throws_on_copy &) { throw std::runtime_error("copy"); }
+};
+} // namespace
+
+TEST_CASE("soa_vector exception safety", "[soa_vector][exception]") {
+  tinystl::soa_vector<int, throws_on_copy> soa;
+  soa.emplace_back(1, throws_on_copy{});
+
+  throws_on_copy t;
+  REQUIRE_THROWS_AS(soa.emplace_back(2, t), std::runtime_error);
+  REQUIRE(soa.size() == 1);
+  REQUIRE(soa.column<0>().size() == 1);
+}
@@ -1,7 +1,13 @@
 #include <catch2/catch_test_macros.hpp>
 
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "tinystl/container/split_buffer.h"
 
+#include "support/counting.h"
+
 using tinystl::split_buffer;
 
 TEST_CASE("split_buffer basic operations", "[split_buffer][basic]") {
@@ -84,4 +90,100 @@ TEST_CASE("split_buffer basic operations", "[split_buffer][basic]") {
     REQUIRE(sb.front() == 1);
     REQUIRE(sb.back() == 5);
   }
+
+  SECTION("recentring relocates non-trivial elements") {
+    std::allocator<std::string> alloc;
+    split_buffer<std::string, std::allocator<std::string>&> sb(8, 4, alloc);
+    for (int i = 0; i < 4; ++i) {
+      sb.emplace_back(std::string(32, static_cast<char>('a' + i)));
+    }
+    // No back spare left: the elements slide into the front spare.
+    sb.emplace_back(std::string(32, 'e'));
+    REQUIRE(sb.capacity() == 8);
+    sb.pop_back();
+    sb.pop_back();
+    sb.pop_back();
+    sb.pop_back();
+    sb.pop_back();
+    for (int i = 0; i < 4; ++i) {
+      sb.emplace_front(std::string(32, static_cast<char>('a' + i)));
+    }
+    sb.emplace_front(std::string(32, 'e'));
+    REQUIRE(sb.capacity() == 8);
+    REQUIRE(sb.size() == 5);
+    REQUIRE(sb.front() == std::string(32, 'e'));
+    REQUIRE(sb.back() == std::string(32, 'a'));
+  }
+}
+
+TEST_CASE("split_buffer complexity guarantees", "[split_buffer][complexity]") {
+  using tinystl::test::counted;
+  using tinystl::test::counts;
+  using counted_alloc = tinystl::test::counting_allocator<counted>;
+  using buffer = split_buffer<counted, counted_alloc>;
+  constexpr int n = 1000;
+  tinystl::test::reset_counts();
+
+  SECTION("growth at either end is amortized") {
+    buffer back;
+    for (int i = 0; i < n; ++i) {
+      back.emplace_back(i);
+    }
+    buffer front;
+    for (int i = 0; i < n; ++i) {
+      front.emplace_front(i);
+    }
+    // A buffer pushed at one end grows once it is three quarters full, so
+    // each doubles up to 2048: 12 allocations apiece.
+    REQUIRE(counts().allocations == 24);
+    REQUIRE(counts().copies() == 0);
+    REQUIRE(counts().value_constructions == 2 * n);
+    // Relocations, by growing or sliding into spare room, stay below three
+    // per element on average.
+    REQUIRE(counts().moves() < 3 * 2 * n);
+  }
+
+  SECTION("alternating ends still grow geometrically") {
+    buffer b;
+    for (int i = 0; i < n; ++i) {
+      b.emplace_back(i);
+      b.emplace_front(-i);
+    }
+    REQUIRE(counts().allocations <= 12);
+    REQUIRE(counts().copies() == 0);
+    REQUIRE(counts().moves() < 3 * 2 * n);
+  }
+
+  SECTION("a sized buffer allocates exactly once") {
+    counted_alloc alloc;
+    buffer b(n, n / 2, alloc);
+    for (int i = 0; i < n / 2; ++i) {
+      b.emplace_back(i);
+      b.emplace_front(-i);
+    }
+    REQUIRE(counts().allocations == 1);
+    REQUIRE(counts().moves() == 0);
+  }
+
+  SECTION("moves transfer the buffer without touching elements") {
+    buffer b;
+    for (int i = 0; i < n; ++i) {
+      b.emplace_back(i);
+    }
+    buffer other;
+    other.emplace_back(7);
+    tinystl::test::reset_counts();
+
+    buffer moved(std::move(b));
+    REQUIRE(counts().allocations == 0);
+    REQUIRE(counts().constructions() == 0);
+    REQUIRE(moved.size() == n);
+
+    other = std::move(moved);
+    REQUIRE(counts().allocations == 0);
+    REQUIRE(counts().constructions() == 0);
+    REQUIRE(counts().copies() == 0);
+    REQUIRE(counts().destructions == 1);
+    REQUIRE(other.size() == n);
+  }
 }
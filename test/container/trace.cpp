@@ -0,0 +1,122 @@
+#if !defined(TINYSTL_ENABLE_TRACING)
+#define TINYSTL_ENABLE_TRACING
+#endif
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <tinystl/container/split_buffer.h>
+#include <tinystl/container/trace.h>
+#include <tinystl/container/vector.h>
+
+namespace {
+
+using tinystl::trace::event;
+using tinystl::trace::event_kind;
+
+std::vector<event> drain() {
+  std::vector<event> events;
+  tinystl::trace::ring_backend::drain([&](const event &e) {
+    events.push_back(e);
+  });
+  return events;
+}
+
+} // namespace
+
+TEST_CASE("Trace hooks report vector reallocations", "[trace]") {
+  static_assert(tinystl::trace::enabled);
+  drain();
+
+  SECTION("reserve and growth are grow events") {
+    tinystl::vector<int> v;
+    v.push_back(1);
+    v.push_back(2);
+    v.reserve(100);
+
+    std::vector<event> events = drain();
+    REQUIRE(events.size() == 3);
+    for (const event &e : events) {
+      REQUIRE(e.kind == event_kind::grow);
+      REQUIRE(e.element_size == sizeof(int));
+    }
+    const event &e = events.back();
+    REQUIRE(e.elements == 2);
+    REQUIRE(e.old_capacity == 2);
+    REQUIRE(e.new_capacity == 100);
+    REQUIRE(e.bytes() == 2 * sizeof(int));
+    REQUIRE(events[0].start_ns <= e.start_ns);
+  }
+
+  SECTION("shrink_to_fit is a shrink event") {
+    tinystl::vector<int> v;
+    v.reserve(64);
+    v.push_back(1);
+    drain();
+    v.shrink_to_fit();
+
+    std::vector<event> events = drain();
+    REQUIRE(events.size() == 1);
+    REQUIRE(events[0].kind == event_kind::shrink);
+    REQUIRE(events[0].old_capacity == 64);
+    REQUIRE(events[0].new_capacity == 1);
+  }
+
+  SECTION("only large copies are bulk_copy events") {
+    tinystl::vector<char> small(TINYSTL_TRACE_MIN_COPY_BYTES - 1);
+    tinystl::vector<char> large(TINYSTL_TRACE_MIN_COPY_BYTES);
+    drain();
+
+    tinystl::vector<char> a(small);
+    REQUIRE(drain().empty());
+
+    tinystl::vector<char> b(large);
+    a = large;
+    std::vector<event> events = drain();
+    REQUIRE(events.size() == 2);
+    for (const event &e : events) {
+      REQUIRE(e.kind == event_kind::bulk_copy);
+      REQUIRE(e.bytes() == TINYSTL_TRACE_MIN_COPY_BYTES);
+    }
+    REQUIRE(events[1].old_capacity == TINYSTL_TRACE_MIN_COPY_BYTES - 1);
+  }
+
+  REQUIRE(tinystl::trace::ring_backend::dropped() == 0);
+}
+
+TEST_CASE("Trace hooks report split_buffer growth", "[trace]") {
+  drain();
+  tinystl::split_buffer<int, std::allocator<int>> b;
+  b.emplace_back(1);
+  b.emplace_back(2);
+
+  std::vector<event> events = drain();
+  REQUIRE(events.size() == 2);
+  REQUIRE(events[1].kind == event_kind::grow);
+  REQUIRE(events[1].old_capacity == 1);
+  REQUIRE(events[1].new_capacity == 2);
+  REQUIRE(std::string(events[1].container) == "split_buffer");
+
+  // Room at the front only: the elements slide back instead of growing.
+  b.pop_back();
+  b.emplace_front(0);
+  b.emplace_back(3);
+  events = drain();
+  bool relocated = false;
+  for (const event &e : events) {
+    relocated |= e.kind == event_kind::relocate;
+  }
+  REQUIRE(relocated);
+}
+
+TEST_CASE("A full ring drops events instead of blocking", "[trace]") {
+  drain();
+  const std::size_t before = tinystl::trace::ring_backend::dropped();
+  for (int i = 0; i < TINYSTL_TRACE_RING_CAPACITY + 10; ++i) {
+    tinystl::trace::span(event_kind::relocate, "test", 1, 0, 0, 0);
+  }
+  REQUIRE(tinystl::trace::ring_backend::dropped() >= before + 10);
+  REQUIRE(drain().size() <= TINYSTL_TRACE_RING_CAPACITY);
+}
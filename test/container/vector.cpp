@@ -1,9 +1,16 @@
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 #include <tinystl/container/vector.h>
 
+#include "support/counting.h"
+
 TEST_CASE("Vector constructors", "[vector][ctor]") {
   SECTION("default constructor") {
     tinystl::vector<int> vec;
@@ -298,6 +305,27 @@ TEST_CASE("Vector modifiers", "[vector][modifiers]") {
     REQUIRE(vec.back().second == std_vec.back().second);
   }
 
+  SECTION("push_back of an own element while growing") {
+    tinystl::vector<std::string> vec = {"alpha", "beta"};
+    vec.shrink_to_fit();
+    REQUIRE(vec.capacity() == vec.size());
+
+    vec.push_back(vec[0]);
+    vec.shrink_to_fit();
+    vec.emplace_back(vec[1]);
+
+    REQUIRE(vec.size() == 4);
+    REQUIRE(vec[2] == "alpha");
+    REQUIRE(vec[3] == "beta");
+    REQUIRE(vec[0] == "alpha");
+  }
+
+  SECTION("const at throws on out-of-range") {
+    const tinystl::vector<int> vec = {1, 2};
+    REQUIRE(vec.at(1) == 2);
+    REQUIRE_THROWS_AS((void)vec.at(2), std::out_of_range);
+  }
+
   SECTION("clear") {
     tinystl::vector<int> vec = {1, 2, 3, 4, 5};
     std::vector<int> std_vec = {1, 2, 3, 4, 5};
@@ -438,6 +466,21 @@ TEST_CASE("Vector modifiers", "[vector][modifiers]") {
     }
   }
 
+  SECTION("resize within capacity") {
+    tinystl::vector<int> vec = {1, 2, 3};
+    std::vector<int> std_vec = {1, 2, 3};
+    vec.reserve(10);
+    std_vec.reserve(10);
+
+    vec.resize(6, 7);
+    std_vec.resize(6, 7);
+
+    REQUIRE(vec.size() == std_vec.size());
+    for (size_t i = 0; i < vec.size(); ++i) {
+      REQUIRE(vec[i] == std_vec[i]);
+    }
+  }
+
   SECTION("swap") {
     tinystl::vector<int> vec1 = {1, 2, 3};
     tinystl::vector<int> vec2 = {4, 5, 6, 7};
@@ -588,3 +631,280 @@ TEST_CASE("Vector special cases", "[vector][special]") {
     }
   }
 }
+
+namespace {
+// Counts live instances and throws from the copy constructor once a given
+// number of copies have been made.
+struct fragile {
+  static inline std::atomic<long> live{0};
+  static inline std::atomic<long> copies_left{-1};
+
+  int value = 0;
+
+  fragile() { ++live; }
+  explicit fragile(int v) : value(v) { ++live; }
+  fragile(const fragile &other) : value(other.value) {
+    if (copies_left.fetch_sub(1) == 0) {
+      throw std::runtime_error("copy");
+    }
+    ++live;
+  }
+  ~fragile() { --live; }
+};
+} // namespace
+
+TEST_CASE("Vector execution policy constructors", "[vector][ctor][parallel]") {
+  tinystl::thread_pool pool(4);
+  const size_t n = 100000;
+
+  SECTION("size constructor") {
+    tinystl::vector<int> vec(tinystl::execution::par.on(pool), n);
+    REQUIRE(vec.size() == n);
+    REQUIRE(std::all_of(vec.begin(), vec.end(), [](int x) { return x == 0; }));
+  }
+
+  SECTION("size and value constructor") {
+    tinystl::vector<double> vec(tinystl::execution::par_unseq.on(pool), n, 2.5);
+    REQUIRE(vec.size() == n);
+    REQUIRE(vec.capacity() == n);
+    REQUIRE(std::all_of(vec.begin(), vec.end(), [](double x) { return x == 2.5; }));
+  }
+
+  SECTION("range constructor") {
+    std::vector<long> source(n);
+    std::iota(source.begin(), source.end(), 0L);
+    tinystl::vector<long> vec(tinystl::execution::par.on(pool), source.begin(), source.end());
+    REQUIRE(std::equal(vec.begin(), vec.end(), source.begin(), source.end()));
+  }
+
+  SECTION("types that may throw") {
+    std::vector<std::string> source(50000, "tinystl");
+    tinystl::vector<std::string> vec(tinystl::execution::par.on(pool), source.begin(), source.end());
+    REQUIRE(std::equal(vec.begin(), vec.end(), source.begin(), source.end()));
+
+    tinystl::vector<std::string> copy(tinystl::execution::par.on(pool), vec);
+    REQUIRE(copy == vec);
+  }
+
+  SECTION("a throwing element constructor destroys exactly what was built") {
+    fragile prototype(3);
+    for (long fail_after : {0L, 1L, 4095L, 50000L, 99999L}) {
+      fragile::copies_left = fail_after;
+      REQUIRE_THROWS_AS(
+        tinystl::vector<fragile>(tinystl::execution::par.on(pool), n, prototype),
+        std::runtime_error
+      );
+      REQUIRE(fragile::live == 1);
+    }
+
+    fragile::copies_left = -1000000000L;
+    tinystl::vector<fragile> ok(tinystl::execution::par.on(pool), n, prototype);
+    REQUIRE(fragile::live == long(n) + 1);
+  }
+
+  SECTION("sequential fallback is exception safe too") {
+    fragile prototype;
+    fragile::copies_left = 10;
+    REQUIRE_THROWS_AS(
+      tinystl::vector<fragile>(tinystl::execution::seq, 100, prototype),
+      std::runtime_error
+    );
+    REQUIRE(fragile::live == 1);
+    fragile::copies_left = -1;
+  }
+
+  SECTION("assign reuses or replaces the buffer") {
+    tinystl::vector<int> vec(tinystl::execution::par.on(pool), n, 1);
+    int *buffer = vec.data();
+    vec.assign(tinystl::execution::par.on(pool), n / 2, 2);
+    REQUIRE(vec.data() == buffer);
+    REQUIRE(vec.size() == n / 2);
+    REQUIRE(std::all_of(vec.begin(), vec.end(), [](int x) { return x == 2; }));
+
+    std::vector<int> source(2 * n, 5);
+    vec.assign(tinystl::execution::par.on(pool), source.begin(), source.end());
+    REQUIRE(vec.size() == 2 * n);
+    REQUIRE(std::all_of(vec.begin(), vec.end(), [](int x) { return x == 5; }));
+
+    vec.assign(tinystl::execution::par.on(pool), 10, vec[3]);
+    REQUIRE(vec == tinystl::vector<int>(10, 5));
+  }
+
+  SECTION("sequenced policy and empty input") {
+    tinystl::vector<int> vec(tinystl::execution::seq, 10, 7);
+    REQUIRE(vec == tinystl::vector<int>(10, 7));
+    tinystl::vector<int> empty(tinystl::execution::par, 0);
+    REQUIRE(empty.empty());
+  }
+}
+
+TEST_CASE("Vector complexity guarantees", "[vector][complexity]") {
+  using tinystl::test::counted;
+  using tinystl::test::counts;
+  using counted_vector =
+    tinystl::vector<counted, tinystl::test::counting_allocator<counted>>;
+  constexpr int n = 1000;
+  tinystl::test::reset_counts();
+
+  SECTION("push_back grows geometrically") {
+    counted_vector v;
+    for (int i = 0; i < n; ++i) {
+      v.push_back(counted(i));
+    }
+    // Capacities 1, 2, 4, ..., 1024.
+    REQUIRE(counts().allocations == 11);
+    REQUIRE(counts().deallocations == 10);
+    REQUIRE(counts().copies() == 0);
+    // One move out of each temporary; relocations add fewer than 2 per
+    // element over the whole sequence.
+    REQUIRE(counts().move_constructions - n < 2 * n);
+  }
+
+  SECTION("emplace_back constructs in place") {
+    counted_vector v;
+    v.reserve(n);
+    for (int i = 0; i < n; ++i) {
+      v.emplace_back(i);
+    }
+    REQUIRE(counts().allocations == 1);
+    REQUIRE(counts().value_constructions == n);
+    REQUIRE(counts().copies() == 0);
+    REQUIRE(counts().moves() == 0);
+  }
+
+  SECTION("range construction allocates exactly once") {
+    std::vector<counted> source(n);
+    tinystl::test::reset_counts();
+
+    counted_vector copied(source.begin(), source.end());
+    REQUIRE(counts().allocations == 1);
+    REQUIRE(counts().bytes_allocated == n * sizeof(counted));
+    REQUIRE(counts().copy_constructions == n);
+    REQUIRE(counts().moves() == 0);
+
+    tinystl::test::reset_counts();
+    counted_vector moved(
+      std::make_move_iterator(source.begin()),
+      std::make_move_iterator(source.end())
+    );
+    REQUIRE(counts().allocations == 1);
+    REQUIRE(counts().move_constructions == n);
+    REQUIRE(counts().copies() == 0);
+  }
+
+  SECTION("copy construction allocates exactly once") {
+    counted_vector v(n);
+    tinystl::test::reset_counts();
+    counted_vector copy(v);
+    REQUIRE(counts().allocations == 1);
+    REQUIRE(counts().copy_constructions == n);
+    REQUIRE(counts().constructions() == n);
+  }
+
+  SECTION("move construction touches no element") {
+    counted_vector v(n);
+    tinystl::test::reset_counts();
+    counted_vector moved(std::move(v));
+    REQUIRE(counts().allocations == 0);
+    REQUIRE(counts().constructions() == 0);
+    REQUIRE(counts().destructions == 0);
+    REQUIRE(moved.size() == n);
+  }
+
+  SECTION("move assignment frees the old elements and copies nothing") {
+    counted_vector target(n);
+    counted_vector source(10);
+    tinystl::test::reset_counts();
+    target = std::move(source);
+    REQUIRE(counts().allocations == 0);
+    REQUIRE(counts().deallocations == 1);
+    REQUIRE(counts().constructions() == 0);
+    REQUIRE(counts().destructions == n);
+    REQUIRE(target.size() == 10);
+
+    counted_vector &self = target;
+    target = std::move(self);
+    REQUIRE(target.size() == 10);
+    REQUIRE(counts().destructions == n);
+  }
+
+  SECTION("insert within capacity does not allocate") {
+    counted_vector v;
+    v.reserve(n + 1);
+    for (int i = 0; i < n; ++i) {
+      v.emplace_back(i);
+    }
+    tinystl::test::reset_counts();
+    v.insert(v.begin(), counted(-5));
+    REQUIRE(counts().allocations == 0);
+    REQUIRE(counts().copies() == 0);
+    // Every element shifts by one, plus the new one.
+    REQUIRE(counts().moves() == n + 1);
+    REQUIRE(v.size() == n + 1);
+    for (int i = 0; i < n; ++i) {
+      REQUIRE(v[i + 1].value() == i);
+    }
+    REQUIRE(v.front().value() == -5);
+  }
+}
+
+TEST_CASE("Vector inserts and fills from its own elements", "[vector][aliasing]") {
+  auto numbered = [](int n, int reserve) {
+    tinystl::vector<std::string> v;
+    v.reserve(reserve);
+    for (int i = 0; i < n; ++i) {
+      v.push_back(std::string(32, static_cast<char>('a' + i)));
+    }
+    return v;
+  };
+  const std::string c(32, 'c');
+
+  SECTION("insert of a later element within capacity") {
+    auto v = numbered(5, 8);
+    v.insert(v.begin() + 1, v[2]);
+    REQUIRE(v[1] == c);
+    REQUIRE(v[3] == c);
+    REQUIRE(v.size() == 6);
+  }
+
+  SECTION("insert of an earlier element while growing") {
+    auto v = numbered(4, 4);
+    v.insert(v.begin() + 3, v[2]);
+    v.insert(v.begin() + 4, 3, v[2]);
+    REQUIRE(v.size() == 8);
+    REQUIRE(std::count(v.begin(), v.end(), c) == 5);
+  }
+
+  SECTION("n copies of an element that shifts") {
+    auto v = numbered(5, 16);
+    v.insert(v.begin(), 2, v[2]);
+    REQUIRE(v[0] == c);
+    REQUIRE(v[1] == c);
+    REQUIRE(v[4] == c);
+  }
+
+  SECTION("emplace in the middle within capacity") {
+    auto v = numbered(4, 8);
+    v.emplace(v.begin() + 1, 3, 'x');
+    REQUIRE(v[1] == "xxx");
+    REQUIRE(v[2] == std::string(32, 'b'));
+    REQUIRE(v.back() == std::string(32, 'd'));
+  }
+
+  SECTION("resize and assign with an element while growing") {
+    auto v = numbered(3, 3);
+    v.resize(6, v[2]);
+    REQUIRE(std::count(v.begin(), v.end(), c) == 4);
+    v.assign(20, v[1]);
+    REQUIRE(v.size() == 20);
+    REQUIRE(std::count(v.begin(), v.end(), std::string(32, 'b')) == 20);
+  }
+
+  SECTION("range insert longer than the tail") {
+    tinystl::vector<int> v{1, 2, 3};
+    v.reserve(10);
+    const int more[] = {7, 8, 9, 10};
+    v.insert(v.begin() + 2, std::begin(more), std::end(more));
+    REQUIRE(v == tinystl::vector<int>{1, 2, 7, 8, 9, 10, 3});
+  }
+}
@@ -0,0 +1,111 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <thread>
+
+#include <tinystl/container/vector.h>
+#include <tinystl/coroutine/batching_sink.h>
+
+namespace {
+
+tinystl::async_generator<std::string> numbers(std::size_t n, bool with_hint) {
+  if (with_hint) {
+    co_yield tinystl::size_hint{n};
+  }
+  for (std::size_t i = 0; i < n; ++i) {
+    co_yield std::to_string(i);
+  }
+}
+
+tinystl::async_generator<std::string> scheduled_numbers(tinystl::thread_pool &pool, std::size_t n) {
+  co_await tinystl::schedule(pool);
+  for (std::size_t i = 0; i < n; ++i) {
+    co_yield std::to_string(i);
+  }
+}
+
+} // namespace
+
+TEST_CASE("batching_sink fills a container", "[coroutine]") {
+  SECTION("a size hint reserves for the whole stream") {
+    tinystl::vector<std::string> out;
+    tinystl::batching_sink sink(out, 64);
+    auto gen = numbers(10000, true);
+    REQUIRE(tinystl::sync_wait(sink.drain(gen)) == 10000);
+    REQUIRE(sink.closed());
+    REQUIRE(out.size() == 10000);
+    REQUIRE(out.capacity() == 10000);
+    REQUIRE(out[1234] == "1234");
+  }
+
+  SECTION("without a hint the container grows on its own") {
+    tinystl::vector<std::string> out;
+    tinystl::batching_sink sink(out, 100);
+    auto gen = numbers(1001, false);
+    REQUIRE(tinystl::sync_wait(sink.drain(gen)) == 1001);
+    REQUIRE(out.size() == 1001);
+    REQUIRE(out.back() == "1000");
+  }
+
+  SECTION("containers without reserve") {
+    std::deque<std::string> out;
+    tinystl::batching_sink sink(out, 7);
+    auto gen = numbers(50, true);
+    tinystl::sync_wait(sink.drain(gen));
+    REQUIRE(out.size() == 50);
+    REQUIRE(out[49] == "49");
+  }
+
+  SECTION("pushing by hand") {
+    tinystl::vector<int> out;
+    tinystl::batching_sink sink(out, 4);
+    auto producer = [](tinystl::batching_sink<tinystl::vector<int>> &s) -> tinystl::task<> {
+      for (int i = 0; i < 10; ++i) {
+        co_await s.push(i);
+      }
+    };
+    tinystl::sync_wait(producer(sink));
+    REQUIRE(out.size() == 8);
+    sink.flush();
+    REQUIRE(out.size() == 10);
+  }
+}
+
+TEST_CASE("batching_sink applies backpressure", "[coroutine]") {
+  constexpr std::size_t total = 20000;
+  constexpr std::size_t batch = 32;
+  constexpr std::size_t capacity = 256;
+  tinystl::thread_pool pool(1);
+
+  tinystl::vector<std::string> out;
+  tinystl::batching_sink sink(out, batch, capacity);
+
+  std::size_t received = 0;
+  std::size_t largest = 0;
+  bool in_order = true;
+  std::thread consumer([&] {
+    for (;;) {
+      const bool finished = sink.closed();
+      tinystl::vector<std::string> taken = sink.take();
+      largest = std::max(largest, taken.size());
+      for (const std::string &s : taken) {
+        in_order = in_order && s == std::to_string(received);
+        ++received;
+      }
+      if (finished) {
+        break;
+      }
+      std::this_thread::yield();
+    }
+  });
+
+  auto gen = scheduled_numbers(pool, total);
+  REQUIRE(tinystl::sync_wait(sink.drain(gen)) == total);
+  consumer.join();
+
+  REQUIRE(received == total);
+  REQUIRE(in_order);
+  REQUIRE(largest < capacity + batch);
+}
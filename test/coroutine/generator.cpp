@@ -0,0 +1,143 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <tinystl/container/vector.h>
+#include <tinystl/coroutine/async_generator.h>
+#include <tinystl/coroutine/generator.h>
+#include <tinystl/coroutine/task.h>
+
+namespace {
+
+tinystl::generator<int> iota(int n) {
+  co_yield tinystl::size_hint{static_cast<std::size_t>(n)};
+  for (int i = 0; i < n; ++i) {
+    co_yield i;
+  }
+}
+
+tinystl::generator<std::string> words() {
+  std::string word = "lvalue";
+  co_yield word;
+  co_yield std::string("rvalue");
+  word += "s are copied";
+  co_yield word;
+}
+
+tinystl::generator<int> failing() {
+  co_yield 1;
+  throw std::runtime_error("generator failed");
+}
+
+tinystl::task<int> answer() { co_return 42; }
+
+tinystl::task<int> sum_of_answers(int n) {
+  int sum = 0;
+  for (int i = 0; i < n; ++i) {
+    sum += co_await answer();
+  }
+  co_return sum;
+}
+
+tinystl::task<std::thread::id> thread_after(tinystl::thread_pool &pool) {
+  co_await tinystl::schedule(pool);
+  co_return std::this_thread::get_id();
+}
+
+tinystl::task<> throws() {
+  co_await answer();
+  throw std::logic_error("task failed");
+}
+
+tinystl::async_generator<std::unique_ptr<int>> boxes(tinystl::thread_pool &pool, int n) {
+  co_yield tinystl::size_hint{static_cast<std::size_t>(n)};
+  for (int i = 0; i < n; ++i) {
+    if (i % 10 == 0) {
+      co_await tinystl::schedule(pool);
+    }
+    co_yield std::make_unique<int>(i + co_await answer());
+  }
+}
+
+tinystl::task<std::vector<int>> collect(tinystl::async_generator<std::unique_ptr<int>> gen) {
+  std::vector<int> out;
+  while (auto *box = co_await gen.next()) {
+    out.push_back(**box);
+  }
+  co_return out;
+}
+
+} // namespace
+
+TEST_CASE("generator", "[coroutine]") {
+  SECTION("yields lazily and counts down its hint") {
+    auto gen = iota(5);
+    auto it = gen.begin();
+    REQUIRE(*it == 0);
+    REQUIRE(gen.hint() == 4u);
+    ++it;
+    ++it;
+    REQUIRE(*it == 2);
+    REQUIRE(gen.hint() == 2u);
+
+    tinystl::vector<int> rest;
+    for (; it != gen.end(); ++it) {
+      rest.push_back(*it);
+    }
+    REQUIRE(rest == tinystl::vector<int>{2, 3, 4});
+    REQUIRE(gen.hint() == 0u);
+  }
+
+  SECTION("fills a container through its iterators") {
+    tinystl::vector<int> v;
+    for (int x : iota(1000)) {
+      v.push_back(x);
+    }
+    REQUIRE(v.size() == 1000);
+    REQUIRE(v[999] == 999);
+  }
+
+  SECTION("lvalues are copied, rvalues are not") {
+    std::vector<std::string> seen;
+    for (std::string &w : words()) {
+      seen.push_back(std::move(w));
+    }
+    REQUIRE(seen == std::vector<std::string>{"lvalue", "rvalue", "lvalues are copied"});
+  }
+
+  SECTION("exceptions reach the consumer") {
+    auto gen = failing();
+    auto it = gen.begin();
+    REQUIRE(*it == 1);
+    REQUIRE_THROWS_AS(++it, std::runtime_error);
+  }
+
+  SECTION("an unfinished generator frees its frame") {
+    auto gen = iota(10);
+    REQUIRE(*gen.begin() == 0);
+  }
+}
+
+TEST_CASE("task and sync_wait", "[coroutine]") {
+  tinystl::thread_pool pool(2);
+
+  REQUIRE(tinystl::sync_wait(answer()) == 42);
+  REQUIRE(tinystl::sync_wait(sum_of_answers(100000)) == 4200000);
+  REQUIRE(tinystl::sync_wait(thread_after(pool)) != std::this_thread::get_id());
+  REQUIRE_THROWS_AS(tinystl::sync_wait(throws()), std::logic_error);
+}
+
+TEST_CASE("async_generator", "[coroutine]") {
+  tinystl::thread_pool pool(2);
+
+  std::vector<int> values = tinystl::sync_wait(collect(boxes(pool, 100)));
+  REQUIRE(values.size() == 100);
+  for (int i = 0; i < 100; ++i) {
+    REQUIRE(values[i] == i + 42);
+  }
+  REQUIRE(tinystl::sync_wait(collect(boxes(pool, 0))).empty());
+}
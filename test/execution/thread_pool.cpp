@@ -0,0 +1,157 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <tinystl/algorithm/parallel.h>
+#include <tinystl/execution/execution.h>
+
+TEST_CASE("Thread pool", "[thread_pool]") {
+  SECTION("runs every submitted task") {
+    tinystl::thread_pool pool(3);
+    REQUIRE(pool.size() == 3);
+    std::atomic<int> sum{0};
+    tinystl::task_group group(pool);
+    for (int i = 1; i <= 1000; ++i) {
+      group.run([&sum, i] { sum += i; });
+    }
+    group.wait();
+    REQUIRE(sum == 500500);
+  }
+
+  SECTION("nested groups do not deadlock a single worker") {
+    tinystl::thread_pool pool(1);
+    std::atomic<int> leaves{0};
+    tinystl::task_group outer(pool);
+    for (int i = 0; i < 8; ++i) {
+      outer.run([&] {
+        tinystl::task_group inner(pool);
+        for (int j = 0; j < 8; ++j) {
+          inner.run([&] { ++leaves; });
+        }
+        inner.wait();
+      });
+    }
+    outer.wait();
+    REQUIRE(leaves == 64);
+  }
+
+  SECTION("wait rethrows the first exception and can be reused") {
+    tinystl::thread_pool pool(2);
+    tinystl::task_group group(pool);
+    group.run([] { throw std::logic_error("task"); });
+    group.run([] {});
+    REQUIRE_THROWS_AS(group.wait(), std::logic_error);
+
+    int ran = 0;
+    group.run([&ran] { ran = 1; });
+    group.wait();
+    REQUIRE(ran == 1);
+  }
+}
+
+TEST_CASE("Execution policies", "[execution]") {
+  STATIC_REQUIRE(tinystl::is_execution_policy_v<tinystl::execution::sequenced_policy>);
+  STATIC_REQUIRE(tinystl::execution_policy<const tinystl::execution::parallel_policy &>);
+  STATIC_REQUIRE(!tinystl::execution_policy<int>);
+
+  tinystl::thread_pool pool(2);
+  REQUIRE(&tinystl::execution::par.on(pool).pool() == &pool);
+  REQUIRE(&tinystl::execution::par.pool() == &tinystl::thread_pool::global());
+}
+
+TEST_CASE("Work-stealing deque", "[thread_pool][deque]") {
+  SECTION("owner pops in LIFO order and thieves steal FIFO") {
+    tinystl::detail::work_stealing_deque<int *> deque(2);
+    int items[8];
+    for (int &item : items) {
+      deque.push(&item);
+    }
+    REQUIRE(deque.steal() == &items[0]);
+    REQUIRE(deque.pop() == &items[7]);
+    REQUIRE(deque.steal() == &items[1]);
+    for (int i = 6; i >= 2; --i) {
+      REQUIRE(deque.pop() == &items[i]);
+    }
+    REQUIRE(deque.pop() == nullptr);
+    REQUIRE(deque.steal() == nullptr);
+    REQUIRE(deque.empty());
+  }
+
+  SECTION("every item is taken exactly once under contention") {
+    constexpr int count = 200000;
+    std::vector<int> items(count);
+    std::vector<std::atomic<int>> taken(count);
+    tinystl::detail::work_stealing_deque<int *> deque(4);
+    std::atomic<bool> done{false};
+
+    auto take = [&](int *item) { ++taken[item - items.data()]; };
+    std::vector<std::thread> thieves;
+    for (int t = 0; t < 3; ++t) {
+      thieves.emplace_back([&] {
+        while (!done.load() || !deque.empty()) {
+          if (int *item = deque.steal()) {
+            take(item);
+          }
+        }
+      });
+    }
+
+    for (int i = 0; i < count; ++i) {
+      deque.push(&items[i]);
+      if (i % 3 == 0) {
+        if (int *item = deque.pop()) {
+          take(item);
+        }
+      }
+    }
+    while (int *item = deque.pop()) {
+      take(item);
+    }
+    done = true;
+    for (auto &thief : thieves) {
+      thief.join();
+    }
+
+    REQUIRE(std::all_of(taken.begin(), taken.end(), [](const std::atomic<int> &n) { return n == 1; }));
+  }
+}
+
+TEST_CASE("Work-stealing pool", "[thread_pool]") {
+  SECTION("recursive splitting spreads across workers") {
+    tinystl::thread_pool pool(4);
+    std::atomic<long> sum{0};
+    std::vector<std::atomic<int>> seen(pool.size() + 1);
+    tinystl::detail::parallel_for(pool, 1 << 20, 1 << 10, [&](std::size_t b, std::size_t e) {
+      long local = 0;
+      for (std::size_t i = b; i < e; ++i) {
+        local += static_cast<long>(i);
+      }
+      sum += local;
+      seen[pool.worker_index()] = 1;
+    });
+    REQUIRE(sum == (1L << 20) * ((1L << 20) - 1) / 2);
+  }
+
+  SECTION("worker_index identifies pool threads") {
+    tinystl::thread_pool pool(2);
+    REQUIRE(pool.worker_index() == pool.size());
+    std::atomic<std::size_t> index{99};
+    pool.submit([&] { index = pool.worker_index(); });
+    while (index == 99) {
+      std::this_thread::yield();
+    }
+    REQUIRE(index < pool.size());
+  }
+
+  SECTION("a pool can be destroyed while idle workers sleep") {
+    for (int i = 0; i < 20; ++i) {
+      tinystl::thread_pool pool(3);
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+}
@@ -0,0 +1,215 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include <unistd.h>
+
+#include <tinystl/container/vector.h>
+#include <tinystl/io/binary.h>
+
+#include "support/counting.h"
+
+namespace {
+
+struct point {
+  double x;
+  double y;
+  std::int32_t id;
+};
+
+// A path in the temporary directory, removed when the test ends.
+class temp_file {
+public:
+  explicit temp_file(const std::string &name)
+    : m_path(
+        (std::filesystem::temp_directory_path() /
+         ("tinystl_" + std::to_string(::getpid()) + "_" + name))
+          .string()
+      ) {}
+  temp_file(const temp_file &) = delete;
+  temp_file &operator=(const temp_file &) = delete;
+  ~temp_file() { std::remove(m_path.c_str()); }
+
+  const std::string &path() const noexcept { return m_path; }
+
+  // Overwrites size bytes at offset with data.
+  void patch(std::size_t offset, const void *data, std::size_t size) const {
+    std::fstream f(m_path, std::ios::in | std::ios::out | std::ios::binary);
+    f.seekp(static_cast<std::streamoff>(offset));
+    f.write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+  }
+
+  void truncate(std::size_t size) const {
+    std::filesystem::resize_file(m_path, size);
+  }
+
+private:
+  std::string m_path;
+};
+
+tinystl::vector<point> make_points(int n) {
+  tinystl::vector<point> v;
+  for (int i = 0; i < n; ++i) {
+    v.push_back({i * 0.5, i * -1.5, i});
+  }
+  return v;
+}
+
+bool same_points(std::span<const point> a, std::span<const point> b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    if (a[i].x != b[i].x || a[i].y != b[i].y || a[i].id != b[i].id) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+TEST_CASE("Binary arrays round-trip through save and load", "[io]") {
+  temp_file file("roundtrip.bin");
+
+  SECTION("vector of structs") {
+    const tinystl::vector<point> saved = make_points(1000);
+    tinystl::io::save(file.path(), saved);
+
+    tinystl::vector<point> loaded = tinystl::io::load<point>(file.path());
+    REQUIRE(same_points(loaded, saved));
+  }
+
+  SECTION("empty vector") {
+    tinystl::io::save(file.path(), tinystl::vector<int>());
+    REQUIRE(tinystl::io::load<int>(file.path()).empty());
+    REQUIRE(tinystl::io::mapped_view<int>(file.path()).empty());
+  }
+
+  SECTION("span of a plain array") {
+    const std::uint64_t values[] = {1, 1ull << 40, ~0ull};
+    tinystl::io::save(file.path(), std::span<const std::uint64_t>(values));
+
+    tinystl::vector<std::uint64_t> loaded =
+      tinystl::io::load<std::uint64_t>(file.path());
+    REQUIRE(loaded.size() == 3);
+    REQUIRE(loaded[1] == 1ull << 40);
+    REQUIRE(loaded[2] == ~0ull);
+  }
+
+  SECTION("the payload is aligned in the file") {
+    tinystl::io::save(file.path(), make_points(3));
+    REQUIRE(std::filesystem::file_size(file.path()) == 64 + 3 * sizeof(point));
+  }
+}
+
+TEST_CASE("mapped_view reads elements in place", "[io]") {
+  temp_file file("view.bin");
+  const tinystl::vector<point> saved = make_points(5000);
+  tinystl::io::save(file.path(), saved);
+
+  tinystl::io::mapped_view<point> view(file.path());
+  REQUIRE(view.size() == saved.size());
+  REQUIRE(same_points(view, saved));
+  REQUIRE(view.front().id == 0);
+  REQUIRE(view.back().id == 4999);
+  REQUIRE(view.at(42).id == 42);
+  REQUIRE_THROWS_AS(view.at(5000), std::out_of_range);
+  REQUIRE(reinterpret_cast<std::uintptr_t>(view.data()) % alignof(point) == 0);
+
+  SECTION("moving transfers the mapping") {
+    const point *data = view.data();
+    tinystl::io::mapped_view<point> moved(std::move(view));
+    REQUIRE(moved.data() == data);
+    REQUIRE(view.empty());
+    REQUIRE(view.data() == nullptr);
+
+    view = std::move(moved);
+    REQUIRE(view.data() == data);
+    REQUIRE(view.size() == 5000);
+  }
+
+  SECTION("a vector built from the view matches") {
+    tinystl::vector<point> copy(view.begin(), view.end());
+    REQUIRE(same_points(copy, view));
+  }
+}
+
+TEST_CASE("load allocates once and copies no element", "[io]") {
+  using tinystl::test::counting_allocator;
+
+  temp_file file("alloc.bin");
+  tinystl::io::save(file.path(), make_points(10000));
+
+  tinystl::test::reset_counts();
+  {
+    auto loaded = tinystl::io::load<point>(
+      file.path(), counting_allocator<point>()
+    );
+    REQUIRE(loaded.size() == 10000);
+    REQUIRE(loaded.capacity() == 10000);
+    REQUIRE(loaded[9999].id == 9999);
+  }
+  REQUIRE(tinystl::test::counts().allocations == 1);
+  REQUIRE(tinystl::test::counts().deallocations == 1);
+  REQUIRE(tinystl::test::counts().bytes_allocated == 10000 * sizeof(point));
+}
+
+TEST_CASE("Binary readers reject files they cannot use", "[io]") {
+  using tinystl::io::format_error;
+  using tinystl::io::mapped_view;
+
+  temp_file file("bad.bin");
+  tinystl::io::save(file.path(), make_points(100));
+
+  SECTION("missing file") {
+    temp_file missing("missing.bin");
+    REQUIRE_THROWS_AS(mapped_view<point>(missing.path()), std::system_error);
+  }
+
+  SECTION("different element type") {
+    REQUIRE_THROWS_AS(tinystl::io::load<int>(file.path()), format_error);
+  }
+
+  SECTION("bad magic") {
+    file.patch(0, "NOTATSTL", 8);
+    REQUIRE_THROWS_AS(mapped_view<point>(file.path()), format_error);
+  }
+
+  SECTION("newer version") {
+    const std::uint32_t version = 2;
+    file.patch(offsetof(tinystl::io::binary_header, version), &version, 4);
+    REQUIRE_THROWS_AS(mapped_view<point>(file.path()), format_error);
+  }
+
+  SECTION("other byte order") {
+    const std::uint32_t mark = 0x04030201;
+    file.patch(offsetof(tinystl::io::binary_header, byte_order), &mark, 4);
+    REQUIRE_THROWS_AS(mapped_view<point>(file.path()), format_error);
+  }
+
+  SECTION("truncated payload") {
+    file.truncate(64 + 99 * sizeof(point));
+    REQUIRE_THROWS_AS(mapped_view<point>(file.path()), format_error);
+  }
+
+  SECTION("truncated header") {
+    file.truncate(10);
+    REQUIRE_THROWS_AS(tinystl::io::load<point>(file.path()), format_error);
+  }
+
+  SECTION("count past the end of the file") {
+    const std::uint64_t count = ~0ull / 2;
+    file.patch(offsetof(tinystl::io::binary_header, count), &count, 8);
+    REQUIRE_THROWS_AS(mapped_view<point>(file.path()), format_error);
+  }
+}
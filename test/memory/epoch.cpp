@@ -0,0 +1,200 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <tinystl/memory/epoch.h>
+
+namespace {
+
+struct tracked {
+  static inline std::atomic<int> live{0};
+
+  std::uint64_t value;
+  std::uint64_t check;
+
+  explicit tracked(std::uint64_t v) : value(v), check(~v) { ++live; }
+  ~tracked() {
+    // Poison the object so a reader that outlives it notices.
+    value = 0;
+    check = 0;
+    --live;
+  }
+};
+
+template <class T>
+struct counting_allocator {
+  using value_type = T;
+
+  std::atomic<int> *outstanding;
+
+  explicit counting_allocator(std::atomic<int> &counter) : outstanding(&counter) {}
+  template <class U>
+  counting_allocator(const counting_allocator<U> &other) noexcept : outstanding(other.outstanding) {}
+
+  T *allocate(std::size_t n) {
+    ++*outstanding;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *p, std::size_t n) noexcept {
+    --*outstanding;
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  friend bool operator==(const counting_allocator &, const counting_allocator &) = default;
+};
+
+} // namespace
+
+TEST_CASE("Epoch domain reclamation", "[epoch]") {
+  SECTION("retired objects outlive every guard that could see them") {
+    tinystl::epoch_domain domain(4);
+    std::atomic<int> reclaimed{0};
+
+    auto reader = domain.pin();
+    {
+      auto writer = domain.pin();
+      for (int i = 0; i < 10; ++i) {
+        writer.defer([&reclaimed] { ++reclaimed; });
+      }
+      writer.flush();
+    }
+    for (int i = 0; i < 4; ++i) {
+      domain.collect();
+    }
+    REQUIRE(reclaimed == 0);
+
+    { auto released = std::move(reader); }
+    std::size_t total = 0;
+    for (int i = 0; i < 4; ++i) {
+      total += domain.collect();
+    }
+    REQUIRE(total == 10);
+    REQUIRE(reclaimed == 10);
+  }
+
+  SECTION("a full bag is reclaimed without an explicit flush") {
+    tinystl::epoch_domain domain(4);
+    for (int i = 0; i < 1000; ++i) {
+      auto guard = domain.pin();
+      guard.retire(new tracked(i));
+    }
+    REQUIRE(tracked::live < 1000);
+  }
+
+  SECTION("the destructor reclaims whatever is still pending") {
+    {
+      tinystl::epoch_domain domain;
+      auto guard = domain.pin();
+      for (int i = 0; i < 5; ++i) {
+        guard.retire(new tracked(i));
+      }
+      REQUIRE(tracked::live == 5);
+    }
+    REQUIRE(tracked::live == 0);
+  }
+
+  SECTION("storage goes back through its allocator") {
+    std::atomic<int> outstanding{0};
+    counting_allocator<tracked> alloc(outstanding);
+    {
+      tinystl::epoch_domain domain;
+      auto guard = domain.pin();
+      tracked *p = alloc.allocate(3);
+      for (int i = 0; i < 3; ++i) {
+        std::construct_at(p + i, i);
+      }
+      guard.retire(p, 3, alloc);
+      REQUIRE(outstanding == 1);
+    }
+    REQUIRE(outstanding == 0);
+    REQUIRE(tracked::live == 0);
+  }
+
+  SECTION("pin waits for a free slot") {
+    tinystl::epoch_domain domain(1);
+    std::atomic<bool> pinned{false};
+    auto held = std::make_unique<tinystl::epoch_domain::guard>(domain.pin());
+    std::thread other([&] {
+      auto guard = domain.pin();
+      pinned = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    REQUIRE_FALSE(pinned);
+    held.reset();
+    other.join();
+    REQUIRE(pinned);
+  }
+}
+
+TEST_CASE("Epoch domain under contention", "[epoch][concurrent]") {
+  constexpr int readers = 4;
+  constexpr int writers = 2;
+  constexpr int swaps = 20000;
+
+  std::atomic<int> outstanding{0};
+  counting_allocator<tracked> alloc(outstanding);
+  {
+    tinystl::epoch_domain domain;
+    std::atomic<tracked *> shared{nullptr};
+    {
+      tracked *first = alloc.allocate(1);
+      std::construct_at(first, 1);
+      shared.store(first);
+    }
+
+    std::atomic<bool> done{false};
+    std::atomic<bool> intact{true};
+    std::vector<std::thread> pool;
+    for (int r = 0; r < readers; ++r) {
+      pool.emplace_back([&] {
+        while (!done.load(std::memory_order_relaxed)) {
+          auto guard = domain.pin();
+          const tracked *t = shared.load(std::memory_order_acquire);
+          if (t->value == 0 || t->check != ~t->value) {
+            intact = false;
+          }
+        }
+      });
+    }
+
+    std::vector<std::thread> writer_threads;
+    for (int w = 0; w < writers; ++w) {
+      writer_threads.emplace_back([&, w] {
+        for (int i = 0; i < swaps; ++i) {
+          tracked *fresh = alloc.allocate(1);
+          std::construct_at(fresh, std::uint64_t(w) * swaps + i + 2);
+          auto guard = domain.pin();
+          tracked *old = shared.exchange(fresh, std::memory_order_acq_rel);
+          guard.retire(old, 1, alloc);
+        }
+      });
+    }
+    for (auto &t : writer_threads) {
+      t.join();
+    }
+    done = true;
+    for (auto &t : pool) {
+      t.join();
+    }
+
+    REQUIRE(intact);
+    // Once nothing is pinned, everything sealed is reclaimed; what is left
+    // are the partly filled bags of the writers' slots.
+    for (int i = 0; i < 3; ++i) {
+      domain.collect();
+    }
+    REQUIRE(outstanding <= 1 + writers * 64);
+
+    tracked *last = shared.load();
+    std::destroy_at(last);
+    alloc.deallocate(last, 1);
+  }
+  REQUIRE(outstanding == 0);
+  REQUIRE(tracked::live == 0);
+}
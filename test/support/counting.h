@@ -0,0 +1,114 @@
+#pragma once
+
+// An element type and an allocator that count what a container does to
+// them, so tests can check how many allocations, copies and moves an
+// operation costs and not only what it produces. The counters are global
+// and not synchronized: reset them at the start of a check and keep the
+// counted objects on one thread.
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace tinystl::test {
+
+struct counters {
+  long default_constructions = 0;
+  long value_constructions = 0;
+  long copy_constructions = 0;
+  long move_constructions = 0;
+  long copy_assignments = 0;
+  long move_assignments = 0;
+  long destructions = 0;
+
+  long allocations = 0;
+  long deallocations = 0;
+  std::size_t bytes_allocated = 0;
+
+  long constructions() const noexcept {
+    return default_constructions + value_constructions + copy_constructions +
+           move_constructions;
+  }
+  long copies() const noexcept { return copy_constructions + copy_assignments; }
+  long moves() const noexcept { return move_constructions + move_assignments; }
+  long live() const noexcept { return constructions() - destructions; }
+};
+
+inline counters &counts() noexcept {
+  static counters c;
+  return c;
+}
+
+inline void reset_counts() noexcept { counts() = counters{}; }
+
+// An int that records every special member call. Its moves are noexcept,
+// so containers are allowed to relocate it by moving; a moved-from value
+// reads -1.
+class counted {
+public:
+  counted() noexcept { ++counts().default_constructions; }
+  explicit counted(int value) noexcept : m_value(value) {
+    ++counts().value_constructions;
+  }
+  counted(const counted &other) noexcept : m_value(other.m_value) {
+    ++counts().copy_constructions;
+  }
+  counted(counted &&other) noexcept : m_value(other.m_value) {
+    other.m_value = -1;
+    ++counts().move_constructions;
+  }
+  counted &operator=(const counted &other) noexcept {
+    m_value = other.m_value;
+    ++counts().copy_assignments;
+    return *this;
+  }
+  counted &operator=(counted &&other) noexcept {
+    m_value = other.m_value;
+    other.m_value = -1;
+    ++counts().move_assignments;
+    return *this;
+  }
+  ~counted() { ++counts().destructions; }
+
+  int value() const noexcept { return m_value; }
+
+  friend bool operator==(const counted &a, const counted &b) noexcept {
+    return a.m_value == b.m_value;
+  }
+
+private:
+  int m_value = 0;
+};
+
+// A stateless allocator that counts allocation calls and bytes. It
+// propagates on move assignment, so moving a container never has to fall
+// back to moving its elements one by one.
+template <class T>
+class counting_allocator {
+public:
+  using value_type = T;
+  using propagate_on_container_move_assignment = std::true_type;
+  using is_always_equal = std::true_type;
+
+  counting_allocator() noexcept = default;
+  template <class U>
+  counting_allocator(const counting_allocator<U> &) noexcept {}
+
+  T *allocate(std::size_t n) {
+    ++counts().allocations;
+    counts().bytes_allocated += n * sizeof(T);
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T *p, std::size_t n) noexcept {
+    ++counts().deallocations;
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  friend bool
+  operator==(const counting_allocator &, const counting_allocator &) noexcept {
+    return true;
+  }
+};
+
+} // namespace tinystl::test